@@ -33,6 +33,8 @@
 // Finally, we take our exact solution from the library as well as volume_quadrature
 // and additional tools.
 #include <EpetraExt_Transpose_RowMatrix.h>
+#include <Epetra_Import.h>
+#include <Epetra_MultiVector.h>
 #include <deal.II/distributed/grid_refinement.h>
 #include <deal.II/dofs/dof_renumbering.h>
 #include <deal.II/grid/grid_refinement.h>
@@ -92,10 +94,10 @@ DGBase<dim,nspecies,real,MeshType>::DGBase(
     , oneD_quadrature_collection(std::get<7>(collection_tuple))
     , oneD_face_quadrature(max_degree)
     , dof_handler(*triangulation, true)
-    , high_order_grid(std::make_shared<HighOrderGrid<dim,real,MeshType>>(grid_degree_input, triangulation, all_parameters->check_valid_metric_Jacobian, all_parameters->do_renumber_dofs, all_parameters->output_high_order_grid))
+    , high_order_grid(std::make_shared<HighOrderGrid<dim,real,MeshType>>(grid_degree_input, triangulation, all_parameters->check_valid_metric_Jacobian, all_parameters->do_renumber_dofs, all_parameters->output_high_order_grid, all_parameters->mpi_communicator))
     , fe_q_artificial_dissipation(1)
     , dof_handler_artificial_dissipation(*triangulation, false)
-    , mpi_communicator(MPI_COMM_WORLD)
+    , mpi_communicator(all_parameters->mpi_communicator)
     , pcout(std::cout, dealii::Utilities::MPI::this_mpi_process(mpi_communicator)==0)
     , freeze_artificial_dissipation(false)
     , max_artificial_dissipation_coeff(0.0)
@@ -309,7 +311,7 @@ unsigned int DGBase<dim,nspecies,real,MeshType>::get_max_fe_degree()
         if(cell->is_locally_owned() && cell->active_fe_index() > max_fe_degree)
             max_fe_degree = cell->active_fe_index();
 
-    return dealii::Utilities::MPI::max(max_fe_degree, MPI_COMM_WORLD);
+    return dealii::Utilities::MPI::max(max_fe_degree, mpi_communicator);
 }
 
 template <int dim, int nspecies, typename real, typename MeshType>
@@ -321,7 +323,7 @@ unsigned int DGBase<dim,nspecies,real,MeshType>::get_min_fe_degree()
         if(cell->is_locally_owned() && cell->active_fe_index() < min_fe_degree)
             min_fe_degree = cell->active_fe_index();
 
-    return dealii::Utilities::MPI::min(min_fe_degree, MPI_COMM_WORLD);
+    return dealii::Utilities::MPI::min(min_fe_degree, mpi_communicator);
 }
 
 template <int dim, int nspecies, typename real, typename MeshType>
@@ -1038,6 +1040,9 @@ typename std::enable_if<!std::is_same<adtype, double>::value,void>::type
     for (unsigned int idof = 0; idof < n_soln_dofs; ++idof) {
         const real val = this->solution(soln_dofs_indices[idof]);
         local_solution[idof] = val;
+        if (compute_d2R && this->compute_d2R_direction_product) {
+            set_direction_tangent(local_solution[idof], this->d2R_direction_solution[soln_dofs_indices[idof]]);
+        }
 
         if (compute_dRdW || compute_d2R) {
             th.registerInput(local_solution[idof]);
@@ -1051,6 +1056,9 @@ typename std::enable_if<!std::is_same<adtype, double>::value,void>::type
     {
         const real val = this->high_order_grid->volume_nodes[metric_dofs_indices[idof]];
         local_metric_coeff_int[idof] = val;
+        if (compute_d2R && this->compute_d2R_direction_product) {
+            set_direction_tangent(local_metric_coeff_int[idof], this->d2R_direction_volume_nodes[metric_dofs_indices[idof]]);
+        }
         if (compute_dRdX || compute_d2R) {
             th.registerInput(local_metric_coeff_int[idof]);
         } else {
@@ -1183,7 +1191,17 @@ typename std::enable_if<!std::is_same<adtype, double>::value,void>::type
         th.deleteJacobian(jac);
     }
     
-    if (compute_d2R) {
+    if (compute_d2R && this->compute_d2R_direction_product) {
+        dual_dot_residual.gradient()[0] = 1.0;
+        tape.evaluate();
+        for (unsigned int idof=0; idof<n_soln_dofs; ++idof) {
+            this->d2R_product_solution[soln_dofs_indices[idof]] += get_direction_product(local_solution[idof]);
+        }
+        for (unsigned int idof=0; idof<n_metric_dofs; ++idof) {
+            this->d2R_product_volume_nodes[metric_dofs_indices[idof]] += get_direction_product(local_metric_coeff_int[idof]);
+        }
+        tape.clearAdjoints();
+    } else if (compute_d2R) {
         typename TH::HessianType& hes = th.createHessian();
         th.evalHessian(hes);
 
@@ -1290,6 +1308,9 @@ typename std::enable_if<!std::is_same<adtype, double>::value,void>::type
     for (unsigned int idof = 0; idof < n_soln_dofs; ++idof) {
         const real val = this->solution(soln_dofs_indices[idof]);
         local_solution[idof] = val;
+        if (compute_d2R && this->compute_d2R_direction_product) {
+            set_direction_tangent(local_solution[idof], this->d2R_direction_solution[soln_dofs_indices[idof]]);
+        }
 
         if (compute_dRdW || compute_d2R) {
             th.registerInput(local_solution[idof]);
@@ -1303,6 +1324,9 @@ typename std::enable_if<!std::is_same<adtype, double>::value,void>::type
     {
         const real val = this->high_order_grid->volume_nodes[metric_dofs_indices[idof]];
         local_metric_coeff[idof] = val;
+        if (compute_d2R && this->compute_d2R_direction_product) {
+            set_direction_tangent(local_metric_coeff[idof], this->d2R_direction_volume_nodes[metric_dofs_indices[idof]]);
+        }
         if (compute_dRdX || compute_d2R) {
             th.registerInput(local_metric_coeff[idof]);
         } else {
@@ -1443,7 +1467,17 @@ typename std::enable_if<!std::is_same<adtype, double>::value,void>::type
         th.deleteJacobian(jac);
     }
 
-    if (compute_d2R) {
+    if (compute_d2R && this->compute_d2R_direction_product) {
+        dual_dot_residual.gradient()[0] = 1.0;
+        tape.evaluate();
+        for (unsigned int idof=0; idof<n_soln_dofs; ++idof) {
+            this->d2R_product_solution[soln_dofs_indices[idof]] += get_direction_product(local_solution[idof]);
+        }
+        for (unsigned int idof=0; idof<n_metric_dofs; ++idof) {
+            this->d2R_product_volume_nodes[metric_dofs_indices[idof]] += get_direction_product(local_metric_coeff[idof]);
+        }
+        tape.clearAdjoints();
+    } else if (compute_d2R) {
         typename TH::HessianType& hes = th.createHessian();
         th.evalHessian(hes);
 
@@ -1677,6 +1711,9 @@ typename std::enable_if<!std::is_same<adtype, double>::value,void>::type
     for (unsigned int idof = 0; idof < n_soln_dofs_int; ++idof) {
         const real val = this->solution(soln_dofs_indices_int[idof]);
         soln_coeff_int[idof] = val;
+        if (compute_d2R && this->compute_d2R_direction_product) {
+            set_direction_tangent(soln_coeff_int[idof], this->d2R_direction_solution[soln_dofs_indices_int[idof]]);
+        }
         if (compute_dRdW || compute_d2R) {
             th.registerInput(soln_coeff_int[idof]);
         } else {
@@ -1688,6 +1725,9 @@ typename std::enable_if<!std::is_same<adtype, double>::value,void>::type
     for (unsigned int idof = 0; idof < n_soln_dofs_ext; ++idof) {
         const real val = this->solution(soln_dofs_indices_ext[idof]);
         soln_coeff_ext[idof] = val;
+        if (compute_d2R && this->compute_d2R_direction_product) {
+            set_direction_tangent(soln_coeff_ext[idof], this->d2R_direction_solution[soln_dofs_indices_ext[idof]]);
+        }
         if (compute_dRdW || compute_d2R) {
             th.registerInput(soln_coeff_ext[idof]);
         } else {
@@ -1699,6 +1739,9 @@ typename std::enable_if<!std::is_same<adtype, double>::value,void>::type
     for (unsigned int idof = 0; idof < n_metric_dofs; ++idof) {
         const real val = this->high_order_grid->volume_nodes[metric_dofs_indices_int[idof]];
         metric_coeff_int[idof] = val;
+        if (compute_d2R && this->compute_d2R_direction_product) {
+            set_direction_tangent(metric_coeff_int[idof], this->d2R_direction_volume_nodes[metric_dofs_indices_int[idof]]);
+        }
         if (compute_dRdX || compute_d2R) {
             th.registerInput(metric_coeff_int[idof]);
         } else {
@@ -1716,6 +1759,9 @@ typename std::enable_if<!std::is_same<adtype, double>::value,void>::type
     for (unsigned int idof = 0; idof < n_metric_dofs; ++idof) {
         const real val = this->high_order_grid->volume_nodes[metric_dofs_indices_ext[idof]];
         metric_coeff_ext[idof] = val;
+        if (compute_d2R && this->compute_d2R_direction_product) {
+            set_direction_tangent(metric_coeff_ext[idof], this->d2R_direction_volume_nodes[metric_dofs_indices_ext[idof]]);
+        }
         if (compute_dRdX || compute_d2R) {
             th.registerInput(metric_coeff_ext[idof]);
         } else {
@@ -1968,7 +2014,21 @@ typename std::enable_if<!std::is_same<adtype, double>::value,void>::type
         th.deleteJacobian(jac);
     }
 
-    if (compute_d2R) {
+    if (compute_d2R && this->compute_d2R_direction_product) {
+        dual_dot_residual.gradient()[0] = 1.0;
+        tape.evaluate();
+        for (unsigned int idof=0; idof<n_soln_dofs_int; ++idof) {
+            this->d2R_product_solution[soln_dofs_indices_int[idof]] += get_direction_product(soln_coeff_int[idof]);
+        }
+        for (unsigned int idof=0; idof<n_soln_dofs_ext; ++idof) {
+            this->d2R_product_solution[soln_dofs_indices_ext[idof]] += get_direction_product(soln_coeff_ext[idof]);
+        }
+        for (unsigned int idof=0; idof<n_metric_dofs; ++idof) {
+            this->d2R_product_volume_nodes[metric_dofs_indices_int[idof]] += get_direction_product(metric_coeff_int[idof]);
+            this->d2R_product_volume_nodes[metric_dofs_indices_ext[idof]] += get_direction_product(metric_coeff_ext[idof]);
+        }
+        tape.clearAdjoints();
+    } else if (compute_d2R) {
         typename TH::HessianType& hes = th.createHessian();
         th.evalHessian(hes);
 
@@ -2296,6 +2356,30 @@ double DGBase<dim,nspecies,real,MeshType>::getValue(const real2 &x)
     }
 }
 
+template <int dim, int nspecies, typename real, typename MeshType>
+template <typename real2>
+void DGBase<dim,nspecies,real,MeshType>::set_direction_tangent(real2 &x, const double direction)
+{
+    if constexpr (std::is_same<real2, codi_HessianComputationType>::value) {
+        x.value().gradient()[0] = direction;
+    } else {
+        (void) x; (void) direction;
+    }
+}
+
+template <int dim, int nspecies, typename real, typename MeshType>
+template <typename real2>
+double DGBase<dim,nspecies,real,MeshType>::get_direction_product(const real2 &x)
+{
+    if constexpr (std::is_same<real2, codi_HessianComputationType>::value) {
+        // Reverse derivative of dual.residual, whose forward tangent is the Hessian-vector product.
+        return x.getGradient()[0].getGradient()[0];
+    } else {
+        (void) x;
+        return 0.0;
+    }
+}
+
 template <int dim, int nspecies, typename real, typename MeshType>
 void DGBase<dim,nspecies,real,MeshType>::automatic_differentiation_indexing_1(
     const bool compute_dRdW, const bool compute_dRdX, const bool compute_d2R,
@@ -2365,21 +2449,144 @@ void DGBase<dim,nspecies,real,MeshType>::set_dual(const dealii::LinearAlgebra::d
     dual = dual_input;
 }
 
+template <int dim, int nspecies, typename real, typename MeshType>
+void DGBase<dim,nspecies,real,MeshType>::apply_d2R (
+    const dealii::LinearAlgebra::distributed::Vector<real> &direction_solution,
+    const dealii::LinearAlgebra::distributed::Vector<real> &direction_volume_nodes,
+    dealii::LinearAlgebra::distributed::Vector<real> &d2R_times_direction_solution,
+    dealii::LinearAlgebra::distributed::Vector<real> &d2R_times_direction_volume_nodes)
+{
+    d2R_direction_solution.reinit(solution);
+    d2R_direction_solution = direction_solution;
+    d2R_direction_solution.update_ghost_values();
+    d2R_direction_volume_nodes.reinit(high_order_grid->volume_nodes);
+    d2R_direction_volume_nodes = direction_volume_nodes;
+    d2R_direction_volume_nodes.update_ghost_values();
+
+    d2R_product_solution.reinit(solution);
+    d2R_product_volume_nodes.reinit(high_order_grid->volume_nodes);
+
+    compute_d2R_direction_product = true;
+    const bool compute_dRdW=false; const bool compute_dRdX=false; const bool compute_d2R=true;
+    assemble_residual(compute_dRdW, compute_dRdX, compute_d2R);
+    compute_d2R_direction_product = false;
+
+    d2R_product_solution.compress(dealii::VectorOperation::add);
+    d2R_product_volume_nodes.compress(dealii::VectorOperation::add);
+
+    d2R_times_direction_solution = d2R_product_solution;
+    d2R_times_direction_volume_nodes = d2R_product_volume_nodes;
+}
+
+template <int dim, int nspecies, typename real, typename MeshType>
+void DGBase<dim,nspecies,real,MeshType>::build_artificial_dissipation_sensor_operators()
+{
+    const unsigned int n_fe = fe_collection.size();
+    artificial_dissipation_sensor_interpolation.resize(n_fe);
+    artificial_dissipation_sensor_difference.resize(n_fe);
+
+    for (unsigned int i_fele = 0; i_fele < n_fe; ++i_fele) {
+        const dealii::FESystem<dim,dim> &fe_high = fe_collection[i_fele];
+        const unsigned int degree = fe_high.tensor_degree();
+
+        if (degree == 0) continue;
+
+        const unsigned int nstate = fe_high.components;
+
+        // Lower degree basis.
+        const unsigned int lower_degree = degree-1;
+        const dealii::FE_DGQLegendre<dim> fe_dgq_lower(lower_degree);
+        const dealii::FESystem<dim,dim> fe_lower(fe_dgq_lower, nstate);
+
+        const unsigned int n_dofs_high = fe_high.dofs_per_cell / nstate;
+        const unsigned int n_dofs_lower = fe_lower.dofs_per_cell / nstate;
+
+        // Projection quadrature.
+        const dealii::QGauss<dim> projection_quadrature(degree+5);
+        const unsigned int n_proj_pts = projection_quadrature.size();
+        const std::vector<dealii::Point<dim,double>> &unit_proj_pts = projection_quadrature.get_points();
+
+        // L2 projection of the first state onto the lower degree basis, as done by project_function.
+        dealii::FullMatrix<double> mass(n_dofs_lower, n_dofs_lower);
+        dealii::FullMatrix<double> rhs_operator(n_dofs_lower, n_dofs_high);
+        for (unsigned int iquad=0; iquad<n_proj_pts; ++iquad) {
+            const double weight = projection_quadrature.weight(iquad);
+            for (unsigned int row=0; row<n_dofs_lower; ++row) {
+                const double phi_row = fe_lower.shape_value_component(fe_lower.component_to_system_index(0,row), unit_proj_pts[iquad], 0);
+                for (unsigned int col=0; col<n_dofs_lower; ++col) {
+                    mass[row][col] += phi_row * fe_lower.shape_value_component(fe_lower.component_to_system_index(0,col), unit_proj_pts[iquad], 0) * weight;
+                }
+                for (unsigned int col=0; col<n_dofs_high; ++col) {
+                    rhs_operator[row][col] += phi_row * fe_high.shape_value_component(fe_high.component_to_system_index(0,col), unit_proj_pts[iquad], 0) * weight;
+                }
+            }
+        }
+        dealii::FullMatrix<double> inverse_mass(n_dofs_lower, n_dofs_lower);
+        inverse_mass.invert(mass);
+        dealii::FullMatrix<double> projection(n_dofs_lower, n_dofs_high);
+        inverse_mass.mmult(projection, rhs_operator);
+
+        // Quadrature used for solution difference.
+        const dealii::Quadrature<dim> &quadrature = volume_quadrature_collection[i_fele];
+        const std::vector<dealii::Point<dim,double>> &unit_quad_pts = quadrature.get_points();
+        const unsigned int n_quad_pts = quadrature.size();
+
+        dealii::FullMatrix<double> &interpolation = artificial_dissipation_sensor_interpolation[i_fele];
+        dealii::FullMatrix<double> lower_interpolation(n_quad_pts, n_dofs_lower);
+        interpolation.reinit(n_quad_pts, n_dofs_high);
+        for (unsigned int iquad=0; iquad<n_quad_pts; ++iquad) {
+            for (unsigned int idof=0; idof<n_dofs_high; ++idof) {
+                interpolation[iquad][idof] = fe_high.shape_value_component(fe_high.component_to_system_index(0,idof), unit_quad_pts[iquad], 0);
+            }
+            for (unsigned int idof=0; idof<n_dofs_lower; ++idof) {
+                lower_interpolation[iquad][idof] = fe_lower.shape_value_component(fe_lower.component_to_system_index(0,idof), unit_quad_pts[iquad], 0);
+            }
+        }
+
+        dealii::FullMatrix<double> &difference = artificial_dissipation_sensor_difference[i_fele];
+        difference.reinit(n_quad_pts, n_dofs_high);
+        lower_interpolation.mmult(difference, projection);
+        difference *= -1.0;
+        difference.add(1.0, interpolation);
+    }
+}
+
 template <int dim, int nspecies, typename real, typename MeshType>
 void DGBase<dim,nspecies,real,MeshType>::update_artificial_dissipation_discontinuity_sensor()
 {
+    if (freeze_artificial_dissipation) return;
+
+    // The sensor only depends on the solution and the grid.
+    if (solution_artificial_dissipation.size() == solution.size()
+        && volume_nodes_artificial_dissipation.size() == high_order_grid->volume_nodes.size()) {
+
+        auto diff_sol = solution;
+        diff_sol -= solution_artificial_dissipation;
+        const double l2_norm_sol = diff_sol.l2_norm();
+
+        auto diff_node = high_order_grid->volume_nodes;
+        diff_node -= volume_nodes_artificial_dissipation;
+        const double l2_norm_node = diff_node.l2_norm();
+
+        if (l2_norm_sol == 0.0 && l2_norm_node == 0.0) {
+            max_artificial_dissipation_coeff = max_artificial_dissipation_coeff_sensor;
+            return;
+        }
+    }
+
     const auto mapping = (*(high_order_grid->mapping_fe_field));
     dealii::hp::MappingCollection<dim> mapping_collection(mapping);
-    const dealii::UpdateFlags update_flags = dealii::update_values | dealii::update_JxW_values;
+    const dealii::UpdateFlags update_flags = dealii::update_JxW_values;
     dealii::hp::FEValues<dim,dim> fe_values_collection_volume (mapping_collection, fe_collection, volume_quadrature_collection, update_flags); ///< FEValues of volume.
 
-    std::vector< double > soln_coeff_high;
+    dealii::Vector< double > soln_coeff_high;
+    dealii::Vector< double > soln_high;
+    dealii::Vector< double > soln_difference;
     std::vector<dealii::types::global_dof_index> dof_indices;
 
     const unsigned int n_dofs_arti_diss = fe_q_artificial_dissipation.dofs_per_cell;
     std::vector<dealii::types::global_dof_index> dof_indices_artificial_dissipation(n_dofs_arti_diss);
 
-    if (freeze_artificial_dissipation) return;
     artificial_dissipation_c0 *= 0.0;
     for (auto cell : dof_handler.active_cell_iterators()) {
         if (!(cell->is_locally_owned() || cell->is_ghost())) continue;
@@ -2401,63 +2608,34 @@ void DGBase<dim,nspecies,real,MeshType>::update_artificial_dissipation_discontin
         if (degree == 0) continue;
 
         const unsigned int nstate = fe_high.components;
-        const unsigned int n_dofs_high = fe_high.dofs_per_cell;
+        const unsigned int n_dofs_high = fe_high.dofs_per_cell / nstate;
 
         fe_values_collection_volume.reinit (cell, i_quad, i_mapp, i_fele);
         const dealii::FEValues<dim,dim> &fe_values_volume = fe_values_collection_volume.get_present_fe_values();
 
-        dof_indices.resize(n_dofs_high);
+        dof_indices.resize(fe_high.dofs_per_cell);
         cell->get_dof_indices (dof_indices);
 
-        soln_coeff_high.resize(n_dofs_high);
+        // Only integrate over the first state variable.
+        soln_coeff_high.reinit(n_dofs_high);
         for (unsigned int idof=0; idof<n_dofs_high; ++idof) {
-            soln_coeff_high[idof] = solution[dof_indices[idof]];
+            soln_coeff_high[idof] = solution[dof_indices[fe_high.component_to_system_index(0,idof)]];
         }
 
-        // Lower degree basis.
-        const unsigned int lower_degree = degree-1;
-        const dealii::FE_DGQLegendre<dim> fe_dgq_lower(lower_degree);
-        const dealii::FESystem<dim,dim> fe_lower(fe_dgq_lower, nstate);
-
-        // Projection quadrature.
-        const dealii::QGauss<dim> projection_quadrature(degree+5);
-        std::vector< double > soln_coeff_lower = project_function<dim,nspecies,double>( soln_coeff_high, fe_high, fe_lower, projection_quadrature);
-
-        // Quadrature used for solution difference.
-        const dealii::Quadrature<dim> &quadrature = fe_values_volume.get_quadrature();
-        const std::vector<dealii::Point<dim,double>> &unit_quad_pts = quadrature.get_points();
-
-        const unsigned int n_quad_pts = quadrature.size();
-        const unsigned int n_dofs_lower = fe_lower.dofs_per_cell;
+        const unsigned int n_quad_pts = fe_values_volume.n_quadrature_points;
+        soln_high.reinit(n_quad_pts);
+        soln_difference.reinit(n_quad_pts);
+        artificial_dissipation_sensor_interpolation[i_fele].vmult(soln_high, soln_coeff_high);
+        artificial_dissipation_sensor_difference[i_fele].vmult(soln_difference, soln_coeff_high);
 
         double element_volume = 0.0;
         double error = 0.0;
         double soln_norm = 0.0;
-        std::vector<double> soln_high(nstate);
-        std::vector<double> soln_lower(nstate);
         for (unsigned int iquad=0; iquad<n_quad_pts; ++iquad) {
-            for (unsigned int s=0; s<nstate; ++s) {
-                soln_high[s] = 0.0;
-                soln_lower[s] = 0.0;
-            }
-            // Interpolate solution
-            for (unsigned int idof=0; idof<n_dofs_high; ++idof) {
-                  const unsigned int istate = fe_high.system_to_component_index(idof).first;
-                  soln_high[istate] += soln_coeff_high[idof] * fe_high.shape_value_component(idof,unit_quad_pts[iquad],istate);
-            }
-            // Interpolate low order solution
-            for (unsigned int idof=0; idof<n_dofs_lower; ++idof) {
-                  const unsigned int istate = fe_lower.system_to_component_index(idof).first;
-                  soln_lower[istate] += soln_coeff_lower[idof] * fe_lower.shape_value_component(idof,unit_quad_pts[iquad],istate);
-            }
             // Quadrature
             element_volume += fe_values_volume.JxW(iquad);
-            // Only integrate over the first state variable.
-            for (unsigned int s=0; s<1/*nstate*/; ++s) 
-            {
-                error += (soln_high[s] - soln_lower[s]) * (soln_high[s] - soln_lower[s]) * fe_values_volume.JxW(iquad);
-                soln_norm += soln_high[s] * soln_high[s] * fe_values_volume.JxW(iquad);
-            }
+            error += soln_difference[iquad] * soln_difference[iquad] * fe_values_volume.JxW(iquad);
+            soln_norm += soln_high[iquad] * soln_high[iquad] * fe_values_volume.JxW(iquad);
         }
 
         //std::cout << " error: " << error
@@ -2547,6 +2725,10 @@ void DGBase<dim,nspecies,real,MeshType>::update_artificial_dissipation_discontin
     // artificial_dissipation_c0 *= 0.0;
     // artificial_dissipation_c0.add(1e-1);
     artificial_dissipation_c0.update_ghost_values();
+
+    solution_artificial_dissipation = solution;
+    volume_nodes_artificial_dissipation = high_order_grid->volume_nodes;
+    max_artificial_dissipation_coeff_sensor = max_artificial_dissipation_coeff;
 }
 
 template <int dim, int nspecies, typename real, typename MeshType>
@@ -2665,7 +2847,9 @@ void DGBase<dim,nspecies,real,MeshType>::assemble_residual (const bool compute_d
         }
         dRdXv = 0;
     }
-    if (compute_d2R) {
+    if (compute_d2R && compute_d2R_direction_product) {
+        pcout << " with d2R times direction...";
+    } else if (compute_d2R) {
         pcout << " with d2RdWdW, d2RdWdX, d2RdXdX...";
         auto diff_sol = solution;
         diff_sol -= solution_d2R;
@@ -2766,6 +2950,7 @@ void DGBase<dim,nspecies,real,MeshType>::assemble_residual (const bool compute_d
             for (auto soln_cell = dof_handler.begin_active(); soln_cell != dof_handler.end(); ++soln_cell, ++metric_cell) 
             {
                 if (!soln_cell->is_locally_owned()) continue;
+                if (!assembled_cells.empty() && !assembled_cells[soln_cell->active_cell_index()]) continue;
                 assemble_cell_residual_and_ad_derivatives<codi_HessianComputationType>(
                     soln_cell,
                     metric_cell,
@@ -2793,6 +2978,7 @@ void DGBase<dim,nspecies,real,MeshType>::assemble_residual (const bool compute_d
             for (auto soln_cell = dof_handler.begin_active(); soln_cell != dof_handler.end(); ++soln_cell, ++metric_cell) 
             {
                 if (!soln_cell->is_locally_owned()) continue;
+                if (!assembled_cells.empty() && !assembled_cells[soln_cell->active_cell_index()]) continue;
                 assemble_cell_residual_and_ad_derivatives<codi_JacobianComputationType>(
                     soln_cell,
                     metric_cell,
@@ -2820,6 +3006,7 @@ void DGBase<dim,nspecies,real,MeshType>::assemble_residual (const bool compute_d
             for (auto soln_cell = dof_handler.begin_active(); soln_cell != dof_handler.end(); ++soln_cell, ++metric_cell) 
             {
                 if (!soln_cell->is_locally_owned()) continue;
+                if (!assembled_cells.empty() && !assembled_cells[soln_cell->active_cell_index()]) continue;
                 assemble_cell_residual_and_ad_derivatives<double>(
                     soln_cell,
                     metric_cell,
@@ -2903,7 +3090,7 @@ void DGBase<dim,nspecies,real,MeshType>::assemble_residual (const bool compute_d
 
     }
     if ( compute_dRdX ) dRdXv.compress(dealii::VectorOperation::add);
-    if ( compute_d2R ) {
+    if ( compute_d2R && !compute_d2R_direction_product ) {
         d2RdWdW.compress(dealii::VectorOperation::add);
         d2RdXdX.compress(dealii::VectorOperation::add);
         d2RdWdX.compress(dealii::VectorOperation::add);
@@ -2913,6 +3100,104 @@ void DGBase<dim,nspecies,real,MeshType>::assemble_residual (const bool compute_d
 
 } // end of assemble_system_explicit ()
 
+template <int dim, int nspecies, typename real, typename MeshType>
+void DGBase<dim,nspecies,real,MeshType>::set_assembled_cells (const std::vector<bool> &cells_to_assemble)
+{
+    assembled_cells = cells_to_assemble;
+    CFL_mass_dRdW = std::numeric_limits<double>::quiet_NaN();
+}
+
+template <int dim, int nspecies, typename real, typename MeshType>
+void DGBase<dim,nspecies,real,MeshType>::project_cellwise_residual (
+    const Epetra_CrsMatrix &test_basis,
+    const std::function<void(const unsigned int, const dealii::Vector<double> &)> &cell_projection_writer) const
+{
+    const int n_test = test_basis.NumGlobalCols();
+    dealii::Vector<double> cell_projection(n_test);
+    std::vector<dealii::types::global_dof_index> dofs_indices;
+
+    for (const auto &cell : dof_handler.active_cell_iterators()) {
+        if (!cell->is_locally_owned()) continue;
+
+        dofs_indices.resize(cell->get_fe().n_dofs_per_cell());
+        cell->get_dof_indices(dofs_indices);
+
+        cell_projection = 0.0;
+        for (const auto &global_row : dofs_indices) {
+            const double residual_value = right_hand_side[global_row];
+            int n_entries;
+            double *values;
+            int *local_columns;
+            test_basis.ExtractMyRowView(test_basis.LRID(static_cast<int>(global_row)), n_entries, values, local_columns);
+            for (int i_entry = 0; i_entry < n_entries; ++i_entry) {
+                cell_projection[test_basis.GCID(local_columns[i_entry])] += values[i_entry] * residual_value;
+            }
+        }
+        cell_projection_writer(cell->active_cell_index(), cell_projection);
+    }
+}
+
+template <int dim, int nspecies, typename real, typename MeshType>
+void DGBase<dim,nspecies,real,MeshType>::project_cellwise_jacobian (
+    const Epetra_CrsMatrix &test_basis,
+    const Epetra_CrsMatrix &trial_basis,
+    const std::function<void(const unsigned int, const dealii::FullMatrix<double> &)> &cell_projection_writer) const
+{
+    const Epetra_CrsMatrix &jacobian = system_matrix.trilinos_matrix();
+    const int n_test = test_basis.NumGlobalCols();
+    const int n_trial = trial_basis.NumGlobalCols();
+
+    // Dense copy of the locally owned trial basis rows, then import the rows coupled through the Jacobian stencil
+    Epetra_MultiVector trial_basis_owned(trial_basis.RowMap(), n_trial);
+    for (int i_row = 0; i_row < trial_basis.NumMyRows(); ++i_row) {
+        int n_entries;
+        double *values;
+        int *local_columns;
+        trial_basis.ExtractMyRowView(i_row, n_entries, values, local_columns);
+        for (int i_entry = 0; i_entry < n_entries; ++i_entry) {
+            trial_basis_owned[trial_basis.GCID(local_columns[i_entry])][i_row] = values[i_entry];
+        }
+    }
+    Epetra_MultiVector trial_basis_stencil(jacobian.ColMap(), n_trial);
+    Epetra_Import trial_basis_importer(jacobian.ColMap(), trial_basis.RowMap());
+    trial_basis_stencil.Import(trial_basis_owned, trial_basis_importer, Insert);
+
+    dealii::FullMatrix<double> cell_projection(n_test, n_trial);
+    std::vector<double> jacobian_trial_row(n_trial);
+    std::vector<dealii::types::global_dof_index> dofs_indices;
+
+    for (const auto &cell : dof_handler.active_cell_iterators()) {
+        if (!cell->is_locally_owned()) continue;
+
+        dofs_indices.resize(cell->get_fe().n_dofs_per_cell());
+        cell->get_dof_indices(dofs_indices);
+
+        cell_projection = 0.0;
+        for (const auto &global_row : dofs_indices) {
+            // Row of J V
+            std::fill(jacobian_trial_row.begin(), jacobian_trial_row.end(), 0.0);
+            int n_entries;
+            double *values;
+            int *local_columns;
+            jacobian.ExtractMyRowView(jacobian.LRID(static_cast<int>(global_row)), n_entries, values, local_columns);
+            for (int i_entry = 0; i_entry < n_entries; ++i_entry) {
+                for (int i_trial = 0; i_trial < n_trial; ++i_trial) {
+                    jacobian_trial_row[i_trial] += values[i_entry] * trial_basis_stencil[i_trial][local_columns[i_entry]];
+                }
+            }
+            // Outer product with the same row of W
+            test_basis.ExtractMyRowView(test_basis.LRID(static_cast<int>(global_row)), n_entries, values, local_columns);
+            for (int i_entry = 0; i_entry < n_entries; ++i_entry) {
+                const int i_test = test_basis.GCID(local_columns[i_entry]);
+                for (int i_trial = 0; i_trial < n_trial; ++i_trial) {
+                    cell_projection(i_test, i_trial) += values[i_entry] * jacobian_trial_row[i_trial];
+                }
+            }
+        }
+        cell_projection_writer(cell->active_cell_index(), cell_projection);
+    }
+}
+
 template <int dim, int nspecies, typename real, typename MeshType>
 double DGBase<dim,nspecies,real,MeshType>::get_residual_linfnorm () const
 {
@@ -3477,6 +3762,7 @@ void DGBase<dim,nspecies,real,MeshType>::allocate_system (
     right_hand_side.add(1.0); // Avoid 0 initial residual for output and logarithmic visualization.
 
     allocate_dual_vector(compute_d2R);
+    compute_d2R_direction_product = false;
 
     // Set use_auxiliary_eq flag
     set_use_auxiliary_eq();
@@ -3555,6 +3841,13 @@ void DGBase<dim,nspecies,real,MeshType>::allocate_artificial_dissipation ()
 
     artificial_dissipation_coeffs.reinit(triangulation->n_active_cells());
     artificial_dissipation_se.reinit(triangulation->n_active_cells());
+
+    // Force the next sensor update, the cells and dofs may have changed.
+    solution_artificial_dissipation.reinit(0);
+    volume_nodes_artificial_dissipation.reinit(0);
+    max_artificial_dissipation_coeff_sensor = 0.0;
+
+    build_artificial_dissipation_sensor_operators();
 }
 
 
@@ -3591,7 +3884,7 @@ void DGBase<dim,nspecies,real,MeshType>::allocate_dRdX ()
     dealii::SparsityPattern dRdXv_sparsity_pattern = get_dRdX_sparsity_pattern ();
     const dealii::IndexSet &row_parallel_partitioning = locally_owned_dofs;
     const dealii::IndexSet &col_parallel_partitioning = high_order_grid->locally_owned_dofs_grid;
-    dRdXv.reinit(row_parallel_partitioning, col_parallel_partitioning, dRdXv_sparsity_pattern, MPI_COMM_WORLD);
+    dRdXv.reinit(row_parallel_partitioning, col_parallel_partitioning, dRdXv_sparsity_pattern, mpi_communicator);
 }
 
 template <int dim, int nspecies, typename real, typename MeshType>
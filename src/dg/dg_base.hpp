@@ -21,11 +21,14 @@
 #include <deal.II/hp/fe_values.h>
 
 #include <deal.II/lac/vector.h>
+#include <deal.II/lac/full_matrix.h>
 #include <deal.II/lac/sparsity_pattern.h>
 #include <deal.II/lac/trilinos_sparse_matrix.h>
 #include <deal.II/lac/trilinos_vector.h>
 
 #include <Epetra_RowMatrixTransposer.h>
+#include <Epetra_CrsMatrix.h>
+#include <functional>
 #include <AztecOO.h>
 
 #include "ADTypes.hpp"
@@ -204,6 +207,12 @@ private:
      */
     void allocate_artificial_dissipation();
 
+    /// Builds the reference-element operators of the discontinuity sensor for each FE index.
+    /** The sensor only integrates the first state, so the operators act on its coefficients.
+     *  Avoids constructing the lower degree FESystem and its projection for every cell and residual.
+     */
+    void build_artificial_dissipation_sensor_operators();
+
 public:
 
     /// Scales a solution update with the appropriate maximum time step.
@@ -424,6 +433,21 @@ private:
     /// CFL used to add mass matrix in the optimization FlowConstraints class
     double CFL_mass_dRdW;
 
+    /// Modal coefficients of the solution used to compute the discontinuity sensor last
+    /// Will be used to avoid recomputing the artificial dissipation coefficients.
+    dealii::LinearAlgebra::distributed::Vector<double> solution_artificial_dissipation;
+    /// Modal coefficients of the grid nodes used to compute the discontinuity sensor last
+    /// Will be used to avoid recomputing the artificial dissipation coefficients.
+    dealii::LinearAlgebra::distributed::Vector<double> volume_nodes_artificial_dissipation;
+    /// Maximum artificial dissipation coefficient found by the last discontinuity sensor update
+    double max_artificial_dissipation_coeff_sensor;
+
+    /// Interpolation of the first state's coefficients to the volume quadrature nodes, for each FE index
+    std::vector<dealii::FullMatrix<double>> artificial_dissipation_sensor_interpolation;
+    /// Difference between the solution and its projection onto the Legendre basis of one degree lower,
+    /// evaluated at the volume quadrature nodes from the first state's coefficients, for each FE index
+    std::vector<dealii::FullMatrix<double>> artificial_dissipation_sensor_difference;
+
     /// Modal coefficients of the solution used to compute dRdX last
     /// Will be used to avoid recomputing dRdX.
     dealii::LinearAlgebra::distributed::Vector<double> solution_dRdX;
@@ -440,6 +464,17 @@ private:
     /// Dual variables to compute d2R last
     /// Will be used to avoid recomputing d2R.
     dealii::LinearAlgebra::distributed::Vector<double> dual_d2R;
+
+    /// Whether the compute_d2R assembly evaluates the Hessian-vector product of apply_d2R() instead of the d2R matrices.
+    bool compute_d2R_direction_product;
+    /// Solution part of the direction seeded by apply_d2R(), with ghost values.
+    dealii::LinearAlgebra::distributed::Vector<double> d2R_direction_solution;
+    /// Volume nodes part of the direction seeded by apply_d2R(), with ghost values.
+    dealii::LinearAlgebra::distributed::Vector<double> d2R_direction_volume_nodes;
+    /// Solution rows of the Hessian-vector product accumulated by apply_d2R().
+    dealii::LinearAlgebra::distributed::Vector<double> d2R_product_solution;
+    /// Volume nodes rows of the Hessian-vector product accumulated by apply_d2R().
+    dealii::LinearAlgebra::distributed::Vector<double> d2R_product_volume_nodes;
 public:
 
     /// Time it takes for the maximum wavespeed to cross the cell domain.
@@ -458,6 +493,17 @@ public:
 
     dealii::Vector<double> reduced_mesh_weights;
 
+    /// Flags of the active cells whose contributions are assembled by assemble_residual().
+    /** Indexed by active cell index. An empty vector assembles every locally owned cell.
+     *  Used by hyper-reduced solvers to restrict the residual and Jacobian to the sampled cells.
+     */
+    std::vector<bool> assembled_cells;
+
+    /// Restrict assemble_residual() to the flagged cells, or to all cells if the input is empty.
+    /** Forces the next dRdW assembly since the cached Jacobian may have been computed on another set of cells.
+     */
+    void set_assembled_cells(const std::vector<bool> &cells_to_assemble);
+
     /// Artificial dissipation in each cell.
     dealii::Vector<double> artificial_dissipation_coeffs;
 
@@ -565,6 +611,45 @@ public:
     //void assemble_residual_dRdW ();
     void assemble_residual (const bool compute_dRdW=false, const bool compute_dRdX=false, const bool compute_d2R=false, const double CFL_mass = 0.0);
 
+    /// Product of the residual Lagrangian Hessian with a direction, without assembling the Hessian blocks.
+    /** Evaluates
+     *  [ d2RdWdW  d2RdWdX ] [ direction_solution     ]
+     *  [ d2RdXdW  d2RdXdX ] [ direction_volume_nodes ]
+     *  for the current dual. The forward tangents of the codi_HessianComputationType inputs are seeded
+     *  with the direction and each cell's dual.residual is reverse swept once, such that the cost is a
+     *  small multiple of a residual evaluation. The d2R matrices are neither allocated nor modified.
+     */
+    void apply_d2R (
+        const dealii::LinearAlgebra::distributed::Vector<real> &direction_solution,
+        const dealii::LinearAlgebra::distributed::Vector<real> &direction_volume_nodes,
+        dealii::LinearAlgebra::distributed::Vector<real> &d2R_times_direction_solution,
+        dealii::LinearAlgebra::distributed::Vector<real> &d2R_times_direction_volume_nodes);
+
+    /// Projects the residual of each locally owned cell onto a test basis.
+    /** For every locally owned cell e, evaluates W_e^T r_e, where r_e are the entries of right_hand_side
+     *  owned by the cell and W_e the corresponding rows of test_basis. test_basis must share the row
+     *  distribution of system_matrix, so only local rows are accessed and no global vector is formed per cell.
+     *  right_hand_side must have been assembled beforehand.
+     *
+     *  cell_projection_writer is called once per cell with the active cell index and the projection.
+     */
+    void project_cellwise_residual (
+        const Epetra_CrsMatrix &test_basis,
+        const std::function<void(const unsigned int, const dealii::Vector<double> &)> &cell_projection_writer) const;
+
+    /// Projects the Jacobian rows of each locally owned cell onto a test and trial basis.
+    /** For every locally owned cell e, evaluates W_e^T J_e V, where J_e are the rows of system_matrix
+     *  owned by the cell (over its whole stencil) and W_e the corresponding rows of test_basis.
+     *  The rows of trial_basis coupled to local rows are imported once, and each cell only touches its own rows.
+     *  system_matrix must have been assembled beforehand.
+     *
+     *  cell_projection_writer is called once per cell with the active cell index and the n_test x n_trial projection.
+     */
+    void project_cellwise_jacobian (
+        const Epetra_CrsMatrix &test_basis,
+        const Epetra_CrsMatrix &trial_basis,
+        const std::function<void(const unsigned int, const dealii::FullMatrix<double> &)> &cell_projection_writer) const;
+
     /// Used in assemble_residual().
     /** IMPORTANT: This does not fully compute the cell residual since it might not
      *  perform the work on all the faces.
@@ -1088,6 +1173,19 @@ public:
      */
     template <typename real2>
     double getValue(const real2 &x);
+
+    /// Seeds the forward tangent of a codi_HessianComputationType input with a direction component.
+    /** Other types carry no tangent and are left untouched.
+     */
+    template <typename real2>
+    void set_direction_tangent(real2 &x, const double direction);
+
+    /// Returns the forward tangent of the reverse derivative of a codi_HessianComputationType input.
+    /** After seeding the inputs with set_direction_tangent() and reverse sweeping dual.residual,
+     *  this is the input's row of the Hessian-vector product. Other types return zero.
+     */
+    template <typename real2>
+    double get_direction_product(const real2 &x);
    
     /// Derivative indexing when only 1 cell is concerned.
     /// Derivatives are ordered such that w comes first with index 0, then x.
@@ -1249,8 +1347,11 @@ public:
         OPERATOR::mapping_shape_functions<dim,2*dim>                      &mapping_basis,
         std::array<std::vector<codi_HessianComputationType>,dim>          &mapping_support_points) =0;
 
+    /// MPI communicator the DG problem lives on.
+    /** Public so that solvers, functionals and initial conditions built on top of
+     *  this DG object use the same (possibly ensemble sub-) communicator. */
+    MPI_Comm mpi_communicator;
 protected:
-    MPI_Comm mpi_communicator; ///< MPI communicator
     dealii::ConditionalOStream pcout; ///< Parallel std::cout that only outputs on mpi_rank==0
 private:
 
@@ -1289,6 +1390,9 @@ public:
     /// Stores maximum artificial dissipation while assembling the residual.
     double max_artificial_dissipation_coeff;
     /// Update discontinuity sensor.
+    /** The artificial dissipation coefficients are only recomputed if the solution or the grid changed
+     *  since the last update.
+     */
     void update_artificial_dissipation_discontinuity_sensor();
     /// Allocate the necessary variables declared in src/physics/model.h
     virtual void allocate_model_variables() = 0;
@@ -177,6 +177,13 @@ void DGBaseState<dim, nspecies, nstate, real, MeshType>::update_model_variables(
     pde_model_fad_fad->cellwise_volume.update_ghost_values();
     pde_model_rad_fad->cellwise_poly_degree.update_ghost_values();
     pde_model_rad_fad->cellwise_volume.update_ghost_values();
+
+    // update the model data that depend on the cellwise volume and polynomial degree
+    pde_model_double->update_cellwise_model_data();
+    pde_model_fad->update_cellwise_model_data();
+    pde_model_rad->update_cellwise_model_data();
+    pde_model_fad_fad->update_cellwise_model_data();
+    pde_model_rad_fad->update_cellwise_model_data();
 }
 
 template <int dim, int nspecies, int nstate, typename real, typename MeshType>
@@ -119,7 +119,7 @@ dealii::SparsityPattern DGBase<dim,nspecies,real,MeshType>::get_dRdX_sparsity_pa
         } 
     } // end of cell loop
 
-    dealii::SparsityTools::distribute_sparsity_pattern(dsp, dof_handler.locally_owned_dofs(), MPI_COMM_WORLD, locally_relevant_dofs);
+    dealii::SparsityTools::distribute_sparsity_pattern(dsp, dof_handler.locally_owned_dofs(), mpi_communicator, locally_relevant_dofs);
     dealii::SparsityPattern sparsity_pattern;
     sparsity_pattern.copy_from(dsp);
 
@@ -181,7 +181,7 @@ dealii::SparsityPattern DGBase<dim,nspecies,real,MeshType>::get_dRdXs_sparsity_p
         }
     } // end of cell loop
 
-    dealii::SparsityTools::distribute_sparsity_pattern(dsp, dof_handler.locally_owned_dofs(), MPI_COMM_WORLD, locally_owned_dofs);
+    dealii::SparsityTools::distribute_sparsity_pattern(dsp, dof_handler.locally_owned_dofs(), mpi_communicator, locally_owned_dofs);
     dealii::SparsityPattern sparsity_pattern;
     sparsity_pattern.copy_from(dsp);
 
@@ -16,6 +16,7 @@
 #include <deal.II/fe/fe_dgq.h> // Used for flux interpolation
 
 #include "strong_dg.hpp"
+#include "physics/navier_stokes.h"
 
 /// Returns the value from a CoDiPack variable.
 /** The recursive calling allows to retrieve nested CoDiPack types.
@@ -988,6 +989,43 @@ void DGStrong<dim,nspecies,nstate,real,MeshType>::assemble_face_term_auxiliary_e
 * PRIMARY EQUATIONS STRONG FORM
 *
 ****************************************************/
+template <int dim, int nspecies, int nstate, typename real, typename MeshType>
+template <typename adtype>
+bool DGStrong<dim,nspecies,nstate,real,MeshType>::evaluate_convective_flux_batch(
+    const Physics::PhysicsBase<dim, nspecies, nstate, adtype>          &pde_physics,
+    const std::array<std::vector<adtype>,nstate>                       &soln_at_q,
+    std::array<dealii::Tensor<1,dim,std::vector<adtype>>,nstate>       &conv_phys_flux_at_q) const
+{
+    if constexpr (std::is_same<adtype,double>::value && nstate == dim+2 && nspecies == 1) {
+        // None of the physics derived from Euler override the convective flux.
+        const auto *euler_physics = dynamic_cast<const Physics::Euler<dim,nspecies,nstate,double>*>(&pde_physics);
+        if (euler_physics == nullptr) return false;
+        euler_physics->convective_flux_batch(soln_at_q, conv_phys_flux_at_q);
+        return true;
+    } else {
+        return false;
+    }
+}
+
+template <int dim, int nspecies, int nstate, typename real, typename MeshType>
+template <typename adtype>
+bool DGStrong<dim,nspecies,nstate,real,MeshType>::evaluate_dissipative_flux_batch(
+    const Physics::PhysicsBase<dim, nspecies, nstate, adtype>          &pde_physics,
+    const std::array<std::vector<adtype>,nstate>                       &soln_at_q,
+    const std::array<dealii::Tensor<1,dim,std::vector<adtype>>,nstate> &aux_soln_at_q,
+    std::array<dealii::Tensor<1,dim,std::vector<adtype>>,nstate>       &diffusive_phys_flux_at_q) const
+{
+    if constexpr (std::is_same<adtype,double>::value && nstate == dim+2 && nspecies == 1) {
+        // None of the physics derived from NavierStokes override the dissipative flux.
+        const auto *navier_stokes_physics = dynamic_cast<const Physics::NavierStokes<dim,nspecies,nstate,double>*>(&pde_physics);
+        if (navier_stokes_physics == nullptr) return false;
+        navier_stokes_physics->dissipative_flux_batch(soln_at_q, aux_soln_at_q, diffusive_phys_flux_at_q);
+        return true;
+    } else {
+        return false;
+    }
+}
+
 template <int dim, int nspecies, int nstate, typename real, typename MeshType>
 template <typename adtype>
 void DGStrong<dim,nspecies,nstate,real,MeshType>::assemble_volume_term_strong(
@@ -1265,6 +1303,17 @@ void DGStrong<dim,nspecies,nstate,real,MeshType>::assemble_volume_term_strong(
         flux_basis.sum_factorized_Hadamard_sparsity_pattern(n_quad_pts_1D, n_quad_pts_1D, Hadamard_rows_sparsity, Hadamard_columns_sparsity);
     }
 
+    // Evaluate the physical fluxes at all the volume cubature nodes at once with the packed physics kernels, when available.
+    // For split forms, the fluxes are evaluated with the solution recovered from the projected entropy variables,
+    // so they are left to the loop below.
+    std::array<dealii::Tensor<1,dim,std::vector<adtype>>,nstate> conv_phys_flux_at_q;
+    std::array<dealii::Tensor<1,dim,std::vector<adtype>>,nstate> diffusive_phys_flux_at_q;
+    bool use_conv_flux_batch = false;
+    bool use_diffusive_flux_batch = false;
+    if (!this->all_parameters->use_split_form && !this->all_parameters->use_curvilinear_split_form){
+        use_conv_flux_batch = evaluate_convective_flux_batch(pde_physics, soln_at_q, conv_phys_flux_at_q);
+        use_diffusive_flux_batch = evaluate_dissipative_flux_batch(pde_physics, soln_at_q, aux_soln_at_q, diffusive_phys_flux_at_q);
+    }
 
     for (unsigned int iquad=0; iquad<n_quad_pts; ++iquad) {
         //extract soln and auxiliary soln at quad pt to be used in physics
@@ -1357,6 +1406,13 @@ void DGStrong<dim,nspecies,nstate,real,MeshType>::assemble_volume_term_strong(
                 }
             }
         }
+        else if (use_conv_flux_batch){
+            for(int istate=0; istate<nstate; istate++){
+                for(int idim=0; idim<dim; idim++){
+                    conv_phys_flux[istate][idim] = conv_phys_flux_at_q[istate][idim][iquad];
+                }
+            }
+        }
         else{
             //Compute the physical flux
             conv_phys_flux = pde_physics.convective_flux (soln_state);
@@ -1365,7 +1421,16 @@ void DGStrong<dim,nspecies,nstate,real,MeshType>::assemble_volume_term_strong(
         //Diffusion
         std::array<dealii::Tensor<1,dim,adtype>,nstate> diffusive_phys_flux;
         //Compute the physical dissipative flux
-        diffusive_phys_flux = pde_physics.dissipative_flux(soln_state, aux_soln_state, filtered_soln_state, filtered_aux_soln_state, current_cell_index);
+        if (use_diffusive_flux_batch){
+            for(int istate=0; istate<nstate; istate++){
+                for(int idim=0; idim<dim; idim++){
+                    diffusive_phys_flux[istate][idim] = diffusive_phys_flux_at_q[istate][idim][iquad];
+                }
+            }
+        }
+        else{
+            diffusive_phys_flux = pde_physics.dissipative_flux(soln_state, aux_soln_state, filtered_soln_state, filtered_aux_soln_state, current_cell_index);
+        }
 
         // Manufactured source
         std::array<adtype,nstate> manufactured_source;
@@ -2792,6 +2857,12 @@ void DGStrong<dim,nspecies,nstate,real,MeshType>::assemble_face_term_strong(
     // First we do interior.
     std::array<dealii::Tensor<1,dim,std::vector<adtype>>,nstate> conv_ref_flux_at_vol_q_int;
     std::array<dealii::Tensor<1,dim,std::vector<adtype>>,nstate> diffusive_ref_flux_at_vol_q_int;
+    // Physical fluxes at all the volume cubature nodes from the packed physics kernels, when available.
+    std::array<dealii::Tensor<1,dim,std::vector<adtype>>,nstate> conv_phys_flux_at_vol_q_int;
+    std::array<dealii::Tensor<1,dim,std::vector<adtype>>,nstate> diffusive_phys_flux_at_vol_q_int;
+    const bool use_conv_flux_batch_int = !this->all_parameters->use_split_form && !this->all_parameters->use_curvilinear_split_form
+                                      && evaluate_convective_flux_batch(pde_physics, soln_at_vol_q_int, conv_phys_flux_at_vol_q_int);
+    const bool use_diffusive_flux_batch_int = evaluate_dissipative_flux_batch(pde_physics, soln_at_vol_q_int, aux_soln_at_vol_q_int, diffusive_phys_flux_at_vol_q_int);
     for (unsigned int iquad=0; iquad<n_quad_pts_vol_int; ++iquad) {
         // Copy Metric Cofactor in a way can use for transforming Tensor Blocks to reference space
         // The way it is stored in metric_operators is to use sum-factorization in each direction,
@@ -2818,13 +2889,29 @@ void DGStrong<dim,nspecies,nstate,real,MeshType>::assemble_face_term_strong(
         // Evaluate physical convective flux
         std::array<dealii::Tensor<1,dim,adtype>,nstate> conv_phys_flux;
         //Only for conservtive DG do we interpolate volume fluxes to the facet
-        if(!this->all_parameters->use_split_form && !this->all_parameters->use_curvilinear_split_form){
+        if(use_conv_flux_batch_int){
+            for(int istate=0; istate<nstate; istate++){
+                for(int idim=0; idim<dim; idim++){
+                    conv_phys_flux[istate][idim] = conv_phys_flux_at_vol_q_int[istate][idim][iquad];
+                }
+            }
+        }
+        else if(!this->all_parameters->use_split_form && !this->all_parameters->use_curvilinear_split_form){
             conv_phys_flux = pde_physics.convective_flux (soln_state);
         }
 
         // Compute the physical dissipative flux
         std::array<dealii::Tensor<1,dim,adtype>,nstate> diffusive_phys_flux;
-        diffusive_phys_flux = pde_physics.dissipative_flux(soln_state, aux_soln_state, filtered_soln_state, filtered_aux_soln_state, current_cell_index);
+        if(use_diffusive_flux_batch_int){
+            for(int istate=0; istate<nstate; istate++){
+                for(int idim=0; idim<dim; idim++){
+                    diffusive_phys_flux[istate][idim] = diffusive_phys_flux_at_vol_q_int[istate][idim][iquad];
+                }
+            }
+        }
+        else{
+            diffusive_phys_flux = pde_physics.dissipative_flux(soln_state, aux_soln_state, filtered_soln_state, filtered_aux_soln_state, current_cell_index);
+        }
 
         // Write the values in a way that we can use sum-factorization on.
         for(int istate=0; istate<nstate; istate++){
@@ -2865,6 +2952,11 @@ void DGStrong<dim,nspecies,nstate,real,MeshType>::assemble_face_term_strong(
     // Note we split the quad integrals because the interior and exterior could be of different poly basis
     std::array<dealii::Tensor<1,dim,std::vector<adtype>>,nstate> conv_ref_flux_at_vol_q_ext;
     std::array<dealii::Tensor<1,dim,std::vector<adtype>>,nstate> diffusive_ref_flux_at_vol_q_ext;
+    std::array<dealii::Tensor<1,dim,std::vector<adtype>>,nstate> conv_phys_flux_at_vol_q_ext;
+    std::array<dealii::Tensor<1,dim,std::vector<adtype>>,nstate> diffusive_phys_flux_at_vol_q_ext;
+    const bool use_conv_flux_batch_ext = !this->all_parameters->use_split_form && !this->all_parameters->use_curvilinear_split_form
+                                      && evaluate_convective_flux_batch(pde_physics, soln_at_vol_q_ext, conv_phys_flux_at_vol_q_ext);
+    const bool use_diffusive_flux_batch_ext = evaluate_dissipative_flux_batch(pde_physics, soln_at_vol_q_ext, aux_soln_at_vol_q_ext, diffusive_phys_flux_at_vol_q_ext);
     for (unsigned int iquad=0; iquad<n_quad_pts_vol_ext; ++iquad) {
 
         // Extract exterior volume metric cofactor matrix at given volume cubature node.
@@ -2890,13 +2982,29 @@ void DGStrong<dim,nspecies,nstate,real,MeshType>::assemble_face_term_strong(
 
         // Evaluate physical convective flux
         std::array<dealii::Tensor<1,dim,adtype>,nstate> conv_phys_flux;
-        if(!this->all_parameters->use_split_form && !this->all_parameters->use_curvilinear_split_form){
+        if(use_conv_flux_batch_ext){
+            for(int istate=0; istate<nstate; istate++){
+                for(int idim=0; idim<dim; idim++){
+                    conv_phys_flux[istate][idim] = conv_phys_flux_at_vol_q_ext[istate][idim][iquad];
+                }
+            }
+        }
+        else if(!this->all_parameters->use_split_form && !this->all_parameters->use_curvilinear_split_form){
             conv_phys_flux = pde_physics.convective_flux (soln_state);
         }
 
         // Compute the physical dissipative flux
         std::array<dealii::Tensor<1,dim,adtype>,nstate> diffusive_phys_flux;
-        diffusive_phys_flux = pde_physics.dissipative_flux(soln_state, aux_soln_state, filtered_soln_state, filtered_aux_soln_state, neighbor_cell_index);
+        if(use_diffusive_flux_batch_ext){
+            for(int istate=0; istate<nstate; istate++){
+                for(int idim=0; idim<dim; idim++){
+                    diffusive_phys_flux[istate][idim] = diffusive_phys_flux_at_vol_q_ext[istate][idim][iquad];
+                }
+            }
+        }
+        else{
+            diffusive_phys_flux = pde_physics.dissipative_flux(soln_state, aux_soln_state, filtered_soln_state, filtered_aux_soln_state, neighbor_cell_index);
+        }
 
         // Write the values in a way that we can use sum-factorization on.
         for(int istate=0; istate<nstate; istate++){
@@ -3284,6 +3392,21 @@ void DGStrong<dim,nspecies,nstate,real,MeshType>::assemble_face_term_strong(
     
     std::array<std::vector<adtype>,nstate> conv_num_flux_dot_n;
     std::array<std::vector<adtype>,nstate> diss_auxi_num_flux_dot_n;
+    // Face states and unit normals are gathered over all face quadrature points so that the
+    // convective numerical flux is evaluated for the whole face in one call.
+    std::array<std::vector<adtype>,nstate> soln_state_face_int;
+    std::array<std::vector<adtype>,nstate> soln_state_face_ext;
+    std::array<std::vector<adtype>,dim> unit_phys_normal_face_int;
+    std::vector<adtype> face_Jac_norm_scaled_face(n_face_quad_pts);
+    for(int istate=0; istate<nstate; istate++){
+        conv_num_flux_dot_n[istate].resize(n_face_quad_pts);
+        diss_auxi_num_flux_dot_n[istate].resize(n_face_quad_pts);
+        soln_state_face_int[istate].resize(n_face_quad_pts);
+        soln_state_face_ext[istate].resize(n_face_quad_pts);
+    }
+    for(int idim=0; idim<dim; idim++){
+        unit_phys_normal_face_int[idim].resize(n_face_quad_pts);
+    }
     for (unsigned int iquad=0; iquad<n_face_quad_pts; ++iquad) {
         // Copy Metric Cofactor on the facet in a way can use for transforming Tensor Blocks to reference space
         // The way it is stored in metric_operators is to use sum-factorization in each direction,
@@ -3349,10 +3472,17 @@ void DGStrong<dim,nspecies,nstate,real,MeshType>::assemble_face_term_strong(
         // Note that the facet determinant of metric jacobian is the above norm multiplied by the determinant of the metric Jacobian evaluated on the facet.
         // Since the determinant of the metric Jacobian evaluated on the face cancels off, we can just scale the numerical flux by the norm.
 
-        std::array<adtype,nstate> conv_num_flux_dot_n_at_q;
+        // Convective numerical flux is evaluated for all face points after this loop.
+        for(int istate=0; istate<nstate; istate++){
+            soln_state_face_int[istate][iquad] = soln_state_int[istate];
+            soln_state_face_ext[istate][iquad] = soln_state_ext[istate];
+        }
+        for(int idim=0; idim<dim; idim++){
+            unit_phys_normal_face_int[idim][iquad] = unit_phys_normal_int[idim];
+        }
+        face_Jac_norm_scaled_face[iquad] = face_Jac_norm_scaled;
+
         std::array<adtype,nstate> diss_auxi_num_flux_dot_n_at_q;
-        // Convective numerical flux. 
-        conv_num_flux_dot_n_at_q = conv_num_flux.evaluate_flux(soln_state_int, soln_state_ext, unit_phys_normal_int);
         // dissipative numerical flux
         diss_auxi_num_flux_dot_n_at_q = diss_num_flux.evaluate_auxiliary_flux(
             current_cell_index, neighbor_cell_index,
@@ -3368,19 +3498,18 @@ void DGStrong<dim,nspecies,nstate,real,MeshType>::assemble_face_term_strong(
             // Write the data in a way that we can use sum-factorization on.
             // Since sum-factorization improves the speed for matrix-vector multiplications,
             // We need the values to have their inner elements be vectors of n_face_quad_pts.
-
-            // allocate
-            if(iquad == 0){
-                conv_num_flux_dot_n[istate].resize(n_face_quad_pts);
-                diss_auxi_num_flux_dot_n[istate].resize(n_face_quad_pts);
-            }
-
-            // write data
-            conv_num_flux_dot_n[istate][iquad] = face_Jac_norm_scaled * conv_num_flux_dot_n_at_q[istate];
             diss_auxi_num_flux_dot_n[istate][iquad] = face_Jac_norm_scaled * diss_auxi_num_flux_dot_n_at_q[istate];
         }
     }
 
+    // Convective numerical flux at all face points.
+    conv_num_flux.evaluate_flux_batch(soln_state_face_int, soln_state_face_ext, unit_phys_normal_face_int, conv_num_flux_dot_n);
+    for(int istate=0; istate<nstate; istate++){
+        for (unsigned int iquad=0; iquad<n_face_quad_pts; ++iquad) {
+            conv_num_flux_dot_n[istate][iquad] = face_Jac_norm_scaled_face[iquad] * conv_num_flux_dot_n[istate][iquad];
+        }
+    }
+
     // Compute RHS
     const std::vector<double> &surf_quad_weights = this->face_quadrature_collection[poly_degree_int].get_weights();
     for(int istate=0; istate<nstate; istate++){
@@ -877,6 +877,27 @@ protected:
         Physics::PhysicsBase<dim, nspecies, nstate, adtype>    &pde_physics,
         std::vector<adtype>                                    &local_rhs_int_cell);
 
+    /// Evaluates the physical convective flux at a batch of cubature nodes with the packed Euler kernel.
+    /** Returns false, leaving conv_phys_flux_at_q untouched, unless adtype is double and the physics
+     *  derives from Euler, in which case Euler::convective_flux_batch() is used.
+     */
+    template <typename adtype>
+    bool evaluate_convective_flux_batch(
+        const Physics::PhysicsBase<dim, nspecies, nstate, adtype>          &pde_physics,
+        const std::array<std::vector<adtype>,nstate>                       &soln_at_q,
+        std::array<dealii::Tensor<1,dim,std::vector<adtype>>,nstate>       &conv_phys_flux_at_q) const;
+
+    /// Evaluates the physical dissipative flux at a batch of cubature nodes with the packed Navier-Stokes kernel.
+    /** Returns false, leaving diffusive_phys_flux_at_q untouched, unless adtype is double and the physics
+     *  derives from NavierStokes, in which case NavierStokes::dissipative_flux_batch() is used.
+     */
+    template <typename adtype>
+    bool evaluate_dissipative_flux_batch(
+        const Physics::PhysicsBase<dim, nspecies, nstate, adtype>          &pde_physics,
+        const std::array<std::vector<adtype>,nstate>                       &soln_at_q,
+        const std::array<dealii::Tensor<1,dim,std::vector<adtype>>,nstate> &aux_soln_at_q,
+        std::array<dealii::Tensor<1,dim,std::vector<adtype>>,nstate>       &diffusive_phys_flux_at_q) const;
+
     /// Strong form primary equation's boundary right-hand-side.
     template <typename adtype>
     void assemble_boundary_term_strong(
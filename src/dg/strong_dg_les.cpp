@@ -20,6 +20,9 @@ DGStrongLES<dim,nspecies,nstate,real,MeshType>::DGStrongLES(
     const unsigned int grid_degree_input,
     const std::shared_ptr<Triangulation> triangulation_input)
     : DGStrong<dim,nspecies,nstate,real,MeshType>::DGStrong(parameters_input, degree, max_degree_input, grid_degree_input, triangulation_input)
+    , cellwise_mean_quantities_overintegration(this->all_parameters->physics_model_param.cellwise_mean_quantities_overintegration)
+    , store_cellwise_mean_quantities_metric_terms(false)
+    , mean_quantities_grid_degree(0)
 { 
     if constexpr (dim+2==nstate) {
         this->pde_model_les_double = std::dynamic_pointer_cast<Physics::LargeEddySimulationBase<dim,nspecies,dim+2,real>>(this->pde_model_double);
@@ -45,13 +48,27 @@ void DGStrongLES<dim,nspecies,nstate,real,MeshType>::allocate_model_variables()
 template <int dim, int nspecies, int nstate, typename real, typename MeshType>
 void DGStrongLES<dim,nspecies,nstate,real,MeshType>::update_model_variables()
 {
-    // allocate/reinit the model variables
-    allocate_model_variables();
+    // The cellwise volume, polynomial degree and model data (e.g. filter width) only depend on
+    // the grid and the polynomial degree distribution, so they are only rebuilt if either has changed.
+    const bool grid_changed = update_cellwise_mean_quantities_metric_terms();
 
-    /* NOTE: While not essential, the function update_cellwise_volume_and_poly_degree() 
-             could only be called once if no hp-adaptation
-    */
-    update_cellwise_volume_and_poly_degree();
+    bool poly_degree_changed = (this->pde_model_double->cellwise_poly_degree.size() != this->triangulation->n_active_cells());
+    for (auto cell : this->dof_handler.active_cell_iterators()) {
+        if (poly_degree_changed) break;
+        if (!(cell->is_locally_owned() || cell->is_ghost())) continue;
+        const int cell_poly_degree = this->fe_collection[cell->active_fe_index()].tensor_degree();
+        poly_degree_changed = (this->pde_model_double->cellwise_poly_degree[cell->active_cell_index()] != cell_poly_degree);
+    }
+
+    if (grid_changed || poly_degree_changed) {
+        // allocate/reinit the model variables
+        allocate_model_variables();
+
+        update_cellwise_volume_and_poly_degree();
+
+        // update the model data that depend on the cellwise volume and polynomial degree
+        this->pde_model_double->update_cellwise_model_data();
+    }
 
     // update the cellwise mean quantities
     update_cellwise_mean_quantities();
@@ -60,40 +77,14 @@ void DGStrongLES<dim,nspecies,nstate,real,MeshType>::update_model_variables()
 template <int dim, int nspecies, int nstate, typename real, typename MeshType>
 void DGStrongLES<dim,nspecies,nstate,real,MeshType>::update_cellwise_volume_and_poly_degree()
 {
-    // get FEValues of volume
-    const auto mapping = (*(this->high_order_grid->mapping_fe_field));
-    dealii::hp::MappingCollection<dim> mapping_collection(mapping);
-    const dealii::UpdateFlags update_flags = dealii::update_values | dealii::update_JxW_values;
-    dealii::hp::FEValues<dim,dim> fe_values_collection_volume (mapping_collection, 
-                                                               this->fe_collection, 
-                                                               this->volume_quadrature_collection, 
-                                                               update_flags);
-
     // loop through all cells
     for (auto cell : this->dof_handler.active_cell_iterators()) {
         if (!(cell->is_locally_owned() || cell->is_ghost())) continue;
 
-        // get FEValues of volume for current cell
-        const int i_fele = cell->active_fe_index();
-        const int i_quad = i_fele;
-        const int i_mapp = 0;
-        fe_values_collection_volume.reinit(cell, i_quad, i_mapp, i_fele);
-        const dealii::FEValues<dim,dim> &fe_values_volume = fe_values_collection_volume.get_present_fe_values();
-
         // get cell polynomial degree
-        const dealii::FESystem<dim,dim> &fe_high = this->fe_collection[i_fele];
+        const dealii::FESystem<dim,dim> &fe_high = this->fe_collection[cell->active_fe_index()];
         const unsigned int cell_poly_degree = fe_high.tensor_degree();
 
-        // get cell volume
-        const dealii::Quadrature<dim> &quadrature = fe_values_volume.get_quadrature();
-        const unsigned int n_quad_pts = quadrature.size();
-        const std::vector<real> &JxW = fe_values_volume.get_JxW_values();
-        real cell_volume_estimate = 0.0;
-        for (unsigned int iquad=0; iquad<n_quad_pts; ++iquad) {
-            cell_volume_estimate = cell_volume_estimate + JxW[iquad];
-        }
-        const real cell_volume = cell_volume_estimate;
-        
         // get cell index for assignment
         const dealii::types::global_dof_index cell_index = cell->active_cell_index();
         // const dealii::types::global_dof_index cell_index = cell->global_active_cell_index(); // https://www.dealii.org/current/doxygen/deal.II/classCellAccessor.html
@@ -101,7 +92,8 @@ void DGStrongLES<dim,nspecies,nstate,real,MeshType>::update_cellwise_volume_and_
         // assign values
         // -- double
         this->pde_model_double->cellwise_poly_degree[cell_index] = cell_poly_degree;
-        this->pde_model_double->cellwise_volume[cell_index] = cell_volume;
+        // -- the cell volume was integrated with the determinant of the metric Jacobian
+        this->pde_model_double->cellwise_volume[cell_index] = mean_quantities_cell_volume[cell_index];
     }
     this->pde_model_double->cellwise_poly_degree.update_ghost_values();
     this->pde_model_double->cellwise_volume.update_ghost_values();
@@ -113,6 +105,168 @@ void DGStrongLES<dim,nspecies,nstate,real,MeshType>::update_cellwise_mean_quanti
     // do nothing
 }
 
+template <int dim, int nspecies, int nstate, typename real, typename MeshType>
+void DGStrongLES<dim,nspecies,nstate,real,MeshType>::build_cellwise_mean_quantities_operators()
+{
+    const unsigned int grid_degree = this->high_order_grid->fe_system.tensor_degree();
+    if(mean_quantities_grid_degree == grid_degree) return;
+
+    // Set the quadrature of size dim and 1D for sum-factorization.
+    const unsigned int n_quad_pts_1D = this->max_degree+1+cellwise_mean_quantities_overintegration;
+    mean_quantities_quadrature = dealii::QGauss<dim>(n_quad_pts_1D);
+    mean_quantities_quadrature_1D = dealii::QGauss<1>(n_quad_pts_1D);
+
+    const unsigned int poly_degree = this->max_degree;
+    // Construct the basis functions and mapping shape functions.
+    mean_quantities_soln_basis = std::make_unique<OPERATOR::basis_functions<dim,2*dim>>(1, poly_degree, grid_degree);
+    mean_quantities_mapping_basis = std::make_unique<OPERATOR::mapping_shape_functions<dim,2*dim>>(1, poly_degree, grid_degree);
+    // Build basis function volume operator and gradient operator from 1D finite element for 1 state.
+    mean_quantities_soln_basis->build_1D_volume_operator(this->oneD_fe_collection_1state[poly_degree], mean_quantities_quadrature_1D);
+    mean_quantities_soln_basis->build_1D_gradient_operator(this->oneD_fe_collection_1state[poly_degree], mean_quantities_quadrature_1D);
+    // Build mapping shape functions operators using the oneD high_ordeR_grid finite element
+    mean_quantities_mapping_basis->build_1D_shape_functions_at_grid_nodes(this->high_order_grid->oneD_fe_system, this->high_order_grid->oneD_grid_nodes);
+    mean_quantities_mapping_basis->build_1D_shape_functions_at_flux_nodes(this->high_order_grid->oneD_fe_system, mean_quantities_quadrature_1D, this->oneD_face_quadrature);
+
+    // Operators for the filtered solution: projects to Legendre basis, truncates, then interpolates back to quad nodes.
+    // -- Constructor for tensor product polynomials based on Polynomials::Legendre interpolation. 
+    dealii::FE_DGQLegendre<1,1> legendre_poly_1D(poly_degree);
+    // -- Projection operator for legendre basis
+    mean_quantities_legendre_projection_oper = std::make_unique<OPERATOR::vol_projection_operator<dim,2*dim>>(1, poly_degree, grid_degree);
+    mean_quantities_legendre_projection_oper->build_1D_volume_operator(legendre_poly_1D, mean_quantities_quadrature_1D);
+    // -- Legendre basis functions 
+    mean_quantities_legendre_basis = std::make_unique<OPERATOR::basis_functions<dim,2*dim>>(1, poly_degree, grid_degree);
+    mean_quantities_legendre_basis->build_1D_volume_operator(legendre_poly_1D, mean_quantities_quadrature_1D);
+    mean_quantities_legendre_basis->build_1D_gradient_operator(legendre_poly_1D, mean_quantities_quadrature_1D);
+
+    mean_quantities_grid_degree = grid_degree;
+    // The stored metric terms were computed with the previous operators
+    mean_quantities_cell_volume.clear();
+    mean_quantities_det_Jac.clear();
+    mean_quantities_metric_cofactor.clear();
+}
+
+template <int dim, int nspecies, int nstate, typename real, typename MeshType>
+bool DGStrongLES<dim,nspecies,nstate,real,MeshType>::update_cellwise_mean_quantities_metric_terms()
+{
+    build_cellwise_mean_quantities_operators();
+
+    // Only recompute the metric terms if the grid has changed since the last update.
+    // The global vector sizes are identical on all processors, such that the norm below is called collectively.
+    bool grid_changed = (volume_nodes_mean_quantities.size() != this->high_order_grid->volume_nodes.size());
+    if (!grid_changed) {
+        auto diff_node = this->high_order_grid->volume_nodes;
+        diff_node -= volume_nodes_mean_quantities;
+        grid_changed = (diff_node.l2_norm() != 0.0);
+    }
+    if (!grid_changed && mean_quantities_cell_volume.size() == this->triangulation->n_active_cells()) return false;
+
+    volume_nodes_mean_quantities = this->high_order_grid->volume_nodes;
+    mean_quantities_cell_volume.assign(this->triangulation->n_active_cells(), 0.0);
+    mean_quantities_det_Jac.clear();
+    mean_quantities_metric_cofactor.clear();
+    if (store_cellwise_mean_quantities_metric_terms) {
+        mean_quantities_det_Jac.resize(this->triangulation->n_active_cells());
+        mean_quantities_metric_cofactor.resize(this->triangulation->n_active_cells());
+    }
+
+    const unsigned int n_quad_pts = mean_quantities_quadrature.size();
+    const std::vector<double> &quad_weights = mean_quantities_quadrature.get_weights();
+    const unsigned int grid_degree = mean_quantities_grid_degree;
+    const unsigned int poly_degree = this->max_degree;
+    // If in the future we need the physical quadrature node location, turn these flags to true and the constructor will
+    // automatically compute it for you. Currently set to false as to not compute extra unused terms.
+    const bool store_vol_flux_nodes = false;//currently doesn't need the volume physical nodal position
+    const bool store_surf_flux_nodes = false;//currently doesn't need the surface physical nodal position
+
+    const dealii::FESystem<dim> &fe_metric = this->high_order_grid->fe_system;
+    const unsigned int n_metric_dofs = fe_metric.dofs_per_cell;
+    const unsigned int n_grid_nodes  = n_metric_dofs / dim;
+    std::vector<dealii::types::global_dof_index> metric_dof_indices(n_metric_dofs);
+    const std::vector<unsigned int > &index_renumbering = dealii::FETools::hierarchic_to_lexicographic_numbering<dim>(grid_degree);
+    auto metric_cell = this->high_order_grid->dof_handler_grid.begin_active();
+    // Changed for loop to update metric_cell.
+    for (auto cell = this->dof_handler.begin_active(); cell!= this->dof_handler.end(); ++cell, ++metric_cell) {
+        if (!(cell->is_locally_owned() || cell->is_ghost())) continue;
+
+        // We first need to extract the mapping support points (grid nodes) from high_order_grid.
+        metric_cell->get_dof_indices (metric_dof_indices);
+        std::array<std::vector<double>,dim> mapping_support_points;
+        for(int idim=0; idim<dim; idim++){
+            mapping_support_points[idim].resize(n_grid_nodes);
+        }
+        // Get the mapping support points (physical grid nodes) from high_order_grid.
+        // Store it in such a way we can use sum-factorization on it with the mapping basis functions.
+        for (unsigned int idof = 0; idof< n_metric_dofs; ++idof) {
+            const double val = (this->high_order_grid->volume_nodes[metric_dof_indices[idof]]);
+            const unsigned int istate = fe_metric.system_to_component_index(idof).first; 
+            const unsigned int ishape = fe_metric.system_to_component_index(idof).second; 
+            const unsigned int igrid_node = index_renumbering[ishape];
+            mapping_support_points[istate][igrid_node] = val; 
+        }
+        // Construct the metric operators.
+        OPERATOR::metric_operators<real, dim, 2*dim> metric_oper(nstate, poly_degree, grid_degree, store_vol_flux_nodes, store_surf_flux_nodes);
+        // Build the metric terms to compute the gradient and volume node positions.
+        // This functions will compute the determinant of the metric Jacobian and metric cofactor matrix. 
+        metric_oper.build_volume_metric_operators(
+            n_quad_pts, n_grid_nodes,
+            mapping_support_points,
+            *mean_quantities_mapping_basis,
+            this->all_parameters->use_invariant_curl_form);
+
+        const dealii::types::global_dof_index cell_index = cell->active_cell_index();
+        // Integrate the cell volume with the determinant of the metric Jacobian
+        real cell_volume = 0.0;
+        for (unsigned int iquad=0; iquad<n_quad_pts; ++iquad) {
+            cell_volume += quad_weights[iquad] * metric_oper.det_Jac_vol[iquad];
+        }
+        mean_quantities_cell_volume[cell_index] = cell_volume;
+
+        if (store_cellwise_mean_quantities_metric_terms) {
+            mean_quantities_det_Jac[cell_index] = std::move(metric_oper.det_Jac_vol);
+            mean_quantities_metric_cofactor[cell_index] = std::move(metric_oper.metric_cofactor_vol);
+        }
+    }
+    return true;
+}
+
+template <int dim, int nspecies, int nstate, typename real, typename MeshType>
+void DGStrongLES<dim,nspecies,nstate,real,MeshType>::interpolate_to_mean_quantities_quadrature(
+    const dealii::types::global_dof_index                      cell_index,
+    OPERATOR::basis_functions<dim,2*dim>                       &basis,
+    const std::vector<real>                                    &coeff,
+    std::vector<real>                                          &values_at_q,
+    dealii::Tensor<1,dim,std::vector<real>>                    &gradient_at_q)
+{
+    const unsigned int n_quad_pts = mean_quantities_quadrature.size();
+    const std::vector<real> &det_Jac = mean_quantities_det_Jac[cell_index];
+    const dealii::Tensor<2,dim,std::vector<real>> &metric_cofactor = mean_quantities_metric_cofactor[cell_index];
+
+    values_at_q.resize(n_quad_pts);
+    // Interpolate coeff to volume cubature nodes.
+    basis.matrix_vector_mult_1D(coeff, values_at_q, basis.oneD_vol_operator);
+    // We need to first compute the reference gradient, then transform that to a physical gradient.
+    dealii::Tensor<1,dim,std::vector<real>> ref_gradient_basis_fns_times_coeff;
+    for(int idim=0; idim<dim; idim++){
+        ref_gradient_basis_fns_times_coeff[idim].resize(n_quad_pts);
+        gradient_at_q[idim].assign(n_quad_pts, 0.0);
+    }
+    // Apply gradient of reference basis functions on the coefficients at volume cubature nodes.
+    basis.gradient_matrix_vector_mult_1D(coeff, ref_gradient_basis_fns_times_coeff,
+                                         basis.oneD_vol_operator,
+                                         basis.oneD_grad_operator);
+    // Transform the reference gradient into a physical gradient operator.
+    for(int idim=0; idim<dim; idim++){
+        for(unsigned int iquad=0; iquad<n_quad_pts; iquad++){
+            for(int jdim=0; jdim<dim; jdim++){
+                //transform into the physical gradient
+                gradient_at_q[idim][iquad] += metric_cofactor[idim][jdim][iquad]
+                                            * ref_gradient_basis_fns_times_coeff[jdim][iquad]
+                                            / det_Jac[iquad];
+            }
+        }
+    }
+}
+
 template <int dim, int nspecies, int nstate, typename real, typename MeshType>
 DGStrongLES_ShearImproved<dim,nspecies,nstate,real,MeshType>::DGStrongLES_ShearImproved(
     const Parameters::AllParameters *const parameters_input,
@@ -122,7 +276,8 @@ DGStrongLES_ShearImproved<dim,nspecies,nstate,real,MeshType>::DGStrongLES_ShearI
     const std::shared_ptr<Triangulation> triangulation_input)
     : DGStrongLES<dim,nspecies,nstate,real,MeshType>::DGStrongLES(parameters_input, degree, max_degree_input, grid_degree_input, triangulation_input)
 { 
-    // do nothing
+    // the mean strain rate tensor is integrated with the stored metric terms
+    this->store_cellwise_mean_quantities_metric_terms = true;
 }
 
 // Destructor
@@ -147,40 +302,24 @@ void DGStrongLES_ShearImproved<dim,nspecies,nstate,real,MeshType>::allocate_mode
 template <int dim, int nspecies, int nstate, typename real, typename MeshType>
 void DGStrongLES_ShearImproved<dim,nspecies,nstate,real,MeshType>::update_cellwise_mean_quantities()
 {
-    // Overintegrate the error to make sure there is not integration error in the error estimate
-    int overintegrate = 10; // set to zero to reduce computational cost; currently set to 10 for peace of mind
-
-    // Set the quadrature of size dim and 1D for sum-factorization.
-    dealii::QGauss<dim> quad_extra(this->max_degree+1+overintegrate);
-    dealii::QGauss<1> quad_extra_1D(this->max_degree+1+overintegrate);
+    // Build the operators once and update the metric terms only if the grid has changed
+    this->update_cellwise_mean_quantities_metric_terms();
 
-    const unsigned int n_quad_pts = quad_extra.size();
-    const unsigned int grid_degree = this->high_order_grid->fe_system.tensor_degree();
+    const unsigned int n_quad_pts = this->mean_quantities_quadrature.size();
     const unsigned int poly_degree = this->max_degree;
-    // Construct the basis functions and mapping shape functions.
-    OPERATOR::basis_functions<dim,2*dim> soln_basis(1, poly_degree, grid_degree); 
-    OPERATOR::mapping_shape_functions<dim,2*dim> mapping_basis(1, poly_degree, grid_degree);
-    // Build basis function volume operator and gradient operator from 1D finite element for 1 state.
-    soln_basis.build_1D_volume_operator(this->oneD_fe_collection_1state[poly_degree], quad_extra_1D);
-    soln_basis.build_1D_gradient_operator(this->oneD_fe_collection_1state[poly_degree], quad_extra_1D);
-    // Build mapping shape functions operators using the oneD high_ordeR_grid finite element
-    mapping_basis.build_1D_shape_functions_at_grid_nodes(this->high_order_grid->oneD_fe_system, this->high_order_grid->oneD_grid_nodes);
-    mapping_basis.build_1D_shape_functions_at_flux_nodes(this->high_order_grid->oneD_fe_system, quad_extra_1D, this->oneD_face_quadrature);
-    const std::vector<double> &quad_weights = quad_extra.get_weights();
-    // If in the future we need the physical quadrature node location, turn these flags to true and the constructor will
-    // automatically compute it for you. Currently set to false as to not compute extra unused terms.
-    const bool store_vol_flux_nodes = false;//currently doesn't need the volume physical nodal position
-    const bool store_surf_flux_nodes = false;//currently doesn't need the surface physical nodal position
+    const std::vector<double> &quad_weights = this->mean_quantities_quadrature.get_weights();
 
     const unsigned int n_dofs = this->fe_collection[poly_degree].n_dofs_per_cell();
     const unsigned int n_shape_fns = n_dofs / nstate;
     std::vector<dealii::types::global_dof_index> dofs_indices (n_dofs);
-    auto metric_cell = this->high_order_grid->dof_handler_grid.begin_active();
-    // Changed for loop to update metric_cell.
-    for (auto cell = this->dof_handler.begin_active(); cell!= this->dof_handler.end(); ++cell, ++metric_cell) {
+    for (auto cell = this->dof_handler.begin_active(); cell!= this->dof_handler.end(); ++cell) {
         if (!(cell->is_locally_owned() || cell->is_ghost())) continue;
         cell->get_dof_indices (dofs_indices);
 
+        // get cell index
+        const dealii::types::global_dof_index cell_index = cell->active_cell_index();
+        const std::vector<real> &det_Jac = this->mean_quantities_det_Jac[cell_index];
+
         // Initialize the strain rate tensor integral (for computing the mean) to zero
         dealii::Tensor<2,dim,double> cell_strain_rate_tensor_integral;
         for (int d1=0; d1<dim; ++d1) {
@@ -189,37 +328,6 @@ void DGStrongLES_ShearImproved<dim,nspecies,nstate,real,MeshType>::update_cellwi
             }
         }
 
-        // We first need to extract the mapping support points (grid nodes) from high_order_grid.
-        const dealii::FESystem<dim> &fe_metric = this->high_order_grid->fe_system;
-        const unsigned int n_metric_dofs = fe_metric.dofs_per_cell;
-        const unsigned int n_grid_nodes  = n_metric_dofs / dim;
-        std::vector<dealii::types::global_dof_index> metric_dof_indices(n_metric_dofs);
-        metric_cell->get_dof_indices (metric_dof_indices);
-        std::array<std::vector<double>,dim> mapping_support_points;
-        for(int idim=0; idim<dim; idim++){
-            mapping_support_points[idim].resize(n_grid_nodes);
-        }
-        // Get the mapping support points (physical grid nodes) from high_order_grid.
-        // Store it in such a way we can use sum-factorization on it with the mapping basis functions.
-        const std::vector<unsigned int > &index_renumbering = dealii::FETools::hierarchic_to_lexicographic_numbering<dim>(grid_degree);
-        for (unsigned int idof = 0; idof< n_metric_dofs; ++idof) {
-            const double val = (this->high_order_grid->volume_nodes[metric_dof_indices[idof]]);
-            const unsigned int istate = fe_metric.system_to_component_index(idof).first; 
-            const unsigned int ishape = fe_metric.system_to_component_index(idof).second; 
-            const unsigned int igrid_node = index_renumbering[ishape];
-            mapping_support_points[istate][igrid_node] = val; 
-        }
-        // Construct the metric operators.
-        OPERATOR::metric_operators<real, dim, 2*dim> metric_oper(nstate, poly_degree, grid_degree, store_vol_flux_nodes, store_surf_flux_nodes);
-        // Build the metric terms to compute the gradient and volume node positions.
-        // This functions will compute the determinant of the metric Jacobian and metric cofactor matrix. 
-        // If flags store_vol_flux_nodes and store_surf_flux_nodes set as true it will also compute the physical quadrature positions.
-        metric_oper.build_volume_metric_operators(
-            n_quad_pts, n_grid_nodes,
-            mapping_support_points,
-            mapping_basis,
-            this->all_parameters->use_invariant_curl_form);
-
         // Fetch the modal soln coefficients
         // We immediately separate them by state as to be able to use sum-factorization
         // in the interpolation operator. If we left it by n_dofs_cell, then the matrix-vector
@@ -235,36 +343,13 @@ void DGStrongLES_ShearImproved<dim,nspecies,nstate,real,MeshType>::update_cellwi
          
             soln_coeff[istate][ishape] = this->solution(dofs_indices[idof]);
         }
-        // Interpolate each state to the quadrature points using sum-factorization
+        // Interpolate each state and its physical gradient to the quadrature points using sum-factorization
         // with the basis functions in each reference direction.
         std::array<std::vector<double>,nstate> soln_at_q_vect;
         std::array<dealii::Tensor<1,dim,std::vector<double>>,nstate> soln_grad_at_q_vect;
         for(int istate=0; istate<nstate; istate++){
-            soln_at_q_vect[istate].resize(n_quad_pts);
-            // Interpolate soln coeff to volume cubature nodes.
-            soln_basis.matrix_vector_mult_1D(soln_coeff[istate], soln_at_q_vect[istate],
-                                             soln_basis.oneD_vol_operator);
-            // We need to first compute the reference gradient of the solution, then transform that to a physical gradient.
-            dealii::Tensor<1,dim,std::vector<double>> ref_gradient_basis_fns_times_soln;
-            for(int idim=0; idim<dim; idim++){
-                ref_gradient_basis_fns_times_soln[idim].resize(n_quad_pts);
-                soln_grad_at_q_vect[istate][idim].resize(n_quad_pts);
-            }
-            // Apply gradient of reference basis functions on the solution at volume cubature nodes.
-            soln_basis.gradient_matrix_vector_mult_1D(soln_coeff[istate], ref_gradient_basis_fns_times_soln,
-                                                      soln_basis.oneD_vol_operator,
-                                                      soln_basis.oneD_grad_operator);
-            // Transform the reference gradient into a physical gradient operator.
-            for(int idim=0; idim<dim; idim++){
-                for(unsigned int iquad=0; iquad<n_quad_pts; iquad++){
-                    for(int jdim=0; jdim<dim; jdim++){
-                        //transform into the physical gradient
-                        soln_grad_at_q_vect[istate][idim][iquad] += metric_oper.metric_cofactor_vol[idim][jdim][iquad]
-                                                                  * ref_gradient_basis_fns_times_soln[jdim][iquad]
-                                                                  / metric_oper.det_Jac_vol[iquad];
-                    }
-                }
-            }
+            this->interpolate_to_mean_quantities_quadrature(cell_index, *this->mean_quantities_soln_basis, soln_coeff[istate],
+                                                            soln_at_q_vect[istate], soln_grad_at_q_vect[istate]);
         }
 
         // -- Solution at legendre poly
@@ -316,15 +401,7 @@ void DGStrongLES_ShearImproved<dim,nspecies,nstate,real,MeshType>::update_cellwi
             std::array<dealii::Tensor<1,dim,std::vector<real>>,nstate> primitive_legendre_aux_soln_at_q; // legendre auxiliary sol at quad points
 
             // Details: this projects to Legendre basis, truncates, then interpolates back to quad nodes.
-            // -- Constructor for tensor product polynomials based on Polynomials::Legendre interpolation. 
-            dealii::FE_DGQLegendre<1,1> legendre_poly_1D(poly_degree);
-            // -- Projection operator for legendre basis
-            OPERATOR::vol_projection_operator<dim,2*dim> legendre_soln_basis_projection_oper(1, poly_degree, grid_degree);
-            legendre_soln_basis_projection_oper.build_1D_volume_operator(legendre_poly_1D, quad_extra_1D);
-            // -- Legendre basis functions 
-            OPERATOR::basis_functions<dim,2*dim> legendre_soln_basis(1, poly_degree, grid_degree);
-            legendre_soln_basis.build_1D_volume_operator(legendre_poly_1D, quad_extra_1D);
-            legendre_soln_basis.build_1D_gradient_operator(legendre_poly_1D, quad_extra_1D);
+            OPERATOR::vol_projection_operator<dim,2*dim> &legendre_soln_basis_projection_oper = *this->mean_quantities_legendre_projection_oper;
             for(int istate=0; istate<nstate; istate++){
                 //==================================================
                 // Solution and Solution Gradient
@@ -341,32 +418,9 @@ void DGStrongLES_ShearImproved<dim,nspecies,nstate,real,MeshType>::update_cellwi
                         }
                     }    
                 }
-                // -- (3) Interpolate filtered solution back to quadrature points
-                primitive_legendre_soln_at_q[istate].resize(n_quad_pts);
-                legendre_soln_basis.matrix_vector_mult_1D(legendre_soln_coeff, primitive_legendre_soln_at_q[istate],
-                                                          legendre_soln_basis.oneD_vol_operator);
-
-                // We need to first compute the reference gradient of the solution, then transform that to a physical gradient.
-                dealii::Tensor<1,dim,std::vector<double>> ref_gradient_basis_fns_times_soln;
-                for(int idim=0; idim<dim; idim++){
-                    ref_gradient_basis_fns_times_soln[idim].resize(n_quad_pts);
-                    primitive_legendre_aux_soln_at_q[istate][idim].resize(n_quad_pts);
-                }
-                // Apply gradient of reference basis functions on the solution at volume cubature nodes.
-                legendre_soln_basis.gradient_matrix_vector_mult_1D(legendre_soln_coeff, ref_gradient_basis_fns_times_soln,
-                                                                   legendre_soln_basis.oneD_vol_operator,
-                                                                   legendre_soln_basis.oneD_grad_operator);
-                // Transform the reference gradient into a physical gradient operator.
-                for(int idim=0; idim<dim; idim++){
-                    for(unsigned int iquad=0; iquad<n_quad_pts; iquad++){
-                        for(int jdim=0; jdim<dim; jdim++){
-                            //transform into the physical gradient
-                            primitive_legendre_aux_soln_at_q[istate][idim][iquad] += metric_oper.metric_cofactor_vol[idim][jdim][iquad]
-                                                                                   * ref_gradient_basis_fns_times_soln[jdim][iquad]
-                                                                                   / metric_oper.det_Jac_vol[iquad];
-                        }
-                    }
-                }
+                // -- (3) Interpolate filtered solution and its physical gradient back to quadrature points
+                this->interpolate_to_mean_quantities_quadrature(cell_index, *this->mean_quantities_legendre_basis, legendre_soln_coeff,
+                                                                primitive_legendre_soln_at_q[istate], primitive_legendre_aux_soln_at_q[istate]);
                 //==================================================
             }
             //=======================================================
@@ -422,13 +476,11 @@ void DGStrongLES_ShearImproved<dim,nspecies,nstate,real,MeshType>::update_cellwi
             const dealii::Tensor<2,dim,double> strain_rate_tensor = this->pde_model_les_double->navier_stokes_physics->compute_strain_rate_tensor_from_conservative(soln_at_q,soln_grad_at_q);
             for (int d1=0; d1<dim; ++d1) {
                 for (int d2=0; d2<dim; ++d2) {
-                    cell_strain_rate_tensor_integral[d1][d2] += strain_rate_tensor[d1][d2] * quad_weights[iquad] * metric_oper.det_Jac_vol[iquad];
+                    cell_strain_rate_tensor_integral[d1][d2] += strain_rate_tensor[d1][d2] * quad_weights[iquad] * det_Jac[iquad];
                 }
             }
         }
-        
-        // get cell index
-        const dealii::types::global_dof_index cell_index = cell->active_cell_index();
+
         // get mean strain rate tensor
         dealii::Tensor<2,dim,double> cell_mean_strain_rate_tensor;
         for (int d1=0; d1<dim; ++d1) {
@@ -455,7 +507,8 @@ DGStrongLES_DynamicSmagorinsky<dim,nspecies,nstate,real,MeshType>::DGStrongLES_D
     : DGStrongLES<dim,nspecies,nstate,real,MeshType>::DGStrongLES(parameters_input, degree, max_degree_input, grid_degree_input, triangulation_input)
     , dynamic_smagorinsky_model_constant_clipping_limit(this->all_parameters->physics_model_param.dynamic_smagorinsky_model_constant_clipping_limit)
 { 
-    // do nothing
+    // the Germano identity terms are integrated with the stored metric terms
+    this->store_cellwise_mean_quantities_metric_terms = true;
 }
 
 // Destructor
@@ -480,75 +533,31 @@ void DGStrongLES_DynamicSmagorinsky<dim,nspecies,nstate,real,MeshType>::allocate
 template <int dim, int nspecies, int nstate, typename real, typename MeshType>
 void DGStrongLES_DynamicSmagorinsky<dim,nspecies,nstate,real,MeshType>::update_cellwise_mean_quantities()
 {
-    // Overintegrate the error to make sure there is not integration error in the error estimate
-    int overintegrate = 10; // set to zero to reduce computational cost; currently set to 10 for peace of mind
+    // Build the operators once and update the metric terms only if the grid has changed
+    this->update_cellwise_mean_quantities_metric_terms();
 
-    // Set the quadrature of size dim and 1D for sum-factorization.
-    dealii::QGauss<dim> quad_extra(this->max_degree+1+overintegrate);
-    dealii::QGauss<1> quad_extra_1D(this->max_degree+1+overintegrate);
-
-    const unsigned int n_quad_pts = quad_extra.size();
-    const unsigned int grid_degree = this->high_order_grid->fe_system.tensor_degree();
+    const unsigned int n_quad_pts = this->mean_quantities_quadrature.size();
     const unsigned int poly_degree = this->max_degree;
-    // Construct the basis functions and mapping shape functions.
-    OPERATOR::basis_functions<dim,2*dim> soln_basis(1, poly_degree, grid_degree); 
-    OPERATOR::mapping_shape_functions<dim,2*dim> mapping_basis(1, poly_degree, grid_degree);
-    // Build basis function volume operator and gradient operator from 1D finite element for 1 state.
-    soln_basis.build_1D_volume_operator(this->oneD_fe_collection_1state[poly_degree], quad_extra_1D);
-    soln_basis.build_1D_gradient_operator(this->oneD_fe_collection_1state[poly_degree], quad_extra_1D);
-    // Build mapping shape functions operators using the oneD high_ordeR_grid finite element
-    mapping_basis.build_1D_shape_functions_at_grid_nodes(this->high_order_grid->oneD_fe_system, this->high_order_grid->oneD_grid_nodes);
-    mapping_basis.build_1D_shape_functions_at_flux_nodes(this->high_order_grid->oneD_fe_system, quad_extra_1D, this->oneD_face_quadrature);
-    const std::vector<double> &quad_weights = quad_extra.get_weights();
-    // If in the future we need the physical quadrature node location, turn these flags to true and the constructor will
-    // automatically compute it for you. Currently set to false as to not compute extra unused terms.
-    const bool store_vol_flux_nodes = false;//currently doesn't need the volume physical nodal position
-    const bool store_surf_flux_nodes = false;//currently doesn't need the surface physical nodal position
+    const std::vector<double> &quad_weights = this->mean_quantities_quadrature.get_weights();
+    // Details: the test filter projects to Legendre basis, truncates, then interpolates back to quad nodes.
+    OPERATOR::vol_projection_operator<dim,2*dim> &legendre_soln_basis_projection_oper = *this->mean_quantities_legendre_projection_oper;
+    OPERATOR::basis_functions<dim,2*dim> &legendre_soln_basis = *this->mean_quantities_legendre_basis;
 
     const unsigned int n_dofs = this->fe_collection[poly_degree].n_dofs_per_cell();
     const unsigned int n_shape_fns = n_dofs / nstate;
     std::vector<dealii::types::global_dof_index> dofs_indices (n_dofs);
-    auto metric_cell = this->high_order_grid->dof_handler_grid.begin_active();
-    // Changed for loop to update metric_cell.
-    for (auto cell = this->dof_handler.begin_active(); cell!= this->dof_handler.end(); ++cell, ++metric_cell) {
+    for (auto cell = this->dof_handler.begin_active(); cell!= this->dof_handler.end(); ++cell) {
         if (!(cell->is_locally_owned() || cell->is_ghost())) continue;
         cell->get_dof_indices (dofs_indices);
 
+        // get cell index
+        const dealii::types::global_dof_index cell_index = cell->active_cell_index();
+        const std::vector<real> &det_Jac = this->mean_quantities_det_Jac[cell_index];
+
         // Initialize the matrix product integrals (for computing the means) to zero
         real cell_matrix_L_times_matrix_M_integral = 0.0;
         real cell_matrix_M_times_matrix_M_integral = 0.0;
 
-        // We first need to extract the mapping support points (grid nodes) from high_order_grid.
-        const dealii::FESystem<dim> &fe_metric = this->high_order_grid->fe_system;
-        const unsigned int n_metric_dofs = fe_metric.dofs_per_cell;
-        const unsigned int n_grid_nodes  = n_metric_dofs / dim;
-        std::vector<dealii::types::global_dof_index> metric_dof_indices(n_metric_dofs);
-        metric_cell->get_dof_indices (metric_dof_indices);
-        std::array<std::vector<double>,dim> mapping_support_points;
-        for(int idim=0; idim<dim; idim++){
-            mapping_support_points[idim].resize(n_grid_nodes);
-        }
-        // Get the mapping support points (physical grid nodes) from high_order_grid.
-        // Store it in such a way we can use sum-factorization on it with the mapping basis functions.
-        const std::vector<unsigned int > &index_renumbering = dealii::FETools::hierarchic_to_lexicographic_numbering<dim>(grid_degree);
-        for (unsigned int idof = 0; idof< n_metric_dofs; ++idof) {
-            const double val = (this->high_order_grid->volume_nodes[metric_dof_indices[idof]]);
-            const unsigned int istate = fe_metric.system_to_component_index(idof).first; 
-            const unsigned int ishape = fe_metric.system_to_component_index(idof).second; 
-            const unsigned int igrid_node = index_renumbering[ishape];
-            mapping_support_points[istate][igrid_node] = val; 
-        }
-        // Construct the metric operators.
-        OPERATOR::metric_operators<real, dim, 2*dim> metric_oper(nstate, poly_degree, grid_degree, store_vol_flux_nodes, store_surf_flux_nodes);
-        // Build the metric terms to compute the gradient and volume node positions.
-        // This functions will compute the determinant of the metric Jacobian and metric cofactor matrix. 
-        // If flags store_vol_flux_nodes and store_surf_flux_nodes set as true it will also compute the physical quadrature positions.
-        metric_oper.build_volume_metric_operators(
-            n_quad_pts, n_grid_nodes,
-            mapping_support_points,
-            mapping_basis,
-            this->all_parameters->use_invariant_curl_form);
-
         // Fetch the modal soln coefficients
         // We immediately separate them by state as to be able to use sum-factorization
         // in the interpolation operator. If we left it by n_dofs_cell, then the matrix-vector
@@ -564,36 +573,13 @@ void DGStrongLES_DynamicSmagorinsky<dim,nspecies,nstate,real,MeshType>::update_c
          
             soln_coeff[istate][ishape] = this->solution(dofs_indices[idof]);
         }
-        // Interpolate each state to the quadrature points using sum-factorization
+        // Interpolate each state and its physical gradient to the quadrature points using sum-factorization
         // with the basis functions in each reference direction.
         std::array<std::vector<double>,nstate> soln_at_q_vect;
         std::array<dealii::Tensor<1,dim,std::vector<double>>,nstate> soln_grad_at_q_vect;
         for(int istate=0; istate<nstate; istate++){
-            soln_at_q_vect[istate].resize(n_quad_pts);
-            // Interpolate soln coeff to volume cubature nodes.
-            soln_basis.matrix_vector_mult_1D(soln_coeff[istate], soln_at_q_vect[istate],
-                                             soln_basis.oneD_vol_operator);
-            // We need to first compute the reference gradient of the solution, then transform that to a physical gradient.
-            dealii::Tensor<1,dim,std::vector<double>> ref_gradient_basis_fns_times_soln;
-            for(int idim=0; idim<dim; idim++){
-                ref_gradient_basis_fns_times_soln[idim].resize(n_quad_pts);
-                soln_grad_at_q_vect[istate][idim].resize(n_quad_pts);
-            }
-            // Apply gradient of reference basis functions on the solution at volume cubature nodes.
-            soln_basis.gradient_matrix_vector_mult_1D(soln_coeff[istate], ref_gradient_basis_fns_times_soln,
-                                                      soln_basis.oneD_vol_operator,
-                                                      soln_basis.oneD_grad_operator);
-            // Transform the reference gradient into a physical gradient operator.
-            for(int idim=0; idim<dim; idim++){
-                for(unsigned int iquad=0; iquad<n_quad_pts; iquad++){
-                    for(int jdim=0; jdim<dim; jdim++){
-                        //transform into the physical gradient
-                        soln_grad_at_q_vect[istate][idim][iquad] += metric_oper.metric_cofactor_vol[idim][jdim][iquad]
-                                                                  * ref_gradient_basis_fns_times_soln[jdim][iquad]
-                                                                  / metric_oper.det_Jac_vol[iquad];
-                    }
-                }
-            }
+            this->interpolate_to_mean_quantities_quadrature(cell_index, *this->mean_quantities_soln_basis, soln_coeff[istate],
+                                                            soln_at_q_vect[istate], soln_grad_at_q_vect[istate]);
         }
 
         // -- Solution at legendre poly
@@ -671,16 +657,6 @@ void DGStrongLES_DynamicSmagorinsky<dim,nspecies,nstate,real,MeshType>::update_c
             // -- Primitive solution at legendre poly
             std::array<std::vector<real>,nstate> primitive_legendre_soln_at_q;
             std::array<dealii::Tensor<1,dim,std::vector<real>>,nstate> primitive_legendre_aux_soln_at_q; // legendre auxiliary sol at quad points
-            // Details: this projects to Legendre basis, truncates, then interpolates back to quad nodes.
-            // -- Constructor for tensor product polynomials based on Polynomials::Legendre interpolation. 
-            dealii::FE_DGQLegendre<1,1> legendre_poly_1D(poly_degree);
-            // -- Projection operator for legendre basis
-            OPERATOR::vol_projection_operator<dim,2*dim> legendre_soln_basis_projection_oper(1, poly_degree, grid_degree);
-            legendre_soln_basis_projection_oper.build_1D_volume_operator(legendre_poly_1D, quad_extra_1D);
-            // -- Legendre basis functions 
-            OPERATOR::basis_functions<dim,2*dim> legendre_soln_basis(1, poly_degree, grid_degree);
-            legendre_soln_basis.build_1D_volume_operator(legendre_poly_1D, quad_extra_1D);
-            legendre_soln_basis.build_1D_gradient_operator(legendre_poly_1D, quad_extra_1D);
             for(int istate=0; istate<nstate; istate++){
                 //==================================================
                 // Solution and Solution Gradient
@@ -697,32 +673,9 @@ void DGStrongLES_DynamicSmagorinsky<dim,nspecies,nstate,real,MeshType>::update_c
                         }
                     }    
                 }
-                // -- (3) Interpolate filtered solution back to quadrature points
-                primitive_legendre_soln_at_q[istate].resize(n_quad_pts);
-                legendre_soln_basis.matrix_vector_mult_1D(legendre_soln_coeff, primitive_legendre_soln_at_q[istate],
-                                                          legendre_soln_basis.oneD_vol_operator);
-
-                // We need to first compute the reference gradient of the solution, then transform that to a physical gradient.
-                dealii::Tensor<1,dim,std::vector<double>> ref_gradient_basis_fns_times_soln;
-                for(int idim=0; idim<dim; idim++){
-                    ref_gradient_basis_fns_times_soln[idim].resize(n_quad_pts);
-                    primitive_legendre_aux_soln_at_q[istate][idim].resize(n_quad_pts);
-                }
-                // Apply gradient of reference basis functions on the solution at volume cubature nodes.
-                legendre_soln_basis.gradient_matrix_vector_mult_1D(legendre_soln_coeff, ref_gradient_basis_fns_times_soln,
-                                                                   legendre_soln_basis.oneD_vol_operator,
-                                                                   legendre_soln_basis.oneD_grad_operator);
-                // Transform the reference gradient into a physical gradient operator.
-                for(int idim=0; idim<dim; idim++){
-                    for(unsigned int iquad=0; iquad<n_quad_pts; iquad++){
-                        for(int jdim=0; jdim<dim; jdim++){
-                            //transform into the physical gradient
-                            primitive_legendre_aux_soln_at_q[istate][idim][iquad] += metric_oper.metric_cofactor_vol[idim][jdim][iquad]
-                                                                                   * ref_gradient_basis_fns_times_soln[jdim][iquad]
-                                                                                   / metric_oper.det_Jac_vol[iquad];
-                        }
-                    }
-                }
+                // -- (3) Interpolate filtered solution and its physical gradient back to quadrature points
+                this->interpolate_to_mean_quantities_quadrature(cell_index, legendre_soln_basis, legendre_soln_coeff,
+                                                                primitive_legendre_soln_at_q[istate], primitive_legendre_aux_soln_at_q[istate]);
                 //==================================================
             }
 
@@ -812,8 +765,7 @@ void DGStrongLES_DynamicSmagorinsky<dim,nspecies,nstate,real,MeshType>::update_c
             }
         /*}*/
 
-        // get cell index
-        const dealii::types::global_dof_index cell_index = cell->active_cell_index();
+        // get filter widths
         const real filter_width = this->pde_model_les_double->get_filter_width(cell_index);
         const real test_filter_width = this->pde_model_les_double->get_filter_width_from_poly_degree(cell_index,(int)this->poly_degree_max_large_scales);
 
@@ -859,8 +811,8 @@ void DGStrongLES_DynamicSmagorinsky<dim,nspecies,nstate,real,MeshType>::update_c
             const real matrix_L_times_matrix_M = this->pde_model_les_double->navier_stokes_physics->get_tensor_product_magnitude_sqr(matrix_L,matrix_M);
             const real matrix_M_times_matrix_M = this->pde_model_les_double->navier_stokes_physics->get_tensor_product_magnitude_sqr(matrix_M,matrix_M);
 
-            cell_matrix_L_times_matrix_M_integral += matrix_L_times_matrix_M * quad_weights[iquad] * metric_oper.det_Jac_vol[iquad];
-            cell_matrix_M_times_matrix_M_integral += matrix_M_times_matrix_M * quad_weights[iquad] * metric_oper.det_Jac_vol[iquad];
+            cell_matrix_L_times_matrix_M_integral += matrix_L_times_matrix_M * quad_weights[iquad] * det_Jac[iquad];
+            cell_matrix_M_times_matrix_M_integral += matrix_M_times_matrix_M * quad_weights[iquad] * det_Jac[iquad];
         }
         // get the mean
         const real cell_volume = this->pde_model_double->cellwise_volume[cell_index];
@@ -44,11 +44,67 @@ public:
 
 protected:
     /// Update the cellwise volume and polynomial degree
+    /** The volumes are those integrated by update_cellwise_mean_quantities_metric_terms(). */
     void update_cellwise_volume_and_poly_degree();
 
     /// Update the cellwise mean quantities
     virtual void update_cellwise_mean_quantities();
 
+    /// Number of extra 1D quadrature points used to integrate the cellwise mean quantities
+    const unsigned int cellwise_mean_quantities_overintegration;
+
+    /// Builds the quadrature and 1D operators used to compute the cellwise mean quantities.
+    /** The operators only depend on max_degree, the grid degree and the overintegration,
+     *  so they are built on the first call and only rebuilt if the grid degree changes.
+     */
+    void build_cellwise_mean_quantities_operators();
+
+    /// Updates the metric terms at the mean quantities quadrature nodes of the locally relevant cells.
+    /** The metric terms are only recomputed if the grid nodes or the number of cells changed
+     *  since the last update, such that a fixed grid builds them once for the whole simulation.
+     *  The cell volumes are always integrated from the metric Jacobian determinant, while the metric terms themselves
+     *  are only stored if store_cellwise_mean_quantities_metric_terms is set, since their storage scales with
+     *  the number of cells times (max_degree+1+overintegration)^dim.
+     *  Returns true if the metric terms were recomputed.
+     */
+    bool update_cellwise_mean_quantities_metric_terms();
+
+    /// Flag to store the metric terms used by update_cellwise_mean_quantities(); set by the models that need them
+    bool store_cellwise_mean_quantities_metric_terms;
+
+    /// Quadrature used to compute the cellwise mean quantities
+    dealii::Quadrature<dim> mean_quantities_quadrature;
+    /// 1D quadrature used to build the sum-factorized mean quantities operators
+    dealii::Quadrature<1> mean_quantities_quadrature_1D;
+    /// Grid degree used to build the mean quantities operators; zero if not built yet
+    unsigned int mean_quantities_grid_degree;
+
+    /// Solution basis functions and gradients at the mean quantities quadrature nodes
+    std::unique_ptr<OPERATOR::basis_functions<dim,2*dim>> mean_quantities_soln_basis;
+    /// Mapping shape functions at the grid nodes and at the mean quantities quadrature nodes
+    std::unique_ptr<OPERATOR::mapping_shape_functions<dim,2*dim>> mean_quantities_mapping_basis;
+    /// Projection onto the Legendre basis from the mean quantities quadrature nodes
+    std::unique_ptr<OPERATOR::vol_projection_operator<dim,2*dim>> mean_quantities_legendre_projection_oper;
+    /// Legendre basis functions and gradients at the mean quantities quadrature nodes
+    std::unique_ptr<OPERATOR::basis_functions<dim,2*dim>> mean_quantities_legendre_basis;
+
+    /// Cell volumes integrated with the metric Jacobian determinant, indexed by active cell index
+    std::vector<real> mean_quantities_cell_volume;
+    /// Determinant of the metric Jacobian at the mean quantities quadrature nodes, indexed by active cell index
+    std::vector<std::vector<real>> mean_quantities_det_Jac;
+    /// Metric cofactor matrix at the mean quantities quadrature nodes, indexed by active cell index
+    std::vector<dealii::Tensor<2,dim,std::vector<real>>> mean_quantities_metric_cofactor;
+    /// Grid nodes used to compute the stored mean quantities metric terms
+    dealii::LinearAlgebra::distributed::Vector<double> volume_nodes_mean_quantities;
+
+    /// Interpolates the solution coefficients of a cell and its physical gradient to the mean quantities quadrature nodes
+    void interpolate_to_mean_quantities_quadrature(
+        const dealii::types::global_dof_index                      cell_index,
+        OPERATOR::basis_functions<dim,2*dim>                       &basis,
+        const std::vector<real>                                    &coeff,
+        std::vector<real>                                          &values_at_q,
+        dealii::Tensor<1,dim,std::vector<real>>                    &gradient_at_q);
+
     using DGBase<dim,nspecies,real,MeshType>::pcout; ///< Parallel std::cout that only outputs on mpi_rank==0
     
 }; // end of DGStrongLES class
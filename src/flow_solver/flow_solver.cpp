@@ -26,9 +26,9 @@ FlowSolver<dim, nspecies, nstate>::FlowSolver(
 : FlowSolverBase()
 , flow_solver_case(flow_solver_case_input)
 , parameter_handler(parameter_handler_input)
-, mpi_communicator(MPI_COMM_WORLD)
-, mpi_rank(dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD))
-, n_mpi(dealii::Utilities::MPI::n_mpi_processes(MPI_COMM_WORLD))
+, mpi_communicator(parameters_input->mpi_communicator)
+, mpi_rank(dealii::Utilities::MPI::this_mpi_process(parameters_input->mpi_communicator))
+, n_mpi(dealii::Utilities::MPI::n_mpi_processes(parameters_input->mpi_communicator))
 , pcout(std::cout, mpi_rank==0)
 , all_param(*parameters_input)
 , flow_solver_param(all_param.flow_solver_param)
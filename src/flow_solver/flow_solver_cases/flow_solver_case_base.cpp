@@ -7,9 +7,9 @@ template<int dim, int nspecies, int nstate>
 FlowSolverCaseBase<dim, nspecies, nstate>::FlowSolverCaseBase(const PHiLiP::Parameters::AllParameters *const parameters_input)
         : initial_condition_function(InitialConditionFactory<dim, nspecies, nstate, double>::create_InitialConditionFunction(parameters_input))
         , all_param(*parameters_input)
-        , mpi_communicator(MPI_COMM_WORLD)
-        , mpi_rank(dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD))
-        , n_mpi(dealii::Utilities::MPI::n_mpi_processes(MPI_COMM_WORLD))
+        , mpi_communicator(parameters_input->mpi_communicator)
+        , mpi_rank(dealii::Utilities::MPI::this_mpi_process(parameters_input->mpi_communicator))
+        , n_mpi(dealii::Utilities::MPI::n_mpi_processes(parameters_input->mpi_communicator))
         , pcout(std::cout, mpi_rank==0)
         {}
 
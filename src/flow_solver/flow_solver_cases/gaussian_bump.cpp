@@ -41,7 +41,7 @@ std::shared_ptr<Triangulation> GaussianBump<dim,nspecies,nstate>::generate_grid(
     } 
     else if constexpr(dim==3) {
         const std::string mesh_filename = this->all_param.flow_solver_param.input_mesh_filename+std::string(".msh");
-        std::shared_ptr<HighOrderGrid<dim,double>> gaussian_bump_mesh = read_gmsh<dim, dim> (mesh_filename, this->all_param.do_renumber_dofs);
+        std::shared_ptr<HighOrderGrid<dim,double>> gaussian_bump_mesh = read_gmsh<dim, dim> (mesh_filename, this->all_param.do_renumber_dofs, 0, true, this->mpi_communicator);
         return gaussian_bump_mesh->triangulation;
     }
     
@@ -53,7 +53,7 @@ void GaussianBump<dim,nspecies,nstate>::set_higher_order_grid(std::shared_ptr<DG
 {
     if constexpr(dim==3) {
         const std::string mesh_filename = this->all_param.flow_solver_param.input_mesh_filename+std::string(".msh");
-        std::shared_ptr<HighOrderGrid<dim,double>> gaussian_bump_mesh = read_gmsh<dim, dim> (mesh_filename, this->all_param.do_renumber_dofs);
+        std::shared_ptr<HighOrderGrid<dim,double>> gaussian_bump_mesh = read_gmsh<dim, dim> (mesh_filename, this->all_param.do_renumber_dofs, 0, true, this->mpi_communicator);
         dg->set_high_order_grid(gaussian_bump_mesh);
         for (int i=0; i<this->all_param.flow_solver_param.number_of_mesh_refinements; ++i) {
             dg->high_order_grid->refine_global();
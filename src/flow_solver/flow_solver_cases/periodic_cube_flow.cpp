@@ -41,7 +41,10 @@ std::shared_ptr<Triangulation> PeriodicCubeFlow<dim,nspecies,nstate>::generate_g
                 this->all_param.flow_solver_param.z_periodic_id_face_1, 
                 this->all_param.flow_solver_param.z_periodic_id_face_2,
                 this->all_param.flow_solver_param.mesh_reader_verbose_output,
-                this->all_param.do_renumber_dofs);
+                this->all_param.do_renumber_dofs,
+                0,
+                true,
+                this->mpi_communicator);
 
             return cube_mesh->triangulation;
         } 
@@ -37,7 +37,7 @@ Adjoint<dim, nspecies, nstate, real, MeshType>::Adjoint(
     triangulation(dg->triangulation),
     solution_coarse(dg->solution),
     adjoint_state(AdjointStateEnum::coarse),
-    mpi_communicator(MPI_COMM_WORLD),
+    mpi_communicator(_dg->mpi_communicator),
     pcout(std::cout, dealii::Utilities::MPI::this_mpi_process(mpi_communicator)==0)
 {
     // storing the original FE degree distribution
@@ -13,6 +13,7 @@
 
 #include <Sacado.hpp>
 #include <algorithm>
+#include <type_traits>
 #include <vector>
 
 #include "dg/dg_base_state.hpp"
@@ -317,26 +318,27 @@ real2 OutletPressureIntegral<dim,nspecies,nstate,real,MeshType>::evaluate_bounda
 }
 
 
+namespace {
+/// Creates the physics of the given AD type, and its model, from the parameters.
+template <int dim, int nspecies, int nstate, typename ADtype>
+std::shared_ptr<Physics::PhysicsBase<dim,nspecies,nstate,ADtype>> create_physics(const Parameters::AllParameters *const parameters)
+{
+    std::shared_ptr<Physics::ModelBase<dim,nspecies,nstate,ADtype>> model = Physics::ModelFactory<dim,nspecies,nstate,ADtype>::create_Model(parameters);
+    return Physics::PhysicsFactory<dim,nspecies,nstate,ADtype>::create_Physics(parameters,model);
+}
+} // namespace
+
 template <int dim, int nspecies, int nstate, typename real, typename MeshType>
 Functional<dim,nspecies,nstate,real,MeshType>::Functional(
     std::shared_ptr<DGBase<dim,nspecies,real,MeshType>> _dg,
     const bool                                 _uses_solution_values,
     const bool                                 _uses_solution_gradient)
-    : dg(_dg)
-    , d2IdWdW(std::make_shared<dealii::TrilinosWrappers::SparseMatrix>())
-    , d2IdWdX(std::make_shared<dealii::TrilinosWrappers::SparseMatrix>())
-    , d2IdXdX(std::make_shared<dealii::TrilinosWrappers::SparseMatrix>())
-    , uses_solution_values(_uses_solution_values)
-    , uses_solution_gradient(_uses_solution_gradient)
-    , pcout(std::cout, dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD)==0)
-{ 
-    using FadType = Sacado::Fad::DFad<real>;
-    using FadFadType = Sacado::Fad::DFad<FadType>;
-    std::shared_ptr<Physics::ModelBase<dim,nspecies,nstate,FadFadType>> model_fad_fad = Physics::ModelFactory<dim,nspecies,nstate,FadFadType>::create_Model(dg->all_parameters);
-    physics_fad_fad = Physics::PhysicsFactory<dim,nspecies,nstate,FadFadType>::create_Physics(dg->all_parameters,model_fad_fad);
-
-    init_vectors();
-}
+    : Functional(_dg,
+                 create_physics<dim,nspecies,nstate,Sacado::Fad::DFad<real>>(_dg->all_parameters),
+                 create_physics<dim,nspecies,nstate,Sacado::Fad::DFad<Sacado::Fad::DFad<real>>>(_dg->all_parameters),
+                 _uses_solution_values,
+                 _uses_solution_gradient)
+{ }
 template <int dim, int nspecies, int nstate, typename real, typename MeshType>
 void Functional<dim,nspecies,nstate,real,MeshType>::init_vectors()
 {
@@ -367,9 +369,29 @@ Functional<dim,nspecies,nstate,real,MeshType>::Functional(
     std::shared_ptr<PHiLiP::Physics::PhysicsBase<dim,nspecies,nstate,Sacado::Fad::DFad<Sacado::Fad::DFad<real>> >> _physics_fad_fad,
     const bool _uses_solution_values,
     const bool _uses_solution_gradient)
-    : Functional(_dg, _uses_solution_values, _uses_solution_gradient)
+    // The first-order physics created from the parameters might not match the provided one.
+    : Functional(_dg, nullptr, _physics_fad_fad, _uses_solution_values, _uses_solution_gradient)
+{ }
+
+template <int dim, int nspecies, int nstate, typename real, typename MeshType>
+Functional<dim,nspecies,nstate,real,MeshType>::Functional(
+    std::shared_ptr<PHiLiP::DGBase<dim,nspecies,real,MeshType>> _dg,
+    std::shared_ptr<PHiLiP::Physics::PhysicsBase<dim,nspecies,nstate,Sacado::Fad::DFad<real> >> _physics_fad,
+    std::shared_ptr<PHiLiP::Physics::PhysicsBase<dim,nspecies,nstate,Sacado::Fad::DFad<Sacado::Fad::DFad<real>> >> _physics_fad_fad,
+    const bool _uses_solution_values,
+    const bool _uses_solution_gradient)
+    : dg(_dg)
+    , d2IdWdW(std::make_shared<dealii::TrilinosWrappers::SparseMatrix>())
+    , d2IdWdX(std::make_shared<dealii::TrilinosWrappers::SparseMatrix>())
+    , d2IdXdX(std::make_shared<dealii::TrilinosWrappers::SparseMatrix>())
+    , uses_solution_values(_uses_solution_values)
+    , uses_solution_gradient(_uses_solution_gradient)
+    , pcout(std::cout, dealii::Utilities::MPI::this_mpi_process(_dg->mpi_communicator)==0)
 {
+    physics_fad = _physics_fad;
     physics_fad_fad = _physics_fad_fad;
+
+    init_vectors();
 }
 
 template <int dim, int nspecies, int nstate, typename real, typename MeshType>
@@ -393,7 +415,7 @@ void Functional<dim,nspecies,nstate,real,MeshType>::allocate_dIdX(dealii::Linear
     dealii::DoFTools::extract_locally_relevant_dofs(dg->high_order_grid->dof_handler_grid, locally_relevant_dofs);
     ghost_dofs = locally_relevant_dofs;
     ghost_dofs.subtract_set(locally_owned_dofs);
-    dIdX.reinit(locally_owned_dofs, ghost_dofs, MPI_COMM_WORLD);
+    dIdX.reinit(locally_owned_dofs, ghost_dofs, dg->mpi_communicator);
 }
 
 template <int dim, int nspecies, int nstate, typename real, typename MeshType>
@@ -402,7 +424,7 @@ void Functional<dim,nspecies,nstate,real,MeshType>::allocate_derivatives(const b
     if (compute_dIdW) {
         // allocating the vector
         dealii::IndexSet locally_owned_dofs = dg->dof_handler.locally_owned_dofs();
-        dIdw.reinit(locally_owned_dofs, MPI_COMM_WORLD);
+        dIdw.reinit(locally_owned_dofs, dg->mpi_communicator);
     }
     if (compute_dIdX) {
         allocate_dIdX(dIdX);
@@ -412,21 +434,21 @@ void Functional<dim,nspecies,nstate,real,MeshType>::allocate_derivatives(const b
             dealii::SparsityPattern sparsity_pattern_d2IdWdX = dg->get_d2RdWdX_sparsity_pattern ();
             const dealii::IndexSet &row_parallel_partitioning_d2IdWdX = dg->locally_owned_dofs;
             const dealii::IndexSet &col_parallel_partitioning_d2IdWdX = dg->high_order_grid->locally_owned_dofs_grid;
-            d2IdWdX->reinit(row_parallel_partitioning_d2IdWdX, col_parallel_partitioning_d2IdWdX, sparsity_pattern_d2IdWdX, MPI_COMM_WORLD);
+            d2IdWdX->reinit(row_parallel_partitioning_d2IdWdX, col_parallel_partitioning_d2IdWdX, sparsity_pattern_d2IdWdX, dg->mpi_communicator);
         }
 
         {
             dealii::SparsityPattern sparsity_pattern_d2IdWdW = dg->get_d2RdWdW_sparsity_pattern ();
             const dealii::IndexSet &row_parallel_partitioning_d2IdWdW = dg->locally_owned_dofs;
             const dealii::IndexSet &col_parallel_partitioning_d2IdWdW = dg->locally_owned_dofs;
-            d2IdWdW->reinit(row_parallel_partitioning_d2IdWdW, col_parallel_partitioning_d2IdWdW, sparsity_pattern_d2IdWdW, MPI_COMM_WORLD);
+            d2IdWdW->reinit(row_parallel_partitioning_d2IdWdW, col_parallel_partitioning_d2IdWdW, sparsity_pattern_d2IdWdW, dg->mpi_communicator);
         }
 
         {
             dealii::SparsityPattern sparsity_pattern_d2IdXdX = dg->get_d2RdXdX_sparsity_pattern ();
             const dealii::IndexSet &row_parallel_partitioning_d2IdXdX = dg->high_order_grid->locally_owned_dofs_grid;
             const dealii::IndexSet &col_parallel_partitioning_d2IdXdX = dg->high_order_grid->locally_owned_dofs_grid;
-            d2IdXdX->reinit(row_parallel_partitioning_d2IdXdX, col_parallel_partitioning_d2IdXdX, sparsity_pattern_d2IdXdX, MPI_COMM_WORLD);
+            d2IdXdX->reinit(row_parallel_partitioning_d2IdXdX, col_parallel_partitioning_d2IdXdX, sparsity_pattern_d2IdXdX, dg->mpi_communicator);
         }
     }
 }
@@ -499,6 +521,39 @@ void Functional<dim,nspecies,nstate,real,MeshType>::set_derivatives(
     AssertDimension(i_derivative, n_total_indep);
 }
 
+template <int dim, int nspecies, int nstate, typename real, typename MeshType>
+void Functional<dim,nspecies,nstate,real,MeshType>::set_derivatives(
+    const bool compute_dIdW, const bool compute_dIdX, const bool compute_d2I,
+    const Sacado::Fad::DFad<real> volume_local_sum,
+    std::vector<dealii::types::global_dof_index> cell_soln_dofs_indices,
+    std::vector<dealii::types::global_dof_index> cell_metric_dofs_indices)
+{
+    Assert(!compute_d2I, dealii::ExcMessage("Second derivatives require FadFadType."));
+    (void) compute_d2I; // Not used apart from assert.
+
+    const unsigned int n_total_indep = volume_local_sum.size();
+    (void) n_total_indep; // Not used apart from assert.
+    const unsigned int n_soln_dofs_cell = cell_soln_dofs_indices.size();
+    const unsigned int n_metric_dofs_cell = cell_metric_dofs_indices.size();
+    unsigned int i_derivative = 0;
+
+    if (compute_dIdW) {
+        std::vector<real> local_dIdw(n_soln_dofs_cell);
+        for(unsigned int idof = 0; idof < n_soln_dofs_cell; ++idof){
+            local_dIdw[idof] = volume_local_sum.dx(i_derivative++);
+        }
+        dIdw.add(cell_soln_dofs_indices, local_dIdw);
+    }
+    if (compute_dIdX) {
+        std::vector<real> local_dIdX(n_metric_dofs_cell);
+        for(unsigned int idof = 0; idof < n_metric_dofs_cell; ++idof){
+            local_dIdX[idof] = volume_local_sum.dx(i_derivative++);
+        }
+        dIdX.add(cell_metric_dofs_indices, local_dIdX);
+    }
+    AssertDimension(i_derivative, n_total_indep);
+}
+
 template <int dim, int nspecies, int nstate, typename real, typename MeshType>
 template <typename real2>
 real2 Functional<dim, nspecies, nstate, real, MeshType>::evaluate_volume_cell_functional(
@@ -648,6 +703,20 @@ real Functional<dim,nspecies,nstate,real,MeshType>::evaluate_boundary_cell_funct
     return evaluate_boundary_cell_functional<real>(physics, boundary_id, soln_coeff, fe_solution, coords_coeff, fe_metric, face_number, fquadrature);
 }
 
+template <int dim, int nspecies, int nstate, typename real, typename MeshType>
+Sacado::Fad::DFad<real> Functional<dim,nspecies,nstate,real,MeshType>::evaluate_boundary_cell_functional(
+    const Physics::PhysicsBase<dim,nspecies,nstate,Sacado::Fad::DFad<real>> &physics,
+    const unsigned int boundary_id,
+    const std::vector< Sacado::Fad::DFad<real> > &soln_coeff,
+    const dealii::FESystem<dim> &fe_solution,
+    const std::vector< Sacado::Fad::DFad<real> > &coords_coeff,
+    const dealii::FESystem<dim> &fe_metric,
+    const unsigned int face_number,
+    const dealii::Quadrature<dim-1> &fquadrature) const
+{
+    return evaluate_boundary_cell_functional<Sacado::Fad::DFad<real>>(physics, boundary_id, soln_coeff, fe_solution, coords_coeff, fe_metric, face_number, fquadrature);
+}
+
 template <int dim, int nspecies, int nstate, typename real, typename MeshType>
 Sacado::Fad::DFad<Sacado::Fad::DFad<real>> Functional<dim,nspecies,nstate,real,MeshType>::evaluate_boundary_cell_functional(
     const Physics::PhysicsBase<dim,nspecies,nstate,Sacado::Fad::DFad<Sacado::Fad::DFad<real>>> &physics,
@@ -674,6 +743,18 @@ real Functional<dim,nspecies,nstate,real,MeshType>::evaluate_volume_cell_functio
     return evaluate_volume_cell_functional<real>(physics, soln_coeff, fe_solution, coords_coeff, fe_metric, volume_quadrature);
 }
 
+template <int dim, int nspecies, int nstate, typename real, typename MeshType>
+Sacado::Fad::DFad<real> Functional<dim,nspecies,nstate,real,MeshType>::evaluate_volume_cell_functional(
+    const Physics::PhysicsBase<dim,nspecies,nstate,Sacado::Fad::DFad<real>> &physics_fad,
+    const std::vector< Sacado::Fad::DFad<real> > &soln_coeff,
+    const dealii::FESystem<dim> &fe_solution,
+    const std::vector< Sacado::Fad::DFad<real> > &coords_coeff,
+    const dealii::FESystem<dim> &fe_metric,
+    const dealii::Quadrature<dim> &volume_quadrature) const
+{
+    return evaluate_volume_cell_functional<Sacado::Fad::DFad<real>>(physics_fad, soln_coeff, fe_solution, coords_coeff, fe_metric, volume_quadrature);
+}
+
 template <int dim, int nspecies, int nstate, typename real, typename MeshType>
 Sacado::Fad::DFad<Sacado::Fad::DFad<real>> Functional<dim,nspecies,nstate,real,MeshType>::evaluate_volume_cell_functional(
     const Physics::PhysicsBase<dim,nspecies,nstate,Sacado::Fad::DFad<Sacado::Fad::DFad<real>>> &physics_fad_fad,
@@ -792,26 +873,19 @@ void Functional<dim,nspecies,nstate,real,MeshType>::need_compute(bool &compute_v
 }
 
 template <int dim, int nspecies, int nstate, typename real, typename MeshType>
-real Functional<dim, nspecies, nstate, real, MeshType>::evaluate_functional(
+template <typename ADtype>
+real Functional<dim, nspecies, nstate, real, MeshType>::evaluate_local_functional(
+    const Physics::PhysicsBase<dim,nspecies,nstate,ADtype> &physics_ad,
     const bool compute_dIdW,
     const bool compute_dIdX,
     const bool compute_d2I)
 {
     using FadType = Sacado::Fad::DFad<real>;
     using FadFadType = Sacado::Fad::DFad<FadType>;
-
-    bool actually_compute_value = true;
-    bool actually_compute_dIdW = compute_dIdW;
-    bool actually_compute_dIdX = compute_dIdX;
-    bool actually_compute_d2I  = compute_d2I;
-
-    pcout << "Evaluating functional... ";
-    need_compute(actually_compute_value, actually_compute_dIdW, actually_compute_dIdX, actually_compute_d2I);
-    pcout << std::endl;
-
-    if (!actually_compute_value && !actually_compute_dIdW && !actually_compute_dIdX && !actually_compute_d2I) {
-        return current_functional_value;
-    }
+    static_assert(std::is_same<ADtype,FadType>::value || std::is_same<ADtype,FadFadType>::value,
+                  "Cells are evaluated with either FadType or FadFadType.");
+    constexpr bool second_order = std::is_same<ADtype,FadFadType>::value;
+    Assert(second_order || !compute_d2I, dealii::ExcMessage("Second derivatives require FadFadType."));
 
     // Returned value
     real local_functional = 0.0;
@@ -820,30 +894,19 @@ real Functional<dim, nspecies, nstate, real, MeshType>::evaluate_functional(
     const dealii::FESystem<dim,dim> &fe_metric = dg->high_order_grid->fe_system;
     const unsigned int n_metric_dofs_cell = fe_metric.dofs_per_cell;
     std::vector<dealii::types::global_dof_index> cell_metric_dofs_indices(n_metric_dofs_cell);
+    std::vector<ADtype> coords_coeff(n_metric_dofs_cell);
 
     // setup it mostly the same as evaluating the value (with exception that local solution is also AD)
     const unsigned int max_dofs_per_cell = dg->dof_handler.get_fe_collection().max_dofs_per_cell();
     std::vector<dealii::types::global_dof_index> cell_soln_dofs_indices(max_dofs_per_cell);
-    std::vector<FadFadType> soln_coeff(max_dofs_per_cell); // for obtaining the local derivatives (to be copied back afterwards)
-    std::vector<real>   local_dIdw(max_dofs_per_cell);
-
-    std::vector<real>   local_dIdX(n_metric_dofs_cell);
-
-    const auto mapping = (*(dg->high_order_grid->mapping_fe_field));
-    dealii::hp::MappingCollection<dim> mapping_collection(mapping);
-
-    dealii::hp::FEFaceValues<dim,dim> fe_values_collection_face  (mapping_collection, dg->fe_collection, dg->face_quadrature_collection,   this->face_update_flags);
+    std::vector<ADtype> soln_coeff(max_dofs_per_cell); // for obtaining the local derivatives (to be copied back afterwards)
 
-    allocate_derivatives(actually_compute_dIdW, actually_compute_dIdX, actually_compute_d2I);
-
-    dg->solution.update_ghost_values();
     auto metric_cell = dg->high_order_grid->dof_handler_grid.begin_active();
     auto soln_cell = dg->dof_handler.begin_active();
     for( ; soln_cell != dg->dof_handler.end(); ++soln_cell, ++metric_cell) {
         if(!soln_cell->is_locally_owned()) continue;
 
         // setting up the volume integration
-        // const unsigned int i_mapp = 0;
         const unsigned int i_fele = soln_cell->active_fe_index();
         const unsigned int i_quad = i_fele;
 
@@ -856,47 +919,45 @@ real Functional<dim, nspecies, nstate, real, MeshType>::evaluate_functional(
 
         // Get metric coefficients
         metric_cell->get_dof_indices (cell_metric_dofs_indices);
-        std::vector< FadFadType > coords_coeff(n_metric_dofs_cell);
-        for (unsigned int idof = 0; idof < n_metric_dofs_cell; ++idof) {
-            coords_coeff[idof] = dg->high_order_grid->volume_nodes[cell_metric_dofs_indices[idof]];
-        }
 
         // Setup automatic differentiation
         unsigned int n_total_indep = 0;
-        if (actually_compute_dIdW || actually_compute_d2I) n_total_indep += n_soln_dofs_cell;
-        if (actually_compute_dIdX || actually_compute_d2I) n_total_indep += n_metric_dofs_cell;
+        if (compute_dIdW || compute_d2I) n_total_indep += n_soln_dofs_cell;
+        if (compute_dIdX || compute_d2I) n_total_indep += n_metric_dofs_cell;
         unsigned int i_derivative = 0;
         for(unsigned int idof = 0; idof < n_soln_dofs_cell; ++idof) {
             const real val = dg->solution[cell_soln_dofs_indices[idof]];
             soln_coeff[idof] = val;
-            if (actually_compute_dIdW || actually_compute_d2I) soln_coeff[idof].diff(i_derivative++, n_total_indep);
+            if (compute_dIdW || compute_d2I) soln_coeff[idof].diff(i_derivative++, n_total_indep);
         }
         for (unsigned int idof = 0; idof < n_metric_dofs_cell; ++idof) {
             const real val = dg->high_order_grid->volume_nodes[cell_metric_dofs_indices[idof]];
             coords_coeff[idof] = val;
-            if (actually_compute_dIdX || actually_compute_d2I) coords_coeff[idof].diff(i_derivative++, n_total_indep);
+            if (compute_dIdX || compute_d2I) coords_coeff[idof].diff(i_derivative++, n_total_indep);
         }
         AssertDimension(i_derivative, n_total_indep);
-        if (actually_compute_d2I) {
-            unsigned int i_derivative = 0;
-            for(unsigned int idof = 0; idof < n_soln_dofs_cell; ++idof) {
-                const real val = dg->solution[cell_soln_dofs_indices[idof]];
-                soln_coeff[idof].val() = val;
-                soln_coeff[idof].val().diff(i_derivative++, n_total_indep);
-            }
-            for (unsigned int idof = 0; idof < n_metric_dofs_cell; ++idof) {
-                const real val = dg->high_order_grid->volume_nodes[cell_metric_dofs_indices[idof]];
-                coords_coeff[idof].val() = val;
-                coords_coeff[idof].val().diff(i_derivative++, n_total_indep);
+        if constexpr (second_order) {
+            if (compute_d2I) {
+                unsigned int i_derivative = 0;
+                for(unsigned int idof = 0; idof < n_soln_dofs_cell; ++idof) {
+                    const real val = dg->solution[cell_soln_dofs_indices[idof]];
+                    soln_coeff[idof].val() = val;
+                    soln_coeff[idof].val().diff(i_derivative++, n_total_indep);
+                }
+                for (unsigned int idof = 0; idof < n_metric_dofs_cell; ++idof) {
+                    const real val = dg->high_order_grid->volume_nodes[cell_metric_dofs_indices[idof]];
+                    coords_coeff[idof].val() = val;
+                    coords_coeff[idof].val().diff(i_derivative++, n_total_indep);
+                }
+                AssertDimension(i_derivative, n_total_indep);
             }
         }
-        AssertDimension(i_derivative, n_total_indep);
 
         // Get quadrature point on reference cell
         const dealii::Quadrature<dim> &volume_quadrature = dg->volume_quadrature_collection[i_quad];
 
         // Evaluate integral on the cell volume
-        FadFadType volume_local_sum = evaluate_volume_cell_functional(*physics_fad_fad, soln_coeff, fe_solution, coords_coeff, fe_metric, volume_quadrature);
+        ADtype volume_local_sum = evaluate_volume_cell_functional(physics_ad, soln_coeff, fe_solution, coords_coeff, fe_metric, volume_quadrature);
 
         // next looping over the faces of the cell checking for boundary elements
         for(unsigned int iface = 0; iface < dealii::GeometryInfo<dim>::faces_per_cell; ++iface){
@@ -906,68 +967,58 @@ real Functional<dim, nspecies, nstate, real, MeshType>::evaluate_functional(
 
                 const unsigned int boundary_id = face->boundary_id();
 
-                //fe_values_collection_face.reinit(soln_cell, iface, i_quad, i_mapp, i_fele);
-                //const dealii::FEFaceValues<dim,dim> &fe_values_face = fe_values_collection_face.get_present_fe_values();
-                //volume_local_sum += this->evaluate_cell_boundary(*physics_fad_fad, boundary_id, fe_values_face, soln_coeff);
-                volume_local_sum += this->evaluate_boundary_cell_functional(*physics_fad_fad, boundary_id, soln_coeff, fe_solution, coords_coeff, fe_metric, iface, dg->face_quadrature_collection[i_quad]);
+                volume_local_sum += this->evaluate_boundary_cell_functional(physics_ad, boundary_id, soln_coeff, fe_solution, coords_coeff, fe_metric, iface, dg->face_quadrature_collection[i_quad]);
             }
 
         }
 
-        local_functional += volume_local_sum.val().val();
-        // now getting the values and adding them to the derivaitve vector
-
-        i_derivative = 0;
-        if (actually_compute_dIdW) {
-            local_dIdw.resize(n_soln_dofs_cell);
-            for(unsigned int idof = 0; idof < n_soln_dofs_cell; ++idof){
-                local_dIdw[idof] = volume_local_sum.dx(i_derivative++).val();
-            }
-            dIdw.add(cell_soln_dofs_indices, local_dIdw);
-        }
-        if (actually_compute_dIdX) {
-            local_dIdX.resize(n_metric_dofs_cell);
-            for(unsigned int idof = 0; idof < n_metric_dofs_cell; ++idof){
-                local_dIdX[idof] = volume_local_sum.dx(i_derivative++).val();
-            }
-            dIdX.add(cell_metric_dofs_indices, local_dIdX);
+        if constexpr (second_order) {
+            local_functional += volume_local_sum.val().val();
+        } else {
+            local_functional += volume_local_sum.val();
         }
-        if (actually_compute_dIdW || actually_compute_dIdX) AssertDimension(i_derivative, n_total_indep);
-        if (actually_compute_d2I) {
-            std::vector<real> dWidW(n_soln_dofs_cell);
-            std::vector<real> dWidX(n_metric_dofs_cell);
-            std::vector<real> dXidX(n_metric_dofs_cell);
-
-            i_derivative = 0;
-            for (unsigned int idof=0; idof<n_soln_dofs_cell; ++idof) {
-                unsigned int j_derivative = 0;
-                const FadType dWi = volume_local_sum.dx(i_derivative++);
-                for (unsigned int jdof=0; jdof<n_soln_dofs_cell; ++jdof) {
-                    dWidW[jdof] = dWi.dx(j_derivative++);
-                }
-                d2IdWdW->add(cell_soln_dofs_indices[idof], cell_soln_dofs_indices, dWidW);
 
-                for (unsigned int jdof=0; jdof<n_metric_dofs_cell; ++jdof) {
-                    dWidX[jdof] = dWi.dx(j_derivative++);
-                }
-                d2IdWdX->add(cell_soln_dofs_indices[idof], cell_metric_dofs_indices, dWidX);
-            }
+        // now getting the values and adding them to the derivative vector and matrices
+        // A cell contribution independent of the coefficients does not carry any derivative.
+        if (volume_local_sum.size() == 0) volume_local_sum.resizeAndZero(n_total_indep);
+        set_derivatives(compute_dIdW, compute_dIdX, compute_d2I, volume_local_sum, cell_soln_dofs_indices, cell_metric_dofs_indices);
+    }
+
+    return local_functional;
+}
+
+template <int dim, int nspecies, int nstate, typename real, typename MeshType>
+real Functional<dim, nspecies, nstate, real, MeshType>::evaluate_functional(
+    const bool compute_dIdW,
+    const bool compute_dIdX,
+    const bool compute_d2I)
+{
+    bool actually_compute_value = true;
+    bool actually_compute_dIdW = compute_dIdW;
+    bool actually_compute_dIdX = compute_dIdX;
+    bool actually_compute_d2I  = compute_d2I;
 
-            for (unsigned int idof=0; idof<n_metric_dofs_cell; ++idof) {
+    pcout << "Evaluating functional... ";
+    need_compute(actually_compute_value, actually_compute_dIdW, actually_compute_dIdX, actually_compute_d2I);
+    pcout << std::endl;
 
-                const FadType dXi = volume_local_sum.dx(i_derivative++);
+    if (!actually_compute_value && !actually_compute_dIdW && !actually_compute_dIdX && !actually_compute_d2I) {
+        return current_functional_value;
+    }
 
-                unsigned int j_derivative = n_soln_dofs_cell;
-                for (unsigned int jdof=0; jdof<n_metric_dofs_cell; ++jdof) {
-                    dXidX[jdof] = dXi.dx(j_derivative++);
-                }
-                d2IdXdX->add(cell_metric_dofs_indices[idof], cell_metric_dofs_indices, dXidX);
-            }
-        }
-        AssertDimension(i_derivative, n_total_indep);
+    allocate_derivatives(actually_compute_dIdW, actually_compute_dIdX, actually_compute_d2I);
+
+    dg->solution.update_ghost_values();
+
+    // Only the Hessian needs the nested FadFadType; first derivatives are seeded with FadType.
+    real local_functional;
+    if (!actually_compute_d2I && physics_fad && uses_first_order_ad()) {
+        local_functional = evaluate_local_functional(*physics_fad, actually_compute_dIdW, actually_compute_dIdX, actually_compute_d2I);
+    } else {
+        local_functional = evaluate_local_functional(*physics_fad_fad, actually_compute_dIdW, actually_compute_dIdX, actually_compute_d2I);
     }
 
-    current_functional_value = dealii::Utilities::MPI::sum(local_functional, MPI_COMM_WORLD);
+    current_functional_value = dealii::Utilities::MPI::sum(local_functional, dg->mpi_communicator);
     // compress before the return
     if (actually_compute_dIdW) dIdw.compress(dealii::VectorOperation::add);
     if (actually_compute_dIdX) dIdX.compress(dealii::VectorOperation::add);
@@ -995,7 +1046,7 @@ dealii::LinearAlgebra::distributed::Vector<real> Functional<dim,nspecies,nstate,
 
     // allocating the vector
     dealii::IndexSet locally_owned_dofs = dg.dof_handler.locally_owned_dofs();
-    dIdw.reinit(locally_owned_dofs, MPI_COMM_WORLD);
+    dIdw.reinit(locally_owned_dofs, dg.mpi_communicator);
 
     // setup it mostly the same as evaluating the value (with exception that local solution is also AD)
     const unsigned int max_dofs_per_cell = dg.dof_handler.get_fe_collection().max_dofs_per_cell();
@@ -1321,7 +1372,7 @@ FunctionalFactory<dim,nspecies,nstate,real,MeshType>::create_Functional(
             }
         }else if(functional_type == FunctionalTypeEnum::solution_integral) {
             std::shared_ptr< DGBaseState<dim,nspecies,nstate,double,MeshType>> dg_state = std::dynamic_pointer_cast< DGBaseState<dim,nspecies,nstate,double, MeshType>>(dg);
-            return std::make_shared<SolutionIntegral<dim,nspecies,nstate,real,MeshType>>(dg,dg_state->pde_physics_fad_fad,true,false);
+            return std::make_shared<SolutionIntegral<dim,nspecies,nstate,real,MeshType>>(dg,dg_state->pde_physics_fad,dg_state->pde_physics_fad_fad,true,false);
         }else if(functional_type == FunctionalTypeEnum::outlet_pressure_integral) {
             if constexpr (dim==2 && nstate==dim+2){
                 return std::make_shared<OutletPressureIntegral<dim,nspecies,nstate,real,MeshType>>(dg, true,false);
@@ -34,6 +34,11 @@ namespace PHiLiP {
   * are to be overridden in the derived class. Also computes the functional derivatives which 
   * are involved in the computation of the adjoint. If derivatives are needed, the Sacado
   * versions of these functions must also be defined.
+  *
+  * Second derivatives are obtained by evaluating the cells with FadFadType. When only first
+  * derivatives are requested, derived classes that also define the FadType integrands and
+  * return true in uses_first_order_ad() are evaluated with FadType instead, which avoids
+  * the nested derivative arrays of FadFadType.
   */
 #if PHILIP_DIM==1
 template <int dim, int nspecies, int nstate, typename real, typename MeshType = dealii::Triangulation<dim>>
@@ -52,6 +57,11 @@ public:
 protected:
     /// Physics that should correspond to the one in DGBase
     std::shared_ptr<Physics::PhysicsBase<dim,nspecies,nstate,FadFadType>> physics_fad_fad;
+    /// First-order physics used when only dIdW and dIdX are requested.
+    /** Null if the physics has only been provided as FadFadType, in which case all the
+     *  derivatives are evaluated with FadFadType.
+     */
+    std::shared_ptr<Physics::PhysicsBase<dim,nspecies,nstate,FadType>> physics_fad;
 
 public:
     /// Destructor
@@ -68,9 +78,19 @@ public:
         const bool _uses_solution_gradient = true);
 
     /** Constructor.
-     *  Uses provided physics instead of creating a new one based on DGBase */
+     *  Uses provided physics instead of creating a new one based on DGBase.
+     *  No first-order physics is created, so all the derivatives are evaluated with FadFadType. */
+    Functional(
+        std::shared_ptr<PHiLiP::DGBase<dim,nspecies,real,MeshType>> _dg,
+        std::shared_ptr<PHiLiP::Physics::PhysicsBase<dim,nspecies,nstate,Sacado::Fad::DFad<Sacado::Fad::DFad<real>> >> _physics_fad_fad,
+        const bool _uses_solution_values = true,
+        const bool _uses_solution_gradient = true);
+
+    /** Constructor.
+     *  Uses provided first and second-order physics instead of creating new ones based on DGBase */
     Functional(
         std::shared_ptr<PHiLiP::DGBase<dim,nspecies,real,MeshType>> _dg,
+        std::shared_ptr<PHiLiP::Physics::PhysicsBase<dim,nspecies,nstate,Sacado::Fad::DFad<real> >> _physics_fad,
         std::shared_ptr<PHiLiP::Physics::PhysicsBase<dim,nspecies,nstate,Sacado::Fad::DFad<Sacado::Fad::DFad<real>> >> _physics_fad_fad,
         const bool _uses_solution_values = true,
         const bool _uses_solution_gradient = true);
@@ -176,6 +196,32 @@ protected:
         std::vector<dealii::types::global_dof_index> cell_soln_dofs_indices,
         std::vector<dealii::types::global_dof_index> cell_metric_dofs_indices);
 
+    /// Set the first derivative vectors from a FadType cell functional.
+    /** Same as above without the second derivatives, which FadType does not carry. */
+    void set_derivatives(
+        const bool compute_dIdW, const bool compute_dIdX, const bool compute_d2I,
+        const Sacado::Fad::DFad<real> volume_local_sum,
+        std::vector<dealii::types::global_dof_index> cell_soln_dofs_indices,
+        std::vector<dealii::types::global_dof_index> cell_metric_dofs_indices);
+
+    /// Whether first derivatives may be evaluated with FadType.
+    /** Derived classes return true once they define the FadType integrands. Otherwise the
+     *  FadType integrands would return the default 0, so the FadFadType evaluation is kept.
+     */
+    virtual bool uses_first_order_ad() const { return false; }
+
+    /// Loops over the locally owned cells and returns the local sum of the functional.
+    /** The cell coefficients are seeded with @p ADtype, which is FadType when only dIdW and
+     *  dIdX are requested, and FadFadType when d2I is requested. The derivatives are added
+     *  to dIdw, dIdX and the d2I matrices, which are compressed by the caller.
+     */
+    template <typename ADtype>
+    real evaluate_local_functional(
+        const Physics::PhysicsBase<dim,nspecies,nstate,ADtype> &physics_ad,
+        const bool compute_dIdW,
+        const bool compute_dIdX,
+        const bool compute_d2I);
+
 protected:
     /// Checks which derivatives actually need to be recomputed.
     /** If the stored solution and mesh are the same as the one used to previously
@@ -202,6 +248,15 @@ protected:
         const dealii::FESystem<dim> &fe_metric,
         const dealii::Quadrature<dim> &volume_quadrature) const;
     
+    /// Corresponding FadType function to evaluate a cell's volume functional.
+    virtual Sacado::Fad::DFad<real> evaluate_volume_cell_functional(
+        const Physics::PhysicsBase<dim,nspecies,nstate,Sacado::Fad::DFad<real>> &physics_fad,
+        const std::vector< Sacado::Fad::DFad<real> > &soln_coeff,
+        const dealii::FESystem<dim> &fe_solution,
+        const std::vector< Sacado::Fad::DFad<real> > &coords_coeff,
+        const dealii::FESystem<dim> &fe_metric,
+        const dealii::Quadrature<dim> &volume_quadrature) const;
+
     /// Corresponding FadFadType function to evaluate a cell's volume functional.
     virtual Sacado::Fad::DFad<Sacado::Fad::DFad<real>> evaluate_volume_cell_functional(
         const Physics::PhysicsBase<dim,nspecies,nstate,Sacado::Fad::DFad<Sacado::Fad::DFad<real>>> &physics_fad_fad,
@@ -252,6 +307,17 @@ protected:
         const unsigned int face_number,
         const dealii::Quadrature<dim-1> &face_quadrature) const;
     
+    /// Corresponding FadType function to evaluate a cell's boundary functional.
+    virtual Sacado::Fad::DFad<real> evaluate_boundary_cell_functional(
+        const Physics::PhysicsBase<dim,nspecies,nstate,Sacado::Fad::DFad<real>> &physics_fad,
+        const unsigned int boundary_id,
+        const std::vector< Sacado::Fad::DFad<real> > &soln_coeff,
+        const dealii::FESystem<dim> &fe_solution,
+        const std::vector< Sacado::Fad::DFad<real> > &coords_coeff,
+        const dealii::FESystem<dim> &fe_metric,
+        const unsigned int face_number,
+        const dealii::Quadrature<dim-1> &face_quadrature) const;
+
     /// Corresponding FadFadType function to evaluate a cell's boundary functional.
     virtual Sacado::Fad::DFad<Sacado::Fad::DFad<real>> evaluate_boundary_cell_functional(
         const Physics::PhysicsBase<dim,nspecies,nstate,Sacado::Fad::DFad<Sacado::Fad::DFad<real>>> &physics_fad_fad,
@@ -272,6 +338,14 @@ protected:
         const std::array<dealii::Tensor<1,dim,real>,nstate> &/*soln_grad_at_q*/) const
     { return (real) 0.0; }
 
+    /// Virtual function for Sacado computation of cell volume functional term and first derivatives
+    /** Used only if uses_first_order_ad() is true. If not overriden returns 0. */
+    virtual FadType evaluate_volume_integrand(
+        const PHiLiP::Physics::PhysicsBase<dim,nspecies,nstate,FadType> &/*physics*/,
+        const dealii::Point<dim,FadType> &/*phys_coord*/, const std::array<FadType,nstate> &/*soln_at_q*/,
+        const std::array<dealii::Tensor<1,dim,FadType>,nstate> &/*soln_grad_at_q*/) const
+    { return (FadType) 0.0; }
+
     /// Virtual function for Sacado computation of cell volume functional term and derivatives
     /** Used only in the computation of evaluate_dIdw(). If not overriden returns 0. */
     virtual FadFadType evaluate_volume_integrand(
@@ -290,6 +364,17 @@ protected:
         const std::array<real,nstate> &/*soln_at_q*/,
         const std::array<dealii::Tensor<1,dim,real>,nstate> &/*soln_grad_at_q*/) const
     { return (real) 0.0; }
+
+    /// Virtual function for Sacado computation of cell boundary functional term and first derivatives
+    /** Used only if uses_first_order_ad() is true. If not overriden returns 0. */
+    virtual FadType evaluate_boundary_integrand(
+        const PHiLiP::Physics::PhysicsBase<dim,nspecies,nstate,FadType> &/*physics*/,
+        const unsigned int /*boundary_id*/,
+        const dealii::Point<dim,FadType> &/*phys_coord*/,
+        const dealii::Tensor<1,dim,FadType> &/*normal*/,
+        const std::array<FadType,nstate> &/*soln_at_q*/,
+        const std::array<dealii::Tensor<1,dim,FadType>,nstate> &/*soln_grad_at_q*/) const
+    { return (FadType) 0.0; }
     
     /// Virtual function for Sacado computation of cell boundary functional term and derivatives
     /** Used only in the computation of evaluate_dIdw(). If not overriden returns 0. */
@@ -357,6 +442,15 @@ public:
         return evaluate_volume_integrand<>(physics, phys_coord, soln_at_q, soln_grad_at_q);
     }
 
+    FadType evaluate_volume_integrand(
+        const PHiLiP::Physics::PhysicsBase<dim,nspecies,nstate,FadType> &physics,
+        const dealii::Point<dim,FadType> &                      phys_coord,
+        const std::array<FadType,nstate> &                      soln_at_q,
+        const std::array<dealii::Tensor<1,dim,FadType>,nstate> &soln_grad_at_q) const override
+    {
+        return evaluate_volume_integrand<>(physics, phys_coord, soln_at_q, soln_grad_at_q);
+    }
+
     FadFadType evaluate_volume_integrand(
         const PHiLiP::Physics::PhysicsBase<dim,nspecies,nstate,FadFadType> &physics,
         const dealii::Point<dim,FadFadType> &                      phys_coord,
@@ -367,6 +461,9 @@ public:
     }
 
 protected:
+    /// Cells are evaluated with FadType when only first derivatives are requested.
+    bool uses_first_order_ad() const override { return true; }
+
     /// Norm exponent value
     const double normLp;
 };
@@ -419,6 +516,17 @@ public:
         return evaluate_boundary_integrand<>(physics, boundary_id, phys_coord, normal, soln_at_q, soln_grad_at_q);
     }
 
+    FadType evaluate_boundary_integrand(
+        const PHiLiP::Physics::PhysicsBase<dim,nspecies,nstate,FadType> &physics,
+        const unsigned int                                      boundary_id,
+        const dealii::Point<dim,FadType> &                      phys_coord,
+        const dealii::Tensor<1,dim,FadType> &                   normal,
+        const std::array<FadType,nstate> &                      soln_at_q,
+        const std::array<dealii::Tensor<1,dim,FadType>,nstate> &soln_grad_at_q) const override
+    {
+        return evaluate_boundary_integrand<>(physics, boundary_id, phys_coord, normal, soln_at_q, soln_grad_at_q);
+    }
+
     FadFadType evaluate_boundary_integrand(
         const PHiLiP::Physics::PhysicsBase<dim,nspecies,nstate,FadFadType> &physics,
         const unsigned int                                         boundary_id,
@@ -431,6 +539,9 @@ public:
     }
 
 protected:
+    /// Cells are evaluated with FadType when only first derivatives are requested.
+    bool uses_first_order_ad() const override { return true; }
+
     /// Norm exponent value
     const double              normLp;
     /// Ids of selected boundaries for integration
@@ -618,6 +729,15 @@ public:
         return evaluate_volume_integrand<>(physics, phys_coord, soln_at_q, soln_grad_at_q);
     }
 
+    FadType evaluate_volume_integrand(
+        const PHiLiP::Physics::PhysicsBase<dim,nspecies,nstate,FadType> &physics,
+        const dealii::Point<dim,FadType> &                      phys_coord,
+        const std::array<FadType,nstate> &                      soln_at_q,
+        const std::array<dealii::Tensor<1,dim,FadType>,nstate> &soln_grad_at_q) const override
+    {
+        return evaluate_volume_integrand<>(physics, phys_coord, soln_at_q, soln_grad_at_q);
+    }
+
     FadFadType evaluate_volume_integrand(
         const PHiLiP::Physics::PhysicsBase<dim,nspecies,nstate,FadFadType> &physics,
         const dealii::Point<dim,FadFadType> &                      phys_coord,
@@ -628,6 +748,9 @@ public:
     }
 
 protected:
+    /// Cells are evaluated with FadType when only first derivatives are requested.
+    bool uses_first_order_ad() const override { return true; }
+
     /// Norm exponent value
     const double normLp;
 };
@@ -681,6 +804,17 @@ public:
         return evaluate_boundary_integrand<>(physics, boundary_id, phys_coord, normal, soln_at_q, soln_grad_at_q);
     }
 
+    FadType evaluate_boundary_integrand(
+        const PHiLiP::Physics::PhysicsBase<dim,nspecies,nstate,FadType> &physics,
+        const unsigned int                                      boundary_id,
+        const dealii::Point<dim,FadType> &                      phys_coord,
+        const dealii::Tensor<1,dim,FadType> &                   normal,
+        const std::array<FadType,nstate> &                      soln_at_q,
+        const std::array<dealii::Tensor<1,dim,FadType>,nstate> &soln_grad_at_q) const override
+    {
+        return evaluate_boundary_integrand<>(physics, boundary_id, phys_coord, normal, soln_at_q, soln_grad_at_q);
+    }
+
     FadFadType evaluate_boundary_integrand(
         const PHiLiP::Physics::PhysicsBase<dim,nspecies,nstate,FadFadType> &physics,
         const unsigned int                                         boundary_id,
@@ -693,6 +827,9 @@ public:
     }
 
 protected:
+    /// Cells are evaluated with FadType when only first derivatives are requested.
+    bool uses_first_order_ad() const override { return true; }
+
     /// Norm exponent value
     const double              normLp;
     /// Ids of selected boundaries for integration
@@ -716,10 +853,11 @@ public:
     /// Constructor
     SolutionIntegral(
             std::shared_ptr<PHiLiP::DGBase<dim,nspecies,real, MeshType>> dg_input,
+            std::shared_ptr<PHiLiP::Physics::PhysicsBase<dim,nspecies,nstate,FadType>> _physics_fad,
             std::shared_ptr<PHiLiP::Physics::PhysicsBase<dim,nspecies,nstate,FadFadType>> _physics_fad_fad,
             const bool uses_solution_values = true,
             const bool uses_solution_gradient = false)
-            : PHiLiP::Functional<dim,nspecies,nstate,real,MeshType>(dg_input,_physics_fad_fad,uses_solution_values,uses_solution_gradient)
+            : PHiLiP::Functional<dim,nspecies,nstate,real,MeshType>(dg_input,_physics_fad,_physics_fad_fad,uses_solution_values,uses_solution_gradient)
     {}
 
     /// Templated volume integrand
@@ -740,6 +878,16 @@ public:
         return evaluate_volume_integrand<>(physics, phys_coord, soln_at_q, soln_grad_at_q);
     }
 
+    /// Non-template functions to override the template classes
+    FadType evaluate_volume_integrand(
+            const PHiLiP::Physics::PhysicsBase<dim,nspecies,nstate,FadType> &physics,
+            const dealii::Point<dim,FadType> &phys_coord,
+            const std::array<FadType,nstate> &soln_at_q,
+            const std::array<dealii::Tensor<1,dim,FadType>,nstate> &soln_grad_at_q) const override
+    {
+        return evaluate_volume_integrand<>(physics, phys_coord, soln_at_q, soln_grad_at_q);
+    }
+
     /// Non-template functions to override the template classes
     FadFadType evaluate_volume_integrand(
             const PHiLiP::Physics::PhysicsBase<dim,nspecies,nstate,FadFadType> &physics,
@@ -749,6 +897,10 @@ public:
     {
         return evaluate_volume_integrand<>(physics, phys_coord, soln_at_q, soln_grad_at_q);
     }
+
+protected:
+    /// Cells are evaluated with FadType when only first derivatives are requested.
+    bool uses_first_order_ad() const override { return true; }
 };
 
 /** Boundary integral for the Euler Gaussian bump.
@@ -787,6 +939,18 @@ public:
         return evaluate_boundary_integrand<>(physics, boundary_id, phys_coord, normal, soln_at_q, soln_grad_at_q);
     }
 
+    /// Non-template functions to override the template classes
+    FadType evaluate_boundary_integrand(
+            const PHiLiP::Physics::PhysicsBase<dim,nspecies,nstate,FadType> &physics,
+            const unsigned int                                      boundary_id,
+            const dealii::Point<dim,FadType> &                      phys_coord,
+            const dealii::Tensor<1,dim,FadType> &                   normal,
+            const std::array<FadType,nstate> &                      soln_at_q,
+            const std::array<dealii::Tensor<1,dim,FadType>,nstate> &soln_grad_at_q) const override
+    {
+        return evaluate_boundary_integrand<>(physics, boundary_id, phys_coord, normal, soln_at_q, soln_grad_at_q);
+    }
+
     /// Non-template functions to override the template classes
     FadFadType evaluate_boundary_integrand(
             const PHiLiP::Physics::PhysicsBase<dim,nspecies,nstate,FadFadType> &physics,
@@ -798,6 +962,10 @@ public:
     {
         return evaluate_boundary_integrand<>(physics, boundary_id, phys_coord, normal, soln_at_q, soln_grad_at_q);
     }
+
+protected:
+    /// Cells are evaluated with FadType when only first derivatives are requested.
+    bool uses_first_order_ad() const override { return true; }
 };
 
 /// Factory class to construct default functional types
@@ -132,6 +132,25 @@ public:
             soln_grad_at_q);
     }
 
+    /// Virtual function for Sacado computation of cell boundary functional term and first derivatives
+    /** Used when only dIdW or dIdX are requested. */
+    virtual FadType evaluate_boundary_integrand(
+        const PHiLiP::Physics::PhysicsBase<dim,nspecies,nstate,FadType> &physics,
+        const unsigned int boundary_id,
+        const dealii::Point<dim,FadType> &phys_coord,
+        const dealii::Tensor<1,dim,FadType> &normal,
+        const std::array<FadType,nstate> &soln_at_q,
+        const std::array<dealii::Tensor<1,dim,FadType>,nstate> &soln_grad_at_q) const override
+    {
+        return evaluate_boundary_integrand<FadType>(
+            physics,
+            boundary_id,
+            phys_coord,
+            normal,
+            soln_at_q,
+            soln_grad_at_q);
+    }
+
     /// Virtual function for Sacado computation of cell boundary functional term and derivatives
     /** Used only in the computation of evaluate_dIdw(). If not overriden returns 0. */
     virtual FadFadType evaluate_boundary_integrand(
@@ -168,7 +187,9 @@ public:
         const std::array<dealii::Tensor<1,dim,FadFadType>,nstate> &/*soln_grad_at_q*/) const
     { return (FadFadType) 0.0; }
 
-
+protected:
+    /// Cells are evaluated with FadType when only first derivatives are requested.
+    bool uses_first_order_ad() const override { return true; }
 };
 
 // template <int dim, int nspecies, int nstate, typename real>
@@ -8,6 +8,7 @@
 #include "grid_refinement/size_field.h"
 #include "grid_refinement/reconstruct_poly.h"
 #include "grid_refinement/field.h"
+#include "grid_refinement/metric_refinement.h"
 
 #include "grid_refinement_continuous.h"
 
@@ -122,11 +123,23 @@ void GridRefinement_Continuous<dim,nspecies,nstate,real,MeshType>::refine_grid()
     using RefinementTypeEnum = PHiLiP::Parameters::GridRefinementParam::RefinementType;
     RefinementTypeEnum refinement_type = this->grid_refinement_param.refinement_type;
 
+    using OutputType = PHiLiP::Parameters::GridRefinementParam::OutputType;
+    OutputType output_type = this->grid_refinement_param.output_type;
+
     // store the previous solution space
 
     // compute the necessary size fields
     field();
 
+    // adapting the current grid directly, the solution is transfered instead of rezeroed
+    if(refinement_type == RefinementTypeEnum::h && output_type == OutputType::in_process){
+        refine_grid_in_process();
+
+        // increase the count
+        this->iteration++;
+        return;
+    }
+
     // generate a new grid
     if(refinement_type == RefinementTypeEnum::h){
         refine_grid_h();
@@ -264,6 +277,51 @@ void GridRefinement_Continuous<dim,nspecies,nstate,real,MeshType>::refine_grid_g
     gridin.read_msh(f);
 }
 
+template <int dim, int nspecies, int nstate, typename real, typename MeshType>
+void GridRefinement_Continuous<dim,nspecies,nstate,real,MeshType>::refine_grid_in_process()
+{
+    // setting up the solution transfer
+    dealii::LinearAlgebra::distributed::Vector<double> solution_old(this->dg->solution);
+    solution_old.update_ghost_values();
+
+    // anisotropic splitting is not availible with p4est
+    constexpr bool mesh_allows_anisotropic = 
+        (dim == 1) || !std::is_same_v<MeshType, dealii::parallel::distributed::Triangulation<dim>>;
+    
+    // flagging the cells towards the target metric of the h_field
+    MetricRefinement<dim,real>::flag_cells(
+        *(this->tria),
+        this->h_field->get_inverse_quadratic_metric_vector(),
+        mesh_allows_anisotropic && this->grid_refinement_param.anisotropic);
+
+    this->tria->prepare_coarsening_and_refinement();
+
+    using VectorType       = typename dealii::LinearAlgebra::distributed::Vector<double>;
+    using DoFHandlerType   = typename dealii::DoFHandler<dim>;
+    using SolutionTransfer = typename MeshTypeHelper<MeshType>::template SolutionTransfer<dim,VectorType,DoFHandlerType>;
+
+    SolutionTransfer solution_transfer(this->dg->dof_handler);
+    solution_transfer.prepare_for_coarsening_and_refinement(solution_old);
+
+    this->dg->high_order_grid->prepare_for_coarsening_and_refinement();
+
+    this->tria->execute_coarsening_and_refinement();
+    this->dg->high_order_grid->execute_coarsening_and_refinement();
+
+    // transfering the solution from solution_old
+    this->dg->allocate_system();
+    this->dg->solution.zero_out_ghosts();
+
+    if constexpr (std::is_same_v<typename dealii::SolutionTransfer<dim,VectorType,DoFHandlerType>, 
+                                 decltype(solution_transfer)>){
+        solution_transfer.interpolate(solution_old, this->dg->solution);
+    }else{
+        solution_transfer.interpolate(this->dg->solution);
+    }
+
+    this->dg->solution.update_ghost_values();
+}
+
 template <int dim, int nspecies, int nstate, typename real, typename MeshType>
 void GridRefinement_Continuous<dim,nspecies,nstate,real,MeshType>::refine_grid_msh()
 {
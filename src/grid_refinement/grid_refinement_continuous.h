@@ -24,7 +24,8 @@ namespace GridRefinement {
   * for quads method, or in the anisotropic case using the BAMG mesh generator recombined via 
   * Blossom-Quad to form a final all-quad output mesh. Tools for writing to an experimental external
   * mesh generator based on \f$L_p\f$-CVT energy minimization to produce an anisotropic all-quad mesh
-  * have also been included.
+  * have also been included. Alternatively, the current grid can be adapted in-process towards the target
+  * metric through refinement and coarsening with solution transfer (see refine_grid_in_process).
   * 
   * Note: While there are some placeholder functions have been included and certain functionality support
   *       polynomial distributions, \f$p\f$ and \f$hp\f$ adaptation have not been fully implemented or tested.
@@ -271,6 +272,15 @@ protected:
       */ 
     void refine_grid_msh();
 
+    /// Adapts the current grid to the target metric without an external mesh generator
+    /** Flags the cells of the current triangulation for refinement or coarsening based on their lengths
+      * measured in the target metric of h_field (see metric_refinement.h), using anisotropic cuts where 
+      * supported by the mesh type. The solution is then transfered to the adapted grid, avoiding the
+      * file i/o, external process and restart from a zero solution of the GMSH remeshing cycle.
+      * Selected with output_type = in_process.
+      */ 
+    void refine_grid_in_process();
+
     // scheduling of complexity growth
 
     /// Evaluates the current complexity of the mesh
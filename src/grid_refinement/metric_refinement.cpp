@@ -0,0 +1,89 @@
+#include <cmath>
+
+#include <deal.II/grid/tria_accessor.h>
+#include <deal.II/grid/tria_iterator.h>
+
+#include "metric_refinement.h"
+
+namespace PHiLiP {
+
+namespace GridRefinement {
+
+template <int dim, typename real>
+void MetricRefinement<dim,real>::flag_cells(
+    dealii::Triangulation<dim> &                             tria,
+    const std::vector<dealii::SymmetricTensor<2,dim,real>> & metric,
+    const bool                                               allow_anisotropic)
+{
+    AssertDimension(metric.size(), tria.n_active_cells());
+
+    // lengths for which splitting or merging brings the chord closer to unit length (on log scale)
+    const real refine_length  = sqrt(2.0);
+    const real coarsen_length = 1.0/sqrt(2.0);
+
+    for(auto cell = tria.begin_active(); cell != tria.end(); ++cell){
+        if(!cell->is_locally_owned()) continue;
+
+        const std::array<real,dim> length = get_metric_chord_lengths(cell, metric[cell->active_cell_index()]);
+
+        real max_length  = 0.0;
+        real mean_length = 1.0;
+        for(unsigned int i = 0; i < dim; ++i){
+            max_length   = std::max(max_length, length[i]);
+            mean_length *= length[i];
+        }
+        mean_length = pow(mean_length, 1.0/dim);
+
+        if(allow_anisotropic){
+            // cutting each of the axes which are too long in the metric
+            dealii::RefinementCase<dim> refinement_case = dealii::RefinementCase<dim>::no_refinement;
+            for(unsigned int i = 0; i < dim; ++i)
+                if(length[i] > refine_length)
+                    refinement_case = refinement_case | dealii::RefinementCase<dim>::cut_axis(i);
+
+            if(refinement_case != dealii::RefinementCase<dim>::no_refinement){
+                cell->set_refine_flag(refinement_case);
+            }else if(max_length < coarsen_length){
+                cell->set_coarsen_flag();
+            }
+        }else{
+            // isotropic splitting based on the target element density
+            if(mean_length > refine_length){
+                cell->set_refine_flag();
+            }else if(mean_length < coarsen_length){
+                cell->set_coarsen_flag();
+            }
+        }
+    }
+}
+
+template <int dim, typename real>
+std::array<real,dim> MetricRefinement<dim,real>::get_metric_chord_lengths(
+    const typename dealii::Triangulation<dim>::active_cell_iterator & cell,
+    const dealii::SymmetricTensor<2,dim,real> &                       metric)
+{
+    // chord i joins the centers of the faces normal to the i^th reference axis
+    // vertices on the positive side of the i^th axis have the i^th bit of their index set
+    std::array<dealii::Tensor<1,dim,real>,dim> chord;
+    for(unsigned int vertex = 0; vertex < dealii::GeometryInfo<dim>::vertices_per_cell; ++vertex)
+        for(unsigned int i = 0; i < dim; ++i)
+            if((vertex >> i) % 2 == 0){
+                chord[i] -= cell->vertex(vertex);
+            }else{
+                chord[i] += cell->vertex(vertex);
+            }
+
+    std::array<real,dim> length;
+    for(unsigned int i = 0; i < dim; ++i){
+        chord[i] /= pow(2.0, dim-1);
+        length[i] = sqrt(chord[i] * (metric * chord[i]));
+    }
+
+    return length;
+}
+
+template class MetricRefinement <PHILIP_DIM, double>;
+
+} // namespace GridRefinement
+
+} // namespace PHiLiP
@@ -0,0 +1,60 @@
+#ifndef __METRIC_REFINEMENT_H__
+#define __METRIC_REFINEMENT_H__
+
+#include <array>
+#include <vector>
+
+#include <deal.II/base/symmetric_tensor.h>
+#include <deal.II/base/tensor.h>
+
+#include <deal.II/grid/tria.h>
+
+namespace PHiLiP {
+
+namespace GridRefinement {
+
+/// Metric Refinement Static Class
+/** In-process alternative to remeshing with an external mesh generator. Instead of writing the target
+  * Riemannian metric to file and generating a new conforming mesh, the cells of the current triangulation 
+  * are flagged for refinement or coarsening so that their chords (opposing face-center to face-center) 
+  * move towards unit length in the target metric. The length of a chord \f$\boldsymbol{c}_i\f$ in the metric 
+  * \f$\mathcal{M}\f$ is given by
+  * 
+  * \f[
+  *     l_{\mathcal{M}}(\boldsymbol{c}_i) = \sqrt{\boldsymbol{c}_i^T \mathcal{M} \boldsymbol{c}_i}
+  * \f]
+  * 
+  * where a chord is cut when this length exceeds \f$\sqrt{2}\f$ (halving it then brings it closer to unit length)
+  * and a cell is coarsened when all of its lengths are below \f$1/\sqrt{2}\f$. As each cell can only be split
+  * or merged once per call, the metric is approached over successive adaptation cycles. However, the existing
+  * triangulation and solution are kept, allowing for a direct solution transfer instead of a restart on a new mesh.
+  * 
+  * Note: Anisotropic cuts are only possible on meshes which support them (not on p4est based 
+  *       dealii::parallel::distributed::Triangulation). Otherwise the cells are refined isotropically
+  *       based on the geometric mean of their metric lengths, matching the target element density.
+  */ 
+template <int dim, typename real>
+class MetricRefinement
+{
+public:
+    /// Flags the locally owned cells of the triangulation for refinement or coarsening towards the target metric
+    /** Here metric is the quadratic Riemannian metric (as used with BAMG) of each active cell, indexed by 
+      * active_cell_index. Only sets the flags, the caller is responsible for the solution transfer and call to 
+      * execute_coarsening_and_refinement.
+      */ 
+    static void flag_cells(
+        dealii::Triangulation<dim> &                             tria,
+        const std::vector<dealii::SymmetricTensor<2,dim,real>> & metric,
+        const bool                                               allow_anisotropic);
+
+    /// Gets the length of each of the cell chords measured in the metric
+    static std::array<real,dim> get_metric_chord_lengths(
+        const typename dealii::Triangulation<dim>::active_cell_iterator & cell,
+        const dealii::SymmetricTensor<2,dim,real> &                       metric);
+};
+
+} // namespace GridRefinement
+
+} // namespace PHiLiP
+
+#endif // __METRIC_REFINEMENT_H__
@@ -1,3 +1,5 @@
+#include <cmath>
+
 #include <deal.II/hp/fe_collection.h>
 #include <deal.II/hp/fe_values.h>
 #include <deal.II/hp/mapping_collection.h>
@@ -7,6 +9,7 @@
 #include <deal.II/base/tensor.h>
 #include <deal.II/base/polynomial.h>
 #include <deal.II/base/polynomial_space.h>
+#include <deal.II/lac/full_matrix.h>
 #include <deal.II/grid/grid_tools.h>
 
 #include "reconstruct_poly.h"
@@ -28,9 +31,36 @@ ReconstructPoly<dim,nspecies,nstate,real>::ReconstructPoly(
             fe_collection(fe_collection),
             quadrature_collection(quadrature_collection),
             update_flags(update_flags),
-            norm_type(NormType::H1)
+            norm_type(NormType::H1),
+            fe_values_collection(mapping_collection, fe_collection, quadrature_collection, update_flags),
+            n_factorization_cache_hits(0),
+            n_factorization_cache_misses(0)
 {
     reinit(dof_handler.get_triangulation().n_active_cells());
+
+    // cached factorizations are only valid for the current cells and vertices
+    const dealii::Triangulation<dim> &tria = dof_handler.get_triangulation();
+    triangulation_change_connection = tria.signals.any_change.connect([this]() { factorization_cache.clear(); });
+    mesh_movement_connection = tria.signals.mesh_movement.connect([this]() { factorization_cache.clear(); });
+}
+
+template <int dim, int nspecies, int nstate, typename real>
+ReconstructPoly<dim,nspecies,nstate,real>::~ReconstructPoly()
+{
+    triangulation_change_connection.disconnect();
+    mesh_movement_connection.disconnect();
+}
+
+template <int dim, int nspecies, int nstate, typename real>
+unsigned int ReconstructPoly<dim,nspecies,nstate,real>::get_n_factorization_cache_hits() const
+{
+    return n_factorization_cache_hits;
+}
+
+template <int dim, int nspecies, int nstate, typename real>
+unsigned int ReconstructPoly<dim,nspecies,nstate,real>::get_n_factorization_cache_misses() const
+{
+    return n_factorization_cache_misses;
 }
 
 template <int dim, int nspecies, int nstate, typename real>
@@ -62,12 +92,14 @@ void ReconstructPoly<dim,nspecies,nstate,real>::reconstruct_chord_derivative(
         0---+---1
     */
 
+    initialize_reconstruction();
+
     for(auto cell = dof_handler.begin_active(); cell != dof_handler.end(); ++cell){
         if(!cell->is_locally_owned()) continue;
 
         // generating the polynomial space
         unsigned int order = cell->active_fe_index()+rel_order;
-        dealii::PolynomialSpace<dim> poly_space(dealii::Polynomials::Monomial<double>::generate_complete_basis(order));
+        const dealii::PolynomialSpace<dim> &poly_space = get_polynomial_space(order);
 
         // getting the vector of polynomial coefficients from the p+1 expansion
         dealii::Vector<real> coeffs_non_hom = reconstruct_norm(
@@ -169,12 +201,14 @@ void ReconstructPoly<dim,nspecies,nstate,real>::reconstruct_directional_derivati
 {
     const real pi = atan(1)*4.0;
 
+    initialize_reconstruction();
+
     for(auto cell = dof_handler.begin_active(); cell != dof_handler.end(); ++cell){
         if(!cell->is_locally_owned()) continue;
 
         // generating the polynomial space
         unsigned int order = cell->active_fe_index()+rel_order;
-        dealii::PolynomialSpace<dim> poly_space(dealii::Polynomials::Monomial<double>::generate_complete_basis(order));
+        const dealii::PolynomialSpace<dim> &poly_space = get_polynomial_space(order);
 
         // getting the vector of polynomial coefficients from the p+1 expansion
         dealii::Vector<real> coeffs_non_hom = reconstruct_norm(
@@ -517,7 +551,7 @@ template <typename DoFCellAccessorType>
 dealii::Vector<real> ReconstructPoly<dim,nspecies,nstate,real>::reconstruct_norm(
     const NormType                                          norm_type,
     const DoFCellAccessorType &                             curr_cell,
-    const dealii::PolynomialSpace<dim>                      ps,
+    const dealii::PolynomialSpace<dim> &                    ps,
     const dealii::LinearAlgebra::distributed::Vector<real> &solution)
 {
 
@@ -549,213 +583,227 @@ template <int dim, int nspecies, int nstate, typename real>
 template <typename DoFCellAccessorType>
 dealii::Vector<real> ReconstructPoly<dim,nspecies,nstate,real>::reconstruct_H1_norm(
     const DoFCellAccessorType &                             curr_cell,
-    const dealii::PolynomialSpace<dim>                      ps,
+    const dealii::PolynomialSpace<dim> &                    ps,
     const dealii::LinearAlgebra::distributed::Vector<real> &solution)
 {
+    // <u,v>_{H^1(\Omega)} = \int_{\Omega} u*v + \sum_i^N {\partial_i u * \partial_i v} dx
+    return reconstruct_patch_norm(curr_cell, ps, solution, true);
+}
 
-    // center point of the current cell
-    dealii::Point<dim,real> center_point = curr_cell->center();
-
-    // things to be extracted
-    std::vector<std::array<real,nstate>>                       soln_at_q_vec;
-    std::vector<std::array<dealii::Tensor<1,dim,real>,nstate>> grad_at_q_vec; // for the H^1 norm
-    std::vector<dealii::Point<dim,real>>                       qpoint_vec;
-    std::vector<real>                                          JxW_vec;
-
-    // and keeping track of vector lengths
-    unsigned int n_vec = 0;
-
-    // fe_values
-    dealii::hp::FEValues<dim,dim> fe_values_collection(
-        mapping_collection,
-        fe_collection,
-        quadrature_collection,
-        update_flags);
-
-    // looping over the cell vector and extracting the soln, qpoint and JxW
-    // std::vector<DoFCellAccessorType> cell_patch = dealii::GridTools::get_patch_around_cell(curr_cell);
-    std::vector<DoFCellAccessorType> cell_patch = get_patch_around_dof_cell(curr_cell);
-    for(auto cell : cell_patch){
-        const unsigned int mapping_index = 0;
-        const unsigned int fe_index = cell->active_fe_index();
-        const unsigned int quad_index = fe_index; 
+template <int dim, int nspecies, int nstate, typename real>
+template <typename DoFCellAccessorType>
+dealii::Vector<real> ReconstructPoly<dim,nspecies,nstate,real>::reconstruct_L2_norm(
+    const DoFCellAccessorType &                             curr_cell,
+    const dealii::PolynomialSpace<dim> &                    ps,
+    const dealii::LinearAlgebra::distributed::Vector<real> &solution)
+{
+    // <u,v>_{L^2(\Omega)} = \int_{\Omega} u*v dx
+    return reconstruct_patch_norm(curr_cell, ps, solution, false);
+}
 
-        const unsigned int n_dofs = fe_collection[fe_index].n_dofs_per_cell();
-        const unsigned int n_quad = quadrature_collection[quad_index].size();
+template <int dim, int nspecies, int nstate, typename real>
+template <typename DoFCellAccessorType>
+dealii::Vector<real> ReconstructPoly<dim,nspecies,nstate,real>::reconstruct_patch_norm(
+    const DoFCellAccessorType &                             curr_cell,
+    const dealii::PolynomialSpace<dim> &                    ps,
+    const dealii::LinearAlgebra::distributed::Vector<real> &solution,
+    const bool                                              use_gradients)
+{
+    // center point of the current cell
+    const dealii::Point<dim,real> center_point = curr_cell->center();
 
-        fe_values_collection.reinit(cell, quad_index, mapping_index, fe_index);
-        const dealii::FEValues<dim,dim> &fe_values = fe_values_collection.get_present_fe_values();
+    // gathering the (cached) quadrature data of the patch
+    std::vector<DoFCellAccessorType> cell_patch = get_patch_around_dof_cell(curr_cell);
+    std::vector<const CellQuadratureData *> patch_data;
+    patch_data.reserve(cell_patch.size());
+    for(auto cell : cell_patch)
+        patch_data.push_back(&get_cell_quadrature_data(cell, solution, use_gradients));
 
-        std::vector<dealii::types::global_dof_index> dofs_indices(fe_values.dofs_per_cell);
-        cell->get_dof_indices(dofs_indices);
+    // number of polynomials in the space
+    const unsigned int n_poly = ps.n();
 
-        // looping over the quadrature points of this cell
-        std::array<real,nstate>                       soln_at_q;
-        std::array<dealii::Tensor<1,dim,real>,nstate> grad_at_q; 
-        for(unsigned int iquad = 0; iquad < n_quad; ++iquad){
-            soln_at_q.fill(0.0);
-            for(unsigned int istate = 0; istate < nstate; ++istate)
-                grad_at_q[istate] = 0.0;
-                        
-            // looping over the DoFS to get the solution value
-            for(unsigned int idof = 0; idof < n_dofs; ++idof){
-                const unsigned int istate = fe_values.get_fe().system_to_component_index(idof).first;
-                soln_at_q[istate] += solution[dofs_indices[idof]] * fe_values.shape_value_component(idof, iquad, istate);
-                grad_at_q[istate] += solution[dofs_indices[idof]] * fe_values.shape_grad_component(idof, iquad, istate);
+    // evaluating the polynomial space once per quadrature point,
+    // with the reference point moved to the center of the curr_cell
+    std::vector<std::vector<double>>                     values_at_q;
+    std::vector<std::vector<dealii::Tensor<1,dim>>>      grads_at_q;
+    std::vector<real>                                    JxW_vec;
+    std::vector<dealii::Tensor<2,dim>>                   grad_grads;
+    std::vector<dealii::Tensor<3,dim>>                   third_derivatives;
+    std::vector<dealii::Tensor<4,dim>>                   fourth_derivatives;
+
+    dealii::Vector<real> rhs(n_poly);
+    for(const CellQuadratureData *data : patch_data){
+        for(unsigned int iquad = 0; iquad < data->JxW.size(); ++iquad){
+            const dealii::Point<dim,real> point_q(data->qpoints[iquad] - center_point);
+
+            std::vector<double>                values(n_poly);
+            std::vector<dealii::Tensor<1,dim>> grads(use_gradients ? n_poly : 0);
+            ps.evaluate(point_q, values, grads, grad_grads, third_derivatives, fourth_derivatives);
+
+            // take inner product of \psi_i and u (solution)
+            // if multiple states, taking the sum over the different states
+            for(unsigned int i_poly = 0; i_poly < n_poly; ++i_poly){
+                for(unsigned int istate = 0; istate < nstate; ++istate){
+                    real val = values[i_poly] * data->soln_at_q[iquad][istate];
+                    if(use_gradients)
+                        val += grads[i_poly] * data->grad_at_q[iquad][istate];
+                    rhs[i_poly] += val * data->JxW[iquad];
+                }
             }
 
-            // moving the reference point to the center of the curr_cell
-            dealii::Tensor<1,dim,real> tensor_q = fe_values.quadrature_point(iquad) - center_point;
-            dealii::Point<dim,real> point_q(tensor_q);
-
-            // push back into the vectors
-            soln_at_q_vec.push_back(soln_at_q);
-            grad_at_q_vec.push_back(grad_at_q);
-            qpoint_vec.push_back(point_q);
-            JxW_vec.push_back(fe_values.JxW(iquad));
-            n_vec++;
+            values_at_q.push_back(std::move(values));
+            grads_at_q.push_back(std::move(grads));
+            JxW_vec.push_back(data->JxW[iquad]);
         }
     }
 
-    // number of polynomials in the space
-    const unsigned int n_poly = ps.n();
+    // patches with the same geometry and norm share the inverse of the reconstruction matrix
+    const std::vector<long long> key = get_patch_geometry_key(
+        ps.degree(),
+        use_gradients,
+        patch_data,
+        center_point,
+        curr_cell->diameter());
+
+    auto factorization = factorization_cache.find(key);
+    if(factorization != factorization_cache.end()){
+        ++n_factorization_cache_hits;
+    }else{
+        ++n_factorization_cache_misses;
 
-    // allocating the matrix and vector for the RHS
-    dealii::FullMatrix<real> mat(n_poly);
-    dealii::Vector<real>     rhs(n_poly);
-
-    // looping over to assemble the matrices
-    mat = 0.0;
-    for(unsigned int i_poly = 0; i_poly < n_poly; ++i_poly){
-        for(unsigned int j_poly = 0; j_poly < n_poly; ++j_poly){
-            // taking the inner product between \psi_i and \psi_j
-            // <u,v>_{H^1(\Omega)} = \int_{\Omega} u*v + \sum_i^N {\partial_i u * \partial_i v} dx
-            for(unsigned int i_vec = 0; i_vec < n_vec; ++i_vec)
-                mat.add(i_poly, j_poly, 
-                    ((ps.compute_value(i_poly, qpoint_vec[i_vec]) * ps.compute_value(j_poly, qpoint_vec[i_vec]))
-                    +(ps.compute_grad(i_poly, qpoint_vec[i_vec])  * ps.compute_grad(j_poly, qpoint_vec[i_vec])))
-                    *JxW_vec[i_vec]);
+        // looping over to assemble the (symmetric) matrix
+        dealii::FullMatrix<real> mat(n_poly);
+        for(unsigned int i_poly = 0; i_poly < n_poly; ++i_poly){
+            for(unsigned int j_poly = i_poly; j_poly < n_poly; ++j_poly){
+                // taking the inner product between \psi_i and \psi_j
+                real val = 0.0;
+                for(unsigned int i_vec = 0; i_vec < JxW_vec.size(); ++i_vec){
+                    real integrand = values_at_q[i_vec][i_poly] * values_at_q[i_vec][j_poly];
+                    if(use_gradients)
+                        integrand += grads_at_q[i_vec][i_poly] * grads_at_q[i_vec][j_poly];
+                    val += integrand * JxW_vec[i_vec];
+                }
+                mat(i_poly, j_poly) = val;
+                mat(j_poly, i_poly) = val;
+            }
         }
 
-        // take inner product of \psi_i and u (solution)
-        // if multiple states, taking the 2 norm of the different states
-        dealii::Vector<real> rhs_poly(nstate);
-        for(unsigned int istate = 0; istate < nstate; ++istate)
-            for(unsigned int i_vec = 0; i_vec < n_vec; ++i_vec)
-                rhs[i_poly] += ((ps.compute_value(i_poly, qpoint_vec[i_vec]) * soln_at_q_vec[i_vec][istate])
-                               +(ps.compute_grad(i_poly, qpoint_vec[i_vec]) * grad_at_q_vec[i_vec][istate]))
-                               *JxW_vec[i_vec];
+        mat.gauss_jordan();
+
+        if(factorization_cache.size() >= max_cached_factorizations)
+            factorization_cache.clear();
+        factorization = factorization_cache.emplace(key, std::move(mat)).first;
     }
 
     // solving the system
     dealii::Vector<real> coeffs(n_poly);
-
-    mat.gauss_jordan();
-    mat.vmult(coeffs, rhs);
+    factorization->second.vmult(coeffs, rhs);
 
     return coeffs;
 }
 
 template <int dim, int nspecies, int nstate, typename real>
-template <typename DoFCellAccessorType>
-dealii::Vector<real> ReconstructPoly<dim,nspecies,nstate,real>::reconstruct_L2_norm(
-    const DoFCellAccessorType &                             curr_cell,
-    const dealii::PolynomialSpace<dim>                      ps,
-    const dealii::LinearAlgebra::distributed::Vector<real> &solution)
+void ReconstructPoly<dim,nspecies,nstate,real>::initialize_reconstruction()
 {
-    // center point of the current cell
-    dealii::Point<dim,real> center_point = curr_cell->center();
-
-    // things to be extracted
-    std::vector<std::array<real,nstate>>                       soln_at_q_vec;
-    std::vector<dealii::Point<dim,real>>                       qpoint_vec;
-    std::vector<real>                                          JxW_vec;
-
-    // and keeping track of vector lengths
-    unsigned int n_vec = 0;
+    quadrature_data.clear();
+    quadrature_data.resize(dof_handler.get_triangulation().n_active_cells());
+    n_factorization_cache_hits   = 0;
+    n_factorization_cache_misses = 0;
+}
 
-    // fe_values
-    dealii::hp::FEValues<dim,dim> fe_values_collection(
-        mapping_collection,
-        fe_collection,
-        quadrature_collection,
-        update_flags);
+template <int dim, int nspecies, int nstate, typename real>
+template <typename DoFCellAccessorType>
+const typename ReconstructPoly<dim,nspecies,nstate,real>::CellQuadratureData & 
+ReconstructPoly<dim,nspecies,nstate,real>::get_cell_quadrature_data(
+    const DoFCellAccessorType &                             cell,
+    const dealii::LinearAlgebra::distributed::Vector<real> &solution,
+    const bool                                              use_gradients)
+{
+    CellQuadratureData &data = quadrature_data[cell->active_cell_index()];
+    if(!data.JxW.empty())
+        return data;
+
+    const unsigned int mapping_index = 0;
+    const unsigned int fe_index = cell->active_fe_index();
+    const unsigned int quad_index = fe_index; 
+
+    const unsigned int n_dofs = fe_collection[fe_index].n_dofs_per_cell();
+    const unsigned int n_quad = quadrature_collection[quad_index].size();
+
+    fe_values_collection.reinit(cell, quad_index, mapping_index, fe_index);
+    const dealii::FEValues<dim,dim> &fe_values = fe_values_collection.get_present_fe_values();
+
+    std::vector<dealii::types::global_dof_index> dofs_indices(fe_values.dofs_per_cell);
+    cell->get_dof_indices(dofs_indices);
+
+    data.qpoints.resize(n_quad);
+    data.JxW.resize(n_quad);
+    data.soln_at_q.resize(n_quad);
+    if(use_gradients)
+        data.grad_at_q.resize(n_quad);
+
+    // looping over the quadrature points of this cell
+    for(unsigned int iquad = 0; iquad < n_quad; ++iquad){
+        std::array<real,nstate> &soln_at_q = data.soln_at_q[iquad];
+        soln_at_q.fill(0.0);
+        if(use_gradients)
+            for(unsigned int istate = 0; istate < nstate; ++istate)
+                data.grad_at_q[iquad][istate] = 0.0;
+
+        // looping over the DoFS to get the solution value
+        for(unsigned int idof = 0; idof < n_dofs; ++idof){
+            const unsigned int istate = fe_values.get_fe().system_to_component_index(idof).first;
+            soln_at_q[istate] += solution[dofs_indices[idof]] * fe_values.shape_value_component(idof, iquad, istate);
+            if(use_gradients)
+                data.grad_at_q[iquad][istate] += solution[dofs_indices[idof]] * fe_values.shape_grad_component(idof, iquad, istate);
+        }
 
-    // looping over the cell vector and extracting the soln, qpoint and JxW
-    // std::vector<DoFCellAccessorType> cell_patch = dealii::GridTools::get_patch_around_cell(curr_cell);
-    std::vector<DoFCellAccessorType> cell_patch = get_patch_around_dof_cell(curr_cell);
-    for(auto cell : cell_patch){
-        const unsigned int mapping_index = 0;
-        const unsigned int fe_index = cell->active_fe_index();
-        const unsigned int quad_index = fe_index; 
-
-        const unsigned int n_dofs = fe_collection[fe_index].n_dofs_per_cell();
-        const unsigned int n_quad = quadrature_collection[quad_index].size();
-
-        fe_values_collection.reinit(cell, quad_index, mapping_index, fe_index);
-        const dealii::FEValues<dim,dim> &fe_values = fe_values_collection.get_present_fe_values();
-
-        std::vector<dealii::types::global_dof_index> dofs_indices(fe_values.dofs_per_cell);
-        cell->get_dof_indices(dofs_indices);
-
-        // looping over the quadrature points of this cell
-        std::array<real,nstate> soln_at_q;
-        for(unsigned int iquad = 0; iquad < n_quad; ++iquad){
-            soln_at_q.fill(0.0);
-                        
-            // looping over the DoFS to get the solution value
-            for(unsigned int idof = 0; idof < n_dofs; ++idof){
-                const unsigned int istate = fe_values.get_fe().system_to_component_index(idof).first;
-                soln_at_q[istate] += solution[dofs_indices[idof]] * fe_values.shape_value_component(idof, iquad, istate);
-            }
+        data.qpoints[iquad] = fe_values.quadrature_point(iquad);
+        data.JxW[iquad]     = fe_values.JxW(iquad);
+    }
 
-            // moving the reference point to the center of the curr_cell
-            dealii::Tensor<1,dim,real> tensor_q = fe_values.quadrature_point(iquad) - center_point;
-            dealii::Point<dim,real> point_q(tensor_q);
+    return data;
+}
 
-            // push back into the vectors
-            soln_at_q_vec.push_back(soln_at_q);
-            qpoint_vec.push_back(point_q);
-            JxW_vec.push_back(fe_values.JxW(iquad));
-            n_vec++;
-        }
-    }
+template <int dim, int nspecies, int nstate, typename real>
+const dealii::PolynomialSpace<dim> & ReconstructPoly<dim,nspecies,nstate,real>::get_polynomial_space(
+    const unsigned int order)
+{
+    auto poly_space = polynomial_spaces.find(order);
+    if(poly_space == polynomial_spaces.end())
+        poly_space = polynomial_spaces.emplace(
+            order, 
+            dealii::PolynomialSpace<dim>(dealii::Polynomials::Monomial<double>::generate_complete_basis(order))).first;
 
-    // number of polynomials in the space
-    const unsigned int n_poly = ps.n();
+    return poly_space->second;
+}
 
-    // allocating the matrix and vector for the RHS
-    dealii::FullMatrix<real> mat(n_poly);
-    dealii::Vector<real>     rhs(n_poly);
-
-    // looping over to assemble the matrices
-    mat = 0.0;
-    for(unsigned int i_poly = 0; i_poly < n_poly; ++i_poly){
-        for(unsigned int j_poly = 0; j_poly < n_poly; ++j_poly){
-            // taking the inner product between \psi_i and \psi_j
-            // <u,v>_{L^2(\Omega)} = \int_{\Omega} u*v dx
-            for(unsigned int i_vec = 0; i_vec < n_vec; ++i_vec)
-                mat.add(i_poly, j_poly, 
-                    (ps.compute_value(i_poly, qpoint_vec[i_vec]) * ps.compute_value(j_poly, qpoint_vec[i_vec]))
-                    *JxW_vec[i_vec]);
+template <int dim, int nspecies, int nstate, typename real>
+std::vector<long long> ReconstructPoly<dim,nspecies,nstate,real>::get_patch_geometry_key(
+    const unsigned int                                  order,
+    const bool                                          use_gradients,
+    const std::vector<const CellQuadratureData *> &     patch_data,
+    const dealii::Point<dim,real> &                     center_point,
+    const real                                          diameter) const
+{
+    // relative tolerance below which two patch geometries are considered equal
+    const real tolerance = 1e-10;
+    const real volume    = std::pow(diameter, dim);
+
+    std::vector<long long> key;
+    key.push_back(order);
+    key.push_back(use_gradients);
+    key.push_back(std::llround(std::log(diameter)/tolerance));
+    for(const CellQuadratureData *data : patch_data){
+        key.push_back(data->JxW.size());
+        for(unsigned int iquad = 0; iquad < data->JxW.size(); ++iquad){
+            for(int d = 0; d < dim; ++d)
+                key.push_back(std::llround((data->qpoints[iquad][d] - center_point[d])/(diameter*tolerance)));
+            key.push_back(std::llround(data->JxW[iquad]/(volume*tolerance)));
         }
-
-        // take inner product of \psi_i and u (solution)
-        // if multiple states, taking the 2 norm of the different states
-        dealii::Vector<real> rhs_poly(nstate);
-        for(unsigned int istate = 0; istate < nstate; ++istate)
-            for(unsigned int i_vec = 0; i_vec < n_vec; ++i_vec)
-                rhs[i_poly] += (ps.compute_value(i_poly, qpoint_vec[i_vec]) * soln_at_q_vec[i_vec][istate])
-                               *JxW_vec[i_vec];
     }
 
-    // solving the system
-    dealii::Vector<real> coeffs(n_poly);
-
-    mat.gauss_jordan();
-    mat.vmult(coeffs, rhs);
-
-    return coeffs;
+    return key;
 }
 
 // based on DEALII GridTools::get_patch_around_cell
@@ -4,6 +4,7 @@
 
 #include <deal.II/lac/la_parallel_vector.h>
 
+#include <deal.II/hp/fe_values.h>
 #include <deal.II/hp/mapping_collection.h>
 #include <deal.II/hp/q_collection.h>
 
@@ -14,6 +15,8 @@
 #include <deal.II/fe/fe.h>
 #include <deal.II/fe/mapping.h>
 
+#include <map>
+
 #include "physics/manufactured_solution.h"
 
 namespace PHiLiP {
@@ -47,6 +50,11 @@ std::array<unsigned int, dim> compute_index(
   * where the additional directional derivatives provide anisotropic information to the
   * remeshing process. After computation, the results can be extracted from the corresponding
   * derivative_value and derivative_direction fields.
+  *
+  * During a reconstruction, the quadrature data of each cell is evaluated once and shared by all the
+  * patches containing it, and patches with the same geometry relative to their center cell share the
+  * inverse of their reconstruction matrix. These inverses are kept for later reconstructions until the
+  * triangulation is refined or its vertices are moved.
   */ 
 template <int dim, int nspecies, int nstate, typename real>
 class ReconstructPoly
@@ -62,6 +70,10 @@ public:
         const dealii::UpdateFlags&                update_flags           ///< update flags for for volume fe
         );
 
+    /// Destructor
+    /** Disconnects from the triangulation signals. */
+    ~ReconstructPoly();
+
     /// Reinitialze the internal vectors 
     /** These vectors are used to store the obtained derivative
       * values and directions at each mesh element.
@@ -141,6 +153,12 @@ public:
         const unsigned int                                     rel_order   ///< Relative order of the approximation
         );
 
+    /// Number of patches whose inverted reconstruction matrix was found in the cache during the last reconstruction
+    unsigned int get_n_factorization_cache_hits() const;
+
+    /// Number of patches whose reconstruction matrix was assembled and inverted during the last reconstruction
+    unsigned int get_n_factorization_cache_misses() const;
+
     /// Constructs directional derivates based on the manufactured solution hessian
     /** For \f$p=2\f$ only, gets the exact directional derivative components using the spectral decomposition of the hessian:
       * 
@@ -203,7 +221,7 @@ private:
     dealii::Vector<real> reconstruct_norm(
         const NormType                                          norm_type,
         const DoFCellAccessorType &                             curr_cell,
-        const dealii::PolynomialSpace<dim>                      ps,
+        const dealii::PolynomialSpace<dim> &                    ps,
         const dealii::LinearAlgebra::distributed::Vector<real> &solution);
 
     /// Performs polynomial patchwise reconstruction on the current cell in the H1 semi-norm
@@ -225,7 +243,7 @@ private:
     template <typename DoFCellAccessorType>
     dealii::Vector<real> reconstruct_H1_norm(
         const DoFCellAccessorType &                             curr_cell,
-        const dealii::PolynomialSpace<dim>                      ps,
+        const dealii::PolynomialSpace<dim> &                    ps,
         const dealii::LinearAlgebra::distributed::Vector<real> &solution);
 
     /// Performs polynomial patchwise reconstruction on the current cell in the L2 norm
@@ -246,7 +264,7 @@ private:
     template <typename DoFCellAccessorType>
     dealii::Vector<real> reconstruct_L2_norm(
         const DoFCellAccessorType &                             curr_cell,
-        const dealii::PolynomialSpace<dim>                      ps,
+        const dealii::PolynomialSpace<dim> &                    ps,
         const dealii::LinearAlgebra::distributed::Vector<real> &solution);
 
     /// Get the patch of cells surrounding the current cell of DofCellAccessorType
@@ -258,6 +276,53 @@ private:
     std::vector<DoFCellAccessorType> get_patch_around_dof_cell(
         const DoFCellAccessorType &cell);
 
+    /// Performs the patchwise reconstruction shared by reconstruct_H1_norm and reconstruct_L2_norm
+    /** The gradient terms of the inner products are only included if \p use_gradients is set.
+      * The inverse of the reconstruction matrix is looked up in factorization_cache from the patch geometry
+      * (see get_patch_geometry_key) and only assembled and inverted on a miss.
+      */ 
+    template <typename DoFCellAccessorType>
+    dealii::Vector<real> reconstruct_patch_norm(
+        const DoFCellAccessorType &                             curr_cell,
+        const dealii::PolynomialSpace<dim> &                    ps,
+        const dealii::LinearAlgebra::distributed::Vector<real> &solution,
+        const bool                                              use_gradients);
+
+    /// Quadrature data of a cell used by every patch containing it
+    struct CellQuadratureData
+    {
+        std::vector<dealii::Point<dim,real>>                       qpoints;   ///< Physical quadrature points
+        std::vector<real>                                          JxW;       ///< Quadrature weights times Jacobian determinant
+        std::vector<std::array<real,nstate>>                       soln_at_q; ///< Solution at the quadrature points
+        std::vector<std::array<dealii::Tensor<1,dim,real>,nstate>> grad_at_q; ///< Solution gradient at the quadrature points (H1 only)
+    };
+
+    /// Clears the cached cell data and the cache counters at the start of a reconstruction
+    void initialize_reconstruction();
+
+    /// Returns the cached quadrature data of a cell, evaluating it on first access
+    template <typename DoFCellAccessorType>
+    const CellQuadratureData & get_cell_quadrature_data(
+        const DoFCellAccessorType &                             cell,
+        const dealii::LinearAlgebra::distributed::Vector<real> &solution,
+        const bool                                              use_gradients);
+
+    /// Returns the (cached) complete monomial space of given order
+    const dealii::PolynomialSpace<dim> & get_polynomial_space(const unsigned int order);
+
+    /// Key identifying the geometry of a patch relative to its center cell
+    /** Made of the polynomial order and norm followed by the quadrature points (relative to the center point) and weights
+      * of the patch, scaled by the diameter of the center cell and rounded to a relative tolerance. Patches that are
+      * translations of each other, as in structured regions of the mesh, therefore get the same key. Since the key is
+      * built from the physical quadrature points, moving the high-order nodes of a patch also changes its key.
+      */ 
+    std::vector<long long> get_patch_geometry_key(
+        const unsigned int                                  order,
+        const bool                                          use_gradients,
+        const std::vector<const CellQuadratureData *> &     patch_data,
+        const dealii::Point<dim,real> &                     center_point,
+        const real                                          diameter) const;
+
     // member attributes
     const dealii::DoFHandler<dim>&             dof_handler;           ///< Degree of freedom handler for iteration over mesh elements and their nodes
     const dealii::hp::MappingCollection<dim> & mapping_collection;    ///< Collection of mapping rules for reference element conversion
@@ -268,6 +333,33 @@ private:
     /// Setting controls the choice of norm used in reconstruction. Set via set_norm_type.
     NormType norm_type;
 
+    /// hp::FEValues reused for every cell
+    dealii::hp::FEValues<dim,dim> fe_values_collection;
+
+    /// Quadrature data of each active cell, empty until first needed in the current reconstruction
+    std::vector<CellQuadratureData> quadrature_data;
+
+    /// Complete monomial spaces indexed by their order
+    std::map<unsigned int, dealii::PolynomialSpace<dim>> polynomial_spaces;
+
+    /// Inverted reconstruction matrices indexed by the key of their patch geometry
+    std::map<std::vector<long long>, dealii::FullMatrix<real>> factorization_cache;
+
+    /// Number of factorization_cache hits during the current reconstruction
+    unsigned int n_factorization_cache_hits;
+
+    /// Number of factorization_cache misses during the current reconstruction
+    unsigned int n_factorization_cache_misses;
+
+    /// Connection to the triangulation signal clearing factorization_cache on refinement
+    boost::signals2::connection triangulation_change_connection;
+
+    /// Connection to the triangulation signal clearing factorization_cache when vertices are moved
+    boost::signals2::connection mesh_movement_connection;
+
+    /// Upper bound on the size of factorization_cache, limiting its memory use on unstructured meshes
+    static constexpr unsigned int max_cached_factorizations = 4096;
+
 public:
     /// Derivative values
     /** For each element, array of values indicates the scale of the \f$(p+1)^{th}\f$ (or rel_order) directional
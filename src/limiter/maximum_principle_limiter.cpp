@@ -13,15 +13,9 @@ MaximumPrincipleLimiter<dim, nspecies, nstate, real>::MaximumPrincipleLimiter(
     const Parameters::AllParameters* const parameters_input)
     : BoundPreservingLimiterState<dim,nspecies,nstate, real>::BoundPreservingLimiterState(parameters_input) 
 {
-    // Create pointer to TVB Limiter class if use_tvb_limiter==true && dim == 1
+    // Create pointer to TVB Limiter class if use_tvb_limiter==true
     if (parameters_input->limiter_param.use_tvb_limiter) {
-        if (dim == 1) {
-            tvbLimiter = std::make_shared < TVBLimiter<dim, nspecies, nstate, real> >(parameters_input);
-        }
-        else {
-            std::cout << "Error: Cannot create TVB limiter for dim > 1" << std::endl;
-            std::abort();
-        }
+        tvbLimiter = std::make_shared < TVBLimiter<dim, nspecies, nstate, real> >(parameters_input);
     }
 }
 
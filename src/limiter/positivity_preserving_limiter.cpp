@@ -3,6 +3,7 @@
 #include "physics/physics_factory.h"
 #include <eigen/unsupported/Eigen/Polynomials>
 #include <eigen/Eigen/Dense>
+#include <limits>
 
 namespace PHiLiP {
 /**********************************
@@ -16,6 +17,7 @@ PositivityPreservingLimiter<dim, nspecies, nstate, real>::PositivityPreservingLi
     const Parameters::AllParameters* const parameters_input)
     : BoundPreservingLimiterState<dim,nspecies,nstate,real>::BoundPreservingLimiterState(parameters_input)
     , flow_solver_param(parameters_input->flow_solver_param)
+    , operators_max_degree(0)
     , dx((flow_solver_param.grid_right_bound-flow_solver_param.grid_left_bound)/flow_solver_param.number_of_grid_elements_x)
     , dy((flow_solver_param.grid_top_bound-flow_solver_param.grid_bottom_bound)/flow_solver_param.number_of_grid_elements_y)
     , dz((flow_solver_param.grid_z_upper_bound-flow_solver_param.grid_z_lower_bound)/flow_solver_param.number_of_grid_elements_z)
@@ -40,15 +42,9 @@ PositivityPreservingLimiter<dim, nspecies, nstate, real>::PositivityPreservingLi
         std::abort();
     }
 
-    // Create pointer to TVB Limiter class if use_tvb_limiter==true && dim == 1
+    // Create pointer to TVB Limiter class if use_tvb_limiter==true
     if (parameters_input->limiter_param.use_tvb_limiter) {
-        if (dim == 1) {
-            tvbLimiter = std::make_shared < TVBLimiter<dim, nspecies, nstate, real> >(parameters_input);
-        }
-        else {
-            std::cout << "Error: Cannot create TVB limiter for dim > 1" << std::endl;
-            std::abort();
-        }
+        tvbLimiter = std::make_shared < TVBLimiter<dim, nspecies, nstate, real> >(parameters_input);
     }
 
     if(dim >= 2 && (flow_solver_param.number_of_grid_elements_x == 1 || flow_solver_param.number_of_grid_elements_y == 1)) {
@@ -63,15 +59,16 @@ PositivityPreservingLimiter<dim, nspecies, nstate, real>::PositivityPreservingLi
 }
 
 template <int dim, int nspecies, int nstate, typename real>
-std::vector<real> PositivityPreservingLimiter<dim, nspecies, nstate, real>::get_theta2_Zhang2010(
+void PositivityPreservingLimiter<dim, nspecies, nstate, real>::get_theta2_Zhang2010(
     const std::vector< real >&                      p_lim,
     const std::array<real, nstate>&                 soln_cell_avg,
     const std::array<std::vector<real>, nstate>&    soln_at_q,
     const unsigned int                              n_quad_pts,
     const double                                    eps,
-    const double                                    gamma)
+    const double                                    gamma,
+    std::vector<real>&                              theta2)
 {
-    std::vector<real> theta2(n_quad_pts, 1); // Value used to linearly scale state variables
+    theta2.resize(n_quad_pts); // Value used to linearly scale state variables
     Eigen::PolynomialSolver<double, 2> solver; // Solver to find smallest root
 
     for (unsigned int iquad = 0; iquad < n_quad_pts; ++iquad) {
@@ -104,8 +101,25 @@ std::vector<real> PositivityPreservingLimiter<dim, nspecies, nstate, real>::get_
             theta2[iquad] = r.real();
         }
     }
+}
 
-    return theta2;
+template <int dim, int nspecies, int nstate, typename real>
+real PositivityPreservingLimiter<dim, nspecies, nstate, real>::compute_pressure_at_nodes(
+    const std::array<std::vector<real>, nstate>&    soln_at_q,
+    const unsigned int                              n_quad_pts,
+    std::vector<real>&                              p_at_q)
+{
+    p_at_q.resize(n_quad_pts);
+    real p_min = std::numeric_limits<real>::max();
+    std::array<real, nstate> soln_at_iquad;
+    for (unsigned int iquad = 0; iquad < n_quad_pts; ++iquad) {
+        for (unsigned int istate = 0; istate < nstate; ++istate) {
+            soln_at_iquad[istate] = soln_at_q[istate][iquad];
+        }
+        p_at_q[iquad] = pde_physics->compute_pressure(soln_at_iquad);
+        if (p_at_q[iquad] < p_min) p_min = p_at_q[iquad];
+    }
+    return p_min;
 }
 
 template <int dim, int nspecies, int nstate, typename real>
@@ -114,7 +128,6 @@ real PositivityPreservingLimiter<dim, nspecies, nstate, real>::get_theta2_Wang20
     const unsigned int                              n_quad_pts,
     const double                                    p_avg)
 {
-    std::vector<real> t2(n_quad_pts, 1);
     real theta2 = 1.0; // Value used to linearly scale state variables 
     std::array<real, nstate> soln_at_iquad;
 
@@ -128,14 +141,10 @@ real PositivityPreservingLimiter<dim, nspecies, nstate, real>::get_theta2_Wang20
         if (nstate == dim + nspecies + 1)
             p_lim = pde_physics->compute_pressure(soln_at_iquad);
 
-        if (p_lim >= 0)
-            t2[iquad] = 1;
-        else
-            t2[iquad] = p_avg / (p_avg - p_lim);
-
-        if (t2[iquad] != 1) {
-            if (t2[iquad] >= 0 && t2[iquad] <= 1 && t2[iquad] < theta2) {
-                theta2 = t2[iquad];
+        if (p_lim < 0) {
+            const real t2 = p_avg / (p_avg - p_lim);
+            if (t2 != 1 && t2 >= 0 && t2 <= 1 && t2 < theta2) {
+                theta2 = t2;
             }
         }
     }
@@ -359,6 +368,39 @@ std::array<real, nstate> PositivityPreservingLimiter<dim, nspecies, nstate, real
     return soln_cell_avg;
 }
 
+template <int dim, int nspecies, int nstate, typename real>
+void PositivityPreservingLimiter<dim, nspecies, nstate, real>::build_operators(
+    const unsigned int                              grid_degree,
+    const unsigned int                              max_degree,
+    const dealii::hp::FECollection<1>&              oneD_fe_collection_1state)
+{
+    if (soln_basis_GLL && operators_max_degree == max_degree) return;
+
+    // Construct 1D Quad Points
+    oneD_quad_GLL = dealii::QGaussLobatto<1>(max_degree + 1);
+    oneD_quad_GL = dealii::QGauss<1>(max_degree + 1);
+    // Constructor for the operators
+    soln_basis_GLL = std::make_unique<OPERATOR::basis_functions<dim, 2 * dim>>(1, max_degree, grid_degree);
+    soln_basis_GLL->build_1D_volume_operator(oneD_fe_collection_1state[max_degree], oneD_quad_GLL);
+    soln_basis_GL = std::make_unique<OPERATOR::basis_functions<dim, 2 * dim>>(1, max_degree, grid_degree);
+    soln_basis_GL->build_1D_volume_operator(oneD_fe_collection_1state[max_degree], oneD_quad_GL);
+
+    operators_max_degree = max_degree;
+}
+
+template <int dim, int nspecies, int nstate, typename real>
+void PositivityPreservingLimiter<dim, nspecies, nstate, real>::interpolate_to_mixed_nodes(
+    const unsigned int                              idim,
+    const std::vector<real>&                        coeff,
+    std::vector<real>&                              values_at_q)
+{
+    // GLL nodes in direction idim to include the surface nodes, GL nodes in the other directions
+    const dealii::FullMatrix<double>& GLL_oper = soln_basis_GLL->oneD_vol_operator;
+    const dealii::FullMatrix<double>& GL_oper = soln_basis_GL->oneD_vol_operator;
+    soln_basis_GLL->matrix_vector_mult(coeff, values_at_q,
+        (idim == 0) ? GLL_oper : GL_oper, (idim == 1) ? GLL_oper : GL_oper, (idim == 2) ? GLL_oper : GL_oper);
+}
+
 template <int dim, int nspecies, int nstate, typename real>
 void PositivityPreservingLimiter<dim, nspecies, nstate, real>::limit(
     dealii::LinearAlgebra::distributed::Vector<double>&     solution,
@@ -377,25 +419,22 @@ void PositivityPreservingLimiter<dim, nspecies, nstate, real>::limit(
         this->tvbLimiter->limit(solution, dof_handler, fe_collection, volume_quadrature_collection, grid_degree, max_degree, oneD_fe_collection_1state, oneD_quadrature_collection, dt);
 
     //create 1D solution polynomial basis functions to interpolate the solution to the quadrature nodes
-    const unsigned int init_grid_degree = grid_degree;
+    build_operators(grid_degree, max_degree, oneD_fe_collection_1state);
+    const std::vector<real>& GLL_weights = oneD_quad_GLL.get_weights();
+    const std::vector<real>& GL_weights = oneD_quad_GL.get_weights();
 
-    // Construct 1D Quad Points
-    dealii::QGauss<1> oneD_quad_GL(max_degree + 1);
-    dealii::QGaussLobatto<1> oneD_quad_GLL(max_degree + 1);
-    // Constructor for the operators
-    OPERATOR::basis_functions<dim, 2 * dim> soln_basis_GLL(1, max_degree, init_grid_degree);
-    soln_basis_GLL.build_1D_volume_operator(oneD_fe_collection_1state[max_degree], oneD_quad_GLL);
-    OPERATOR::basis_functions<dim, 2 * dim> soln_basis_GL(1, max_degree, init_grid_degree);
-    soln_basis_GL.build_1D_volume_operator(oneD_fe_collection_1state[max_degree], oneD_quad_GL);
+    using limiter_enum = Parameters::LimiterParam::LimiterType;
+    const limiter_enum limiter_type = this->all_parameters->limiter_param.bound_preserving_limiter;
+    const real lower_bound = this->all_parameters->limiter_param.min_density;
+    // Pressure above which theta2 is one at a node (3.16 in Zhang, Shu 2010 or 3.7 in Wang, Shu 2012)
+    const real pressure_bound = (limiter_type == limiter_enum::positivity_preservingZhang2010) ? lower_bound : 0.0;
 
     for (auto soln_cell : dof_handler.active_cell_iterators()) {
         if (!soln_cell->is_locally_owned()) continue;
 
-        std::vector<dealii::types::global_dof_index> current_dofs_indices;
         // Current reference element related to this physical cell
         const int i_fele = soln_cell->active_fe_index();
         const dealii::FESystem<dim, dim>& current_fe_ref = fe_collection[i_fele];
-        const int poly_degree = current_fe_ref.tensor_degree();
 
         const unsigned int n_dofs_curr_cell = current_fe_ref.n_dofs_per_cell();
 
@@ -404,8 +443,6 @@ void PositivityPreservingLimiter<dim, nspecies, nstate, real>::limit(
         soln_cell->get_dof_indices(current_dofs_indices);
 
         // Extract the local solution dofs in the cell from the global solution dofs
-        std::array<std::vector<real>, nstate> soln_coeff;
-
         const unsigned int n_shape_fns = n_dofs_curr_cell / nstate;
         real local_min_density = 1e6;
 
@@ -416,8 +453,8 @@ void PositivityPreservingLimiter<dim, nspecies, nstate, real>::limit(
         bool nan_check = false;
         // Allocate solution dofs and set local min
         for (unsigned int idof = 0; idof < n_dofs_curr_cell; ++idof) {
-            const unsigned int istate = fe_collection[poly_degree].system_to_component_index(idof).first;
-            const unsigned int ishape = fe_collection[poly_degree].system_to_component_index(idof).second;
+            const unsigned int istate = current_fe_ref.system_to_component_index(idof).first;
+            const unsigned int ishape = current_fe_ref.system_to_component_index(idof).second;
             soln_coeff[istate][ishape] = solution[current_dofs_indices[idof]];
 
             if (isnan(soln_coeff[istate][ishape])) {
@@ -441,29 +478,12 @@ void PositivityPreservingLimiter<dim, nspecies, nstate, real>::limit(
             }  
         }
 
-        std::array<std::array<std::vector<real>, nstate>, dim> soln_at_q;
-        std::array<std::vector<real>, nstate> soln_at_q_dim;
         // Interpolate solution dofs to quadrature pts.
         for(unsigned int idim = 0; idim < dim; idim++) {
             for (int istate = 0; istate < nstate; istate++) {
-                soln_at_q_dim[istate].resize(n_quad_pts);
-
-                if(idim == 0) {
-                    soln_basis_GLL.matrix_vector_mult(soln_coeff[istate], soln_at_q_dim[istate],
-                        soln_basis_GLL.oneD_vol_operator, soln_basis_GL.oneD_vol_operator, soln_basis_GL.oneD_vol_operator);
-                }
-
-                if(idim == 1) {
-                    soln_basis_GLL.matrix_vector_mult(soln_coeff[istate], soln_at_q_dim[istate],
-                        soln_basis_GL.oneD_vol_operator, soln_basis_GLL.oneD_vol_operator, soln_basis_GL.oneD_vol_operator);
-                }
-
-                if(idim == 2) {
-                    soln_basis_GLL.matrix_vector_mult(soln_coeff[istate], soln_at_q_dim[istate],
-                        soln_basis_GL.oneD_vol_operator, soln_basis_GL.oneD_vol_operator, soln_basis_GLL.oneD_vol_operator);
-                }
+                soln_at_q[idim][istate].resize(n_quad_pts);
+                interpolate_to_mixed_nodes(idim, soln_coeff[istate], soln_at_q[idim][istate]);
             }
-            soln_at_q[idim] = soln_at_q_dim;
         }
 
         for (unsigned int idim = 0; idim < dim; ++idim) {
@@ -475,13 +495,19 @@ void PositivityPreservingLimiter<dim, nspecies, nstate, real>::limit(
             }
         }
 
-        std::vector< real > GLL_weights = oneD_quad_GLL.get_weights();
-        std::vector< real > GL_weights = oneD_quad_GL.get_weights();
-        std::array<real, nstate> soln_cell_avg;
+        // If the density is above its lower bound and the pressure above its bound at every node, both theta and theta2
+        // are one and the cell is left unchanged, so the cell average and the scaling values are not needed.
+        if (nspecies == 1 && local_min_density >= lower_bound) {
+            real p_min = compute_pressure_at_nodes(soln_coeff, n_quad_pts, p_lim);
+            for (unsigned int idim = 0; idim < dim; ++idim) {
+                p_min = std::min(p_min, compute_pressure_at_nodes(soln_at_q[idim], n_quad_pts, p_lim_quad[idim]));
+            }
+            if (p_min >= pressure_bound) continue;
+        }
+
         // Obtain solution cell average
-        soln_cell_avg = get_soln_cell_avg_PPL(soln_at_q, n_quad_pts, oneD_quad_GLL.get_weights(), oneD_quad_GL.get_weights(), dt);
+        const std::array<real, nstate> soln_cell_avg = get_soln_cell_avg_PPL(soln_at_q, n_quad_pts, GLL_weights, GL_weights, dt);
 
-        real lower_bound = this->all_parameters->limiter_param.min_density;
         real p_avg = 1e-13;
 
         real nth_species_avg = 0.0;
@@ -500,10 +526,13 @@ void PositivityPreservingLimiter<dim, nspecies, nstate, real>::limit(
         }
         // Obtain value used to linearly scale density
         real theta = get_density_scaling_value(soln_cell_avg[0], local_min_density, lower_bound, p_avg);
+        const bool density_limited = (theta < 1.0);
 
         // Apply limiter on density values at quadrature points
-        for (unsigned int ishape = 0; ishape < n_shape_fns; ++ishape) {
-            soln_coeff[0][ishape] = theta*(soln_coeff[0][ishape] - soln_cell_avg[0]) + soln_cell_avg[0];
+        if (density_limited) {
+            for (unsigned int ishape = 0; ishape < n_shape_fns; ++ishape) {
+                soln_coeff[0][ishape] = theta*(soln_coeff[0][ishape] - soln_cell_avg[0]) + soln_cell_avg[0];
+            }
         }
 
         if(nspecies > 1) {
@@ -554,115 +583,70 @@ void PositivityPreservingLimiter<dim, nspecies, nstate, real>::limit(
         }
 
         // Interpolate new density values to mixed quadrature points
-        if constexpr(dim >= 1) {
-            soln_basis_GLL.matrix_vector_mult(soln_coeff[0], soln_at_q[0][0],
-                soln_basis_GLL.oneD_vol_operator, soln_basis_GL.oneD_vol_operator, soln_basis_GL.oneD_vol_operator);
-            if(nspecies > 1) {
-                for(unsigned int ispecies = 0; ispecies < (nspecies - 1); ++ispecies) {
-                    int index = dim + 2 + ispecies;
-                    soln_basis_GLL.matrix_vector_mult(soln_coeff[index], soln_at_q[0][index],
-                        soln_basis_GLL.oneD_vol_operator, soln_basis_GL.oneD_vol_operator, soln_basis_GL.oneD_vol_operator);
-                }
-            }
-        }
-
-        if constexpr(dim >= 2) {
-            soln_basis_GLL.matrix_vector_mult(soln_coeff[0], soln_at_q[1][0],
-                soln_basis_GL.oneD_vol_operator, soln_basis_GLL.oneD_vol_operator, soln_basis_GL.oneD_vol_operator);
-            if(nspecies > 1) {
-                for(unsigned int ispecies = 0; ispecies < (nspecies - 1); ++ispecies) {
-                    int index = dim + 2 + ispecies;
-                    soln_basis_GLL.matrix_vector_mult(soln_coeff[index], soln_at_q[1][index],
-                        soln_basis_GLL.oneD_vol_operator, soln_basis_GL.oneD_vol_operator, soln_basis_GL.oneD_vol_operator);
-                }
+        for (unsigned int idim = 0; idim < dim; ++idim) {
+            if (density_limited) {
+                interpolate_to_mixed_nodes(idim, soln_coeff[0], soln_at_q[idim][0]);
             }
-        }
-
-        if constexpr(dim == 3) {
-            soln_basis_GLL.matrix_vector_mult(soln_coeff[0], soln_at_q[2][0],
-                soln_basis_GL.oneD_vol_operator, soln_basis_GL.oneD_vol_operator, soln_basis_GLL.oneD_vol_operator);
             if(nspecies > 1) {
                 for(unsigned int ispecies = 0; ispecies < (nspecies - 1); ++ispecies) {
                     int index = dim + 2 + ispecies;
-                    soln_basis_GLL.matrix_vector_mult(soln_coeff[index], soln_at_q[2][index],
-                        soln_basis_GLL.oneD_vol_operator, soln_basis_GL.oneD_vol_operator, soln_basis_GL.oneD_vol_operator);
+                    interpolate_to_mixed_nodes(idim, soln_coeff[index], soln_at_q[idim][index]);
                 }
             }
         }
 
 
         real theta2 = 1.0;
-        using limiter_enum = Parameters::LimiterParam::LimiterType;
-        limiter_enum limiter_type = this->all_parameters->limiter_param.bound_preserving_limiter;
 
         if (limiter_type == limiter_enum::positivity_preservingWang2012 && nstate == dim + nspecies + 1) {
-            std::array<real, dim> theta2_quad;
+            std::array<real, dim> theta2_dim;
             for(unsigned int idim = 0; idim < dim; ++idim) {
-                theta2_quad[idim] = get_theta2_Wang2012(soln_at_q[idim], n_quad_pts, p_avg);
+                theta2_dim[idim] = get_theta2_Wang2012(soln_at_q[idim], n_quad_pts, p_avg);
             }
 
             for(unsigned int idim = 0; idim < dim; ++idim) {
-                if(theta2_quad[idim] < theta2)
-                    theta2 = theta2_quad[idim];
+                if(theta2_dim[idim] < theta2)
+                    theta2 = theta2_dim[idim];
             }
 
-            real theta2_soln = get_theta2_Wang2012(soln_coeff, n_quad_pts, p_avg);
-            if(theta2_soln < theta2)
-                    theta2 = theta2_soln;
+            real theta2_soln_min = get_theta2_Wang2012(soln_coeff, n_quad_pts, p_avg);
+            if(theta2_soln_min < theta2)
+                    theta2 = theta2_soln_min;
 
             // Limit values at quadrature points
-            for (unsigned int istate = 0; istate < nstate; ++istate) {
-                for (unsigned int iquad = 0; iquad < n_quad_pts; ++iquad) {
-                    soln_coeff[istate][iquad] = theta2 * (soln_coeff[istate][iquad] - soln_cell_avg[istate])
-                            + soln_cell_avg[istate];
+            if (theta2 < 1.0) {
+                for (unsigned int istate = 0; istate < nstate; ++istate) {
+                    for (unsigned int iquad = 0; iquad < n_quad_pts; ++iquad) {
+                        soln_coeff[istate][iquad] = theta2 * (soln_coeff[istate][iquad] - soln_cell_avg[istate])
+                                + soln_cell_avg[istate];
+                    }
                 }
             }
         }
 
         if (limiter_type == limiter_enum::positivity_preservingZhang2010 && nstate == dim + 2) {
 
-            std::array<std::vector< real >, dim> p_lim_quad;
-            std::array<real, nstate> soln_at_iquad;
-
-            for(unsigned int idim = 0; idim < dim; ++idim) {
-                p_lim_quad[idim].resize(n_quad_pts);
-                // Compute pressure at quadrature points
-                for (unsigned int iquad = 0; iquad < n_quad_pts; ++iquad) {
-                    for (unsigned int istate = 0; istate < nstate; ++istate) {
-                        soln_at_iquad[istate] = soln_at_q[idim][istate][iquad];
-                    }
-                    p_lim_quad[idim][iquad] = pde_physics->compute_pressure(soln_at_iquad);
-                }
-            }
-
-            std::array<std::vector< real >, dim> theta2_quad;
             // Obtain value used to linearly scale state variables
             for(unsigned int idim = 0; idim < dim; ++idim) {
-                theta2_quad[idim].resize(n_quad_pts);
-                theta2_quad[idim] = get_theta2_Zhang2010(p_lim_quad[idim], soln_cell_avg, soln_at_q[idim], n_quad_pts, lower_bound, 1.4);
+                // Compute pressure at quadrature points
+                compute_pressure_at_nodes(soln_at_q[idim], n_quad_pts, p_lim_quad[idim]);
+                get_theta2_Zhang2010(p_lim_quad[idim], soln_cell_avg, soln_at_q[idim], n_quad_pts, lower_bound, 1.4, theta2_quad[idim]);
             }
 
             // Compute pressure at solution points
-            std::vector< real > p_lim;
-            p_lim.resize(n_quad_pts);
-            for (unsigned int iquad = 0; iquad < n_quad_pts; ++iquad) {
-                for (unsigned int istate = 0; istate < nstate; ++istate) {
-                    soln_at_iquad[istate] = soln_coeff[istate][iquad];
-                }
-                p_lim[iquad] = pde_physics->compute_pressure(soln_at_iquad);
-            }
-            std::vector<real> theta2_soln = get_theta2_Zhang2010(p_lim, soln_cell_avg, soln_coeff, n_quad_pts, lower_bound, 1.4);
+            compute_pressure_at_nodes(soln_coeff, n_quad_pts, p_lim);
+            get_theta2_Zhang2010(p_lim, soln_cell_avg, soln_coeff, n_quad_pts, lower_bound, 1.4, theta2_soln);
 
             // Limit values at quadrature points
-            for (unsigned int istate = 0; istate < nstate; ++istate) {
-                for (unsigned int iquad = 0; iquad < n_quad_pts; ++iquad) {
-                    real min_theta2_quad = 1e6;
-                    for(unsigned int idim = 0; idim < dim; ++idim) {
-                        if(theta2_quad[idim][iquad] < min_theta2_quad)
-                            min_theta2_quad = theta2_quad[idim][iquad];
-                    }
+            for (unsigned int iquad = 0; iquad < n_quad_pts; ++iquad) {
+                real min_theta2_quad = 1e6;
+                for(unsigned int idim = 0; idim < dim; ++idim) {
+                    if(theta2_quad[idim][iquad] < min_theta2_quad)
+                        min_theta2_quad = theta2_quad[idim][iquad];
+                }
 
-                    theta2 = std::min({ min_theta2_quad, theta2_soln[iquad] });
+                theta2 = std::min({ min_theta2_quad, theta2_soln[iquad] });
+                for (unsigned int istate = 0; istate < nstate; ++istate) {
                     soln_coeff[istate][iquad] = theta2 * (soln_coeff[istate][iquad] - soln_cell_avg[istate])
                             + soln_cell_avg[istate];
                 }
@@ -66,13 +66,32 @@ protected:
 
     /// Obtain the theta value used to scale all states and enforce positivity of pressure 
     /// Using 3.16-3.18 in Zhang, Shu Nov 2010
-    std::vector<real> get_theta2_Zhang2010(
+    void get_theta2_Zhang2010(
         const std::vector< real >&                      p_lim,
         const std::array<real, nstate>&                 soln_cell_avg,
         const std::array<std::vector<real>, nstate>&    soln_at_q,
         const unsigned int                              n_quad_pts,
         const double                                    eps,
-        const double                                    gamma);
+        const double                                    gamma,
+        std::vector<real>&                              theta2);
+
+    /// Compute the pressure at each node and return the minimum
+    real compute_pressure_at_nodes(
+        const std::array<std::vector<real>, nstate>&    soln_at_q,
+        const unsigned int                              n_quad_pts,
+        std::vector<real>&                              p_at_q);
+
+    /// Build the GLL and GL interpolation operators if the polynomial degree changed
+    void build_operators(
+        const unsigned int                              grid_degree,
+        const unsigned int                              max_degree,
+        const dealii::hp::FECollection<1>&              oneD_fe_collection_1state);
+
+    /// Interpolate the coefficients of one state to the nodes that are GLL in direction idim and GL in the others
+    void interpolate_to_mixed_nodes(
+        const unsigned int                              idim,
+        const std::vector<real>&                        coeff,
+        std::vector<real>&                              values_at_q);
 
     /// Obtain the theta value used to scale all states and enforce positivity of pressure
     /// Using 3.7 in Wang, Shu 2012
@@ -107,6 +126,42 @@ protected:
         const unsigned int                                      n_shape_fns,
         const std::vector<dealii::types::global_dof_index>&     current_dofs_indices);
 
+    /// Polynomial degree with which the operators were last built
+    unsigned int operators_max_degree;
+
+    /// 1D Gauss-Lobatto quadrature used to include the surface nodes
+    dealii::Quadrature<1> oneD_quad_GLL;
+
+    /// 1D Gauss-Legendre quadrature used in the directions tangential to the surface nodes
+    dealii::Quadrature<1> oneD_quad_GL;
+
+    /// Solution basis evaluated at the 1D GLL nodes
+    std::unique_ptr<OPERATOR::basis_functions<dim, 2 * dim>> soln_basis_GLL;
+
+    /// Solution basis evaluated at the 1D GL nodes
+    std::unique_ptr<OPERATOR::basis_functions<dim, 2 * dim>> soln_basis_GL;
+
+    /// Global dof indices of the current cell
+    std::vector<dealii::types::global_dof_index> current_dofs_indices;
+
+    /// Solution coefficients of the current cell
+    std::array<std::vector<real>, nstate> soln_coeff;
+
+    /// Solution of the current cell at the mixed GLL/GL nodes of each direction
+    std::array<std::array<std::vector<real>, nstate>, dim> soln_at_q;
+
+    /// Pressure at the solution nodes of the current cell
+    std::vector<real> p_lim;
+
+    /// Pressure at the mixed GLL/GL nodes of each direction of the current cell
+    std::array<std::vector<real>, dim> p_lim_quad;
+
+    /// Theta2 at the solution nodes of the current cell
+    std::vector<real> theta2_soln;
+
+    /// Theta2 at the mixed GLL/GL nodes of each direction of the current cell
+    std::array<std::vector<real>, dim> theta2_quad;
+
     // Values required to compute solution cell average in 2D/3D
     real dx; ///< Value required to compute solution cell average in 2D/3D, calculated using xmax and xmin parameters
     real dy; ///< Value required to compute solution cell average in 2D/3D, calculated using ymax and ymin parameters
@@ -10,7 +10,14 @@ namespace PHiLiP {
 template <int dim, int nspecies, int nstate, typename real>
 TVBLimiter<dim, nspecies, nstate, real>::TVBLimiter(
     const Parameters::AllParameters* const parameters_input)
-    : BoundPreservingLimiterState<dim,nspecies,nstate,real>::BoundPreservingLimiterState( parameters_input) {}
+    : BoundPreservingLimiterState<dim,nspecies,nstate,real>::BoundPreservingLimiterState( parameters_input)
+    , operators_max_degree(0)
+{
+    if (parameters_input->limiter_param.tuning_parameter_for_each_state.size() < nstate) {
+        std::cout << "Error: TVB Limiter requires a tuning parameter for each of the " << nstate << " states" << std::endl;
+        std::abort();
+    }
+}
 
 template <int dim, int nspecies, int nstate, typename real>
 real TVBLimiter<dim, nspecies, nstate, real>::apply_modified_minmod(
@@ -56,56 +63,94 @@ real TVBLimiter<dim, nspecies, nstate, real>::apply_modified_minmod(
 }
 
 template <int dim, int nspecies, int nstate, typename real>
-std::array<std::vector<real>, nstate> TVBLimiter<dim, nspecies, nstate, real>::limit_cell(
-    std::array<std::vector<real>, nstate>                   soln_at_q,
+void TVBLimiter<dim, nspecies, nstate, real>::limit_cell(
+    std::array<std::vector<real>, nstate>&                  soln_at_q,
     const unsigned int                                      n_quad_pts,
-    const std::array<real, nstate>                          prev_cell_avg,
-    const std::array<real, nstate>                          soln_cell_avg,
-    const std::array<real, nstate>                          next_cell_avg,
-    const std::array<real, nstate>                          M,
+    const std::vector<real>&                                quad_weights,
+    const std::vector<real>&                                oneD_quad_weights,
+    const std::array<std::array<real, nstate>, dim>&        prev_cell_avg,
+    const std::array<real, nstate>&                         soln_cell_avg,
+    const std::array<std::array<real, nstate>, dim>&        next_cell_avg,
+    const std::array<real, nstate>&                         M,
     const double                                            h)
 {
-    std::array<real, nstate> soln_cell_0;
-    std::array<real, nstate> soln_cell_k;
-    std::array<real, nstate> diff_next;
-    std::array<real, nstate> diff_prev;
+    const unsigned int n_quad_pts_1D = oneD_quad_weights.size();
+
+    std::array<std::array<real, nstate>, dim> soln_face_0; // Value at left face of the cell in each direction
+    std::array<std::array<real, nstate>, dim> soln_face_k; // Value at right face of the cell in each direction
+    for (unsigned int idim = 0; idim < dim; ++idim) {
+        for (unsigned int istate = 0; istate < nstate; ++istate) {
+            soln_face_0[idim][istate] = 0;
+            soln_face_k[idim][istate] = 0;
+        }
+    }
+
+    // Average the solution over the GLL nodes of each face. The tensor-product weights divided by the
+    // 1D weight normal to the face are the face quadrature weights, which sum to one.
+    for (unsigned int iquad = 0; iquad < n_quad_pts; ++iquad) {
+        unsigned int remaining_index = iquad;
+        for (unsigned int idim = 0; idim < dim; ++idim) {
+            const unsigned int iquad_1D = remaining_index % n_quad_pts_1D;
+            remaining_index /= n_quad_pts_1D;
+            if (iquad_1D == 0) {
+                const real face_weight = quad_weights[iquad] / oneD_quad_weights[0];
+                for (unsigned int istate = 0; istate < nstate; ++istate) {
+                    soln_face_0[idim][istate] += face_weight * soln_at_q[istate][iquad];
+                }
+            }
+            if (iquad_1D == n_quad_pts_1D - 1) {
+                const real face_weight = quad_weights[iquad] / oneD_quad_weights[n_quad_pts_1D - 1];
+                for (unsigned int istate = 0; istate < nstate; ++istate) {
+                    soln_face_k[idim][istate] += face_weight * soln_at_q[istate][iquad];
+                }
+            }
+        }
+    }
+
     std::array<real, nstate> soln_0_lim;
     std::array<real, nstate> soln_k_lim;
     std::array<real, nstate> theta; // Value used to linearly scale solution 
-
-    // This part is only valid for 1D as it uses the value at the first and last quadrature points 
-    // as the face values of the cell which does not hold true for 2D and 3D.
     for (unsigned int istate = 0; istate < nstate; ++istate) {
-        soln_cell_0[istate] = soln_at_q[istate][0]; // Value at left face of the cell
-        soln_cell_k[istate] = soln_at_q[istate][n_quad_pts - 1]; // Value at right face of the cell
-
-        diff_next[istate] = next_cell_avg[istate] - soln_cell_avg[istate];
-        diff_prev[istate] = soln_cell_avg[istate] - prev_cell_avg[istate];
+        theta[istate] = 1.0;
     }
 
     real a = 0.0; // Chen,Shu 2017, Thm 3.7 minmod function
 
-    for (unsigned int istate = 0; istate < nstate; ++istate) {
-        a = soln_cell_avg[istate] - soln_cell_0[istate];
-        soln_0_lim[istate] = apply_modified_minmod(a, M[istate], h, diff_next[istate], diff_prev[istate], soln_cell_avg[istate], true);
-
-        a = soln_cell_k[istate] - soln_cell_avg[istate];
-        soln_k_lim[istate] = apply_modified_minmod(a, M[istate], h, diff_next[istate], diff_prev[istate], soln_cell_avg[istate], false);
-
-        real scale = ((soln_cell_0[istate] - soln_cell_avg[istate]) + (soln_cell_k[istate] - soln_cell_avg[istate]));
-        if (scale != 0)
-            theta[istate] = ((soln_0_lim[istate] - soln_cell_avg[istate]) + (soln_k_lim[istate] - soln_cell_avg[istate])) / scale;
-        else
-            theta[istate] = 0;
+    for (unsigned int idim = 0; idim < dim; ++idim) {
+        for (unsigned int istate = 0; istate < nstate; ++istate) {
+            const real diff_next = next_cell_avg[idim][istate] - soln_cell_avg[istate];
+            const real diff_prev = soln_cell_avg[istate] - prev_cell_avg[idim][istate];
+
+            a = soln_cell_avg[istate] - soln_face_0[idim][istate];
+            soln_0_lim[istate] = apply_modified_minmod(a, M[istate], h, diff_next, diff_prev, soln_cell_avg[istate], true);
+
+            a = soln_face_k[idim][istate] - soln_cell_avg[istate];
+            soln_k_lim[istate] = apply_modified_minmod(a, M[istate], h, diff_next, diff_prev, soln_cell_avg[istate], false);
+
+            if constexpr (dim == 1) {
+                real scale = ((soln_face_0[idim][istate] - soln_cell_avg[istate]) + (soln_face_k[idim][istate] - soln_cell_avg[istate]));
+                if (scale != 0)
+                    theta[istate] = ((soln_0_lim[istate] - soln_cell_avg[istate]) + (soln_k_lim[istate] - soln_cell_avg[istate])) / scale;
+                else
+                    theta[istate] = 0;
+            } else {
+                // Ratio of the limited to the unlimited variation across the cell in this direction
+                const real variation = soln_face_k[idim][istate] - soln_face_0[idim][istate];
+                if (variation != 0) {
+                    const real theta_dir = (soln_k_lim[istate] - soln_0_lim[istate]) / variation;
+                    theta[istate] = std::min(theta[istate], std::max(std::min(theta_dir, (real)1.0), (real)0.0));
+                }
+            }
+        }
     }
 
     // Limit the values at the quadrature points
     for (unsigned int istate = 0; istate < nstate; ++istate) {
         for (unsigned int iquad = 0; iquad < n_quad_pts; ++iquad) {
-            if (iquad == 0) {
+            if (dim == 1 && iquad == 0) {
                 soln_at_q[istate][iquad] = soln_0_lim[istate];
             }
-            else if (iquad == n_quad_pts - 1) {
+            else if (dim == 1 && iquad == n_quad_pts - 1) {
                 soln_at_q[istate][iquad] = soln_k_lim[istate];
             }
             else {
@@ -114,60 +159,98 @@ std::array<std::vector<real>, nstate> TVBLimiter<dim, nspecies, nstate, real>::l
             }
         }
     }
-
-    return soln_at_q;
 }
 
 template <int dim, int nspecies, int nstate, typename real>
-std::array<real, nstate> TVBLimiter<dim, nspecies, nstate, real>::get_neighbour_cell_avg(
+void TVBLimiter<dim, nspecies, nstate, real>::get_soln_at_q(
     const dealii::LinearAlgebra::distributed::Vector<double>&       solution,
+    const typename dealii::DoFHandler<dim>::active_cell_iterator&   soln_cell,
     const dealii::hp::FECollection<dim>&                            fe_collection,
-    const dealii::hp::QCollection<dim>&                             volume_quadrature_collection,
-    OPERATOR::basis_functions<dim, 2 * dim>                         soln_basis,
-    const int                                                       poly_degree,
-    const std::vector<dealii::types::global_dof_index>&             neigh_dofs_indices,
-    const unsigned int                                              n_dofs_neigh_cell)
+    const unsigned int                                              n_quad_pts)
 {
-    // Extract the local solution dofs in the cell from the global solution dofs
-    std::array<std::vector<real>, nstate> soln_coeff;
-    const unsigned int n_shape_fns = n_dofs_neigh_cell / nstate;
+    // Current reference element related to this physical cell
+    const dealii::FESystem<dim, dim>& current_fe_ref = fe_collection[soln_cell->active_fe_index()];
+    const unsigned int n_dofs_curr_cell = current_fe_ref.n_dofs_per_cell();
+    const unsigned int n_shape_fns = n_dofs_curr_cell / nstate;
+
+    // Obtain the mapping from local dof indices to global dof indices
+    current_dofs_indices.resize(n_dofs_curr_cell);
+    soln_cell->get_dof_indices(current_dofs_indices);
 
+    // Extract the local solution dofs in the cell from the global solution dofs
     for (unsigned int istate = 0; istate < nstate; ++istate) {
         soln_coeff[istate].resize(n_shape_fns);
+        soln_at_q[istate].resize(n_quad_pts);
+    }
+    for (unsigned int idof = 0; idof < n_dofs_curr_cell; ++idof) {
+        const unsigned int istate = current_fe_ref.system_to_component_index(idof).first;
+        const unsigned int ishape = current_fe_ref.system_to_component_index(idof).second;
+        soln_coeff[istate][ishape] = solution[current_dofs_indices[idof]];
     }
 
-    // Allocate soln_coeff
-    for (unsigned int idof = 0; idof < n_dofs_neigh_cell; ++idof) {
-        const unsigned int istate = fe_collection[poly_degree].system_to_component_index(idof).first;
-        const unsigned int ishape = fe_collection[poly_degree].system_to_component_index(idof).second;
-        soln_coeff[istate][ishape] = solution[neigh_dofs_indices[idof]];
+    // Interpolate solution dofs to quadrature pts.
+    for (int istate = 0; istate < nstate; istate++) {
+        soln_basis->matrix_vector_mult_1D(soln_coeff[istate], soln_at_q[istate],
+            soln_basis->oneD_vol_operator);
     }
-    const unsigned int n_quad_pts = volume_quadrature_collection[poly_degree].size();
-    const std::vector<real>& quad_weights = volume_quadrature_collection[poly_degree].get_weights();
+}
 
-    std::array<real, nstate> cell_avg;
+template <int dim, int nspecies, int nstate, typename real>
+void TVBLimiter<dim, nspecies, nstate, real>::compute_cell_averages(
+    const dealii::LinearAlgebra::distributed::Vector<double>&       solution,
+    const dealii::DoFHandler<dim>&                                  dof_handler,
+    const dealii::hp::FECollection<dim>&                            fe_collection,
+    const dealii::hp::QCollection<dim>&                             volume_quadrature_collection)
+{
+    const unsigned int n_active_cells = dof_handler.get_triangulation().n_active_cells();
     for (unsigned int istate = 0; istate < nstate; ++istate) {
-        cell_avg[istate] = 0;
+        cell_avg[istate].resize(n_active_cells);
     }
 
-    std::array<std::vector<real>, nstate> soln_at_q_neigh;
+    for (auto soln_cell : dof_handler.active_cell_iterators()) {
+        if (!soln_cell->is_locally_owned() && !soln_cell->is_ghost()) continue;
 
-    // Interpolate solution dofs to quadrature pts
-    for (int istate = 0; istate < nstate; istate++) {
-        soln_at_q_neigh[istate].resize(n_quad_pts);
-        soln_basis.matrix_vector_mult_1D(soln_coeff[istate], soln_at_q_neigh[istate],
-            soln_basis.oneD_vol_operator);
+        const int poly_degree = fe_collection[soln_cell->active_fe_index()].tensor_degree();
+        const unsigned int n_quad_pts = volume_quadrature_collection[poly_degree].size();
+        const std::vector<real>& quad_weights = volume_quadrature_collection[poly_degree].get_weights();
+
+        get_soln_at_q(solution, soln_cell, fe_collection, n_quad_pts);
+
+        const std::array<real, nstate> soln_cell_avg = get_soln_cell_avg(soln_at_q, n_quad_pts, quad_weights);
+        for (unsigned int istate = 0; istate < nstate; ++istate) {
+            cell_avg[istate][soln_cell->active_cell_index()] = soln_cell_avg[istate];
+        }
     }
+}
 
-    // Apply integral for solution cell average (dealii quadrature operates from [0,1])
+template <int dim, int nspecies, int nstate, typename real>
+std::array<real, nstate> TVBLimiter<dim, nspecies, nstate, real>::get_neighbour_cell_avg(
+    const typename dealii::DoFHandler<dim>::active_cell_iterator&   soln_cell,
+    const unsigned int                                              face_no) const
+{
+    std::array<real, nstate> neigh_cell_avg;
     for (unsigned int istate = 0; istate < nstate; ++istate) {
-        for (unsigned int iquad = 0; iquad < n_quad_pts; ++iquad) {
-            cell_avg[istate] += quad_weights[iquad]
-                * soln_at_q_neigh[istate][iquad];
+        neigh_cell_avg[istate] = 0;
+    }
+
+    if (soln_cell->neighbor(face_no).state() != dealii::IteratorState::valid) return neigh_cell_avg;
+
+    const auto neigh = soln_cell->neighbor(face_no);
+    if (neigh->is_active()) {
+        for (unsigned int istate = 0; istate < nstate; ++istate) {
+            neigh_cell_avg[istate] = cell_avg[istate][neigh->active_cell_index()];
+        }
+    } else {
+        const unsigned int n_subfaces = soln_cell->face(face_no)->n_children();
+        for (unsigned int isubface = 0; isubface < n_subfaces; ++isubface) {
+            const auto neigh_child = soln_cell->neighbor_child_on_subface(face_no, isubface);
+            for (unsigned int istate = 0; istate < nstate; ++istate) {
+                neigh_cell_avg[istate] += cell_avg[istate][neigh_child->active_cell_index()] / n_subfaces;
+            }
         }
     }
 
-    return cell_avg;
+    return neigh_cell_avg;
 }
 
 template <int dim, int nspecies, int nstate, typename real>
@@ -191,105 +274,55 @@ void TVBLimiter<dim, nspecies, nstate, real>::limit(
 
     //create 1D solution polynomial basis functions and corresponding projection operator
     //to interpolate the solution to the quadrature nodes, and to project it back to the
-    //modal coefficients.
-    const unsigned int init_grid_degree = grid_degree;
-    //Constructor for the operators
-    OPERATOR::basis_functions<dim, 2 * dim> soln_basis(1, max_degree, init_grid_degree);
-    OPERATOR::vol_projection_operator<dim, 2 * dim> soln_basis_projection_oper(1, max_degree, init_grid_degree);
+    //modal coefficients. They are only rebuilt if the polynomial degree changes.
+    if (!soln_basis || operators_max_degree != max_degree) {
+        const unsigned int init_grid_degree = grid_degree;
+        //Constructor for the operators
+        soln_basis = std::make_unique<OPERATOR::basis_functions<dim, 2 * dim>>(1, max_degree, init_grid_degree);
+        soln_basis_projection_oper = std::make_unique<OPERATOR::vol_projection_operator<dim, 2 * dim>>(1, max_degree, init_grid_degree);
+
+        //build the oneD operator to perform interpolation/projection
+        soln_basis->build_1D_volume_operator(oneD_fe_collection_1state[max_degree], oneD_quadrature_collection[max_degree]);
+        soln_basis_projection_oper->build_1D_volume_operator(oneD_fe_collection_1state[max_degree], oneD_quadrature_collection[max_degree]);
+        operators_max_degree = max_degree;
+    }
+    const std::vector<real>& oneD_quad_weights = oneD_quadrature_collection[max_degree].get_weights();
 
+    // Cell averages of the unlimited solution, shared by every cell and its neighbours
+    compute_cell_averages(solution, dof_handler, fe_collection, volume_quadrature_collection);
 
-    //build the oneD operator to perform interpolation/projection
-    soln_basis.build_1D_volume_operator(oneD_fe_collection_1state[max_degree], oneD_quadrature_collection[max_degree]);
-    soln_basis_projection_oper.build_1D_volume_operator(oneD_fe_collection_1state[max_degree], oneD_quadrature_collection[max_degree]);
+    std::array<std::array<real, nstate>, dim> prev_cell_avg;
+    std::array<std::array<real, nstate>, dim> next_cell_avg;
+    std::array<real, nstate> soln_cell_avg;
 
     for (auto soln_cell : dof_handler.active_cell_iterators()) {
         if (!soln_cell->is_locally_owned()) continue;
 
-        std::array<real, nstate> prev_cell_avg;
-        std::array<real, nstate> next_cell_avg;
-
-        // Initialize all cell_avg arrays to zero
-        for (unsigned int istate = 0; istate < nstate; ++istate) {
-            prev_cell_avg[istate] = 0;
-            next_cell_avg[istate] = 0;
-        }
-
-        for (const auto face_no : soln_cell->face_indices()) {
-            if (soln_cell->neighbor(face_no).state() != dealii::IteratorState::valid) continue;
-
-            std::vector<dealii::types::global_dof_index> neigh_dofs_indices;
-            // Current reference element related to this physical cell
-            auto neigh = soln_cell->neighbor(face_no);
-            const int i_fele = soln_cell->active_fe_index();
-            const dealii::FESystem<dim, dim>& neigh_fe_ref = fe_collection[i_fele];
-            const int poly_degree = neigh_fe_ref.tensor_degree();
-
-            const unsigned int n_dofs_neigh_cell = neigh_fe_ref.n_dofs_per_cell();
-            // Obtain the mapping from local dof indices to global dof indices
-            neigh_dofs_indices.resize(n_dofs_neigh_cell);
-            neigh->get_dof_indices(neigh_dofs_indices);
-            
-            std::array<real, nstate> neigh_cell_avg = get_neighbour_cell_avg(solution, fe_collection, volume_quadrature_collection, soln_basis,
-                poly_degree, neigh_dofs_indices, n_dofs_neigh_cell);
-
-            if (face_no == 0) {
-                prev_cell_avg = neigh_cell_avg;
-            }
-            else if (face_no == 1) {
-                next_cell_avg = neigh_cell_avg;
-            }
+        // Faces 2*idim and 2*idim+1 are the left and right faces in direction idim
+        for (unsigned int idim = 0; idim < dim; ++idim) {
+            prev_cell_avg[idim] = get_neighbour_cell_avg(soln_cell, 2 * idim);
+            next_cell_avg[idim] = get_neighbour_cell_avg(soln_cell, 2 * idim + 1);
         }
-
-        std::vector<dealii::types::global_dof_index> current_dofs_indices;
-        // Current reference element related to this physical cell
-        const int i_fele = soln_cell->active_fe_index();
-        const dealii::FESystem<dim, dim>& current_fe_ref = fe_collection[i_fele];
-        const int poly_degree = current_fe_ref.tensor_degree();
-
-        const unsigned int n_dofs_curr_cell = current_fe_ref.n_dofs_per_cell();
-        // Obtain the mapping from local dof indices to global dof indices
-        current_dofs_indices.resize(n_dofs_curr_cell);
-        soln_cell->get_dof_indices(current_dofs_indices);
-
-        // Extract the local solution dofs in the cell from the global solution dofs
-        std::array<std::vector<real>, nstate> soln_coeff;
-        const unsigned int n_shape_fns = n_dofs_curr_cell / nstate;
-
         for (unsigned int istate = 0; istate < nstate; ++istate) {
-            soln_coeff[istate].resize(n_shape_fns);
+            soln_cell_avg[istate] = cell_avg[istate][soln_cell->active_cell_index()];
         }
 
-        // Allocate soln_coeff
-        for (unsigned int idof = 0; idof < n_dofs_curr_cell; ++idof) {
-            const unsigned int istate = fe_collection[poly_degree].system_to_component_index(idof).first;
-            const unsigned int ishape = fe_collection[poly_degree].system_to_component_index(idof).second;
-            soln_coeff[istate][ishape] = solution[current_dofs_indices[idof]];
-        }
-
-
+        const int poly_degree = fe_collection[soln_cell->active_fe_index()].tensor_degree();
         const unsigned int n_quad_pts = volume_quadrature_collection[poly_degree].size();
         const std::vector<real>& quad_weights = volume_quadrature_collection[poly_degree].get_weights();
 
-        std::array<std::vector<real>, nstate> soln_at_q;
+        get_soln_at_q(solution, soln_cell, fe_collection, n_quad_pts);
 
-        // Interpolate solution dofs to quadrature pts.
-        for (int istate = 0; istate < nstate; istate++) {
-            soln_at_q[istate].resize(n_quad_pts);
-            soln_basis.matrix_vector_mult_1D(soln_coeff[istate], soln_at_q[istate],
-                soln_basis.oneD_vol_operator);
-        }
-
-        std::array<real, nstate> soln_cell_avg = get_soln_cell_avg(soln_at_q, n_quad_pts, quad_weights);
-
-        std::array<std::vector<real>, nstate> soln_at_q_lim = limit_cell(soln_at_q, n_quad_pts, prev_cell_avg, soln_cell_avg, next_cell_avg, M, h);
+        limit_cell(soln_at_q, n_quad_pts, quad_weights, oneD_quad_weights, prev_cell_avg, soln_cell_avg, next_cell_avg, M, h);
 
         // Project solution at quadrature points to dofs.
         for (int istate = 0; istate < nstate; istate++) {
-            soln_basis_projection_oper.matrix_vector_mult_1D(soln_at_q_lim[istate], soln_coeff[istate],
-                soln_basis_projection_oper.oneD_vol_operator);
+            soln_basis_projection_oper->matrix_vector_mult_1D(soln_at_q[istate], soln_coeff[istate],
+                soln_basis_projection_oper->oneD_vol_operator);
         }
 
         // Write limited solution dofs to the global solution vector.
+        const unsigned int n_shape_fns = soln_coeff[0].size();
         for (int istate = 0; istate < nstate; istate++) {
             for (unsigned int ishape = 0; ishape < n_shape_fns; ++ishape) {
                 const unsigned int idof = istate * n_shape_fns + ishape;
@@ -298,17 +331,16 @@ void TVBLimiter<dim, nspecies, nstate, real>::limit(
         }
     }
 }
-#if PHILIP_DIM==1
-    #if PHILIP_SPECIES==1
-        // Define a sequence of nstate in the range [1, 6]
-        #define POSSIBLE_NSTATE (1)(2)(3)(4)(5)(6)
-
-        // Define a macro to instantiate Limiter Function for a specific nstate
-        #define INSTANTIATE_LIMITER(r, data, nstate) \
-            template class TVBLimiter <PHILIP_DIM, PHILIP_SPECIES, nstate, double>;
-        BOOST_PP_SEQ_FOR_EACH(INSTANTIATE_LIMITER, _, POSSIBLE_NSTATE)
-    #else
-        template class TVBLimiter <PHILIP_DIM, PHILIP_SPECIES, PHILIP_DIM+PHILIP_SPECIES+1, double>;
-    #endif
+
+#if PHILIP_SPECIES==1
+    // Define a sequence of nstate in the range [1, 6]
+    #define POSSIBLE_NSTATE (1)(2)(3)(4)(5)(6)
+
+    // Define a macro to instantiate Limiter Function for a specific nstate
+    #define INSTANTIATE_LIMITER(r, data, nstate) \
+        template class TVBLimiter <PHILIP_DIM, PHILIP_SPECIES, nstate, double>;
+    BOOST_PP_SEQ_FOR_EACH(INSTANTIATE_LIMITER, _, POSSIBLE_NSTATE)
+#else
+    template class TVBLimiter <PHILIP_DIM, PHILIP_SPECIES, PHILIP_DIM+PHILIP_SPECIES+1, double>;
 #endif
 } // PHiLiP namespace
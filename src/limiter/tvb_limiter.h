@@ -23,31 +23,47 @@ public:
     ~TVBLimiter() = default;
 
 private:
-    /// Function to limit cell - apply minmod function, obtain theta (linear scaling value) and apply limiter
-    std::array<std::vector<real>, nstate> limit_cell(
-        std::array<std::vector<real>, nstate>                   soln_at_q,
+    /// Function to limit cell - apply minmod function in each direction, obtain theta (linear scaling value) and apply limiter
+    /** The face values of the cell in direction idim are the averages of the solution over the GLL nodes lying on the
+     *  faces 2*idim and 2*idim+1, so the 1D face values are recovered when dim == 1.
+     *  In 1D the limited face values are set directly as in Chen, Shu 2017. In 2D and 3D, the solution is scaled about
+     *  the cell average by the smallest theta in [0,1] among the directions.
+     */
+    void limit_cell(
+        std::array<std::vector<real>, nstate>&                  soln_at_q,
         const unsigned int                                      n_quad_pts,
-        const std::array<real, nstate>                          prev_cell_avg,
-        const std::array<real, nstate>                          soln_cell_avg,
-        const std::array<real, nstate>                          next_cell_avg,
-        const std::array<real, nstate>                          M,
+        const std::vector<real>&                                quad_weights,
+        const std::vector<real>&                                oneD_quad_weights,
+        const std::array<std::array<real, nstate>, dim>&        prev_cell_avg,
+        const std::array<real, nstate>&                         soln_cell_avg,
+        const std::array<std::array<real, nstate>, dim>&        next_cell_avg,
+        const std::array<real, nstate>&                         M,
         const double                                            h);
 
-    /// Function to obtain the neighbour cell average
+    /// Function to compute the cell average of every locally owned and ghost cell once per call to limit
+    /** The solution is ghosted, so the averages of the ghost cells are computed locally instead of being communicated.
+     */
+    void compute_cell_averages(
+        const dealii::LinearAlgebra::distributed::Vector<double>&       solution,
+        const dealii::DoFHandler<dim>&                                  dof_handler,
+        const dealii::hp::FECollection<dim>&                            fe_collection,
+        const dealii::hp::QCollection<dim>&                             volume_quadrature_collection);
+
+    /// Function to obtain the neighbour cell average across a face from the stored cell averages
+    /** Returns zero on boundary faces. If the neighbour is refined, the averages of the children adjacent to the face are averaged.
+     */
     std::array<real, nstate> get_neighbour_cell_avg(
+        const typename dealii::DoFHandler<dim>::active_cell_iterator&   soln_cell,
+        const unsigned int                                              face_no) const;
+
+    /// Function to interpolate the solution dofs of a cell to its quadrature points
+    /** Fills soln_coeff, soln_at_q and current_dofs_indices, which are reused from cell to cell.
+     */
+    void get_soln_at_q(
         const dealii::LinearAlgebra::distributed::Vector<double>&       solution,
+        const typename dealii::DoFHandler<dim>::active_cell_iterator&   soln_cell,
         const dealii::hp::FECollection<dim>&                            fe_collection,
-        const dealii::hp::QCollection<dim>&                             volume_quadrature_collection,
-        OPERATOR::basis_functions<dim, 2 * dim>                         soln_basis,
-        const int                                                       poly_degree,
-        const std::vector<dealii::types::global_dof_index>&             neigh_dofs_indices,
-        const unsigned int                                              n_dofs_neigh_cell);
-
-    /// Function to obtain the current cell average
-    std::array<real, nstate> get_current_cell_avg(
-        std::array<std::vector<real>, nstate> soln_at_q,
-        const unsigned int n_quad_pts,
-        const std::vector<real>& quad_weights);
+        const unsigned int                                              n_quad_pts);
 
     /// Function to apply modified_minmod using Thm3.7 in Chen, Shu 2017
     real apply_modified_minmod(
@@ -58,12 +74,35 @@ private:
         const double        diff_prev_state,
         const double        cell_avg_state,
         const bool          left_face);
+
+    /// Cell average of each state, indexed by the active cell index
+    std::array<std::vector<real>, nstate> cell_avg;
+
+    /// Polynomial degree with which the operators were last built
+    unsigned int operators_max_degree;
+
+    /// Solution basis evaluated at the volume quadrature nodes
+    std::unique_ptr<OPERATOR::basis_functions<dim, 2 * dim>> soln_basis;
+
+    /// Projection of the solution at the volume quadrature nodes onto the modal coefficients
+    std::unique_ptr<OPERATOR::vol_projection_operator<dim, 2 * dim>> soln_basis_projection_oper;
+
+    /// Global dof indices of the current cell
+    std::vector<dealii::types::global_dof_index> current_dofs_indices;
+
+    /// Solution coefficients of the current cell
+    std::array<std::vector<real>, nstate> soln_coeff;
+
+    /// Solution of the current cell at the quadrature nodes
+    std::array<std::vector<real>, nstate> soln_at_q;
+
 public:
     /// Function to obtain the solution cell average
     using BoundPreservingLimiterState<dim, nspecies, nstate, real>::get_soln_cell_avg;
 
     /// Applies total variation bounded limiter to the solution.
-    /// Using Chen,Shu September 2017 Thm3.7 we apply a limiter on the solution
+    /// Using Chen,Shu September 2017 Thm3.7 we apply a limiter on the solution, dimension by dimension on tensor-product meshes.
+    /// The cell averages are computed once per call and reused for the minmod test of every neighbour.
     void limit(
         dealii::LinearAlgebra::distributed::Vector<double>&     solution,
         const dealii::DoFHandler<dim>&                          dof_handler,
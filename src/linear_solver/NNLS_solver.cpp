@@ -1,6 +1,9 @@
 
 #include "NNLS_solver.h"
 #include "helper_functions.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
 
 namespace PHiLiP {
 
@@ -131,171 +134,248 @@ NNLSSolver::NNLSSolver(
     all_parameters(parameters_input),
     parameter_handler(parameter_handler_input),
     Comm_(Comm), 
-    A_((Comm.NumProc() == 1) ?  transpose_matrix_on_single_core(A, is_input_A_matrix_transposed) : allocate_matrix_to_single_core(A, is_input_A_matrix_transposed)),
-    b_((Comm.NumProc() == 1) ?  b : allocate_vector_to_single_core(b)), 
-    x_(A_.ColMap()), 
-    multi_x_((is_input_A_matrix_transposed) ? A.RowMap(): A.ColMap()),
+    num_columns_(0),
+    multi_x_((is_input_A_matrix_transposed) ? A.RowMap(): A.DomainMap()),
     LS_iter_(LS_iter), 
     LS_tol_(LS_tol),
-    Z(A_.NumGlobalCols()), 
-    P(A_.NumGlobalCols()), 
     iter_solver_(iter_solver), 
     grad_exit_crit_(grad_exit_crit),
-    is_input_A_matrix_transposed_(is_input_A_matrix_transposed)
+    is_input_A_matrix_transposed_(is_input_A_matrix_transposed),
+    iter_(0)
     {
-      index_set = Eigen::VectorXd::LinSpaced(A_.NumGlobalCols(), 0, A_.NumGlobalCols() -1); // Indices proceeding and including numInactive are in the P set (Inactive/Positive)
-      Z.flip(); // All columns begin in the Z set (Active)
-      //EpetraExt::RowMatrixToMatlabFile("C_multicore_consol", A_);
+      distribute_over_rows(A, b);
+      P.assign(num_columns_, false); // All columns begin in the Z set (Active)
     }
 
-void NNLSSolver::epetra_permutation_matrix(Epetra_CrsMatrix &P_mat){
-  // Fill diagonal matrix with ones in the positive set
-  // No longer in use
-  double posOne = 1.0;
-  for(int i = 0; i < P_mat.NumMyCols(); i++){
-    int globalRow = P_mat.GRID(i);
-    if (P[i] == 1) {
-      P_mat.InsertGlobalValues(globalRow, 1, &posOne , &i);
+void NNLSSolver::distribute_over_rows(const Epetra_CrsMatrix &A, const Epetra_Vector &b){
+  // The rows of A are kept on the cores that own them. If A^T was given, it is transposed in parallel,
+  // such that the rows of A follow the domain map of A^T (no data is gathered on a single core)
+  EpetraExt::RowMatrix_Transpose transposer;
+  const Epetra_RowMatrix *A_rows = &A;
+  if (is_input_A_matrix_transposed_){
+    A_rows = &transposer(const_cast<Epetra_CrsMatrix &>(A));
+  }
+  const Epetra_Map &row_map = A_rows->RowMatrixRowMap();
+  const Epetra_Map &col_map = A_rows->RowMatrixColMap();
+  num_columns_ = A_rows->NumGlobalCols();
+
+  // Store the local rows densely, such that each column of A is contiguous in memory
+  A_local_ = Eigen::MatrixXd::Zero(A_rows->NumMyRows(), num_columns_);
+  const int max_num_entries = A_rows->MaxNumEntries();
+  std::vector<double> values(max_num_entries);
+  std::vector<int> indices(max_num_entries);
+  for(int i = 0; i < A_rows->NumMyRows(); i++){
+    int num_entries;
+    A_rows->ExtractMyRowCopy(i, max_num_entries, num_entries, values.data(), indices.data());
+    for(int j = 0; j < num_entries; j++){
+      A_local_(i, col_map.GID(indices[j])) = values[j];
     }
   }
+
+  // Move b onto the row distribution of A
+  Epetra_Import b_importer(row_map, b.Map());
+  Epetra_Vector b_rows(row_map);
+  b_rows.Import(b, b_importer, Epetra_CombineMode::Insert);
+  b_local_.resize(b_rows.MyLength());
+  for(int i = 0; i < b_rows.MyLength(); i++){
+    b_local_(i) = b_rows[i];
+  }
+
+  x_ = Eigen::VectorXd::Zero(num_columns_);
 }
 
-void NNLSSolver::positive_set_matrix(Epetra_CrsMatrix &P_mat){
-  // Create matrix P_mat which contains the positive set of columns in A
-
-  // Create map between index_set and the columns to be added to P_mat
-  std::vector<int> colMap(A_.NumGlobalCols());
-  int numCol = 0;
-  for(int j = 0; j < A_.NumGlobalCols(); j++){
-    int idx = index_set[j];
-    if (P[idx] == 1) {
-      colMap[idx] = numCol;
-      numCol++;
-    }
+void NNLSSolver::starting_solution(Epetra_Vector &start){
+  // Replicate the starting solution on all cores
+  Epetra_LocalMap all_cores_map(num_columns_, 0, Comm_);
+  Epetra_Import start_importer(all_cores_map, start.Map());
+  Epetra_Vector start_all_cores(all_cores_map);
+  start_all_cores.Import(start, start_importer, Epetra_CombineMode::Insert);
+  for(int j = 0; j < num_columns_; j++){
+    x_(j) = start_all_cores[j];
   }
+}
 
-  // Fill Epetra_CrsMatrix P_mat with columns of A in set P
-  for(int i =0; i < A_.NumGlobalRows(); i++){
-    double *row = new double[A_.NumGlobalCols()];
-    int numE;
-    const int globalRow = A_.GRID(i);
-    A_.ExtractGlobalRowCopy(globalRow, A_.NumGlobalCols(), numE , row);
-    for(int j = 0; j < A_.NumGlobalCols(); j++){
-      if (P[j] == 1) {
-        P_mat.InsertGlobalValues(i, 1, &row[j] , &colMap[j]);
-        
-      }
+void NNLSSolver::sum_over_cores(Eigen::VectorXd &v) const{
+  const Eigen::VectorXd v_local = v;
+  Comm_.SumAll(const_cast<double *>(v_local.data()), v.data(), v.size());
+}
+
+void NNLSSolver::sum_over_cores(Eigen::MatrixXd &M) const{
+  const Eigen::MatrixXd M_local = M;
+  Comm_.SumAll(const_cast<double *>(M_local.data()), M.data(), M.size());
+}
+
+double NNLSSolver::global_norm(const Eigen::VectorXd &v_local) const{
+  double norm_sq_local = v_local.squaredNorm();
+  double norm_sq = 0.0;
+  Comm_.SumAll(&norm_sq_local, &norm_sq, 1);
+  return std::sqrt(norm_sq);
+}
+
+std::vector<int> NNLSSolver::select_entering_columns(const Eigen::VectorXd &gradient, const std::vector<bool> &blocked) const{
+  // Only columns which decrease the residual (positive gradient) can enter the inactive set
+  std::vector<int> candidates;
+  for(int j = 0; j < num_columns_; j++){
+    if (!P[j] && !blocked[j] && gradient(j) > 0.0) {
+      candidates.push_back(j);
     }
-    delete[] row;
   }
+  // Keep the columns with the largest gradient, ties are broken by index so every core picks the same columns
+  const int max_columns = std::max(1, all_parameters->hyper_reduction_param.NNLS_max_columns_per_iteration);
+  const int num_entering = std::min(max_columns, static_cast<int>(candidates.size()));
+  std::partial_sort(candidates.begin(), candidates.begin() + num_entering, candidates.end(),
+    [&gradient](const int a, const int b){
+      return (gradient(a) > gradient(b)) || (gradient(a) == gradient(b) && a < b);
+    });
+  candidates.resize(num_entering);
+  return candidates;
 }
 
-void NNLSSolver::sub_into_x(Epetra_Vector &temp){
-  // Substitute new values into the solution vector
-  std::vector<int> colMap(A_.NumGlobalCols());
-  int numCol = 0;
-  for(int j = 0; j < x_.MyLength(); j++){
-    int idx = index_set[j];
-    if (P[idx] == 1) {
-      colMap[idx] = numCol;
-      numCol++;
+int NNLSSolver::add_columns_to_positive_set(const std::vector<int> &candidates, std::vector<bool> &blocked){
+  const int num_positive = positive_set_.size();
+  const int num_candidates = candidates.size();
+
+  // Inner products of each candidate with the columns already in R_ and with the other candidates
+  Eigen::MatrixXd cross_products(num_positive + num_candidates, num_candidates);
+  for(int c = 0; c < num_candidates; c++){
+    const auto a_c = A_local_.col(candidates[c]);
+    for(int i = 0; i < num_positive; i++){
+      cross_products(i, c) = A_local_.col(positive_set_[i]).dot(a_c);
+    }
+    for(int i = 0; i < num_candidates; i++){
+      cross_products(num_positive + i, c) = A_local_.col(candidates[i]).dot(a_c);
     }
   }
-  for(int j = 0; j < x_.MyLength(); j++){
-    if (P[j] == 1) {
-      x_[j] = temp[colMap[j]];
+  sum_over_cores(cross_products);
+
+  // Append the columns one at a time: for the new column a, R^T r = A_P^T a and rho^2 = ||a||^2 - ||r||^2
+  const double dependence_tol = 1E3 * std::numeric_limits<double>::epsilon();
+  std::vector<int> added;
+  for(int c = 0; c < num_candidates; c++){
+    const int k = positive_set_.size();
+    Eigen::VectorXd inner_products(k);
+    inner_products.head(num_positive) = cross_products.col(c).head(num_positive);
+    for(unsigned int a = 0; a < added.size(); a++){
+      inner_products(num_positive + a) = cross_products(num_positive + added[a], c);
     }
+    const Eigen::VectorXd r = R_.triangularView<Eigen::Upper>().transpose().solve(inner_products);
+    const double column_norm_sq = cross_products(num_positive + c, c);
+    const double rho_sq = column_norm_sq - r.squaredNorm();
+    if (rho_sq <= dependence_tol * column_norm_sq) {
+      // Column is (numerically) in the span of the inactive set, adding it would make R_ singular
+      blocked[candidates[c]] = true;
+      continue;
+    }
+    R_.conservativeResize(k+1, k+1);
+    R_.row(k).setZero();
+    R_.col(k).head(k) = r;
+    R_(k, k) = std::sqrt(rho_sq);
+
+    positive_set_.push_back(candidates[c]);
+    P[candidates[c]] = true;
+    added.push_back(c);
   }
+  return added.size();
 }
 
-void NNLSSolver::add_into_x(Epetra_Vector &temp, double alpha){
-  // Add vector temp time scalar alpha into the vector x
-  std::vector<int> colMap(A_.NumGlobalCols());
-  int numCol = 0;
-  for(int j = 0; j < x_.MyLength(); j++){
-    int idx = index_set[j];
-    if (P[idx] == 1) {
-      colMap[idx] = numCol;
-      numCol++;
-    }
+void NNLSSolver::remove_column_from_positive_set(const int idx){
+  // Move column at idx into the Active Set (Z set)
+  const int k = positive_set_.size();
+  P[positive_set_[idx]] = false;
+  positive_set_.erase(positive_set_.begin() + idx);
+
+  // Deleting column idx of R_ leaves an upper Hessenberg matrix, which is re-triangularized with Givens rotations
+  for(int j = idx; j < k-1; j++){
+    R_.col(j) = R_.col(j+1);
   }
-  for(int j = 0; j < x_.MyLength(); j++){
-    if (P[j] == 1) {
-      x_[j] += alpha*(temp[colMap[j]] -x_[j]);
-    }
+  for(int j = idx; j < k-1; j++){
+    Eigen::JacobiRotation<double> G;
+    G.makeGivens(R_(j, j), R_(j+1, j));
+    R_.applyOnTheLeft(j, j+1, G.adjoint());
+    R_(j+1, j) = 0.0;
   }
+  R_ = R_.topLeftCorner(k-1, k-1).eval();
 }
 
-void NNLSSolver::move_to_active_set(int idx){
-  // Move index at idx into the Active Set (Z set)
-  P[index_set(idx)] = 0;
-  Z[index_set(idx)] = 1; 
-
-  std::swap(index_set(idx), index_set(numInactive_ - 1));
-  numInactive_--;
+Eigen::VectorXd NNLSSolver::solve_semi_normal_equations(const Eigen::VectorXd &rhs) const{
+  const Eigen::VectorXd y = R_.triangularView<Eigen::Upper>().transpose().solve(rhs);
+  return R_.triangularView<Eigen::Upper>().solve(y);
 }
 
-void NNLSSolver::move_to_inactive_set(int idx){
-  // Move index at idx into the Inactive Set (P set)
-  P[index_set(idx)] = 1;
-  Z[index_set(idx)] = 0;
+Eigen::VectorXd NNLSSolver::solve_positive_set_least_squares(const Eigen::VectorXd &Atb) const{
+  const int k = positive_set_.size();
+  Eigen::VectorXd z(k);
+  if (k == 0) return z;
+
+  Eigen::VectorXd Ptb(k);
+  for(int i = 0; i < k; i++){
+    Ptb(i) = Atb(positive_set_[i]);
+  }
+  z = solve_semi_normal_equations(Ptb);
+
+  // Correction steps with the residual computed from A itself (corrected semi-normal equations)
+  // A single step recovers the accuracy of a QR solve, more can be requested by setting iter_solver_ to true
+  const int num_refinements = (iter_solver_) ? LS_iter_ : 1;
+  Eigen::VectorXd residual(b_local_.size());
+  Eigen::VectorXd Ptr(k);
+  for(int s = 0; s < num_refinements; s++){
+    residual = b_local_;
+    for(int i = 0; i < k; i++){
+      residual.noalias() -= z(i) * A_local_.col(positive_set_[i]);
+    }
+    for(int i = 0; i < k; i++){
+      Ptr(i) = A_local_.col(positive_set_[i]).dot(residual);
+    }
+    sum_over_cores(Ptr);
+    const Eigen::VectorXd dz = solve_semi_normal_equations(Ptr);
+    z += dz;
+    if (dz.norm() <= LS_tol_ * z.norm()) break;
+  }
+  return z;
+}
 
-  std::swap(index_set(idx), index_set(numInactive_));
-  numInactive_++;
+void NNLSSolver::copy_solution_to_multiple_cores(){
+  // x_ is replicated, so every core fills its own entries without communication
+  for(int i = 0; i < multi_x_.MyLength(); i++){
+    multi_x_[i] = x_(multi_x_.Map().GID(i));
+  }
 }
 
 bool NNLSSolver::solve(){
-  const int rank = this->Comm_.MyPID();
   iter_ = 0;
-  numInactive_ = 0;
-  // Pre-mult by A^T
-  Epetra_CrsMatrix AtA(Epetra_DataAccess::Copy, A_.ColMap(), A_.NumMyCols());
-  EpetraExt::MatrixMatrix::Multiply(A_, true, A_, false, AtA);
+  positive_set_.clear();
+  P.assign(num_columns_, false);
+  R_.resize(0, 0);
 
-  Epetra_Vector Atb (A_.ColMap());
-  A_.Multiply(true, b_, Atb);
+  // Pre-mult by A^T
+  Eigen::VectorXd Atb = A_local_.transpose() * b_local_;
+  sum_over_cores(Atb);
+  const double normb = global_norm(b_local_);
 
-  Epetra_Vector AtAx (A_.ColMap());
-  Epetra_Vector Ax (A_.RowMap());
-  Epetra_MultiVector gradient (A_.ColMap(), 1);
-  Epetra_MultiVector residual (A_.RowMap(), 1);
-  Eigen::VectorXd grad_eig (gradient.GlobalLength());
-  Epetra_Vector grad_col (A_.ColMap());
+  Eigen::VectorXd residual(b_local_.size());
+  Eigen::VectorXd gradient(num_columns_);
+  // Columns found to be dependent on the inactive set or dropped from it, cleared whenever a step changes x
+  std::vector<bool> blocked(num_columns_, false);
 
   // OUTER LOOP
   while(true){
-    // Early exit if all variables are inactive, which breaks 'maxCoeff' below. 
-    if (A_.NumGlobalCols() == numInactive_){
-      multi_x_ = allocate_vector_to_multiple_cores(this->x_, this->multi_x_);
+    // Early exit if all variables are inactive
+    if (num_columns_ == static_cast<int>(positive_set_.size())){
+      copy_solution_to_multiple_cores();
       return true;
     }
-    AtA.Multiply(false, x_, AtAx);
-    gradient = Atb;
-    gradient.Update(-1.0, AtAx, 1.0); // gradient = A^T * (b-A*x)
-
-    grad_col = *gradient(0);
-    for(int i = 0; i < gradient.MyLength() ; ++i){
-      grad_eig[i] = grad_col[i];
-    }
+    residual = b_local_;
+    residual.noalias() -= A_local_ * x_; // residual = b - A*x
+    const double normRes = global_norm(residual);
+    gradient.noalias() = A_local_.transpose() * residual;
+    sum_over_cores(gradient); // gradient = A^T * (b-A*x)
 
     // Find the maximum element of the gradient in the active set
-    // Move that variable to the inactive set
-    int numActive = A_.NumGlobalCols() - numInactive_;
-    int argmaxGradient = -1;
-    double maxGradient;
-    if(rank==0){
-      maxGradient = grad_eig(index_set.tail(numActive)).maxCoeff(&argmaxGradient);
+    double maxGradient = -Eigen::NumTraits<double>::highest();
+    for(int j = 0; j < num_columns_; j++){
+      if (!P[j]) maxGradient = std::max(maxGradient, gradient(j));
     }
-    MPI_Bcast(&maxGradient,1,MPI_DOUBLE,0,MPI_COMM_WORLD);
-    argmaxGradient += numInactive_;
-    MPI_Bcast(&argmaxGradient,1, MPI_INT,0,MPI_COMM_WORLD);
-    residual = b_;
-    A_.Multiply(false, x_, Ax);
-    residual.Update(-1.0, Ax, 1.0); // residual = b - A*x
-    double normRes[1];
-    residual.Norm2(normRes);
-    double normb[1];
-    b_.Norm2(normb);
+
     // Old exit condition dependent on the maxGradient
     // Original exit condition presented in "SOLVING LEAST SQUARES PROBLEMS", by Charles L. Lawson and
     // Richard J. Hanson, Prentice-Hall, 1974
@@ -304,10 +384,10 @@ bool NNLSSolver::solve(){
       if (maxGradient < all_parameters->hyper_reduction_param.NNLS_tol){
         std::cout << "Exited due to Gradient Criteria" << std::endl;
         std::cout << "Norm-2 of b" << std::endl;
-        std::cout << normb[0] << std::endl;
+        std::cout << normb << std::endl;
         std::cout << "Norm-2 of the residual (b-A*x)" << std::endl;
-        std::cout << normRes[0] << std::endl;
-        multi_x_ = allocate_vector_to_multiple_cores(this->x_, this->multi_x_);
+        std::cout << normRes << std::endl;
+        copy_solution_to_multiple_cores();
         return true;
       }
     }
@@ -316,106 +396,108 @@ bool NNLSSolver::solve(){
     // by Chapman et. al, 2016 (EQUATION 13)
     // https://onlinelibrary.wiley.com/doi/full/10.1002/nme.5332
     else {
-      if ((normRes[0]) <= (all_parameters->hyper_reduction_param.NNLS_tol * normb[0])){
+      if (normRes <= (all_parameters->hyper_reduction_param.NNLS_tol * normb)){
         std::cout << "Exited due to Residual Criteria" << std::endl;
         std::cout << "Norm-2 of b" << std::endl;
-        std::cout << normb[0] << std::endl;
+        std::cout << normb << std::endl;
         std::cout << "Norm-2 of the residual (b-A*x)" << std::endl;
-        std::cout << normRes[0] << std::endl;
-        multi_x_ = allocate_vector_to_multiple_cores(this->x_, this->multi_x_);
+        std::cout << normRes << std::endl;
+        copy_solution_to_multiple_cores();
         return true;
       }
     }
-    
-    move_to_inactive_set(argmaxGradient);
+
+    // Move the variables with the largest gradient to the inactive set
+    const std::vector<int> entering_columns = select_entering_columns(gradient, blocked);
+    if (entering_columns.empty()){
+      // No column can decrease the residual further, the tolerance cannot be reached
+      std::cout << "Exited since no column of the active set can decrease the residual" << std::endl;
+      copy_solution_to_multiple_cores();
+      return false;
+    }
+    if (add_columns_to_positive_set(entering_columns, blocked) == 0) continue;
 
     // INNER LOOP 
     bool no_feasible_soln = true;
     while(no_feasible_soln){
       // Check if max. number of iterations is reached
       if (iter_ >= all_parameters->hyper_reduction_param.NNLS_max_iter){
-        multi_x_ = allocate_vector_to_multiple_cores(this->x_, this->multi_x_);
+        copy_solution_to_multiple_cores();
         return false;
       } 
-      // Create matrix P_mat with columns from set P
-      Epetra_Map Map(A_.NumGlobalRows(),(rank == 0) ?  A_.NumGlobalRows() : 0, 0, Comm_);
-      Epetra_Map ColMap(numInactive_,(rank == 0) ?  numInactive_ : 0, 0, Comm_);
-      Epetra_CrsMatrix P_mat(Epetra_DataAccess::Copy, Map, numInactive_);
-      positive_set_matrix(P_mat);
-      P_mat.FillComplete(ColMap, Map);
-      // Create temporary solution vector temp which is only the length of numInactive
-      Epetra_Vector temp(P_mat.ColMap());
-
-      // Set up normal equations
-      Epetra_CrsMatrix PtP(Epetra_DataAccess::Copy, P_mat.ColMap(), P_mat.NumMyCols());
-      EpetraExt::MatrixMatrix::Multiply(P_mat, true, P_mat, false, PtP);
-
-      Epetra_Vector Ptb (P_mat.ColMap());
-      P_mat.Multiply(true, b_, Ptb);
-      // An iterative solver can be used by setting iter_solver_ to true
-      if (iter_solver_){
-        // Solve least-squares problem in inactive set only
-        Epetra_LinearProblem problem(&P_mat, &temp, &b_);
-        AztecOO solver(problem);
-
-        // Iterative Solver Setup
-        solver.SetAztecOption(AZ_conv, AZ_rhs);
-        solver.SetAztecOption( AZ_precond, AZ_Jacobi);
-        solver.SetAztecOption(AZ_output, AZ_none);
-        solver.Iterate(LS_iter_, LS_tol_);
-      }
-      else{
-        // Solve least-squares problem in inactive set only
-        Epetra_LinearProblem problem(&PtP, &temp, &Ptb);
-
-        // Direct Solver Setup
-        Amesos Factory;
-        std::string SolverType = "Klu";
-        std::unique_ptr<Amesos_BaseSolver> Solver(Factory.Create(SolverType, problem));
-
-        Teuchos::ParameterList List;
-        Solver->SetParameters(List);
-        Solver->SymbolicFactorization();
-        Solver->NumericFactorization();
-        Solver->Solve();
-      }
+      // Solve least-squares problem in inactive set only
+      const Eigen::VectorXd temp = solve_positive_set_least_squares(Atb);
       iter_++; // The solve is expensive, so that is what we count as an iteration
-      
+
+      // Columns still at zero with a negative LS value are dropped from the inactive set without a step,
+      // since removing them leaves x unchanged. This only happens to columns that just entered, and is
+      // needed when several columns enter at once (a single entering column has a positive value in exact arithmetic)
+      // Entries which are zero up to round-off are not treated as negative, otherwise degenerate
+      // problems remove those columns one solve at a time without changing x
+      const double zero_tol = (temp.size() == 0) ? 0.0 : 1E3 * std::numeric_limits<double>::epsilon() * temp.cwiseAbs().maxCoeff();
+      bool dropped_columns = false;
+      for(int k = positive_set_.size() - 1; k >= 0; k--){
+        const int idx = positive_set_[k];
+        if (x_(idx) == 0.0 && temp(k) < -zero_tol){
+          remove_column_from_positive_set(k);
+          // Skipped in the next selection, otherwise the same columns would enter again
+          blocked[idx] = true;
+          dropped_columns = true;
+        }
+      }
+      if (dropped_columns) continue;
+
       // Check feasability...
+      // Every core holds the same positive set and solution, so no broadcast is needed
+      const int numInactive = positive_set_.size();
       bool feasible = true;
-      double alpha = Eigen::NumTraits<Eigen::VectorXd::Scalar>::highest();
+      double alpha = Eigen::NumTraits<double>::highest();
       int infeasibleIdx = -1;
-      if(rank == 0){ // Will only proceed on the root as the other cores do no have access to this information
-        for(int k = 0; k < numInactive_; k++){
-          int idx = index_set[k];
-          if (temp[k] < 0){
-            // t should always be in [0,1]
-            double t = -x_[idx]/(temp[k] - x_[idx]);
-            if (alpha > t){
-              alpha = t;
-              infeasibleIdx = k;
-              feasible = false;
-            }
+      for(int k = 0; k < numInactive; k++){
+        const int idx = positive_set_[k];
+        if (temp(k) < -zero_tol){
+          // t should always be in [0,1]
+          const double t = -x_(idx)/(temp(k) - x_(idx));
+          if (alpha > t){
+            alpha = t;
+            infeasibleIdx = k;
+            feasible = false;
           }
         }
       }
-      // Broadcast these variables so that the loop does not fail on other cores
-      MPI_Bcast(&feasible,1,MPI_CXX_BOOL,0,MPI_COMM_WORLD);
-      MPI_Bcast(&infeasibleIdx, 1, MPI_INT,0,MPI_COMM_WORLD);
-      MPI_Bcast(&alpha,1,MPI_DOUBLE,0,MPI_COMM_WORLD);
       eigen_assert(feasible || 0 <= infeasibleIdx);
 
       // If solution is feasible, exit to outer loop
       if (feasible){
-        sub_into_x(temp);
+        bool x_changed = false;
+        for(int k = 0; k < numInactive; k++){
+          const int idx = positive_set_[k];
+          const double x_new = std::max(temp(k), 0.0);
+          x_changed = x_changed || (x_new != x_(idx));
+          x_(idx) = x_new;
+        }
+        // The gradient has changed with x, so the blocked columns may enter again.
+        // They stay blocked if x did not move, otherwise the same columns would be selected again.
+        if (x_changed) std::fill(blocked.begin(), blocked.end(), false);
         no_feasible_soln = false;
       }
       else{
         // Infeasible solution -> interpolate to feasible one
-        add_into_x(temp, alpha);
-
-        // Remove the infeasibleIdx column from the inactive set
-        move_to_active_set(infeasibleIdx);
+        for(int k = 0; k < numInactive; k++){
+          const int idx = positive_set_[k];
+          x_(idx) += alpha*(temp(k) - x_(idx));
+        }
+        // Remove the infeasibleIdx column, and any other column which reached zero, from the inactive set
+        x_(positive_set_[infeasibleIdx]) = 0.0;
+        for(int k = numInactive - 1; k >= 0; k--){
+          const int idx = positive_set_[k];
+          if (x_(idx) <= 0.0){
+            x_(idx) = 0.0;
+            remove_column_from_positive_set(k);
+          }
+        }
+        // x has changed, so previously dependent or dropped columns may enter again
+        std::fill(blocked.begin(), blocked.end(), false);
       }
     }
   }
@@ -40,8 +40,18 @@
  * 
  * Additionally Functionality added to the Eigen NNLS:
  * -Option to use Gradient Exit Condition (used in Eigen/original textbook) or Residual Exit Condition (default - Introduced in ECSW work) (discussed further in NNLS_solver.cpp)
- * -Option to use an iterative linear solver or direct solve (default) for LS problem in the algorithm
+ * -Option to use iterative refinement or a single correction step (default) for LS problem in the algorithm
  * -Option to input a transposed matrix
+ * -Option to move several columns into the positive set per outer iteration
+ *
+ * The least-squares problem on the positive set is not re-assembled and re-factored every inner iteration.
+ * Instead, the triangular factor R of the QR factorization A_P = Q R of the positive-set columns is kept
+ * and updated as columns enter (appended column) and leave (Givens rotations) the set, following
+ * "A fast non-negativity-constrained least squares algorithm", R. Bro and S. de Jong, 1997
+ * https://doi.org/10.1002/(SICI)1099-128X(199709/10)11:5<393::AID-CEM483>3.0.CO;2-L
+ * Q is never formed; each LS solve uses the corrected semi-normal equations R^T R z = A_P^T b.
+ * The rows of A are distributed over the cores, so that only inner products of length equal to the
+ * number of columns are reduced across the cores, and R is replicated on every core.
 */
 
 #ifndef NNLS_H
@@ -57,12 +67,11 @@
 #include <Epetra_Vector.h>
 #include <Epetra_MultiVector.h>
 #include <Epetra_Import.h>
-#include <Epetra_LinearProblem.h>
+#include <Epetra_LocalMap.h>
 #include <EpetraExt_MatrixMatrix.h>
-#include <AztecOO.h>
-#include <Amesos.h>
-#include <Amesos_BaseSolver.h>
+#include <EpetraExt_Transpose_RowMatrix.h>
 #include <eigen/Eigen/Dense>
+#include <eigen/Eigen/Jacobi>
 #include "parameters/all_parameters.h"
 #include "reduced_order/multi_core_helper_functions.h"
 
@@ -113,7 +122,7 @@ public:
         Epetra_Vector &b, 
         bool grad_exit_crit);
     
-    /// Constructor w/ Iterative Linear Solver
+    /// Constructor w/ Iterative Refinement of the LS solves
     NNLSSolver(        
         const Parameters::AllParameters *const parameters_input,
         const dealii::ParameterHandler &parameter_handler_input,
@@ -124,7 +133,7 @@ public:
         int LS_iter, 
         double LS_tol);
 
-    /// Constructor w/ Iterative Linear Solver & transposed A matrix
+    /// Constructor w/ Iterative Refinement of the LS solves & transposed A matrix
     NNLSSolver(        
         const Parameters::AllParameters *const parameters_input,
         const dealii::ParameterHandler &parameter_handler_input,
@@ -136,7 +145,7 @@ public:
         int LS_iter, 
         double LS_tol);
 
-    /// Common Constructor w/ Gradient Exit Condition & Iterative Linear Solver & transposed A matrix
+    /// Common Constructor w/ Gradient Exit Condition & Iterative Refinement & transposed A matrix
     NNLSSolver(
         const Parameters::AllParameters *const parameters_input,
         const dealii::ParameterHandler &parameter_handler_input,
@@ -159,11 +168,7 @@ public:
     Epetra_Vector & get_solution() {return multi_x_;}
 
     /// Initiliazes the solution vector, must be used before .solve is called
-    void starting_solution(Epetra_Vector &start) {
-        Epetra_Vector start_single_core = allocate_vector_to_single_core(start);
-        P.flip();
-        sub_into_x(start_single_core);
-        P.flip();}
+    void starting_solution(Epetra_Vector &start);
   
     const Parameters::AllParameters *const all_parameters; ///< Pointer to all parameters
 
@@ -173,27 +178,29 @@ public:
 protected:
     /// Epetra Commuicator Object with MPI
     Epetra_MpiComm Comm_;
-    /// Epetra Matrix A allocated to a single core
-    const Epetra_CrsMatrix A_;
-    /// Epetra Vector b allocated to a single core
-    Epetra_Vector b_;
-    /// Epetra Vector x, to be solved. Allocated to a single core
-    Epetra_Vector x_;
+    /// Number of columns of A (i.e. length of the solution)
+    int num_columns_;
+    /// Rows of A owned by this core, stored densely (columns are contiguous)
+    Eigen::MatrixXd A_local_;
+    /// Entries of b matching the rows in A_local_
+    Eigen::VectorXd b_local_;
+    /// Solution x, replicated on all cores
+    Eigen::VectorXd x_;
     /// Epetra_Vector x, to be solved. Allocated to multiple cores
     Epetra_Vector multi_x_;
-    /// Needed if the an iterative solver is used
+    /// Maximum number of refinement steps if iterative refinement is used
     int LS_iter_;
-    /// Needed if the an iterative solver is used
+    /// Relative tolerance on the refinement correction if iterative refinement is used
     double LS_tol_; 
-    /// Number of inactive points
-    int numInactive_;
-    /// Vector of booleans representing the columns in the active set
-    std::vector<bool> Z;
     /// Vector of boolean representing the columns in the inactive set
     std::vector<bool> P;
+    /// Columns in the inactive set, in the order of the columns of R_
+    std::vector<int> positive_set_;
+    /// Upper triangular factor of the QR factorization of the columns of A in positive_set_
+    Eigen::MatrixXd R_;
 
 public:
-    /// Boolean used for iterative solvers
+    /// Boolean used for iterative refinement of the LS solves
     bool iter_solver_;
     /// Boolean to use an exit Condition depending on maximum gradent
     bool grad_exit_crit_;
@@ -203,28 +210,39 @@ public:
     /// Number of iterations in the NNLS solver
     int iter_;
 
-protected:
-    /// Eigen Vector of the index_set
-    Eigen::VectorXd index_set;
-
 private:
-    /// Creates square permutation matrix based off the active/inactive set, no longer in use
-    void epetra_permutation_matrix(Epetra_CrsMatrix &P_mat);
+    /// Stores the rows of A (transposing the input in parallel if needed) and the matching entries of b on each core
+    void distribute_over_rows(const Epetra_CrsMatrix &A, const Epetra_Vector &b);
+
+    /// Sums a vector over all cores, the result is replicated on every core
+    void sum_over_cores(Eigen::VectorXd &v) const;
+
+    /// Sums a matrix over all cores, the result is replicated on every core
+    void sum_over_cores(Eigen::MatrixXd &M) const;
+
+    /// Returns the global 2-norm of a vector distributed like the rows of A
+    double global_norm(const Eigen::VectorXd &v_local) const;
+
+    /// Returns the columns of the active set with the largest positive gradient, at most NNLS_max_columns_per_iteration
+    std::vector<int> select_entering_columns(const Eigen::VectorXd &gradient, const std::vector<bool> &blocked) const;
 
-    /// Creates a matrix using the columns in A in the set P
-    void positive_set_matrix(Epetra_CrsMatrix &P_mat);
+    /// Appends the candidate columns to R_ and the inactive set, returns the number of columns added
+    /** Numerically dependent columns are not added and are flagged in blocked instead.
+     *  All the inner products needed for the update are reduced across the cores at once.
+     */
+    int add_columns_to_positive_set(const std::vector<int> &candidates, std::vector<bool> &blocked);
 
-    /// Replaces the entries with x with the values in temp
-    void sub_into_x(Epetra_Vector &temp);
+    /// Removes the column at position idx of positive_set_ and restores R_ to upper triangular form with Givens rotations
+    void remove_column_from_positive_set(const int idx);
 
-    /// Adds the values of temp times alpha into the solution vector x 
-    void add_into_x(Epetra_Vector &temp, double alpha);
+    /// Solves R^T R z = rhs with the current triangular factor
+    Eigen::VectorXd solve_semi_normal_equations(const Eigen::VectorXd &rhs) const;
 
-    /// Moves the column at idx into the active set (updating the index_set, Z, P, and numInactive_)
-    void move_to_active_set(int idx);
+    /// Solves the unconstrained least-squares problem in the inactive set using the corrected semi-normal equations
+    Eigen::VectorXd solve_positive_set_least_squares(const Eigen::VectorXd &Atb) const;
 
-    /// Moves the column at idx into the inactive set (updating the index_set, Z, P, and numInactive_)
-    void move_to_inactive_set(int idx);
+    /// Copies the replicated solution into the multi core solution vector
+    void copy_solution_to_multiple_cores();
 
 };
 } // PHiLiP namespace
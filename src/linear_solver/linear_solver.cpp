@@ -163,71 +163,55 @@ solve_linear3 (
 
 }
 
+namespace {
+/// Solves the linear system with AztecOO's GMRES.
+/** If preconditioner is a nullptr, AztecOO builds the domain decomposition ILU or ILUT requested by param.
+ *  Otherwise, the given preconditioner is applied as is.
+ */
 std::pair<unsigned int, double>
-solve_linear (
+solve_linear_gmres (
     const dealii::TrilinosWrappers::SparseMatrix &system_matrix,
+    Epetra_Operator *preconditioner,
     dealii::LinearAlgebra::distributed::Vector<double> &right_hand_side,
     dealii::LinearAlgebra::distributed::Vector<double> &solution,
     const Parameters::LinearSolverParam &param)
 {
+    //solution = right_hand_side;
+    //solution *= 1e-3;
+    solution *= 0.0;
+    Epetra_Vector x(View,
+                    system_matrix.trilinos_matrix().DomainMap(),
+                    solution.begin());
+    Epetra_Vector b(View,
+                    system_matrix.trilinos_matrix().RangeMap(),
+                    right_hand_side.begin());
+    AztecOO solver;
+    solver.SetAztecOption( AZ_output, (param.linear_solver_output ? AZ_all : AZ_last));
+    solver.SetAztecOption(AZ_solver, AZ_gmres);
+    //solver.SetAztecOption(AZ_solver, AZ_bicgstab);
+    //solver.SetAztecOption(AZ_solver, AZ_cg);
+    solver.SetAztecOption(AZ_kspace, param.restart_number);
+    solver.SetRHS(&b);
+    solver.SetLHS(&x);
 
-    // if (pcout.is_active()) system_matrix.print(pcout.get_stream(), true);
-    // if (pcout.is_active()) solution.print(pcout.get_stream());
-
-    Parameters::LinearSolverParam::LinearSolverEnum direct_type = Parameters::LinearSolverParam::LinearSolverEnum::direct;
-    Parameters::LinearSolverParam::LinearSolverEnum gmres_type = Parameters::LinearSolverParam::LinearSolverEnum::gmres;
 
-    //if (param.linear_solver_output == Parameters::OutputEnum::verbose) {
-    //    dealii::ConditionalOStream pcout(std::cout, dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD)==0);
-    //    if (pcout.is_active()) right_hand_side.print(pcout.get_stream());
-    //    if (pcout.is_active()) solution.print(pcout.get_stream());
-    //    dealii::FullMatrix<double> fullA(system_matrix.m());
-    //    fullA.copy_from(system_matrix);
-    //    pcout<<"Dense matrix:"<<std::endl;
-    //    if (pcout.is_active()) fullA.print_formatted(pcout.get_stream(), 12, true, 10, "0", 1., 0.);
-    //}
-    if (param.linear_solver_type == direct_type) {
+    const double rhs_norm = right_hand_side.l2_norm();
+    const double linear_residual = param.linear_residual * rhs_norm;//1e-4;
+    const int max_iterations = param.max_iterations;//200
+    solver.SetUserMatrix(const_cast<Epetra_CrsMatrix *>(&system_matrix.trilinos_matrix()));
+    dealii::ConditionalOStream pcout(std::cout, dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD)==0);
+    pcout << " Solving linear system with " << (preconditioner ? "a precomputed preconditioner, " : "")
+          << "max_iterations = " << max_iterations
+          << " and linear residual tolerance: " << linear_residual << std::endl;
 
-        dealii::SolverControl solver_control(1, 0);
-        dealii::TrilinosWrappers::SolverDirect::AdditionalData data(false);
-        //dealii::TrilinosWrappers::SolverDirect::AdditionalData data(parameters.output == Parameters::Solver::verbose);
-        dealii::TrilinosWrappers::SolverDirect direct(solver_control, data);
 
-        direct.solve(system_matrix, solution, right_hand_side);
-        return {solver_control.last_step(), solver_control.last_value()};
-    } else if (param.linear_solver_type == gmres_type) {
-        //solution = right_hand_side;
-        //solution *= 1e-3;
-        solution *= 0.0;
-        Epetra_Vector x(View,
-                        system_matrix.trilinos_matrix().DomainMap(),
-                        solution.begin());
-        Epetra_Vector b(View,
-                        system_matrix.trilinos_matrix().RangeMap(),
-                        right_hand_side.begin());
-        AztecOO solver;
-        solver.SetAztecOption( AZ_output, (param.linear_solver_output ? AZ_all : AZ_last));
-        solver.SetAztecOption(AZ_solver, AZ_gmres);
-        //solver.SetAztecOption(AZ_solver, AZ_bicgstab);
-        //solver.SetAztecOption(AZ_solver, AZ_cg);
-        solver.SetAztecOption(AZ_kspace, param.restart_number);
-        solver.SetRHS(&b);
-        solver.SetLHS(&x);
-
-
-        const double rhs_norm = right_hand_side.l2_norm();
-        const double linear_residual = param.linear_residual * rhs_norm;//1e-4;
-        const int max_iterations = param.max_iterations;//200
-        solver.SetUserMatrix(const_cast<Epetra_CrsMatrix *>(&system_matrix.trilinos_matrix()));
-        dealii::ConditionalOStream pcout(std::cout, dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD)==0);
-        pcout << " Solving linear system with max_iterations = " << max_iterations
-              << " and linear residual tolerance: " << linear_residual << std::endl;
-
-
-        //solver.SetAztecOption(AZ_orthog, AZ_modified);
-        solver.SetAztecOption(AZ_orthog, AZ_classic);
-        solver.SetAztecOption(AZ_conv, AZ_rhs);
+    //solver.SetAztecOption(AZ_orthog, AZ_modified);
+    solver.SetAztecOption(AZ_orthog, AZ_classic);
+    solver.SetAztecOption(AZ_conv, AZ_rhs);
 
+    if (preconditioner) {
+        solver.SetPrecOperator(preconditioner);
+    } else {
         solver.SetAztecOption(AZ_precond, AZ_dom_decomp);
         solver.SetAztecOption(AZ_overlap, 1);
         solver.SetAztecOption(AZ_reorder, 1); // RCM re-ordering
@@ -258,34 +242,121 @@ solve_linear (
             solver.SetAztecParam(AZ_athresh, ilut_atol);
             solver.SetAztecParam(AZ_rthresh, ilut_rtol);
         }
+    }
 
-        unsigned int n_iterations = 0;
-        const int n_solves = 2;
-        for (int i_solve = 0; i_solve < n_solves; ++i_solve) {
-            solver.Iterate(max_iterations,
-                           linear_residual);
-            n_iterations += solver.NumIters();
-            pcout << " Solve #" << i_solve + 1 << " out of " << n_solves << "."
-                  << " Linear solver took " << solver.NumIters()
-                  << " iterations resulting in a linear residual of " << solver.ScaledResidual()
-                  << std::endl;
-        }
+    unsigned int n_iterations = 0;
+    const int n_solves = 2;
+    for (int i_solve = 0; i_solve < n_solves; ++i_solve) {
+        solver.Iterate(max_iterations,
+                       linear_residual);
+        n_iterations += solver.NumIters();
+        pcout << " Solve #" << i_solve + 1 << " out of " << n_solves << "."
+              << " Linear solver took " << solver.NumIters()
+              << " iterations resulting in a linear residual of " << solver.ScaledResidual()
+              << std::endl;
+    }
+
+    pcout << " Totalling " << n_iterations
+          << " iterations resulting in a linear residual of " << solver.ScaledResidual() << std::endl
+          << " Current RHS norm: " << right_hand_side.l2_norm()
+          << " Linear solution norm: " << solution.l2_norm() << std::endl;
+
+    //n_vmult += 3*solver.NumIters();
+    //dRdW_mult += 3*solver.NumIters();
+    n_vmult += 7*solver.NumIters();
+    dRdW_mult += 7*solver.NumIters();
 
-        pcout << " Totalling " << n_iterations
-              << " iterations resulting in a linear residual of " << solver.ScaledResidual() << std::endl
-              << " Current RHS norm: " << right_hand_side.l2_norm()
-              << " Linear solution norm: " << solution.l2_norm() << std::endl;
+    //std::abort();
+    return {solver.NumIters(), solver.TrueResidual()};
+}
+} // namespace
 
-        //n_vmult += 3*solver.NumIters();
-        //dRdW_mult += 3*solver.NumIters();
-        n_vmult += 7*solver.NumIters();
-        dRdW_mult += 7*solver.NumIters();
+std::pair<unsigned int, double>
+solve_linear (
+    const dealii::TrilinosWrappers::SparseMatrix &system_matrix,
+    dealii::LinearAlgebra::distributed::Vector<double> &right_hand_side,
+    dealii::LinearAlgebra::distributed::Vector<double> &solution,
+    const Parameters::LinearSolverParam &param)
+{
 
-        //std::abort();
-        return {solver.NumIters(), solver.TrueResidual()};
+    // if (pcout.is_active()) system_matrix.print(pcout.get_stream(), true);
+    // if (pcout.is_active()) solution.print(pcout.get_stream());
+
+    Parameters::LinearSolverParam::LinearSolverEnum direct_type = Parameters::LinearSolverParam::LinearSolverEnum::direct;
+    Parameters::LinearSolverParam::LinearSolverEnum gmres_type = Parameters::LinearSolverParam::LinearSolverEnum::gmres;
+
+    //if (param.linear_solver_output == Parameters::OutputEnum::verbose) {
+    //    dealii::ConditionalOStream pcout(std::cout, dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD)==0);
+    //    if (pcout.is_active()) right_hand_side.print(pcout.get_stream());
+    //    if (pcout.is_active()) solution.print(pcout.get_stream());
+    //    dealii::FullMatrix<double> fullA(system_matrix.m());
+    //    fullA.copy_from(system_matrix);
+    //    pcout<<"Dense matrix:"<<std::endl;
+    //    if (pcout.is_active()) fullA.print_formatted(pcout.get_stream(), 12, true, 10, "0", 1., 0.);
+    //}
+    if (param.linear_solver_type == direct_type) {
+
+        dealii::SolverControl solver_control(1, 0);
+        dealii::TrilinosWrappers::SolverDirect::AdditionalData data(false);
+        //dealii::TrilinosWrappers::SolverDirect::AdditionalData data(parameters.output == Parameters::Solver::verbose);
+        dealii::TrilinosWrappers::SolverDirect direct(solver_control, data);
+
+        direct.solve(system_matrix, solution, right_hand_side);
+        return {solver_control.last_step(), solver_control.last_value()};
+    } else if (param.linear_solver_type == gmres_type) {
+        return solve_linear_gmres(system_matrix, nullptr, right_hand_side, solution, param);
     }
     return {-1.0, -1.0};
 }
 
+std::pair<unsigned int, double>
+solve_linear (
+    const dealii::TrilinosWrappers::SparseMatrix &system_matrix,
+    Epetra_Operator &preconditioner,
+    dealii::LinearAlgebra::distributed::Vector<double> &right_hand_side,
+    dealii::LinearAlgebra::distributed::Vector<double> &solution,
+    const Parameters::LinearSolverParam &param)
+{
+    return solve_linear_gmres(system_matrix, &preconditioner, right_hand_side, solution, param);
+}
+
+std::unique_ptr<Ifpack_Preconditioner>
+build_ilu_preconditioner (
+    const dealii::TrilinosWrappers::SparseMatrix &system_matrix,
+    const Parameters::LinearSolverParam &param)
+{
+    const int ilut_fill = param.ilut_fill;
+    if (ilut_fill < -99) return nullptr;
+
+    Teuchos::ParameterList List;
+    std::string PrecType;
+    if (ilut_fill < 1) {
+        PrecType = "ILU";
+        List.set("fact: level-of-fill", std::abs(ilut_fill));
+    } else {
+        PrecType = "ILUT";
+        List.set("fact: ilut level-of-fill", static_cast<double>(ilut_fill));
+        List.set("fact: drop tolerance", param.ilut_drop);
+    }
+    List.set("fact: absolute threshold", param.ilut_atol);
+    List.set("fact: relative threshold", param.ilut_rtol);
+    List.set("schwarz: reordering type", "rcm");
+    const int OverlapLevel = 1; // one row of overlap among the processes
+
+    Epetra_CrsMatrix * epetra_matrix = const_cast<Epetra_CrsMatrix *>(&(system_matrix.trilinos_matrix()));
+    Ifpack Factory;
+    std::unique_ptr<Ifpack_Preconditioner> preconditioner(Factory.Create(PrecType, epetra_matrix, OverlapLevel));
+    AssertThrow(preconditioner != nullptr, dealii::ExcMessage("Trilinos could not create the " + PrecType + " preconditioner."));
+
+    int ierr = preconditioner->SetParameters(List);
+    AssertThrow(ierr == 0, dealii::ExcTrilinosError(ierr));
+    ierr = preconditioner->Initialize();
+    AssertThrow(ierr == 0, dealii::ExcTrilinosError(ierr));
+    ierr = preconditioner->Compute();
+    AssertThrow(ierr == 0, dealii::ExcTrilinosError(ierr));
+
+    return preconditioner;
+}
+
 
 } // PHiLiP namespace
@@ -3,6 +3,8 @@
 
 #include <deal.II/lac/trilinos_sparse_matrix.h>
 #include <deal.II/lac/la_parallel_vector.h>
+#include <Epetra_Operator.h>
+#include <Ifpack_Preconditioner.h>
 #include "parameters/all_parameters.h"
 
 namespace PHiLiP {
@@ -18,6 +20,28 @@ namespace PHiLiP {
                        dealii::LinearAlgebra::distributed::Vector<double> &solution,
                        const Parameters::LinearSolverParam &param);
 
+    /// Solves the linear system with GMRES using an already computed preconditioner.
+    /** The preconditioner's ApplyInverse() is used as is. This allows a single factorization
+     *  to be reused across many right-hand sides, and for transposed systems by setting
+     *  its UseTranspose flag beforehand.
+     */
+    std::pair<unsigned int, double>
+        solve_linear ( const dealii::TrilinosWrappers::SparseMatrix &system_matrix,
+                       Epetra_Operator &preconditioner,
+                       dealii::LinearAlgebra::distributed::Vector<double> &right_hand_side,
+                       dealii::LinearAlgebra::distributed::Vector<double> &solution,
+                       const Parameters::LinearSolverParam &param);
+
+    /// Computes the ILU or ILUT factorization that the GMRES solve_linear would build for param.
+    /** Like AztecOO's domain decomposition, it is an additive Schwarz preconditioner with one row of overlap
+     *  and RCM reordering, using ilut_fill, ilut_drop, ilut_atol and ilut_rtol. Returns a nullptr if param
+     *  requests no preconditioner (ilut_fill < -99). The factorization can then be reused by the solve_linear
+     *  overload above for as long as system_matrix is unchanged.
+     */
+    std::unique_ptr<Ifpack_Preconditioner>
+        build_ilu_preconditioner ( const dealii::TrilinosWrappers::SparseMatrix &system_matrix,
+                                   const Parameters::LinearSolverParam &param);
+
     std::pair<unsigned int, double>
     solve_linear_2 ( const dealii::TrilinosWrappers::SparseMatrix &system_matrix,
                    const dealii::LinearAlgebra::distributed::Vector<double> &right_hand_side,
@@ -1,8 +1,6 @@
 #include <fstream>
 #include <boost/math/special_functions/binomial.hpp>
 
-#include <Sacado.hpp>
-
 #include "free_form_deformation.h"
 #include "meshmover_linear_elasticity.hpp"
 
@@ -241,35 +239,31 @@ dealii::Point<dim,double> FreeFormDeformation<dim>
 {
     assert(ctl_axis < dim);
     assert(ctl_index < n_control_pts);
-    using FadType = Sacado::Fad::DFad<double>;
-    std::vector<dealii::Point<dim,FadType>> control_pts_ad(control_pts.size());
-    for (unsigned int i=0; i<n_control_pts; ++i) {
-        control_pts_ad[i] = control_pts[i];
-    }
-    control_pts_ad[ctl_index][ctl_axis].diff(0,1);
-
-    dealii::Point<dim, FadType> new_point_ad = new_point_location(initial_point, control_pts_ad);
 
+    // The FFD is linear in the control points, and points outside the box are not moved.
     dealii::Point<dim,double> dXdXp;
+    const dealii::Point<dim,double> s_t_u = get_local_coordinates (initial_point);
+    for (int d=0; d<dim; ++d) {
+        if (!(0 <= s_t_u[d] && s_t_u[d] <= 1.0)) return dXdXp;
+    }
+
+    const std::array<std::vector<double>,dim> ijk_coefficients = get_bernstein_coefficients (s_t_u);
+    const std::array<unsigned int,dim> ijk = global_to_grid(ctl_index);
+    double coeff = 1.0;
     for (int d=0; d<dim; ++d) {
-        dXdXp[d] = new_point_ad[d].dx(0);
+        coeff *= ijk_coefficients[d][ijk[d]];
     }
+    dXdXp[ctl_axis] = coeff;
     return dXdXp;
 }
 
 template<int dim>
-template<typename real>
-dealii::Point<dim,real> FreeFormDeformation<dim>
-::evaluate_ffd (
-    const dealii::Point<dim,double> &s_t_u_point,
-    const std::vector<dealii::Point<dim,real>> &control_pts) const
+std::array<std::vector<double>,dim> FreeFormDeformation<dim>
+::get_bernstein_coefficients (const dealii::Point<dim,double> &s_t_u_point) const
 {
-    dealii::Point<dim,real> ffd_location;
+    std::array<std::vector<double>,dim> ijk_coefficients;
 
-    std::array<std::vector<real>,dim> ijk_coefficients;
-    
     for (int d=0; d<dim; ++d) {
-        ffd_location[d] = 0.0;
 
         ijk_coefficients[d].resize(ndim_control_pts[d]);
 
@@ -281,11 +275,27 @@ dealii::Point<dim,real> FreeFormDeformation<dim>
             ijk_coefficients[d][i] = bin_coeff * std::pow(1.0 - s_t_u_point[d], power) * std::pow(s_t_u_point[d], i);
         }
     }
+    return ijk_coefficients;
+}
+
+template<int dim>
+template<typename real>
+dealii::Point<dim,real> FreeFormDeformation<dim>
+::evaluate_ffd (
+    const dealii::Point<dim,double> &s_t_u_point,
+    const std::vector<dealii::Point<dim,real>> &control_pts) const
+{
+    dealii::Point<dim,real> ffd_location;
+    for (int d=0; d<dim; ++d) {
+        ffd_location[d] = 0.0;
+    }
+
+    const std::array<std::vector<double>,dim> ijk_coefficients = get_bernstein_coefficients (s_t_u_point);
 
     for (unsigned int ictl = 0; ictl < n_control_pts; ++ictl) {
         std::array<unsigned int, dim> ijk = global_to_grid(ictl);
 
-        real coeff = 1.0;
+        double coeff = 1.0;
         for (int d=0; d<dim; ++d) {
             coeff *= ijk_coefficients[d][ijk[d]];
         }
@@ -348,6 +358,7 @@ void FreeFormDeformation<dim>
           high_order_grid.dof_handler_grid,
           high_order_grid.surface_to_volume_indices,
           surface_node_displacements);
+    reuse_meshmover_preconditioner(high_order_grid, meshmover);
     dealii::LinearAlgebra::distributed::Vector<double> volume_displacements = meshmover.get_volume_displacements();
     high_order_grid.volume_nodes = high_order_grid.initial_volume_nodes;
     high_order_grid.volume_nodes += volume_displacements;
@@ -449,43 +460,81 @@ FreeFormDeformation<dim>
 }
 
 template<int dim>
-std::vector<dealii::LinearAlgebra::distributed::Vector<double>>
+std::vector<std::tuple<dealii::types::global_dof_index, unsigned int, double>>
 FreeFormDeformation<dim>
-::get_dXvsdXp (
+::get_dXvsdXp_entries (
     const HighOrderGrid<dim,double> &high_order_grid,
     const std::vector< std::pair< unsigned int, unsigned int > > &ffd_design_variables_indices_dim
     ) const
 {
-    std::vector<dealii::LinearAlgebra::distributed::Vector<double>> dXvsdXp_vector;
+    const unsigned int n_design_var = ffd_design_variables_indices_dim.size();
+    std::vector<std::array<unsigned int,dim>> design_ijk(n_design_var);
+    for (unsigned int i_col = 0; i_col < n_design_var; ++i_col) {
+        assert(ffd_design_variables_indices_dim[i_col].first < n_control_pts);
+        assert(ffd_design_variables_indices_dim[i_col].second < dim);
+        design_ijk[i_col] = global_to_grid(ffd_design_variables_indices_dim[i_col].first);
+    }
+
+    std::vector<std::tuple<dealii::types::global_dof_index, unsigned int, double>> dXvsdXp_entries;
 
     const dealii::IndexSet &nodes_locally_owned = high_order_grid.volume_nodes.get_partitioner()->locally_owned_range();
-    for (auto const &ffd_pair: ffd_design_variables_indices_dim) {
+    unsigned int ipoint = 0;
+    for (auto const& surface_point: high_order_grid.initial_locally_relevant_surface_points) {
 
-        const unsigned int ctl_index = ffd_pair.first;
-        const unsigned int ctl_axis  = ffd_pair.second;
+        const unsigned int current_ipoint = ipoint++;
 
-        dealii::LinearAlgebra::distributed::Vector<double> derivative_surface_nodes_ffd_ctl;
-        derivative_surface_nodes_ffd_ctl.reinit(high_order_grid.volume_nodes);
-        unsigned int ipoint = 0;
-        for (auto const& surface_point: high_order_grid.initial_locally_relevant_surface_points) {
+        const dealii::Point<dim,double> s_t_u = get_local_coordinates (surface_point);
+        bool inside_ffd_box = true;
+        for (int d=0; d<dim; ++d) {
+            if (!(0 <= s_t_u[d] && s_t_u[d] <= 1.0)) inside_ffd_box = false;
+        }
+        if (!inside_ffd_box) continue;
 
-            dealii::Point<dim,double> dxsdxp = dXdXp (surface_point, ctl_index, ctl_axis);
+        std::array<dealii::types::global_dof_index,dim> vol_index;
+        bool any_locally_owned = false;
+        std::array<bool,dim> is_locally_owned;
+        for (int d=0; d<dim; ++d) {
+            vol_index[d] = high_order_grid.point_and_axis_to_global_index.at(std::make_pair(current_ipoint,(unsigned int)d));
+            is_locally_owned[d] = nodes_locally_owned.is_element(vol_index[d]);
+            any_locally_owned = any_locally_owned || is_locally_owned[d];
+        }
+        if (!any_locally_owned) continue;
 
-            for (int d=0; d<dim; ++d) { 
-                if ((unsigned int)d!=ctl_axis) {
-                    assert(dxsdxp[d] == 0.0);
-                }
-                const dealii::types::global_dof_index vol_index = high_order_grid.point_and_axis_to_global_index.at(std::make_pair(ipoint,(unsigned int)d));
-                if (nodes_locally_owned.is_element(vol_index)) {
-                    derivative_surface_nodes_ffd_ctl[vol_index] = dxsdxp[d];
-                }
-            }
+        const std::array<std::vector<double>,dim> ijk_coefficients = get_bernstein_coefficients (s_t_u);
+
+        for (unsigned int i_col = 0; i_col < n_design_var; ++i_col) {
+            const unsigned int ctl_axis = ffd_design_variables_indices_dim[i_col].second;
+            if (!is_locally_owned[ctl_axis]) continue;
 
-            ipoint++;
+            double coeff = 1.0;
+            for (int d=0; d<dim; ++d) {
+                coeff *= ijk_coefficients[d][design_ijk[i_col][d]];
+            }
+            dXvsdXp_entries.emplace_back(vol_index[ctl_axis], i_col, coeff);
         }
-        derivative_surface_nodes_ffd_ctl.update_ghost_values();
+    }
+    return dXvsdXp_entries;
+}
+
+template<int dim>
+std::vector<dealii::LinearAlgebra::distributed::Vector<double>>
+FreeFormDeformation<dim>
+::get_dXvsdXp (
+    const HighOrderGrid<dim,double> &high_order_grid,
+    const std::vector< std::pair< unsigned int, unsigned int > > &ffd_design_variables_indices_dim
+    ) const
+{
+    std::vector<dealii::LinearAlgebra::distributed::Vector<double>> dXvsdXp_vector(ffd_design_variables_indices_dim.size());
+    for (auto &derivative_surface_nodes_ffd_ctl: dXvsdXp_vector) {
+        derivative_surface_nodes_ffd_ctl.reinit(high_order_grid.volume_nodes);
+    }
 
-        dXvsdXp_vector.push_back(derivative_surface_nodes_ffd_ctl);
+    for (auto const &entry: get_dXvsdXp_entries (high_order_grid, ffd_design_variables_indices_dim)) {
+        dXvsdXp_vector[std::get<1>(entry)][std::get<0>(entry)] = std::get<2>(entry);
+    }
+
+    for (auto &derivative_surface_nodes_ffd_ctl: dXvsdXp_vector) {
+        derivative_surface_nodes_ffd_ctl.update_ghost_values();
     }
     return dXvsdXp_vector;
 }
@@ -504,46 +553,24 @@ FreeFormDeformation<dim>
     const dealii::IndexSet &row_part = high_order_grid.dof_handler_grid.locally_owned_dofs();
     const dealii::IndexSet col_part = dealii::Utilities::MPI::create_evenly_distributed_partitioning(MPI_COMM_WORLD,n_cols);
 
-    dealii::DynamicSparsityPattern full_dsp(n_rows, n_cols, row_part);
-    for (const auto &i_row: row_part) {
-        for (unsigned int i_col = 0; i_col < n_cols; ++i_col) {
-            full_dsp.add(i_row, i_col);
-        }
+    const std::vector<std::tuple<dealii::types::global_dof_index, unsigned int, double>> dXvsdXp_entries
+        = get_dXvsdXp_entries (high_order_grid, ffd_design_variables_indices_dim);
+
+    dealii::DynamicSparsityPattern dsp(n_rows, n_cols, row_part);
+    for (auto const &entry: dXvsdXp_entries) {
+        dsp.add(std::get<0>(entry), std::get<1>(entry));
     }
     dealii::IndexSet locally_relevant_dofs;
     dealii::DoFTools::extract_locally_relevant_dofs(high_order_grid.dof_handler_grid, locally_relevant_dofs);
-    dealii::SparsityTools::distribute_sparsity_pattern(full_dsp, row_part, MPI_COMM_WORLD, locally_relevant_dofs);
-
-    dealii::SparsityPattern full_sp;
-    full_sp.copy_from(full_dsp);
-
-    dXvsdXp.reinit(row_part, col_part, full_sp, MPI_COMM_WORLD);
+    dealii::SparsityTools::distribute_sparsity_pattern(dsp, row_part, MPI_COMM_WORLD, locally_relevant_dofs);
 
+    dealii::SparsityPattern sp;
+    sp.copy_from(dsp);
 
-    const dealii::IndexSet &nodes_locally_owned = high_order_grid.volume_nodes.get_partitioner()->locally_owned_range();
-    for (unsigned int i_col = 0; i_col < ffd_design_variables_indices_dim.size(); ++i_col) {
-
-        const auto ffd_pair = ffd_design_variables_indices_dim[i_col];
-        const unsigned int ctl_index = ffd_pair.first;
-        const unsigned int ctl_axis  = ffd_pair.second;
-
-        unsigned int ipoint = 0;
-        for (auto const& surface_point: high_order_grid.initial_locally_relevant_surface_points) {
-
-            dealii::Point<dim,double> dxsdxp = dXdXp (surface_point, ctl_index, ctl_axis);
-
-            for (int d=0; d<dim; ++d) { 
-                const dealii::types::global_dof_index vol_index = high_order_grid.point_and_axis_to_global_index.at(std::make_pair(ipoint,(unsigned int)d));
-                if (nodes_locally_owned.is_element(vol_index)) {
-                    dXvsdXp.set(vol_index,i_col, dxsdxp[d]);
-                }
-                if ((unsigned int)d!=ctl_axis) {
-                    assert(dxsdxp[d] == 0.0);
-                }
-            }
+    dXvsdXp.reinit(row_part, col_part, sp, MPI_COMM_WORLD);
 
-            ipoint++;
-        }
+    for (auto const &entry: dXvsdXp_entries) {
+        dXvsdXp.set(std::get<0>(entry), std::get<1>(entry), std::get<2>(entry));
     }
     dXvsdXp.compress(dealii::VectorOperation::insert);
 }
@@ -570,9 +597,31 @@ FreeFormDeformation<dim>
           high_order_grid.surface_to_volume_indices,
           surface_node_displacements);
     //meshmover.evaluate_dXvdXs();
+    reuse_meshmover_preconditioner(high_order_grid, meshmover);
     meshmover.apply_dXvdXvs(dXvsdXp_vector, dXvdXp);
 }
 
+template<int dim>
+void
+FreeFormDeformation<dim>
+::reuse_meshmover_preconditioner (
+    const HighOrderGrid<dim,double> &high_order_grid,
+    MeshMover::LinearElasticity<dim,double> &meshmover) const
+{
+    // The mesh movers always use the initial mapping, such that their system matrix only changes with the mesh itself.
+    const std::shared_ptr<const void> mapping = high_order_grid.initial_mapping_fe_field;
+    const bool same_mesh = meshmover_preconditioner
+                           && !meshmover_preconditioner_mapping.expired()
+                           && !meshmover_preconditioner_mapping.owner_before(mapping)
+                           && !mapping.owner_before(meshmover_preconditioner_mapping);
+    if (same_mesh) {
+        meshmover.set_preconditioner(meshmover_preconditioner);
+        return;
+    }
+    meshmover_preconditioner = meshmover.get_preconditioner();
+    meshmover_preconditioner_mapping = mapping;
+}
+
 template<int dim>
 void
 FreeFormDeformation<dim>
@@ -2,6 +2,7 @@
 #define __FREE_FORM_DEFORMATION__
 
 #include "high_order_grid.h"
+#include "meshmover_linear_elasticity.hpp"
 
 namespace PHiLiP {
 
@@ -47,7 +48,8 @@ public:
 
     /** For the given list of FFD indices and direction, return the analytical
      *  derivatives of the HighOrderGrid's initial surface points with respect to the FFD.
-     *  The result is written into the given dXvsdXp SparseMatrix.
+     *  The result is written into the given dXvsdXp SparseMatrix, whose sparsity pattern only
+     *  holds the surface nodes inside the FFD box along each design variable's axis.
      */
     void get_dXvsdXp (
         const HighOrderGrid<dim,double> &high_order_grid,
@@ -74,7 +76,7 @@ public:
                 const double eps
                );
 
-    /** For the given list of FFD indices and direction, return the finite-differenced
+    /** For the given list of FFD indices and direction, return the analytical
      *  derivatives of the HighOrderGrid's initial volume points with respect to the FFD.
      */
     void
@@ -82,7 +84,7 @@ public:
                 const std::vector< std::pair< unsigned int, unsigned int > > ffd_design_variables_indices_dim,
                 dealii::TrilinosWrappers::SparseMatrix &dXvdXp
                 ) const;
-    /** For the given list of FFD indices and direction, return the analytical
+    /** For the given list of FFD indices and direction, return the finite-differenced
      *  derivatives of the HighOrderGrid's initial volume points with respect to the FFD.
      */
     void
@@ -151,6 +153,24 @@ protected:
      */
     dealii::Point<dim,double> get_local_coordinates (const dealii::Point<dim,double> p) const;
 
+    /// Returns the Bernstein polynomials of each control point index along each axis, evaluated at s-t-u.
+    /** The FFD weight of the control point with grid index (i,j,k) is the product of the returned
+     *  [0][i], [1][j] and [2][k] coefficients.
+     */
+    std::array<std::vector<double>,dim> get_bernstein_coefficients (const dealii::Point<dim,double> &s_t_u_point) const;
+
+    /// Returns the non-zero analytical derivatives of the locally owned initial surface nodes with respect to the design variables.
+    /** The FFD is linear in the control points. Therefore, the derivative of a point inside the FFD box
+     *  with respect to a control point's coordinate is its Bernstein weight along that same axis, and zero
+     *  otherwise. The Bernstein polynomials are evaluated once per surface point for all design variables,
+     *  and points outside the box, which are not moved by the FFD, have no entries.
+     *  Each entry is made of the volume node index, the design variable index, and the derivative.
+     */
+    std::vector<std::tuple<dealii::types::global_dof_index, unsigned int, double>>
+    get_dXvsdXp_entries (
+        const HighOrderGrid<dim,double> &high_order_grid,
+        const std::vector< std::pair< unsigned int, unsigned int > > &ffd_design_variables_indices_dim) const;
+
     /// Parallepiped origin.
     const dealii::Point<dim> origin;
     /// Parallepiped vectors.
@@ -177,6 +197,23 @@ private:
 
     /// Initial message.
     void init_msg() const;
+
+    /** Hands the cached mesh mover preconditioner to meshmover if it was built on the same mesh.
+     *  Otherwise, the preconditioner of meshmover is built and cached for the next mesh movements.
+     */
+    void reuse_meshmover_preconditioner (
+        const HighOrderGrid<dim,double> &high_order_grid,
+        MeshMover::LinearElasticity<dim,double> &meshmover) const;
+
+    /// Mesh mover preconditioner reused across deform_mesh() and get_dXvdXp() calls.
+    mutable std::shared_ptr<dealii::TrilinosWrappers::PreconditionBase> meshmover_preconditioner;
+
+    /// Initial mapping of the mesh on which meshmover_preconditioner was built.
+    /** A new mapping is created whenever the HighOrderGrid is refined, which invalidates the preconditioner.
+     *  The cached preconditioner owns the system matrix it was built on, such that it remains valid
+     *  after the mesh mover that built it goes out of scope.
+     */
+    mutable std::weak_ptr<const void> meshmover_preconditioner_mapping;
 };
 
 } // namespace PHiLiP
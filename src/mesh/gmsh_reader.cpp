@@ -1252,10 +1252,11 @@ read_gmsh(std::string filename,
           const bool mesh_reader_verbose_output,
           const bool do_renumber_dofs,
           int requested_grid_order,
-          const bool use_mesh_smoothing)
+          const bool use_mesh_smoothing,
+          const MPI_Comm mpi_communicator)
 {
 
-    const int mpi_rank = dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD);
+    const int mpi_rank = dealii::Utilities::MPI::this_mpi_process(mpi_communicator);
     dealii::ConditionalOStream pcout(std::cout, mpi_rank==0);
 
 //    Assert(dim==2, dealii::ExcInternalError());
@@ -1358,17 +1359,17 @@ read_gmsh(std::string filename,
 
     if(use_mesh_smoothing) {
         triangulation = std::make_shared<Triangulation>(
-            MPI_COMM_WORLD,
+            mpi_communicator,
             typename dealii::Triangulation<dim>::MeshSmoothing(
                 dealii::Triangulation<dim>::smoothing_on_refinement |
                 dealii::Triangulation<dim>::smoothing_on_coarsening));
     }
     else
     {
-        triangulation = std::make_shared<Triangulation>(MPI_COMM_WORLD); // Dealii's default mesh smoothing flag is none. 
+        triangulation = std::make_shared<Triangulation>(mpi_communicator); // Dealii's default mesh smoothing flag is none. 
     }
 
-    auto high_order_grid = std::make_shared<HighOrderGrid<dim, double>>(grid_order, triangulation, true, do_renumber_dofs, true);
+    auto high_order_grid = std::make_shared<HighOrderGrid<dim, double>>(grid_order, triangulation, true, do_renumber_dofs, true, mpi_communicator);
   
     unsigned int n_entity_blocks, n_cells;
     int min_ele_tag, max_ele_tag;
@@ -1755,7 +1756,7 @@ read_gmsh(std::string filename,
 
 
     if (requested_grid_order > 0) {
-        auto grid = std::make_shared<HighOrderGrid<dim, double>>(requested_grid_order, triangulation);
+        auto grid = std::make_shared<HighOrderGrid<dim, double>>(requested_grid_order, triangulation, true, true, true, mpi_communicator);
         grid->initialize_with_triangulation_manifold();
         
         /// Convert the mesh by interpolating from one order to another.
@@ -1814,7 +1815,7 @@ read_gmsh(std::string filename,
 
 template <int dim, int spacedim>
 std::shared_ptr< HighOrderGrid<dim, double> >
-read_gmsh(std::string filename, const bool do_renumber_dofs, int requested_grid_order, const bool use_mesh_smoothing)
+read_gmsh(std::string filename, const bool do_renumber_dofs, int requested_grid_order, const bool use_mesh_smoothing, const MPI_Comm mpi_communicator)
 {
   // default parameters
   const bool periodic_x = false;
@@ -1836,12 +1837,13 @@ read_gmsh(std::string filename, const bool do_renumber_dofs, int requested_grid_
     mesh_reader_verbose_output,
     do_renumber_dofs,
     requested_grid_order,
-    use_mesh_smoothing);
+    use_mesh_smoothing,
+    mpi_communicator);
 }
 
 #if PHILIP_DIM!=1 
-template std::shared_ptr< HighOrderGrid<PHILIP_DIM, double> > read_gmsh<PHILIP_DIM,PHILIP_DIM>(std::string filename, const bool periodic_x, const bool periodic_y, const bool periodic_z, const int x_periodic_1, const int x_periodic_2, const int y_periodic_1, const int y_periodic_2, const int z_periodic_1, const int z_periodic_2, const bool mesh_reader_verbose_output, const bool do_renumber_dofs, int requested_grid_order, const bool use_mesh_smoothing);
-template std::shared_ptr< HighOrderGrid<PHILIP_DIM, double> > read_gmsh<PHILIP_DIM,PHILIP_DIM>(std::string filename, const bool do_renumber_dofs, int requested_grid_order, const bool use_mesh_smoothing);
+template std::shared_ptr< HighOrderGrid<PHILIP_DIM, double> > read_gmsh<PHILIP_DIM,PHILIP_DIM>(std::string filename, const bool periodic_x, const bool periodic_y, const bool periodic_z, const int x_periodic_1, const int x_periodic_2, const int y_periodic_1, const int y_periodic_2, const int z_periodic_1, const int z_periodic_2, const bool mesh_reader_verbose_output, const bool do_renumber_dofs, int requested_grid_order, const bool use_mesh_smoothing, const MPI_Comm mpi_communicator);
+template std::shared_ptr< HighOrderGrid<PHILIP_DIM, double> > read_gmsh<PHILIP_DIM,PHILIP_DIM>(std::string filename, const bool do_renumber_dofs, int requested_grid_order, const bool use_mesh_smoothing, const MPI_Comm mpi_communicator);
 #endif
 
 } // namespace PHiLiP
@@ -5,6 +5,7 @@
 #include "physics/model_factory.h"
 #include "mesh/gmsh_reader.hpp"
 #include "metric_to_mesh_generator.h"
+#include "grid_refinement/metric_refinement.h"
 #include <deal.II/dofs/dof_renumbering.h>
 #include "fe_values_shape_hessian.h"
 
@@ -15,9 +16,11 @@ AnisotropicMeshAdaptation<dim, nspecies, nstate, real, MeshType> :: AnisotropicM
     std::shared_ptr< DGBase<dim, nspecies, real, MeshType> > dg_input, 
     const real _norm_Lp,
     const real _complexity,
-    const bool _use_goal_oriented_approach)
+    const bool _use_goal_oriented_approach,
+    const bool _use_in_process_remeshing)
     : dg(dg_input)
     , use_goal_oriented_approach(_use_goal_oriented_approach)
+    , use_in_process_remeshing(_use_in_process_remeshing)
     , normLp(_norm_Lp)
     , complexity(_complexity)
     , mpi_communicator(MPI_COMM_WORLD)
@@ -459,13 +462,19 @@ template<int dim, int nspecies, int nstate, typename real, typename MeshType>
 void AnisotropicMeshAdaptation<dim, nspecies, nstate, real, MeshType> :: adapt_mesh()
 {
     compute_cellwise_optimal_metric();
+
+    if(use_in_process_remeshing)
+    {
+        refine_mesh_towards_metric();
+        return;
+    }
     
     std::unique_ptr<MetricToMeshGenerator<dim, nspecies, nstate, real>> metric_to_mesh_generator
         = std::make_unique<MetricToMeshGenerator<dim, nspecies, nstate, real>> (dg->high_order_grid->mapping_fe_field, dg->triangulation);
     metric_to_mesh_generator->generate_mesh_from_cellwise_metric(cellwise_optimal_metric);
     
     std::shared_ptr<HighOrderGrid<dim,double,MeshType>> new_high_order_mesh = 
-                                                        read_gmsh <dim, dim> (metric_to_mesh_generator->get_generated_mesh_filename(), dg->all_parameters->do_renumber_dofs);
+                                                        read_gmsh <dim, dim> (metric_to_mesh_generator->get_generated_mesh_filename(), dg->all_parameters->do_renumber_dofs, 0, true, dg->mpi_communicator);
     dg->set_high_order_grid(new_high_order_mesh);
     dg->allocate_system();
 
@@ -474,6 +483,47 @@ void AnisotropicMeshAdaptation<dim, nspecies, nstate, real, MeshType> :: adapt_m
     dg->solution.update_ghost_values();
 }
 
+template<int dim, int nspecies, int nstate, typename real, typename MeshType>
+void AnisotropicMeshAdaptation<dim, nspecies, nstate, real, MeshType> :: refine_mesh_towards_metric()
+{
+    VectorType solution_old = dg->solution;
+    solution_old.update_ghost_values();
+
+    std::vector<dealii::SymmetricTensor<2, dim, real>> metric(cellwise_optimal_metric.size());
+    for(unsigned int i=0; i<metric.size(); ++i)
+    {
+        metric[i] = dealii::symmetrize(cellwise_optimal_metric[i]);
+    }
+
+    // p4est does not support anisotropic splitting.
+    constexpr bool allow_anisotropic = !std::is_same_v<MeshType, dealii::parallel::distributed::Triangulation<dim>>;
+    GridRefinement::MetricRefinement<dim, real>::flag_cells(*(dg->triangulation), metric, allow_anisotropic);
+    dg->triangulation->prepare_coarsening_and_refinement();
+
+    using DoFHandlerType   = typename dealii::DoFHandler<dim>;
+    using SolutionTransfer = typename MeshTypeHelper<MeshType>::template SolutionTransfer<dim,VectorType,DoFHandlerType>;
+
+    SolutionTransfer solution_transfer(this->dg->dof_handler);
+    solution_transfer.prepare_for_coarsening_and_refinement(solution_old);
+    dg->high_order_grid->prepare_for_coarsening_and_refinement();
+
+    dg->triangulation->execute_coarsening_and_refinement();
+    dg->high_order_grid->execute_coarsening_and_refinement();
+
+    dg->allocate_system();
+    dg->solution.zero_out_ghosts();
+
+    if constexpr (std::is_same_v<typename dealii::SolutionTransfer<dim,VectorType,DoFHandlerType>,
+                                 decltype(solution_transfer)>) {
+        solution_transfer.interpolate(solution_old, this->dg->solution);
+    } else {
+        solution_transfer.interpolate(this->dg->solution);
+    }
+
+    dg->solution.update_ghost_values();
+    pcout<<"Mesh has been refined towards the optimal metric. Number of active cells = "<<dg->triangulation->n_global_active_cells()<<std::endl;
+}
+
 // Instantiations
 #if PHILIP_DIM!=1 && PHILIP_SPECIES==1
     // Define a sequence of nstate in the range [1, 5]
@@ -29,9 +29,13 @@ public:
         std::shared_ptr< DGBase<dim, nspecies, real, MeshType> > dg_input, 
         const real _norm_Lp,
         const real _complexity,
-        const bool _use_goal_oriented_approach = false);
+        const bool _use_goal_oriented_approach = false,
+        const bool _use_in_process_remeshing = false);
 
     /// Function which adapts mesh and loads in new mesh.
+    /** If use_in_process_remeshing is set, the current mesh is refined/coarsened towards the optimal metric 
+     *  and the solution is transfered (see refine_mesh_towards_metric()) instead of remeshing through GMSH.
+     */
     void adapt_mesh();
 
 private:
@@ -57,6 +61,13 @@ private:
     /// Computes pseudo Hessian for the goal oriented approach.
     void compute_goal_oriented_hessian();
 
+    /// Refines and coarsens the current mesh towards the optimal metric, then transfers the solution.
+    /** Avoids the file i/o and external GMSH process of MetricToMeshGenerator. As anisotropic splitting is not 
+     *  availible with p4est, cells of distributed meshes are refined isotropically to match the metric density.
+     *  See GridRefinement::MetricRefinement for details.
+     */
+    void refine_mesh_towards_metric();
+
     /// Change the polynomial order and interpolate solution. 
     void change_p_degree_and_interpolate_solution(const unsigned int poly_degree);
 
@@ -82,6 +93,9 @@ private:
 
     ///Flag to use goal oriented approach. It is set to false by default.
     const bool use_goal_oriented_approach;
+
+    /// Flag to adapt the current mesh in-process instead of remeshing through GMSH. It is set to false by default.
+    const bool use_in_process_remeshing;
     
     /// Stores hessian in each cell
     std::vector<dealii::Tensor<2, dim, real>> cellwise_hessian;
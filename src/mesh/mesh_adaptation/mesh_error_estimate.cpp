@@ -9,6 +9,7 @@
 #include <deal.II/fe/fe_values.h>
 #include <deal.II/grid/tria.h>
 #include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/lapack_full_matrix.h>
 #include <deal.II/numerics/data_out.h>
 #include <deal.II/numerics/vector_tools.h>
 
@@ -17,6 +18,7 @@
 #include <vector>
 
 #include "dg/dg_base.hpp"
+#include "dg/dg_factory.hpp"
 #include "functional/functional.h"
 #include "linear_solver/linear_solver.h"
 #include "parameters/all_parameters.h"
@@ -73,6 +75,7 @@ DualWeightedResidualError<dim, nspecies, nstate, real, MeshType>::DualWeightedRe
     , solution_refinement_state(SolutionRefinementStateEnum::coarse)
     , mpi_communicator(MPI_COMM_WORLD)
     , pcout(std::cout, dealii::Utilities::MPI::this_mpi_process(mpi_communicator)==0)
+    , fine_space_is_current(false)
 {
     Assert(this->dg->triangulation->get_mesh_smoothing() == typename dealii::Triangulation<dim>::MeshSmoothing(dealii::Triangulation<dim>::none), 
            dealii::ExcMessage("Mesh smoothing might h-refine cells while computing the dual weighted residual."));
@@ -92,6 +95,12 @@ DualWeightedResidualError<dim, nspecies, nstate, real, MeshType>::DualWeightedRe
     }
 }
 
+template <int dim, int nspecies, int nstate, typename real, typename MeshType>
+DualWeightedResidualError<dim, nspecies, nstate, real, MeshType>::~DualWeightedResidualError()
+{
+    triangulation_change_connection.disconnect();
+}
+
 template <int dim, int nspecies, int nstate, typename real, typename MeshType>
 real DualWeightedResidualError<dim, nspecies, nstate, real, MeshType>::total_dual_weighted_residual_error()
 {
@@ -173,92 +182,203 @@ void DualWeightedResidualError<dim, nspecies, nstate, real, MeshType>::convert_d
 template <int dim, int nspecies, int nstate, typename real, typename MeshType>
 void DualWeightedResidualError<dim, nspecies, nstate, real, MeshType>::coarse_to_fine()
 {
-    if (this->dg->get_max_fe_degree() >= this->dg->max_degree) 
+    setup_fine_space();
+
+    prolongate_coarse_to_fine(solution_coarse, dg_fine->solution);
+
+    solution_refinement_state = SolutionRefinementStateEnum::fine;
+}
+
+template <int dim, int nspecies, int nstate, typename real, typename MeshType>
+void DualWeightedResidualError<dim, nspecies, nstate, real, MeshType>::fine_to_coarse()
+{
+    this->dg->solution = solution_coarse;
+    this->dg->solution.update_ghost_values();
+
+    solution_refinement_state = SolutionRefinementStateEnum::coarse;
+}
+
+template <int dim, int nspecies, int nstate, typename real, typename MeshType>
+void DualWeightedResidualError<dim, nspecies, nstate, real, MeshType>::setup_fine_space()
+{
+    if (!dg_fine) 
     {
-        pcout<<"Polynomial degree of DG will exceed the maximum allowable after refinement. Update max_degree in dg"<<std::endl;
-        std::abort();
+        // One degree above the coarse maximum so that every coarse cell can be enriched.
+        dg_fine = DGFactory<dim,nspecies,real,MeshType>::create_discontinuous_galerkin(
+            this->dg->all_parameters,
+            this->dg->initial_degree,
+            this->dg->max_degree+1,
+            this->dg->max_grid_degree,
+            this->dg->triangulation);
+        dg_fine->set_high_order_grid(this->dg->high_order_grid);
+
+        // Any later refinement of the shared triangulation (h or p) invalidates the fine DoFs.
+        triangulation_change_connection = this->dg->triangulation->signals.any_change.connect([this]() { fine_space_is_current = false; });
+        fine_space_is_current = false;
+
+        prolongation_matrices.resize(this->dg->fe_collection.size());
+        restriction_matrices.resize(this->dg->fe_collection.size());
     }
-    
-    [[maybe_unused]] unsigned int no_of_cells_before_changing_p = this->dg->triangulation->n_active_cells(); // used in debug mode (in assert).  
-
-    dealii::IndexSet locally_owned_dofs, locally_relevant_dofs;
-    locally_owned_dofs =  this->dg->dof_handler.locally_owned_dofs();
-    dealii::DoFTools::extract_locally_relevant_dofs(this->dg->dof_handler, locally_relevant_dofs);
 
-    solution_coarse.update_ghost_values();
-    
-    // Solution Transfer to fine grid
-    using VectorType       = typename dealii::LinearAlgebra::distributed::Vector<double>;
-    using DoFHandlerType   = typename dealii::DoFHandler<dim>;
-    using SolutionTransfer = typename MeshTypeHelper<MeshType>::template SolutionTransfer<dim,VectorType,DoFHandlerType>;
+    if (dg_fine->high_order_grid != this->dg->high_order_grid) 
+    {
+        dg_fine->set_high_order_grid(this->dg->high_order_grid);
+        fine_space_is_current = false;
+    }
 
-    SolutionTransfer solution_transfer(this->dg->dof_handler);
-    solution_transfer.prepare_for_coarsening_and_refinement(solution_coarse);
+    // FE_index can also be changed directly on the coarse cells without going through the triangulation.
+    int fe_index_mismatch = 0;
+    auto fine_cell = dg_fine->dof_handler.begin_active();
+    for (auto cell = this->dg->dof_handler.begin_active(); cell != this->dg->dof_handler.end(); ++cell, ++fine_cell) 
+    {
+        if (cell->is_locally_owned() && fine_cell->active_fe_index() != cell->active_fe_index()+1) 
+        {
+            fe_index_mismatch = 1;
+            break;
+        }
+    }
+    fe_index_mismatch = dealii::Utilities::MPI::max(fe_index_mismatch, mpi_communicator);
 
-    this->dg->high_order_grid->prepare_for_coarsening_and_refinement();
+    if (fine_space_is_current && !fe_index_mismatch) return;
 
-    for (const auto &cell : this->dg->dof_handler.active_cell_iterators()) 
+    fine_cell = dg_fine->dof_handler.begin_active();
+    for (auto cell = this->dg->dof_handler.begin_active(); cell != this->dg->dof_handler.end(); ++cell, ++fine_cell) 
     {
         if (cell->is_locally_owned()) 
         {
-            cell->set_future_fe_index(cell->active_fe_index()+1);
+            fine_cell->set_active_fe_index(cell->active_fe_index()+1);
         }
     }
+    dg_fine->allocate_system();
 
-    this->dg->triangulation->execute_coarsening_and_refinement();
-    this->dg->high_order_grid->execute_coarsening_and_refinement();
+    functional_fine = FunctionalFactory<dim,nspecies,nstate,real,MeshType>::create_Functional(this->dg->all_parameters->functional_param, dg_fine);
 
-    this->dg->allocate_system();
-    this->dg->solution.zero_out_ghosts();
+    fine_space_is_current = true;
+}
 
-    if constexpr (std::is_same_v<typename dealii::SolutionTransfer<dim,VectorType,DoFHandlerType>, 
-                                 decltype(solution_transfer)>) {
-        solution_transfer.interpolate(solution_coarse, this->dg->solution);
-    } else {
-        solution_transfer.interpolate(this->dg->solution);
-    }
-    
-    this->dg->solution.update_ghost_values();
-    
-    [[maybe_unused]] unsigned int no_of_cells_after_changing_p = this->dg->triangulation->n_active_cells(); // It's used when compiled in debug mode (in assert). 
+template <int dim, int nspecies, int nstate, typename real, typename MeshType>
+void DualWeightedResidualError<dim, nspecies, nstate, real, MeshType>
+::prolongate_coarse_to_fine(const dealii::LinearAlgebra::distributed::Vector<real> &coarse_vector,
+                            dealii::LinearAlgebra::distributed::Vector<real> &fine_vector)
+{
+    fine_vector.reinit(dg_fine->locally_owned_dofs, dg_fine->ghost_dofs, mpi_communicator);
 
-    AssertDimension(no_of_cells_before_changing_p, no_of_cells_after_changing_p);
+    std::vector<dealii::types::global_dof_index> coarse_dofs_indices, fine_dofs_indices;
+    dealii::Vector<real> coarse_dof_values, fine_dof_values;
 
-    solution_refinement_state = SolutionRefinementStateEnum::fine;
+    auto fine_cell = dg_fine->dof_handler.begin_active();
+    for (auto cell = this->dg->dof_handler.begin_active(); cell != this->dg->dof_handler.end(); ++cell, ++fine_cell) 
+    {
+        if (!cell->is_locally_owned()) continue;
+
+        const unsigned int coarse_fe_index_cell = cell->active_fe_index();
+        const dealii::FESystem<dim,dim> &coarse_fe = this->dg->fe_collection[coarse_fe_index_cell];
+        const dealii::FESystem<dim,dim> &fine_fe = dg_fine->fe_collection[fine_cell->active_fe_index()];
+
+        dealii::FullMatrix<real> &prolongation = prolongation_matrices[coarse_fe_index_cell];
+        if (prolongation.m() == 0) 
+        {
+            prolongation.reinit(fine_fe.n_dofs_per_cell(), coarse_fe.n_dofs_per_cell());
+            fine_fe.get_interpolation_matrix(coarse_fe, prolongation);
+        }
+
+        coarse_dofs_indices.resize(coarse_fe.n_dofs_per_cell());
+        cell->get_dof_indices(coarse_dofs_indices);
+        fine_dofs_indices.resize(fine_fe.n_dofs_per_cell());
+        fine_cell->get_dof_indices(fine_dofs_indices);
+
+        coarse_dof_values.reinit(coarse_dofs_indices.size());
+        fine_dof_values.reinit(fine_dofs_indices.size());
+        for (unsigned int idof = 0; idof < coarse_dofs_indices.size(); ++idof) 
+        {
+            coarse_dof_values[idof] = coarse_vector[coarse_dofs_indices[idof]];
+        }
+        prolongation.vmult(fine_dof_values, coarse_dof_values);
+        for (unsigned int idof = 0; idof < fine_dofs_indices.size(); ++idof) 
+        {
+            fine_vector[fine_dofs_indices[idof]] = fine_dof_values[idof];
+        }
+    }
+
+    fine_vector.update_ghost_values();
 }
 
 template <int dim, int nspecies, int nstate, typename real, typename MeshType>
-void DualWeightedResidualError<dim, nspecies, nstate, real, MeshType>::fine_to_coarse()
+void DualWeightedResidualError<dim, nspecies, nstate, real, MeshType>
+::restrict_fine_to_coarse(const dealii::LinearAlgebra::distributed::Vector<real> &fine_vector,
+                          dealii::LinearAlgebra::distributed::Vector<real> &coarse_vector)
 {
-    [[maybe_unused]] unsigned int no_of_cells_before_changing_p = this->dg->triangulation->n_active_cells(); // Used in assert (i.e remains unused in Release mode).
-    this->dg->high_order_grid->prepare_for_coarsening_and_refinement();
+    coarse_vector.reinit(this->dg->locally_owned_dofs, this->dg->ghost_dofs, mpi_communicator);
 
-    for (const auto &cell : this->dg->dof_handler.active_cell_iterators()) 
+    std::vector<dealii::types::global_dof_index> coarse_dofs_indices, fine_dofs_indices;
+    dealii::Vector<real> coarse_dof_values, fine_dof_values;
+
+    auto fine_cell = dg_fine->dof_handler.begin_active();
+    for (auto cell = this->dg->dof_handler.begin_active(); cell != this->dg->dof_handler.end(); ++cell, ++fine_cell) 
     {
-        if (cell->is_locally_owned()) 
+        if (!cell->is_locally_owned()) continue;
+
+        const unsigned int coarse_fe_index_cell = cell->active_fe_index();
+        const dealii::FESystem<dim,dim> &coarse_fe = this->dg->fe_collection[coarse_fe_index_cell];
+        const dealii::FESystem<dim,dim> &fine_fe = dg_fine->fe_collection[fine_cell->active_fe_index()];
+
+        dealii::FullMatrix<real> &restriction = restriction_matrices[coarse_fe_index_cell];
+        if (restriction.m() == 0) 
         {
-            cell->set_future_fe_index(coarse_fe_index[cell->active_cell_index()]);
+            restriction.reinit(coarse_fe.n_dofs_per_cell(), fine_fe.n_dofs_per_cell());
+            coarse_fe.get_interpolation_matrix(fine_fe, restriction);
         }
-    }
 
-    this->dg->triangulation->execute_coarsening_and_refinement();
-    this->dg->high_order_grid->execute_coarsening_and_refinement();
+        coarse_dofs_indices.resize(coarse_fe.n_dofs_per_cell());
+        cell->get_dof_indices(coarse_dofs_indices);
+        fine_dofs_indices.resize(fine_fe.n_dofs_per_cell());
+        fine_cell->get_dof_indices(fine_dofs_indices);
 
-    this->dg->allocate_system();
-    this->dg->solution.zero_out_ghosts();
+        coarse_dof_values.reinit(coarse_dofs_indices.size());
+        fine_dof_values.reinit(fine_dofs_indices.size());
+        for (unsigned int idof = 0; idof < fine_dofs_indices.size(); ++idof) 
+        {
+            fine_dof_values[idof] = fine_vector[fine_dofs_indices[idof]];
+        }
+        restriction.vmult(coarse_dof_values, fine_dof_values);
+        for (unsigned int idof = 0; idof < coarse_dofs_indices.size(); ++idof) 
+        {
+            coarse_vector[coarse_dofs_indices[idof]] = coarse_dof_values[idof];
+        }
+    }
 
-    this->dg->solution = solution_coarse;
-    
-    [[maybe_unused]] unsigned int no_of_cells_after_changing_p = this->dg->triangulation->n_active_cells(); // Used when compiled in debug mode (in assert).
+    coarse_vector.update_ghost_values();
+}
 
-    AssertDimension(no_of_cells_before_changing_p, no_of_cells_after_changing_p);
+template <int dim, int nspecies, int nstate, typename real, typename MeshType>
+std::shared_ptr<DGBase<dim,nspecies,real,MeshType>> DualWeightedResidualError<dim, nspecies, nstate, real, MeshType>::current_dg() const
+{
+    if (solution_refinement_state == SolutionRefinementStateEnum::fine) return dg_fine;
+    return this->dg;
+}
 
-    solution_refinement_state = SolutionRefinementStateEnum::coarse;
+template <int dim, int nspecies, int nstate, typename real, typename MeshType>
+std::shared_ptr< Functional<dim, nspecies, nstate, real, MeshType> > DualWeightedResidualError<dim, nspecies, nstate, real, MeshType>::current_functional() const
+{
+    if (solution_refinement_state == SolutionRefinementStateEnum::fine) return functional_fine;
+    return functional;
 }
 
 template <int dim, int nspecies, int nstate, typename real, typename MeshType>
 dealii::LinearAlgebra::distributed::Vector<real> DualWeightedResidualError<dim, nspecies, nstate, real, MeshType>::fine_grid_adjoint()
 {
+    using FineAdjointEnum = Parameters::MeshAdaptationParam::FineAdjointType;
+    const Parameters::MeshAdaptationParam &mesh_adaptation_param = this->dg->all_parameters->mesh_adaptation_param;
+
+    if (mesh_adaptation_param.fine_adjoint_type == FineAdjointEnum::element_patch) 
+    {
+        return patch_fine_grid_adjoint();
+    }
+    else if (mesh_adaptation_param.fine_adjoint_type == FineAdjointEnum::smoothed_coarse) 
+    {
+        return smoothed_fine_grid_adjoint(mesh_adaptation_param.fine_adjoint_smoothing_sweeps);
+    }
+
     convert_dgsolution_to_coarse_or_fine(SolutionRefinementStateEnum::fine);
 
     adjoint_fine = compute_adjoint(derivative_functional_wrt_solution_fine, adjoint_fine);
@@ -266,6 +386,176 @@ dealii::LinearAlgebra::distributed::Vector<real> DualWeightedResidualError<dim,
     return adjoint_fine;
 }
 
+template <int dim, int nspecies, int nstate, typename real, typename MeshType>
+dealii::LinearAlgebra::distributed::Vector<real> DualWeightedResidualError<dim, nspecies, nstate, real, MeshType>::patch_fine_grid_adjoint()
+{
+    initialize_approximate_fine_adjoint();
+
+    dealii::LinearAlgebra::distributed::Vector<real> residual;
+    fine_adjoint_residual(residual);
+
+    dealii::LinearAlgebra::distributed::Vector<real> correction;
+    correction.reinit(adjoint_fine);
+
+    std::vector<dealii::types::global_dof_index> cell_dofs_indices, patch_dofs_indices;
+    std::vector<typename dealii::DoFHandler<dim>::active_cell_iterator> patch_cells;
+    dealii::FullMatrix<real> patch_matrix;
+    dealii::LAPACKFullMatrix<real> patch_lu;
+    dealii::Vector<real> patch_correction;
+
+    for (const auto &cell : dg_fine->dof_handler.active_cell_iterators()) 
+    {
+        if(!cell->is_locally_owned())  continue;
+
+        // Cell and its locally owned face neighbours, the cell itself comes first.
+        patch_cells.clear();
+        patch_cells.push_back(cell);
+        for (unsigned int iface = 0; iface < dealii::GeometryInfo<dim>::faces_per_cell; ++iface) 
+        {
+            if (cell->at_boundary(iface)) continue;
+
+            auto neighbor = cell->neighbor(iface);
+            if constexpr (dim == 1) 
+            {
+                while (neighbor->has_children()) neighbor = neighbor->child(1-iface);
+            }
+            if (neighbor->has_children()) 
+            {
+                for (unsigned int isubface = 0; isubface < cell->face(iface)->n_children(); ++isubface) 
+                {
+                    const auto neighbor_child = cell->neighbor_child_on_subface(iface, isubface);
+                    if (neighbor_child->is_locally_owned()) patch_cells.push_back(neighbor_child);
+                }
+            }
+            else if (neighbor->is_locally_owned()) 
+            {
+                patch_cells.push_back(neighbor);
+            }
+        }
+
+        patch_dofs_indices.clear();
+        for (const auto &patch_cell : patch_cells) 
+        {
+            cell_dofs_indices.resize(patch_cell->get_fe().n_dofs_per_cell());
+            patch_cell->get_dof_indices(cell_dofs_indices);
+            patch_dofs_indices.insert(patch_dofs_indices.end(), cell_dofs_indices.begin(), cell_dofs_indices.end());
+        }
+
+        // Factor the patch matrix and solve for the residual instead of forming the inverse.
+        transposed_fine_jacobian_block(patch_dofs_indices, patch_dofs_indices, patch_matrix);
+        patch_lu.reinit(patch_dofs_indices.size());
+        patch_lu = patch_matrix;
+        patch_lu.compute_lu_factorization();
+
+        patch_correction.reinit(patch_dofs_indices.size());
+        for (unsigned int idof = 0; idof < patch_dofs_indices.size(); ++idof) 
+        {
+            patch_correction[idof] = residual[patch_dofs_indices[idof]];
+        }
+        patch_lu.solve(patch_correction);
+
+        const unsigned int n_dofs_cell = cell->get_fe().n_dofs_per_cell();
+        for (unsigned int idof = 0; idof < n_dofs_cell; ++idof) 
+        {
+            correction[patch_dofs_indices[idof]] = patch_correction[idof];
+        }
+    }
+
+    adjoint_fine += correction;
+    adjoint_fine.update_ghost_values();
+
+    return adjoint_fine;
+}
+
+template <int dim, int nspecies, int nstate, typename real, typename MeshType>
+dealii::LinearAlgebra::distributed::Vector<real> DualWeightedResidualError<dim, nspecies, nstate, real, MeshType>::smoothed_fine_grid_adjoint(const unsigned int n_sweeps)
+{
+    initialize_approximate_fine_adjoint();
+
+    // Inverse of the diagonal blocks, in the order of the locally owned cells.
+    std::vector<dealii::FullMatrix<real>> inverse_diagonal_blocks;
+    std::vector<dealii::types::global_dof_index> cell_dofs_indices;
+    for (const auto &cell : dg_fine->dof_handler.active_cell_iterators()) 
+    {
+        if(!cell->is_locally_owned())  continue;
+
+        cell_dofs_indices.resize(cell->get_fe().n_dofs_per_cell());
+        cell->get_dof_indices(cell_dofs_indices);
+
+        inverse_diagonal_blocks.emplace_back();
+        transposed_fine_jacobian_block(cell_dofs_indices, cell_dofs_indices, inverse_diagonal_blocks.back());
+        inverse_diagonal_blocks.back().gauss_jordan();
+    }
+
+    dealii::LinearAlgebra::distributed::Vector<real> residual;
+    dealii::Vector<real> cell_residual, cell_correction;
+    for (unsigned int isweep = 0; isweep < n_sweeps; ++isweep) 
+    {
+        fine_adjoint_residual(residual);
+
+        unsigned int iblock = 0;
+        for (const auto &cell : dg_fine->dof_handler.active_cell_iterators()) 
+        {
+            if(!cell->is_locally_owned())  continue;
+
+            const unsigned int n_dofs_cell = cell->get_fe().n_dofs_per_cell();
+            cell_dofs_indices.resize(n_dofs_cell);
+            cell->get_dof_indices(cell_dofs_indices);
+
+            cell_residual.reinit(n_dofs_cell);
+            cell_correction.reinit(n_dofs_cell);
+            for (unsigned int idof = 0; idof < n_dofs_cell; ++idof) 
+            {
+                cell_residual[idof] = residual[cell_dofs_indices[idof]];
+            }
+            inverse_diagonal_blocks[iblock++].vmult(cell_correction, cell_residual);
+            for (unsigned int idof = 0; idof < n_dofs_cell; ++idof) 
+            {
+                adjoint_fine[cell_dofs_indices[idof]] += cell_correction[idof];
+            }
+        }
+        adjoint_fine.update_ghost_values();
+    }
+
+    return adjoint_fine;
+}
+
+template <int dim, int nspecies, int nstate, typename real, typename MeshType>
+void DualWeightedResidualError<dim, nspecies, nstate, real, MeshType>::initialize_approximate_fine_adjoint()
+{
+    coarse_grid_adjoint();
+
+    convert_dgsolution_to_coarse_or_fine(SolutionRefinementStateEnum::fine);
+
+    assemble_adjoint_system(derivative_functional_wrt_solution_fine);
+    prolongate_coarse_to_fine(adjoint_coarse, adjoint_fine);
+}
+
+template <int dim, int nspecies, int nstate, typename real, typename MeshType>
+void DualWeightedResidualError<dim, nspecies, nstate, real, MeshType>::fine_adjoint_residual(dealii::LinearAlgebra::distributed::Vector<real> &residual) const
+{
+    residual.reinit(adjoint_fine);
+    dg_fine->system_matrix_transpose.vmult(residual, adjoint_fine);
+    residual += derivative_functional_wrt_solution_fine;
+    residual *= -1.0;
+}
+
+template <int dim, int nspecies, int nstate, typename real, typename MeshType>
+void DualWeightedResidualError<dim, nspecies, nstate, real, MeshType>
+::transposed_fine_jacobian_block(const std::vector<dealii::types::global_dof_index> &row_indices,
+                                 const std::vector<dealii::types::global_dof_index> &column_indices,
+                                 dealii::FullMatrix<real> &block) const
+{
+    block.reinit(row_indices.size(), column_indices.size());
+    for (unsigned int irow = 0; irow < row_indices.size(); ++irow) 
+    {
+        for (unsigned int icol = 0; icol < column_indices.size(); ++icol) 
+        {
+            block(irow, icol) = dg_fine->system_matrix_transpose.el(row_indices[irow], column_indices[icol]);
+        }
+    }
+}
+
 template <int dim, int nspecies, int nstate, typename real, typename MeshType>
 dealii::LinearAlgebra::distributed::Vector<real> DualWeightedResidualError<dim, nspecies, nstate, real, MeshType>::coarse_grid_adjoint()
 {
@@ -281,22 +571,15 @@ dealii::LinearAlgebra::distributed::Vector<real> DualWeightedResidualError<dim,
 ::compute_adjoint(dealii::LinearAlgebra::distributed::Vector<real> &derivative_functional_wrt_solution, 
                   dealii::LinearAlgebra::distributed::Vector<real> &adjoint_variable)
 {
-    derivative_functional_wrt_solution.reinit(this->dg->solution);
-    adjoint_variable.reinit(this->dg->solution);
-    
-    const bool compute_derivative_functional_wrt_solution = true, compute_derivative_functional_wrt_grid_dofs = false;
-    const real functional_value = functional->evaluate_functional(compute_derivative_functional_wrt_solution, compute_derivative_functional_wrt_grid_dofs);
-    (void) functional_value;
-    derivative_functional_wrt_solution = functional->dIdw;
-    derivative_functional_wrt_solution.update_ghost_values();
-
+    const std::shared_ptr<DGBase<dim,nspecies,real,MeshType>> dg_state = current_dg();
 
-    this->dg->assemble_residual(true);
+    adjoint_variable.reinit(dg_state->solution);
+    assemble_adjoint_system(derivative_functional_wrt_solution);
     
     AssertDimension(derivative_functional_wrt_solution.size(), adjoint_variable.size());
-    AssertDimension(this->dg->system_matrix_transpose.n(), adjoint_variable.size());
+    AssertDimension(dg_state->system_matrix_transpose.n(), adjoint_variable.size());
    
-    solve_linear(this->dg->system_matrix_transpose, derivative_functional_wrt_solution, adjoint_variable, this->dg->all_parameters->linear_solver_param);
+    solve_linear(dg_state->system_matrix_transpose, derivative_functional_wrt_solution, adjoint_variable, dg_state->all_parameters->linear_solver_param);
     adjoint_variable *= -1.0;
     
     adjoint_variable.compress(dealii::VectorOperation::add);
@@ -305,24 +588,42 @@ dealii::LinearAlgebra::distributed::Vector<real> DualWeightedResidualError<dim,
     return adjoint_variable;
 }
 
+template <int dim, int nspecies, int nstate, typename real, typename MeshType>
+void DualWeightedResidualError<dim, nspecies, nstate, real, MeshType>
+::assemble_adjoint_system(dealii::LinearAlgebra::distributed::Vector<real> &derivative_functional_wrt_solution)
+{
+    const std::shared_ptr<DGBase<dim,nspecies,real,MeshType>> dg_state = current_dg();
+    const std::shared_ptr< Functional<dim, nspecies, nstate, real, MeshType> > functional_state = current_functional();
+
+    derivative_functional_wrt_solution.reinit(dg_state->solution);
+    
+    const bool compute_derivative_functional_wrt_solution = true, compute_derivative_functional_wrt_grid_dofs = false;
+    const real functional_value = functional_state->evaluate_functional(compute_derivative_functional_wrt_solution, compute_derivative_functional_wrt_grid_dofs);
+    (void) functional_value;
+    derivative_functional_wrt_solution = functional_state->dIdw;
+    derivative_functional_wrt_solution.update_ghost_values();
+
+    dg_state->assemble_residual(true);
+}
+
 template <int dim, int nspecies, int nstate, typename real, typename MeshType>
 dealii::Vector<real> DualWeightedResidualError<dim, nspecies, nstate, real, MeshType>::dual_weighted_residual()
 {
     convert_dgsolution_to_coarse_or_fine(SolutionRefinementStateEnum::fine);
 
     // allocate 
-    dual_weighted_residual_fine.reinit(this->dg->triangulation->n_active_cells());
+    dual_weighted_residual_fine.reinit(dg_fine->triangulation->n_active_cells());
 
-    const unsigned int max_dofs_per_cell = this->dg->dof_handler.get_fe_collection().max_dofs_per_cell();
+    const unsigned int max_dofs_per_cell = dg_fine->dof_handler.get_fe_collection().max_dofs_per_cell();
     std::vector<dealii::types::global_dof_index> current_dofs_indices(max_dofs_per_cell);
 
     // compute the error indicator cell-wise by taking the dot product over the DOFs with the residual vector
-    for (const auto &cell : this->dg->dof_handler.active_cell_iterators()) 
+    for (const auto &cell : dg_fine->dof_handler.active_cell_iterators()) 
     {
         if(!cell->is_locally_owned())  continue;
         
         const unsigned int fe_index_curr_cell = cell->active_fe_index();
-        const dealii::FESystem<dim,dim> &current_fe_ref = this->dg->fe_collection[fe_index_curr_cell];
+        const dealii::FESystem<dim,dim> &current_fe_ref = dg_fine->fe_collection[fe_index_curr_cell];
         const unsigned int n_dofs_curr_cell = current_fe_ref.n_dofs_per_cell();
 
         current_dofs_indices.resize(n_dofs_curr_cell);
@@ -331,7 +632,7 @@ dealii::Vector<real> DualWeightedResidualError<dim, nspecies, nstate, real, Mesh
         real dwr_cell = 0;
         for(unsigned int idof = 0; idof < n_dofs_curr_cell; ++idof)
         {
-            dwr_cell += this->dg->right_hand_side[current_dofs_indices[idof]]*adjoint_fine[current_dofs_indices[idof]];
+            dwr_cell += dg_fine->right_hand_side[current_dofs_indices[idof]]*adjoint_fine[current_dofs_indices[idof]];
         }
 
         dual_weighted_residual_fine[cell->active_cell_index()] = std::abs(dwr_cell);
@@ -343,22 +644,24 @@ dealii::Vector<real> DualWeightedResidualError<dim, nspecies, nstate, real, Mesh
 template <int dim, int nspecies, int nstate, typename real, typename MeshType>
 void DualWeightedResidualError<dim, nspecies, nstate, real, MeshType>::output_results_vtk(const unsigned int cycle)
 {
+    const std::shared_ptr<DGBase<dim,nspecies,real,MeshType>> dg_state = current_dg();
+
     dealii::DataOut<dim, dealii::DoFHandler<dim>> data_out;
-    data_out.attach_dof_handler(this->dg->dof_handler);
+    data_out.attach_dof_handler(dg_state->dof_handler);
 
-    const std::unique_ptr< dealii::DataPostprocessor<dim> > post_processor = Postprocess::PostprocessorFactory<dim,nspecies>::create_Postprocessor(this->dg->all_parameters);
-    data_out.add_data_vector(this->dg->solution, *post_processor);
+    const std::unique_ptr< dealii::DataPostprocessor<dim> > post_processor = Postprocess::PostprocessorFactory<dim,nspecies>::create_Postprocessor(dg_state->all_parameters);
+    data_out.add_data_vector(dg_state->solution, *post_processor);
 
-    dealii::Vector<float> subdomain(this->dg->triangulation->n_active_cells());
+    dealii::Vector<float> subdomain(dg_state->triangulation->n_active_cells());
     for (unsigned int i = 0; i < subdomain.size(); ++i) 
     {
-        subdomain(i) = this->dg->triangulation->locally_owned_subdomain();
+        subdomain(i) = dg_state->triangulation->locally_owned_subdomain();
     }
     data_out.add_data_vector(subdomain, "subdomain", dealii::DataOut_DoFData<dealii::DoFHandler<dim>,dim>::DataVectorType::type_cell_data);
 
     // Output the polynomial degree in each cell
     std::vector<unsigned int> active_fe_indices;
-    this->dg->dof_handler.get_active_fe_indices(active_fe_indices);
+    dg_state->dof_handler.get_active_fe_indices(active_fe_indices);
     dealii::Vector<double> active_fe_indices_dealiivector(active_fe_indices.begin(), active_fe_indices.end());
     dealii::Vector<double> cell_poly_degree = active_fe_indices_dealiivector;
 
@@ -371,7 +674,7 @@ void DualWeightedResidualError<dim, nspecies, nstate, real, MeshType>::output_re
         residual_names.push_back(varname);
     }
 
-    data_out.add_data_vector(this->dg->right_hand_side, residual_names, dealii::DataOut_DoFData<dealii::DoFHandler<dim>,dim>::DataVectorType::type_dof_data);
+    data_out.add_data_vector(dg_state->right_hand_side, residual_names, dealii::DataOut_DoFData<dealii::DoFHandler<dim>,dim>::DataVectorType::type_dof_data);
 
     // set names of data to be output in the vtu file.
     std::vector<std::string> derivative_functional_wrt_solution_names;
@@ -9,6 +9,7 @@
 #include <deal.II/fe/fe_values.h>
 #include <deal.II/grid/grid_refinement.h>
 #include <deal.II/grid/tria.h>
+#include <deal.II/lac/full_matrix.h>
 #include <deal.II/lac/la_parallel_vector.h>
 
 #include <iostream>
@@ -79,6 +80,11 @@ public:
   * 
   * Includes functions for solving both the coarse and fine \f$p\f$-enriched adjoint problems. Subscripts \f$H\f$ 
   * and \f$h\f$ are used to denote coarse and fine grid variables respectively.
+  *
+  * The \f$p\f$-enriched space is a second DGBase (DualWeightedResidualError::dg_fine) sharing the triangulation and
+  * HighOrderGrid of the coarse one. It is built once and only reallocated when the mesh or the polynomial distribution
+  * of the coarse DGBase changes, so that the coarse DGBase is never refined or reallocated by the error estimate.
+  * Solutions are moved between both spaces through cell-local prolongation and restriction matrices.
   * Reference: Venditti AND Darmafol, "Adjoint Error Estimation and Grid Adaptation for Functional Outputs: Application to Quasi-One-Dimensional Flow". Journal of Computational Physics 164, 1 (2000), 204–227.
   */ 
 #if PHILIP_DIM==1 // dealii::parallel::distributed::Triangulation<dim> does not work for 1D
@@ -103,6 +109,10 @@ public:
      */
     explicit DualWeightedResidualError(std::shared_ptr< DGBase<dim, nspecies, real, MeshType> > dg_input);
 
+    /// Destructor
+    /** Disconnects from the triangulation signals. */
+    ~DualWeightedResidualError();
+
     /// Reinitializes member variables of DualWeightedResidualError.
     /** Sets solution_refinement_state to SolutionRefinementStateEnum::coarse and stores the current
      *  solution and polynomial order distribution
@@ -116,17 +126,35 @@ public:
     void convert_dgsolution_to_coarse_or_fine(SolutionRefinementStateEnum refinement_state);
 
     /// Projects the problem to a p-enriched space.
-    /** Raises the FE_index on each cell and transfers the coarse 
-     *  solution to a fine solution (stored in DGBase::solution)
+    /** Updates the p-enriched space if needed through setup_fine_space() and prolongates the coarse 
+     *  solution to a fine solution (stored in DualWeightedResidualError::dg_fine's DGBase::solution)
      */
     void coarse_to_fine();
 
     /// Return the problem to the original solution and polynomial distribution
-    /** Copies the values that were stored in solution_coarse and 
-     *  DualWeightedResidualError::coarse_fe_index at intilization
+    /** The coarse DGBase is left untouched by coarse_to_fine(), so this only switches the refinement state
+     *  and restores the values stored in solution_coarse.
      */
     void fine_to_coarse();
 
+    /// Builds or updates the p-enriched space.
+    /** Creates DualWeightedResidualError::dg_fine on the first call. Later calls only reallocate it when the
+     *  triangulation changed or when the fine FE_index of a cell is no longer one above the coarse one.
+     */
+    void setup_fine_space();
+
+    /// Prolongates a coarse space vector to the p-enriched space by cell-wise interpolation.
+    void prolongate_coarse_to_fine(const dealii::LinearAlgebra::distributed::Vector<real> &coarse_vector,
+                                   dealii::LinearAlgebra::distributed::Vector<real> &fine_vector);
+
+    /// Restricts a p-enriched space vector to the coarse space by cell-wise interpolation.
+    /** Left inverse of prolongate_coarse_to_fine(). */
+    void restrict_fine_to_coarse(const dealii::LinearAlgebra::distributed::Vector<real> &fine_vector,
+                                 dealii::LinearAlgebra::distributed::Vector<real> &coarse_vector);
+
+    /// DGBase of the current refinement state.
+    std::shared_ptr<DGBase<dim,nspecies,real,MeshType>> current_dg() const;
+
     /// Computes the fine grid adjoint
     /** Converts the state to a refined grid (if needed) and solves for DualWeightedResidualError::adjoint_fine from 
      *  \f[
@@ -135,9 +163,27 @@ public:
      *  \f]
      *  where \f$\mathbf{u}_h^H\f$ is the projected solution on the fine grid.
      *  Eq(7) from Venditti and Darmafol (2000), cited above.
+     *  The global solve can be replaced by patch_fine_grid_adjoint() or smoothed_fine_grid_adjoint()
+     *  through Parameters::MeshAdaptationParam::fine_adjoint_type.
      */ 
     dealii::LinearAlgebra::distributed::Vector<real> fine_grid_adjoint();
 
+    /// Approximates the fine grid adjoint with element-patch local solves
+    /** Starting from the prolongated coarse adjoint \f$\psi_h^H\f$, the fine adjoint system is solved on the patch
+     *  \f$P_K\f$ made of each cell \f$K\f$ and its face neighbours, with the fine adjoint residual
+     *  \f$ -\left(\frac{\partial \mathcal{J}_h}{\partial \mathbf{u}}\right)^T - \left(\frac{\partial \mathbf{R}_h}{\partial \mathbf{u}}\right)^T \psi_h^H \f$
+     *  as right-hand side. Only the correction on \f$K\f$ is kept. Patches are truncated at processor boundaries.
+     */
+    dealii::LinearAlgebra::distributed::Vector<real> patch_fine_grid_adjoint();
+
+    /// Approximates the fine grid adjoint by smoothing the prolongated coarse adjoint
+    /** Applies \p n_sweeps block-Jacobi sweeps, one block per cell, on the fine adjoint system
+     *  starting from the prolongated coarse adjoint \f$\psi_h^H\f$.
+     *  The prolongated coarse adjoint alone gives a vanishing DWR by Galerkin orthogonality,
+     *  the sweeps recover its fine grid components.
+     */
+    dealii::LinearAlgebra::distributed::Vector<real> smoothed_fine_grid_adjoint(const unsigned int n_sweeps);
+
     /// Computes the coarse grid adjoint
     /** Reverts the state to the coarse grid (if needed) and solves for DualWeightedResidualError::adjoint_coarse from
      * \f[
@@ -178,6 +224,12 @@ public:
 
     /// Functional class pointer
     std::shared_ptr< Functional<dim, nspecies, nstate, real, MeshType> > functional;
+
+    /// p-enriched DGBase sharing the triangulation and HighOrderGrid of MeshErrorEstimateBase::dg
+    std::shared_ptr<DGBase<dim,nspecies,real,MeshType>> dg_fine;
+
+    /// Functional evaluated on DualWeightedResidualError::dg_fine
+    std::shared_ptr< Functional<dim, nspecies, nstate, real, MeshType> > functional_fine;
     
     /// original solution
     dealii::LinearAlgebra::distributed::Vector<real> solution_coarse;
@@ -202,6 +254,35 @@ protected:
     MPI_Comm mpi_communicator; ///< MPI communicator
     dealii::ConditionalOStream pcout; ///< Parallel std::cout that only outputs on mpi_rank==0
 
+    /// Set to false whenever the triangulation changes, so that dg_fine gets reallocated.
+    bool fine_space_is_current;
+
+    /// Connection to the triangulation signal invalidating the p-enriched space.
+    boost::signals2::connection triangulation_change_connection;
+
+    /// Interpolation matrices from the coarse FE_index to the next FE_index, indexed by the coarse FE_index.
+    std::vector<dealii::FullMatrix<real>> prolongation_matrices;
+
+    /// Interpolation matrices from the fine FE_index to the previous FE_index, indexed by the coarse FE_index.
+    std::vector<dealii::FullMatrix<real>> restriction_matrices;
+
+    /// Functional of the current refinement state.
+    std::shared_ptr< Functional<dim, nspecies, nstate, real, MeshType> > current_functional() const;
+
+    /// Evaluates the functional derivative and assembles the transposed Jacobian of the current refinement state.
+    void assemble_adjoint_system(dealii::LinearAlgebra::distributed::Vector<real> &derivative_functional_wrt_solution);
+
+    /// Sets DualWeightedResidualError::adjoint_fine to the prolongated coarse adjoint and assembles the fine adjoint system.
+    void initialize_approximate_fine_adjoint();
+
+    /// Residual of the fine adjoint system evaluated at DualWeightedResidualError::adjoint_fine.
+    void fine_adjoint_residual(dealii::LinearAlgebra::distributed::Vector<real> &residual) const;
+
+    /// Dense block of the transposed fine Jacobian coupling \p row_indices to \p column_indices.
+    void transposed_fine_jacobian_block(const std::vector<dealii::types::global_dof_index> &row_indices,
+                                        const std::vector<dealii::types::global_dof_index> &column_indices,
+                                        dealii::FullMatrix<real> &block) const;
+
 }; // DualWeightedResidualError class
 
 } // namespace PHiLiP
@@ -58,7 +58,8 @@ namespace MeshMover {
         const DoFHandlerType &_dof_handler,
         const dealii::LinearAlgebra::distributed::Vector<int> &_boundary_ids_vector,
         const dealii::LinearAlgebra::distributed::Vector<double> &_boundary_displacements_vector)
-      : triangulation(_triangulation)
+      : preconditioner_type(PreconditionerType::amg)
+      , triangulation(_triangulation)
       , mapping_fe_field(mapping_fe_field)
       , dof_handler(_dof_handler)
       , quadrature_formula(dof_handler.get_fe().degree + 1)
@@ -68,6 +69,8 @@ namespace MeshMover {
       , pcout(std::cout, this_mpi_process == 0)
       , boundary_ids_vector(_boundary_ids_vector)
       , boundary_displacements_vector(_boundary_displacements_vector)
+      , system_is_assembled(false)
+      , last_n_linear_iterations(0)
     { 
         AssertDimension(boundary_displacements_vector.size(), boundary_ids_vector.size());
 
@@ -169,10 +172,12 @@ namespace MeshMover {
                                                    dof_handler.locally_owned_dofs(),
                                                    mpi_communicator,
                                                    locally_relevant_dofs);
-        system_matrix.reinit(locally_owned_dofs,
-                             locally_owned_dofs,
-                             sparsity_pattern,
-                             mpi_communicator);
+        // A new matrix is allocated since a preconditioner built on the previous one may still be in use.
+        system_matrix = std::make_shared<dealii::TrilinosWrappers::SparseMatrix>();
+        system_matrix->reinit(locally_owned_dofs,
+                              locally_owned_dofs,
+                              sparsity_pattern,
+                              mpi_communicator);
         system_matrix_unconstrained.reinit(locally_owned_dofs,
                                  locally_owned_dofs,
                                  sparsity_pattern,
@@ -189,7 +194,7 @@ namespace MeshMover {
         setup_system();
 
         system_rhs    = 0;
-        system_matrix = 0;
+        *system_matrix = 0;
         system_rhs_unconstrained    = 0;
         system_matrix_unconstrained = 0;
         const dealii::FESystem<dim> &fe_system = dof_handler.get_fe(0);
@@ -283,7 +288,7 @@ namespace MeshMover {
             //all_constraints.distribute_local_to_global(cell_matrix, cell_rhs, local_dof_indices, system_matrix, system_rhs);
             const bool use_inhomogeneities_for_rhs = false;
             //all_constraints.distribute_local_to_global(cell_matrix, cell_rhs, local_dof_indices, system_matrix, system_rhs, use_inhomogeneities_for_rhs);
-            hanging_node_constraints.distribute_local_to_global(cell_matrix, cell_rhs, local_dof_indices, system_matrix, system_rhs, use_inhomogeneities_for_rhs);
+            hanging_node_constraints.distribute_local_to_global(cell_matrix, cell_rhs, local_dof_indices, *system_matrix, system_rhs, use_inhomogeneities_for_rhs);
          // Unconstrained system matrix and right-hand side
          // std::cout << std::endl;
          // for (auto const &value: local_dof_indices) {
@@ -316,7 +321,7 @@ namespace MeshMover {
          system_rhs_unconstrained.add(local_dof_indices, cell_rhs);
 
         } // active cell loop
-        system_matrix.compress(dealii::VectorOperation::add);
+        system_matrix->compress(dealii::VectorOperation::add);
         system_rhs.compress(dealii::VectorOperation::add);
         system_matrix_unconstrained.compress(dealii::VectorOperation::add);
         system_rhs_unconstrained.compress(dealii::VectorOperation::add);
@@ -328,7 +333,7 @@ namespace MeshMover {
                 const unsigned int iglobal_row = boundary_ids_vector[isurf];
                 const double dirichlet_value = boundary_displacements_vector[isurf];
 
-                system_matrix.clear_row(iglobal_row,1.0);
+                system_matrix->clear_row(iglobal_row,1.0);
                 system_rhs[iglobal_row] = dirichlet_value;
             }
         }
@@ -338,13 +343,15 @@ namespace MeshMover {
             const bool is_accessible = partitionner->in_local_range(isurf) || partitionner->is_ghost_entry(isurf);
             if (is_accessible) {
                 const unsigned int iglobal_row = boundary_ids_vector[isurf];
-                system_matrix.set(iglobal_row,iglobal_row,1.0);
+                system_matrix->set(iglobal_row,iglobal_row,1.0);
             }
         }
-        system_matrix.compress(dealii::VectorOperation::insert);
+        system_matrix->compress(dealii::VectorOperation::insert);
         system_rhs.compress(dealii::VectorOperation::insert);
         system_matrix_unconstrained.compress(dealii::VectorOperation::insert);
         system_rhs_unconstrained.compress(dealii::VectorOperation::insert);
+
+        system_is_assembled = true;
     }
     template <int dim, typename real>
     void LinearElasticity<dim,real>::solve_timestep()
@@ -355,27 +362,105 @@ namespace MeshMover {
         //pcout << "    Solver converged in " << n_iterations << " iterations." << std::endl;
     }
 
+    namespace {
+    /** Returns a handle to the preconditioner that also owns the matrix it was built on.
+     *  Trilinos preconditioners keep a pointer to their matrix, which must therefore outlive them,
+     *  even once the LinearElasticity that assembled it has been destroyed.
+     */
+    std::shared_ptr<dealii::TrilinosWrappers::PreconditionBase> keep_matrix_alive(
+        const std::shared_ptr<dealii::TrilinosWrappers::PreconditionBase> &preconditioner,
+        const std::shared_ptr<const dealii::TrilinosWrappers::SparseMatrix> &matrix)
+    {
+        // Members are destroyed in reverse order, such that the preconditioner is released before its matrix.
+        struct PreconditionerAndMatrix {
+            std::shared_ptr<const dealii::TrilinosWrappers::SparseMatrix> matrix;
+            std::shared_ptr<dealii::TrilinosWrappers::PreconditionBase> preconditioner;
+        };
+        const auto owner = std::make_shared<PreconditionerAndMatrix>(PreconditionerAndMatrix{matrix, preconditioner});
+        return std::shared_ptr<dealii::TrilinosWrappers::PreconditionBase>(owner, owner->preconditioner.get());
+    }
+    } // namespace
+
     template <int dim, typename real>
-    void
-    LinearElasticity<dim,real>
-    ::apply_dXvdXvs(
-        const dealii::LinearAlgebra::distributed::Vector<double> &input_vector,
-        dealii::LinearAlgebra::distributed::Vector<double> &output_vector)
+    void LinearElasticity<dim,real>::initialize_linear_solver()
     {
-        pcout << "Applying [dXvdXs] onto a vector..." << std::endl;
-        assert(input_vector.size() == output_vector.size());
+        if (!system_is_assembled) assemble_system();
+        if (system_preconditioner) return;
 
-        double input_vector_norm = input_vector.l2_norm();
-        if (input_vector_norm == 0.0) {
-            pcout << "Zero input vector. Zero output vector." << std::endl;
-            output_vector = 0.0;
-            return;
+        //dealii::TrilinosWrappers::PreconditionJacobi      precondition;
+        //precondition.initialize(system_matrix);
+
+        //dealii::TrilinosWrappers::PreconditionILU  precondition;
+        //const int ilu_fill = 2;
+        //dealii::TrilinosWrappers::PreconditionILU::AdditionalData precond_settings(ilu_fill, 0., 1.0, 1);
+        //precondition.initialize(system_matrix, precond_settings);
+
+        if (preconditioner_type == PreconditionerType::amg) {
+            pcout << "    Building AMG preconditioner for MeshMover::LinearElasticity..." << std::endl;
+            // Smoothed aggregation using the rigid translations of each displacement component as near-null space.
+            std::vector<std::vector<bool>> constant_modes;
+            const dealii::ComponentMask displacement_components(dim, true);
+            dealii::DoFTools::extract_constant_modes(dof_handler, displacement_components, constant_modes);
+
+            dealii::TrilinosWrappers::PreconditionAMG::AdditionalData amg_settings;
+            amg_settings.constant_modes = constant_modes;
+            amg_settings.elliptic = true;
+            amg_settings.higher_order_elements = (dof_handler.get_fe().degree > 1);
+            amg_settings.n_cycles = 1;
+            amg_settings.w_cycle = false;
+            amg_settings.aggregation_threshold = 1e-2;
+            amg_settings.smoother_sweeps = 2;
+            amg_settings.smoother_overlap = 0;
+            amg_settings.output_details = false;
+
+            auto amg = std::make_shared<dealii::TrilinosWrappers::PreconditionAMG>();
+            amg->initialize(*system_matrix, amg_settings);
+            system_preconditioner = keep_matrix_alive(amg, system_matrix);
+        } else {
+            auto ilut = std::make_shared<dealii::TrilinosWrappers::PreconditionILUT>();
+            const unsigned int ilut_fill=50;
+            const double ilut_drop=1e-15;
+            const double ilut_atol=1e-6;
+            const double ilut_rtol=1.00001;
+            const unsigned int overlap=1;
+            dealii::TrilinosWrappers::PreconditionILUT::AdditionalData precond_settings(ilut_drop, ilut_fill, ilut_atol, ilut_rtol, overlap);
+            ilut->initialize(*system_matrix, precond_settings);
+            system_preconditioner = keep_matrix_alive(ilut, system_matrix);
         }
+    }
 
-        assemble_system();
+    template <int dim, typename real>
+    std::shared_ptr<dealii::TrilinosWrappers::PreconditionBase>
+    LinearElasticity<dim,real>::get_preconditioner()
+    {
+        initialize_linear_solver();
+        return system_preconditioner;
+    }
+
+    template <int dim, typename real>
+    void
+    LinearElasticity<dim,real>
+    ::set_preconditioner(const std::shared_ptr<dealii::TrilinosWrappers::PreconditionBase> &preconditioner)
+    {
+        system_preconditioner = preconditioner;
+    }
+
+    template <int dim, typename real>
+    unsigned int LinearElasticity<dim,real>::get_last_n_linear_iterations() const
+    {
+        return last_n_linear_iterations;
+    }
 
+    template <int dim, typename real>
+    void
+    LinearElasticity<dim,real>
+    ::solve_linear_system(
+        const bool transpose,
+        const dealii::LinearAlgebra::distributed::Vector<double> &rhs_vector,
+        dealii::LinearAlgebra::distributed::Vector<double> &solution_vector)
+    {
         const bool log_history = (this_mpi_process == 0);
-        dealii::SolverControl solver_control(20000, 1e-14 * input_vector_norm, log_history);
+        dealii::SolverControl solver_control(20000, 1e-14 * rhs_vector.l2_norm(), log_history);
         //dealii::SolverControl solver_control(20000, 1e-14, log_history);
         solver_control.log_frequency(100);
         const int max_n_tmp_vectors=200;
@@ -385,51 +470,21 @@ namespace MeshMover {
         dealii::SolverGMRES<dealii::LinearAlgebra::distributed::Vector<double>>::AdditionalData gmres_settings(max_n_tmp_vectors, right_preconditioning, use_default_residual, force_re_orthogonalization);
         dealii::SolverGMRES<dealii::LinearAlgebra::distributed::Vector<double>> solver(solver_control, gmres_settings);
 
-        //dealii::TrilinosWrappers::PreconditionJacobi      precondition;
-        //precondition.initialize(system_matrix);
-
-        //dealii::TrilinosWrappers::PreconditionILU  precondition;
-        //const int ilu_fill = 2;
-        //dealii::TrilinosWrappers::PreconditionILU::AdditionalData precond_settings(ilu_fill, 0., 1.0, 1);
-        //precondition.initialize(system_matrix, precond_settings);
-
-        dealii::TrilinosWrappers::PreconditionILUT  precondition;
-        const unsigned int ilut_fill=50;
-        const double ilut_drop=1e-15;
-        const double ilut_atol=1e-6;
-        const double ilut_rtol=1.00001;
-        const unsigned int overlap=1;
-        dealii::TrilinosWrappers::PreconditionILUT::AdditionalData precond_settings(ilut_drop, ilut_fill, ilut_atol, ilut_rtol, overlap);
-        precondition.initialize(system_matrix, precond_settings);
-
-
-        //const double 	omega = 1;
-        //const double 	min_diagonal = 1e-8;
-        //const unsigned int 	overlap = 1;
-        //const unsigned int 	n_sweeps = 1;
-        //dealii::TrilinosWrappers::PreconditionSSOR::AdditionalData precond_settings(omega, min_diagonal, overlap, n_sweeps);
-        //dealii::TrilinosWrappers::PreconditionSSOR  precondition;
-        //precondition.initialize(system_matrix, precond_settings);
-
         using trilinos_vector_type = dealii::LinearAlgebra::distributed::Vector<double>;
         using payload_type = dealii::TrilinosWrappers::internal::LinearOperatorImplementation::TrilinosPayload;
-        const auto op_a = dealii::linear_operator<trilinos_vector_type,trilinos_vector_type,payload_type>(system_matrix);
-
-        const auto &rhs_vector = input_vector;
-        output_vector = input_vector;
-        //output_vector = 0.0;//input_vector;
+        const auto op_a = dealii::linear_operator<trilinos_vector_type,trilinos_vector_type,payload_type>(*system_matrix);
 
-        // Solve modified system.
+        // The solution vector is used as the initial guess.
         dealii::deallog.depth_console(2);
-        solver.solve(op_a, output_vector, rhs_vector, precondition);
-
-        pcout << "dXvdXvs Solver took " << solver_control.last_step() << " steps. "
-              << "Residual: " << solver_control.last_value() << ". "
-              << std::endl;
-
-        solver.solve(op_a, output_vector, rhs_vector, precondition);
+        if (transpose) {
+            const auto op_at = dealii::transpose_operator(op_a);
+            solver.solve(op_at, solution_vector, rhs_vector, *system_preconditioner);
+        } else {
+            solver.solve(op_a, solution_vector, rhs_vector, *system_preconditioner);
+        }
 
-        pcout << "dXvdXvs Solver took " << solver_control.last_step() << " steps. "
+        last_n_linear_iterations = solver_control.last_step();
+        pcout << (transpose ? "dXvdXvs_Transpose" : "dXvdXvs") << " Solver took " << solver_control.last_step() << " steps. "
               << "Residual: " << solver_control.last_value() << ". "
               << std::endl;
 
@@ -439,6 +494,29 @@ namespace MeshMover {
         }
     }
 
+    template <int dim, typename real>
+    void
+    LinearElasticity<dim,real>
+    ::apply_dXvdXvs(
+        const dealii::LinearAlgebra::distributed::Vector<double> &input_vector,
+        dealii::LinearAlgebra::distributed::Vector<double> &output_vector)
+    {
+        pcout << "Applying [dXvdXs] onto a vector..." << std::endl;
+        assert(input_vector.size() == output_vector.size());
+
+        double input_vector_norm = input_vector.l2_norm();
+        if (input_vector_norm == 0.0) {
+            pcout << "Zero input vector. Zero output vector." << std::endl;
+            output_vector = 0.0;
+            return;
+        }
+
+        initialize_linear_solver();
+
+        output_vector = input_vector;
+        solve_linear_system(false, input_vector, output_vector);
+    }
+
     template <int dim, typename real>
     void
     LinearElasticity<dim,real>
@@ -446,108 +524,102 @@ namespace MeshMover {
         std::vector<dealii::LinearAlgebra::distributed::Vector<double>> &list_of_vectors,
         dealii::TrilinosWrappers::SparseMatrix &output_matrix)
     {
-        assemble_system();
-
         const unsigned int n_rows = dof_handler.n_dofs();
         const unsigned int n_cols = list_of_vectors.size();
-        //const unsigned int max_per_row = n_cols;
 
-        const dealii::IndexSet &row_part = dof_handler.locally_owned_dofs();
-        dealii::DoFTools::extract_locally_relevant_dofs(dof_handler, locally_relevant_dofs);
+        pcout << "Applying for [dXvdXs] onto " << n_cols << " vectors..." << std::endl;
 
-        dealii::DynamicSparsityPattern full_dsp(n_rows, n_cols, row_part);
-        for (const auto &i_row: row_part) {
-            for (unsigned int i_col = 0; i_col < n_cols; ++i_col) {
-                full_dsp.add(i_row, i_col);
-            }
-        }
-        dealii::SparsityTools::distribute_sparsity_pattern(full_dsp, dof_handler.locally_owned_dofs(), mpi_communicator, locally_relevant_dofs);
+        // Assembly and preconditioner are shared by all the right-hand sides.
+        initialize_linear_solver();
 
-        dealii::SparsityPattern full_sp;
-        full_sp.copy_from(full_dsp);
+        dXvdXs.clear();
+        dXvdXs.reserve(n_cols);
 
-        const dealii::IndexSet col_part = dealii::Utilities::MPI::create_evenly_distributed_partitioning(MPI_COMM_WORLD,n_cols);
+        // Since the system is linear, previous solutions are recombined into the initial guess of each new solve.
+        // The non-zero right-hand sides solved so far are factored as B = Q R through modified Gram-Schmidt,
+        // where rhs_basis stores the orthonormal Q and rhs_basis_coefficients stores the columns of the upper-triangular R.
+        // Given A X = Q R, the initial guess X R^{-1} Q^T b exactly reproduces the part of b lying in the span of B,
+        // such that GMRES only needs to resolve the remainder. Right-hand sides lying in that span converge without iterating.
+        std::vector<dealii::LinearAlgebra::distributed::Vector<double>> rhs_basis;
+        std::vector<std::vector<double>> rhs_basis_coefficients;
+        std::vector<unsigned int> rhs_basis_columns;
+        // Right-hand sides whose remainder falls below this fraction of their norm do not extend the basis, keeping R well-conditioned.
+        const double basis_extension_tolerance = 1e-8;
 
-        output_matrix.reinit(row_part, col_part, full_sp, mpi_communicator);
+        for (unsigned int col = 0; col < n_cols; ++col) {
 
-        //dealii::TrilinosWrappers::PreconditionJacobi      precondition;
-        //precondition.initialize(system_matrix);
+            pcout << " Vector " << col << " out of " << n_cols << std::endl;
 
-        //dealii::TrilinosWrappers::PreconditionILU  precondition;
-        //const int ilu_fill = 2;
-        //dealii::TrilinosWrappers::PreconditionILU::AdditionalData precond_settings(ilu_fill, 0., 1.0, 1);
-        //precondition.initialize(system_matrix, precond_settings);
+            const dealii::LinearAlgebra::distributed::Vector<double> &input_vector = list_of_vectors[col];
+            dealii::LinearAlgebra::distributed::Vector<double> output_vector;
+            output_vector.reinit(input_vector);
 
-        dealii::TrilinosWrappers::PreconditionILUT  precondition;
-        const unsigned int ilut_fill=50;
-        const double ilut_drop=0.0;//1e-15;
-        const double ilut_atol=0.0;//1e-6;
-        const double ilut_rtol=1.0;//1.00001;
-        const unsigned int overlap=1;
-        dealii::TrilinosWrappers::PreconditionILUT::AdditionalData precond_settings(ilut_drop, ilut_fill, ilut_atol, ilut_rtol, overlap);
-        precondition.initialize(system_matrix, precond_settings);
-
-
-        //const double 	omega = 1;
-        //const double 	min_diagonal = 1e-8;
-        //const unsigned int 	overlap = 1;
-        //const unsigned int 	n_sweeps = 1;
-        //dealii::TrilinosWrappers::PreconditionSSOR::AdditionalData precond_settings(omega, min_diagonal, overlap, n_sweeps);
-        //dealii::TrilinosWrappers::PreconditionSSOR  precondition;
-        //precondition.initialize(system_matrix, precond_settings);
+            const double input_vector_norm = input_vector.l2_norm();
+            if (input_vector_norm == 0.0) {
+                pcout << "Zero input vector. Zero output vector." << std::endl;
+                dXvdXs.push_back(output_vector);
+                continue;
+            }
 
-        using trilinos_vector_type = dealii::LinearAlgebra::distributed::Vector<double>;
-        using payload_type = dealii::TrilinosWrappers::internal::LinearOperatorImplementation::TrilinosPayload;
-        const auto op_a = dealii::linear_operator<trilinos_vector_type,trilinos_vector_type,payload_type>(system_matrix);
+            const unsigned int n_basis = rhs_basis.size();
+            std::vector<double> projection(n_basis+1);
+            dealii::LinearAlgebra::distributed::Vector<double> rhs_remainder = input_vector;
+            for (unsigned int i = 0; i < n_basis; ++i) {
+                projection[i] = rhs_basis[i] * rhs_remainder;
+                rhs_remainder.add(-projection[i], rhs_basis[i]);
+            }
 
-        dXvdXs.clear();
-        pcout << "Applying for [dXvdXs] onto " << list_of_vectors.size() << " vectors..." << std::endl;
+            // Back substitution of R z = Q^T b, followed by the initial guess X z.
+            std::vector<double> z(projection.begin(), projection.begin()+n_basis);
+            for (int i = (int)n_basis-1; i >= 0; --i) {
+                z[i] /= rhs_basis_coefficients[i][i];
+                for (int k = 0; k < i; ++k) {
+                    z[k] -= rhs_basis_coefficients[i][k] * z[i];
+                }
+            }
+            for (unsigned int i = 0; i < n_basis; ++i) {
+                output_vector.add(z[i], dXvdXs[rhs_basis_columns[i]]);
+            }
 
-        unsigned int col = 0;
-        dealii::LinearAlgebra::distributed::Vector<double> output_vector;
-        output_vector.reinit(list_of_vectors[0]);
-        for (auto &input_vector: list_of_vectors) {
+            solve_linear_system(false, input_vector, output_vector);
 
-            pcout << " Vector " << col << " out of " << list_of_vectors.size() << std::endl;
+            const double remainder_norm = rhs_remainder.l2_norm();
+            if (remainder_norm > basis_extension_tolerance * input_vector_norm) {
+                projection[n_basis] = remainder_norm;
+                rhs_remainder /= remainder_norm;
+                rhs_basis.push_back(rhs_remainder);
+                rhs_basis_coefficients.push_back(projection);
+                rhs_basis_columns.push_back(col);
+            }
 
-            dealii::deallog.depth_console(0);
+            dXvdXs.push_back(output_vector);
+        }
+        rhs_basis.clear();
 
-            double input_vector_norm = input_vector.l2_norm();
-            if (input_vector_norm == 0.0) {
-                pcout << "Zero input vector. Zero output vector." << std::endl;
-                output_vector = 0.0;
-            } else {
-                const bool log_history = (this_mpi_process == 0);
-                dealii::SolverControl solver_control(20000, 1e-14 * input_vector_norm, log_history);
-                //dealii::SolverControl solver_control(20000, 1e-14, log_history);
-                solver_control.log_frequency(100);
-                const int max_n_tmp_vectors=200;
-                const bool right_preconditioning=true;
-                const bool use_default_residual=true;
-                const bool force_re_orthogonalization=false;
-                dealii::SolverGMRES<dealii::LinearAlgebra::distributed::Vector<double>>::AdditionalData gmres_settings(max_n_tmp_vectors, right_preconditioning, use_default_residual, force_re_orthogonalization);
-                dealii::SolverGMRES<dealii::LinearAlgebra::distributed::Vector<double>> solver(solver_control, gmres_settings);
-
-                //dealii::SolverBicgstab<dealii::LinearAlgebra::distributed::Vector<double>> solver(solver_control);
-
-                dealii::deallog.depth_console(2);
-                solver.solve(op_a, output_vector, input_vector, precondition);
-                pcout << "dXvdXvs Solver took " << solver_control.last_step() << " steps. "
-                      << "Residual: " << solver_control.last_value() << ". "
-                      << std::endl;
-
-                solver.solve(op_a, output_vector, input_vector, precondition);
-                pcout << "dXvdXvs Solver took " << solver_control.last_step() << " steps. "
-                      << "Residual: " << solver_control.last_value() << ". "
-                      << std::endl;
+        // Only store the non-zero sensitivities, e.g. zero columns and the rows of fixed boundary nodes are skipped.
+        const dealii::IndexSet &row_part = dof_handler.locally_owned_dofs();
+        dealii::DoFTools::extract_locally_relevant_dofs(dof_handler, locally_relevant_dofs);
+
+        dealii::DynamicSparsityPattern dsp(n_rows, n_cols, row_part);
+        for (unsigned int col = 0; col < n_cols; ++col) {
+            for (const auto &row: row_part) {
+                if (dXvdXs[col][row] != 0.0) dsp.add(row, col);
             }
+        }
+        dealii::SparsityTools::distribute_sparsity_pattern(dsp, dof_handler.locally_owned_dofs(), mpi_communicator, locally_relevant_dofs);
 
-            dXvdXs.push_back(output_vector);
+        dealii::SparsityPattern sp;
+        sp.copy_from(dsp);
 
-            for (const auto &row: dof_handler.locally_owned_dofs()) {
-                output_matrix.set(row, col, dXvdXs[col][row]);
+        const dealii::IndexSet col_part = dealii::Utilities::MPI::create_evenly_distributed_partitioning(MPI_COMM_WORLD,n_cols);
+
+        output_matrix.reinit(row_part, col_part, sp, mpi_communicator);
+
+        for (unsigned int col = 0; col < n_cols; ++col) {
+            for (const auto &row: row_part) {
+                const double value = dXvdXs[col][row];
+                if (value != 0.0) output_matrix.set(row, col, value);
             }
-            col++;
         }
         output_matrix.compress(dealii::VectorOperation::insert);
 
@@ -569,66 +641,10 @@ namespace MeshMover {
             return;
         }
 
-        assemble_system();
-
-        const bool log_history = (this_mpi_process == 0);
-        dealii::SolverControl solver_control(20000, 1e-14 * input_vector_norm, log_history);
-        //dealii::SolverControl solver_control(20000, 1e-14, log_history);
-        solver_control.log_frequency(100);
-        const int max_n_tmp_vectors=200;
-        const bool right_preconditioning=true;
-        const bool use_default_residual=true;
-        const bool force_re_orthogonalization=false;
-        dealii::SolverGMRES<dealii::LinearAlgebra::distributed::Vector<double>>::AdditionalData gmres_settings(max_n_tmp_vectors, right_preconditioning, use_default_residual, force_re_orthogonalization);
-        dealii::SolverGMRES<dealii::LinearAlgebra::distributed::Vector<double>> solver(solver_control, gmres_settings);
+        initialize_linear_solver();
 
-        //dealii::TrilinosWrappers::PreconditionJacobi      precondition;
-        //precondition.initialize(system_matrix);
-
-        // dealii::TrilinosWrappers::PreconditionILU  precondition;
-        // const int ilu_fill = 2;
-        // dealii::TrilinosWrappers::PreconditionILU::AdditionalData precond_settings(ilu_fill, 0., 1.0, 1);
-        // precondition.initialize(system_matrix, precond_settings);
-
-        dealii::TrilinosWrappers::PreconditionILUT  precondition;
-        const unsigned int ilut_fill=50;
-        const double ilut_drop=1e-15;
-        const double ilut_atol=1e-6;
-        const double ilut_rtol=1.00001;
-        const unsigned int overlap=1;
-        dealii::TrilinosWrappers::PreconditionILUT::AdditionalData precond_settings(ilut_drop, ilut_fill, ilut_atol, ilut_rtol, overlap);
-        precondition.initialize(system_matrix, precond_settings);
-
-        //const double 	omega = 1;
-        //const double 	min_diagonal = 1e-8;
-        //const unsigned int 	overlap = 1;
-        //const unsigned int 	n_sweeps = 1;
-        //dealii::TrilinosWrappers::PreconditionSSOR::AdditionalData precond_settings(omega, min_diagonal, overlap, n_sweeps);
-        //dealii::TrilinosWrappers::PreconditionSSOR  precondition;
-        //precondition.initialize(system_matrix, precond_settings);
-
-        using trilinos_vector_type = VectorType;
-        using payload_type = dealii::TrilinosWrappers::internal::LinearOperatorImplementation::TrilinosPayload;
-        const auto op_a = dealii::linear_operator<trilinos_vector_type,trilinos_vector_type,payload_type>(system_matrix);
-        const auto op_at = dealii::transpose_operator(op_a);
-
-        // Solve system.
-        dealii::deallog.depth_console(2);
         output_vector = input_vector;
-        solver.solve(op_at, output_vector, input_vector, precondition);
-        pcout << "dXvdXvs_Transpose Solver took " << solver_control.last_step() << " steps. "
-              << "Residual: " << solver_control.last_value() << ". "
-              << std::endl;
-        solver.solve(op_at, output_vector, input_vector, precondition);
-        pcout << "dXvdXvs_Transpose Solver took " << solver_control.last_step() << " steps. "
-              << "Residual: " << solver_control.last_value() << ". "
-              << std::endl;
-        if (solver_control.last_check() != dealii::SolverControl::State::success) {
-            pcout << "Failed to converge." << std::endl;
-            std::abort();
-        }
-
-
+        solve_linear_system(true, input_vector, output_vector);
     }
 
     // template <int dim, typename real>
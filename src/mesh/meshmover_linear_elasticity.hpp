@@ -2,6 +2,7 @@
 #define __MESHMOVER_LINEAR_ELASTICITY_H__
 
 #include <deal.II/lac/trilinos_sparse_matrix.h>
+#include <deal.II/lac/trilinos_precondition.h>
 
 #include "parameters/all_parameters.h"
 
@@ -62,6 +63,10 @@ namespace MeshMover
          *  If the right-hand-side are the surface node displacements indexed in a
          *  volume node vector, the result is a displacement vector of the volume
          *  volume_nodes (which include the prescribed surface nodes).
+         *
+         *  The system is assembled and preconditioned once for all the right-hand sides,
+         *  and each solve starts from the combination of the previous solutions that best
+         *  matches its right-hand side. Only the non-zero entries are stored in output_matrix.
          */
         void
         apply_dXvdXvs(std::vector<dealii::LinearAlgebra::distributed::Vector<double>> &list_of_vectors, dealii::TrilinosWrappers::SparseMatrix &output_matrix);
@@ -88,6 +93,32 @@ namespace MeshMover
             const dealii::LinearAlgebra::distributed::Vector<double> &input_vector,
             dealii::LinearAlgebra::distributed::Vector<double> &output_vector);
 
+        /// Preconditioners available for the linear elasticity system.
+        enum class PreconditionerType {
+            ilut, ///< Incomplete LU with threshold. Its setup cost and iteration count grow with the mesh.
+            amg   ///< Trilinos ML smoothed aggregation. Its iteration count is mostly independent of the mesh size.
+        };
+        /** Preconditioner built by the next linear solve. Defaults to AMG.
+         *  Changing it has no effect once a preconditioner has been built or set.
+         */
+        PreconditionerType preconditioner_type;
+
+        /** Returns the preconditioner of the system, assembling and building it if needed.
+         *  Since the system matrix only depends on the mesh and its boundary nodes,
+         *  it can be handed to another LinearElasticity on the same mesh through set_preconditioner().
+         *  The returned handle owns the matrix the preconditioner was built on,
+         *  so it stays valid after this LinearElasticity is destroyed.
+         */
+        std::shared_ptr<dealii::TrilinosWrappers::PreconditionBase> get_preconditioner();
+
+        /** Uses a preconditioner built by another LinearElasticity on the same mesh, mapping, and boundary nodes.
+         *  This avoids rebuilding it every time the mesh is moved.
+         */
+        void set_preconditioner(const std::shared_ptr<dealii::TrilinosWrappers::PreconditionBase> &preconditioner);
+
+        /// Number of GMRES iterations taken by the last linear solve.
+        unsigned int get_last_n_linear_iterations() const;
+
         /** Current displacement solution
          */
         VectorType displacement_solution;
@@ -126,6 +157,19 @@ namespace MeshMover
          */
         unsigned int solve_linear_problem();
 
+        /** Assembles the system if needed and builds its preconditioner unless one has been set.
+         *  Both are then reused by every apply_dXvdXvs and apply_dXvdXvs_transpose call.
+         */
+        void initialize_linear_solver();
+
+        /** Solves the system, or its transpose, with GMRES and the stored preconditioner.
+         *  The incoming solution_vector is used as the initial guess.
+         */
+        void solve_linear_system(
+            const bool transpose,
+            const dealii::LinearAlgebra::distributed::Vector<double> &rhs_vector,
+            dealii::LinearAlgebra::distributed::Vector<double> &solution_vector);
+
         const Triangulation &triangulation; ///< Triangulation on which this acts.
         /// MappingFEField corresponding to curved mesh.
         const std::shared_ptr<dealii::MappingFEField<dim,dim,VectorType,DoFHandlerType>> mapping_fe_field;
@@ -142,8 +186,10 @@ namespace MeshMover
          */
         dealii::LinearAlgebra::distributed::Vector<double> system_rhs_unconstrained;
 
-        /// System matrix corresponding to linearized elasticity problem.
-        dealii::TrilinosWrappers::SparseMatrix system_matrix;
+        /** System matrix corresponding to linearized elasticity problem.
+         *  Shared with the preconditioner built on it, which may outlive this mesh mover.
+         */
+        std::shared_ptr<dealii::TrilinosWrappers::SparseMatrix> system_matrix;
         /** System right-hand side corresponding to linearized elasticity problem.
          *  Note that no body forces are present and the right-hand side is therefore zero.
          *  However, Dirichlet boundary conditions may make some RHS entries non-zero,
@@ -174,6 +220,13 @@ namespace MeshMover
          */
         const dealii::LinearAlgebra::distributed::Vector<double> &boundary_displacements_vector;
 
+        /// Whether system_matrix has been assembled.
+        bool system_is_assembled;
+        /// Preconditioner of system_matrix, shared by all the right-hand sides and possibly by other mesh movers on the same mesh.
+        std::shared_ptr<dealii::TrilinosWrappers::PreconditionBase> system_preconditioner;
+        /// Number of GMRES iterations taken by the last linear solve.
+        unsigned int last_n_linear_iterations;
+
         /** Transforms a std::vector<Tensor> into the corresponding distributed vector.
          */
         dealii::LinearAlgebra::distributed::Vector<double> tensor_to_vector(const std::vector<dealii::Tensor<1,dim,real>> &boundary_displacements_tensors) const;
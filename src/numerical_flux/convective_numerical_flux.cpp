@@ -22,6 +22,61 @@ std::array<real_tensor, nstate> array_average(
     return array_average;
 }
 
+template<int dim, int nstate, typename real>
+std::array<real, nstate> flux_dot_normal(
+    const std::array<dealii::Tensor<1,dim,real>, nstate> &flux,
+    const dealii::Tensor<1,dim,real> &normal)
+{
+    std::array<real, nstate> flux_dot_n;
+    for (int s=0; s<nstate; s++) {
+        real flux_dot_n_state = 0.0;
+        for (int d=0; d<dim; ++d) {
+            flux_dot_n_state += flux[s][d]*normal[d];
+        }
+        flux_dot_n[s] = flux_dot_n_state;
+    }
+    return flux_dot_n;
+}
+
+template<int dim, int nstate, typename real>
+std::array<real, nstate> central_flux_dot_normal(
+    const std::array<dealii::Tensor<1,dim,real>, nstate> &flux_int,
+    const std::array<dealii::Tensor<1,dim,real>, nstate> &flux_ext,
+    const dealii::Tensor<1,dim,real> &normal)
+{
+    std::array<dealii::Tensor<1,dim,real>, nstate> flux_avg;
+    for (int s=0; s<nstate; s++) {
+        flux_avg[s] = 0.0;
+        for (int d=0; d<dim; ++d) {
+            flux_avg[s][d] = 0.5*(flux_int[s][d] + flux_ext[s][d]);
+        }
+    }
+    return flux_dot_normal<dim,nstate,real>(flux_avg, normal);
+}
+
+template<int nstate, typename real>
+std::array<real, nstate> lax_friedrichs_dissipation(
+    const real conv_max_eig_int,
+    const real conv_max_eig_ext,
+    const std::array<real, nstate> &soln_int,
+    const std::array<real, nstate> &soln_ext)
+{
+    // Replaced the std::max with an if-statement for the AD to work properly.
+    //const real conv_max_eig = std::max(conv_max_eig_int, conv_max_eig_ext);
+    real conv_max_eig;
+    if (conv_max_eig_int > conv_max_eig_ext) {
+        conv_max_eig = conv_max_eig_int;
+    } else {
+        conv_max_eig = conv_max_eig_ext;
+    }
+    // Scalar dissipation
+    std::array<real, nstate> dissipation_dot_n;
+    for (int s=0; s<nstate; s++) {
+        dissipation_dot_n[s] = - 0.5 * conv_max_eig * (soln_ext[s]-soln_int[s]);
+    }
+    return dissipation_dot_n;
+}
+
 template <int dim, int nspecies, int nstate, typename real>
 NumericalFluxConvective<dim, nspecies, nstate, real>::NumericalFluxConvective(
     std::unique_ptr< BaselineNumericalFluxConvective<dim,nspecies,nstate,real> > baseline_input,
@@ -53,6 +108,33 @@ std::array<real, nstate> NumericalFluxConvective<dim,nspecies,nstate,real>
     return numerical_flux_dot_n;
 }
 
+template<int dim, int nspecies, int nstate, typename real>
+void NumericalFluxConvective<dim,nspecies,nstate,real>
+::evaluate_flux_batch (
+    const std::array<std::vector<real>, nstate> &soln_int,
+    const std::array<std::vector<real>, nstate> &soln_ext,
+    const std::array<std::vector<real>, dim> &normal_int,
+    std::array<std::vector<real>, nstate> &numerical_flux_dot_n) const
+{
+    const unsigned int n_points = soln_int[0].size();
+    for (unsigned int iquad=0; iquad<n_points; ++iquad) {
+        std::array<real, nstate> soln_int_at_q;
+        std::array<real, nstate> soln_ext_at_q;
+        for (int s=0; s<nstate; s++) {
+            soln_int_at_q[s] = soln_int[s][iquad];
+            soln_ext_at_q[s] = soln_ext[s][iquad];
+        }
+        dealii::Tensor<1,dim,real> normal_int_at_q;
+        for (int d=0; d<dim; ++d) {
+            normal_int_at_q[d] = normal_int[d][iquad];
+        }
+        const std::array<real, nstate> numerical_flux_dot_n_at_q = evaluate_flux(soln_int_at_q, soln_ext_at_q, normal_int_at_q);
+        for (int s=0; s<nstate; s++) {
+            numerical_flux_dot_n[s][iquad] = numerical_flux_dot_n_at_q[s];
+        }
+    }
+}
+
 template <int dim, int nspecies, int nstate, typename real>
 LaxFriedrichs<dim, nspecies, nstate, real>::LaxFriedrichs(
     std::shared_ptr<Physics::PhysicsBase<dim, nspecies, nstate, real>> physics_input)
@@ -123,30 +205,10 @@ std::array<real, nstate> CentralBaselineNumericalFluxConvective<dim,nspecies,nst
     const std::array<real, nstate> &soln_ext,
     const dealii::Tensor<1,dim,real> &normal_int) const
 {
-    using RealArrayVector = std::array<dealii::Tensor<1,dim,real>,nstate>;
-    RealArrayVector conv_phys_flux_int;
-    RealArrayVector conv_phys_flux_ext;
-
-    conv_phys_flux_int = pde_physics->convective_flux (soln_int);
-    conv_phys_flux_ext = pde_physics->convective_flux (soln_ext);
-    
-    RealArrayVector flux_avg;
-    for (int s=0; s<nstate; s++) {
-        flux_avg[s] = 0.0;
-        for (int d=0; d<dim; ++d) {
-            flux_avg[s][d] = 0.5*(conv_phys_flux_int[s][d] + conv_phys_flux_ext[s][d]);
-        }
-    }
-
-    std::array<real, nstate> numerical_flux_dot_n;
-    for (int s=0; s<nstate; s++) {
-        real flux_dot_n = 0.0;
-        for (int d=0; d<dim; ++d) {
-            flux_dot_n += flux_avg[s][d]*normal_int[d];
-        }
-        numerical_flux_dot_n[s] = flux_dot_n;
-    }
-    return numerical_flux_dot_n;
+    return central_flux_dot_normal<dim,nstate,real>(
+        pde_physics->convective_flux (soln_int),
+        pde_physics->convective_flux (soln_ext),
+        normal_int);
 }
 
 template <int dim, int nspecies, int nstate, typename real>
@@ -155,21 +217,9 @@ std::array<real, nstate> EntropyConservingBaselineNumericalFluxConvective<dim,ns
     const std::array<real, nstate> &soln_ext,
     const dealii::Tensor<1,dim,real> &normal_int) const
 {
-    using RealArrayVector = std::array<dealii::Tensor<1,dim,real>,nstate>;
-    RealArrayVector conv_phys_split_flux;
-
-    conv_phys_split_flux = pde_physics->convective_numerical_split_flux (soln_int,soln_ext);
-
-    // Scalar dissipation
-    std::array<real, nstate> numerical_flux_dot_n;
-    for (int s=0; s<nstate; s++) {
-        real flux_dot_n = 0.0;
-        for (int d=0; d<dim; ++d) {
-            flux_dot_n += conv_phys_split_flux[s][d] * normal_int[d];
-        }
-        numerical_flux_dot_n[s] = flux_dot_n;
-    }
-    return numerical_flux_dot_n;
+    return flux_dot_normal<dim,nstate,real>(
+        pde_physics->convective_numerical_split_flux (soln_int,soln_ext),
+        normal_int);
 }
 
 template<int dim, int nspecies, int nstate, typename real>
@@ -192,24 +242,30 @@ std::array<real, nstate> LaxFriedrichsRiemannSolverDissipation<dim,nspecies,nsta
     const std::array<real, nstate> &soln_ext,
     const dealii::Tensor<1,dim,real> &normal_int) const
 {
-    const real conv_max_eig_int = pde_physics->max_convective_normal_eigenvalue(soln_int,normal_int);
-    const real conv_max_eig_ext = pde_physics->max_convective_normal_eigenvalue(soln_ext,normal_int);
-    // Replaced the std::max with an if-statement for the AD to work properly.
-    //const real conv_max_eig = std::max(conv_max_eig_int, conv_max_eig_ext);
-    real conv_max_eig;
-    if (conv_max_eig_int > conv_max_eig_ext) {
-        conv_max_eig = conv_max_eig_int;
-    } else {
-        conv_max_eig = conv_max_eig_ext;
-    }
-    //conv_max_eig = std::max(conv_max_eig_int, conv_max_eig_ext);
-    // Scalar dissipation
-    std::array<real, nstate> numerical_flux_dot_n;
-    for (int s=0; s<nstate; s++) {
-        numerical_flux_dot_n[s] = - 0.5 * conv_max_eig * (soln_ext[s]-soln_int[s]);
-    }
+    return lax_friedrichs_dissipation<nstate,real>(
+        pde_physics->max_convective_normal_eigenvalue(soln_int,normal_int),
+        pde_physics->max_convective_normal_eigenvalue(soln_ext,normal_int),
+        soln_int, soln_ext);
+}
 
-    return numerical_flux_dot_n;
+template <int dim, int nspecies, int nstate, typename real>
+std::array<real, nstate> RoePikeRiemannSolverDissipation<dim,nspecies,nstate,real>
+::evaluate_riemann_solver_dissipation (
+    const std::array<real, nstate> &soln_int,
+    const std::array<real, nstate> &soln_ext,
+    const dealii::Tensor<1,dim,real> &normal_int) const
+{
+    return this->template evaluate_roe_dissipation<RoePikeRiemannSolverDissipation<dim,nspecies,nstate,real>>(soln_int, soln_ext, normal_int);
+}
+
+template <int dim, int nspecies, int nstate, typename real>
+std::array<real, nstate> L2RoeRiemannSolverDissipation<dim,nspecies,nstate,real>
+::evaluate_riemann_solver_dissipation (
+    const std::array<real, nstate> &soln_int,
+    const std::array<real, nstate> &soln_ext,
+    const dealii::Tensor<1,dim,real> &normal_int) const
+{
+    return this->template evaluate_roe_dissipation<L2RoeRiemannSolverDissipation<dim,nspecies,nstate,real>>(soln_int, soln_ext, normal_int);
 }
 
 template <int dim, int nspecies, int nstate, typename real>
@@ -329,8 +385,9 @@ void L2RoeRiemannSolverDissipation<dim,nspecies,nstate,real>
 }
 
 template <int dim, int nspecies, int nstate, typename real>
+template <typename RoeType>
 std::array<real, nstate> RoeBaseRiemannSolverDissipation<dim,nspecies,nstate,real>
-::evaluate_riemann_solver_dissipation (
+::evaluate_roe_dissipation (
     const std::array<real, nstate> &soln_int,
     const std::array<real, nstate> &soln_ext,
     const dealii::Tensor<1,dim,real> &normal_int) const
@@ -340,11 +397,24 @@ std::array<real, nstate> RoeBaseRiemannSolverDissipation<dim,nspecies,nstate,rea
     //          dVt (jump in tangential velocities);
     //          expressions are equivalent
     
+    const std::array<real,nstate> prim_soln_int = euler_physics->convert_conservative_to_primitive(soln_int);
+    const std::array<real,nstate> prim_soln_ext = euler_physics->convert_conservative_to_primitive(soln_ext);
+    return evaluate_roe_dissipation_from_primitive<RoeType>(soln_int, soln_ext, prim_soln_int, prim_soln_ext, normal_int);
+}
+
+template <int dim, int nspecies, int nstate, typename real>
+template <typename RoeType>
+std::array<real, nstate> RoeBaseRiemannSolverDissipation<dim,nspecies,nstate,real>
+::evaluate_roe_dissipation_from_primitive (
+    const std::array<real, nstate> &soln_int,
+    const std::array<real, nstate> &soln_ext,
+    const std::array<real, nstate> &prim_soln_int,
+    const std::array<real, nstate> &prim_soln_ext,
+    const dealii::Tensor<1,dim,real> &normal_int) const
+{
     // Blazek 2015
     // p. 103-105
     // Note: This is in fact the Roe-Pike method of Roe & Pike (1984 - Efficient)
-    const std::array<real,nstate> prim_soln_int = euler_physics->convert_conservative_to_primitive(soln_int);
-    const std::array<real,nstate> prim_soln_ext = euler_physics->convert_conservative_to_primitive(soln_ext);
     // Left cell
     const real density_L = prim_soln_int[0];
     const dealii::Tensor< 1,dim,real > velocities_L = euler_physics->extract_velocities_from_primitive(prim_soln_int);
@@ -426,10 +496,11 @@ std::array<real, nstate> RoeBaseRiemannSolverDissipation<dim,nspecies,nstate,rea
     }
 
     // Evaluate entropy fix on wave speeds
-    evaluate_entropy_fix (eig_L, eig_R, eig_ravg, vel2_ravg, sound_ravg);
+    const RoeType &roe = static_cast<const RoeType&>(*this);
+    roe.RoeType::evaluate_entropy_fix (eig_L, eig_R, eig_ravg, vel2_ravg, sound_ravg);
 
     // Evaluate additional modifications to the Roe-Pike scheme (if applicable)
-    evaluate_additional_modifications (soln_int, soln_ext, eig_L, eig_R, dVn, dVt);
+    roe.RoeType::evaluate_additional_modifications (soln_int, soln_ext, eig_L, eig_R, dVn, dVt);
 
     // Product of eigenvalues and wave strengths
     real coeff[4];
@@ -479,6 +550,245 @@ std::array<real, nstate> RoeBaseRiemannSolverDissipation<dim,nspecies,nstate,rea
     return numerical_flux_dot_n;
 }
 
+template <int dim, int nspecies, int nstate, typename real, StaticBaselineFlux baseline_type, StaticRiemannSolverDissipation dissipation_type>
+StaticNumericalFluxConvective<dim, nspecies, nstate, real, baseline_type, dissipation_type>::StaticNumericalFluxConvective(
+    std::shared_ptr<Physics::PhysicsBase<dim, nspecies, nstate, real>> physics_input)
+    : NumericalFluxConvective<dim,nspecies,nstate,real>(
+        create_baseline(physics_input),
+        create_riemann_solver_dissipation(physics_input))
+    , euler_physics(std::dynamic_pointer_cast<Physics::Euler<dim,nspecies,nstate,real>>(physics_input))
+{}
+
+template <int dim, int nspecies, int nstate, typename real, StaticBaselineFlux baseline_type, StaticRiemannSolverDissipation dissipation_type>
+std::unique_ptr< BaselineNumericalFluxConvective<dim,nspecies,nstate,real> >
+StaticNumericalFluxConvective<dim, nspecies, nstate, real, baseline_type, dissipation_type>::create_baseline(
+    std::shared_ptr<Physics::PhysicsBase<dim, nspecies, nstate, real>> physics_input)
+{
+    if constexpr (baseline_type == StaticBaselineFlux::central) {
+        return std::make_unique< CentralBaselineNumericalFluxConvective<dim, nspecies, nstate, real> > (physics_input);
+    } else {
+        return std::make_unique< EntropyConservingBaselineNumericalFluxConvective<dim, nspecies, nstate, real> > (physics_input);
+    }
+}
+
+template <int dim, int nspecies, int nstate, typename real, StaticBaselineFlux baseline_type, StaticRiemannSolverDissipation dissipation_type>
+std::unique_ptr< RiemannSolverDissipation<dim,nspecies,nstate,real> >
+StaticNumericalFluxConvective<dim, nspecies, nstate, real, baseline_type, dissipation_type>::create_riemann_solver_dissipation(
+    std::shared_ptr<Physics::PhysicsBase<dim, nspecies, nstate, real>> physics_input)
+{
+    if constexpr (dissipation_type == StaticRiemannSolverDissipation::zero) {
+        return std::make_unique< ZeroRiemannSolverDissipation<dim, nspecies, nstate, real> > ();
+    } else if constexpr (dissipation_type == StaticRiemannSolverDissipation::lax_friedrichs) {
+        return std::make_unique< LaxFriedrichsRiemannSolverDissipation<dim, nspecies, nstate, real> > (physics_input);
+    } else {
+        return std::make_unique< RoeType > (physics_input);
+    }
+}
+
+template <int dim, int nspecies, int nstate, typename real, StaticBaselineFlux baseline_type, StaticRiemannSolverDissipation dissipation_type>
+std::array<real, nstate> StaticNumericalFluxConvective<dim, nspecies, nstate, real, baseline_type, dissipation_type>
+::evaluate_flux (
+    const std::array<real, nstate> &soln_int,
+    const std::array<real, nstate> &soln_ext,
+    const dealii::Tensor<1,dim,real> &normal_int) const
+{
+    using EulerPhysics = Physics::Euler<dim,nspecies,nstate,real>;
+    const EulerPhysics &euler = *euler_physics;
+
+    // baseline flux (without upwind dissipation)
+    std::array<real, nstate> numerical_flux_dot_n;
+    if constexpr (baseline_type == StaticBaselineFlux::central) {
+        numerical_flux_dot_n = central_flux_dot_normal<dim,nstate,real>(
+            euler.EulerPhysics::convective_flux (soln_int),
+            euler.EulerPhysics::convective_flux (soln_ext),
+            normal_int);
+    } else {
+        numerical_flux_dot_n = flux_dot_normal<dim,nstate,real>(
+            euler.EulerPhysics::convective_numerical_split_flux (soln_int,soln_ext),
+            normal_int);
+    }
+
+    if constexpr (dissipation_type != StaticRiemannSolverDissipation::zero) {
+        // Riemann solver dissipation
+        std::array<real, nstate> riemann_solver_dissipation_dot_n;
+        if constexpr (dissipation_type == StaticRiemannSolverDissipation::lax_friedrichs) {
+            riemann_solver_dissipation_dot_n = lax_friedrichs_dissipation<nstate,real>(
+                euler.EulerPhysics::max_convective_normal_eigenvalue(soln_int,normal_int),
+                euler.EulerPhysics::max_convective_normal_eigenvalue(soln_ext,normal_int),
+                soln_int, soln_ext);
+        } else {
+            const RoeType &roe = static_cast<const RoeType&>(*this->riemann_solver_dissipation);
+            riemann_solver_dissipation_dot_n = roe.RoeType::evaluate_riemann_solver_dissipation(soln_int, soln_ext, normal_int);
+        }
+        for (int s=0; s<nstate; s++) {
+            numerical_flux_dot_n[s] = numerical_flux_dot_n[s] + riemann_solver_dissipation_dot_n[s];
+        }
+    }
+    return numerical_flux_dot_n;
+}
+
+template <int dim, int nspecies, int nstate, typename real, StaticBaselineFlux baseline_type, StaticRiemannSolverDissipation dissipation_type>
+bool StaticNumericalFluxConvective<dim, nspecies, nstate, real, baseline_type, dissipation_type>
+::convert_conservative_to_primitive_batch (
+    const std::array<std::vector<real>, nstate> &soln,
+    std::array<std::vector<real>, nstate> &prim_soln) const
+{
+    const unsigned int n_points = soln[0].size();
+    const double gamm1 = euler_physics->gamm1;
+    for (int s=0; s<nstate; s++) {
+        prim_soln[s].resize(n_points);
+    }
+    // Same operations as Euler::convert_conservative_to_primitive, one variable at a time over all points
+    std::vector<real> &density = prim_soln[0];
+    std::vector<real> &pressure = prim_soln[nstate-1];
+    for (unsigned int iquad=0; iquad<n_points; ++iquad) {
+        density[iquad] = soln[0][iquad];
+        pressure[iquad] = 0.0;
+    }
+    for (int d=0; d<dim; ++d) {
+        std::vector<real> &vel = prim_soln[1+d];
+        for (unsigned int iquad=0; iquad<n_points; ++iquad) {
+            vel[iquad] = soln[1+d][iquad]/density[iquad];
+            pressure[iquad] = pressure[iquad] + vel[iquad]*vel[iquad];
+        }
+    }
+    bool is_physical = true;
+    for (unsigned int iquad=0; iquad<n_points; ++iquad) {
+        pressure[iquad] = gamm1*(soln[nstate-1][iquad] - 0.5*density[iquad]*pressure[iquad]);
+        if (density[iquad] < 0.0 || pressure[iquad] < 0.0) is_physical = false;
+    }
+    return is_physical;
+}
+
+template <int dim, int nspecies, int nstate, typename real, StaticBaselineFlux baseline_type, StaticRiemannSolverDissipation dissipation_type>
+void StaticNumericalFluxConvective<dim, nspecies, nstate, real, baseline_type, dissipation_type>
+::evaluate_flux_batch (
+    const std::array<std::vector<real>, nstate> &soln_int,
+    const std::array<std::vector<real>, nstate> &soln_ext,
+    const std::array<std::vector<real>, dim> &normal_int,
+    std::array<std::vector<real>, nstate> &numerical_flux_dot_n) const
+{
+    using EulerPhysics = Physics::Euler<dim,nspecies,nstate,real>;
+    const unsigned int n_points = soln_int[0].size();
+
+    const bool is_physical_int = convert_conservative_to_primitive_batch(soln_int, prim_soln_int_batch);
+    const bool is_physical_ext = convert_conservative_to_primitive_batch(soln_ext, prim_soln_ext_batch);
+    if (!is_physical_int || !is_physical_ext) {
+        // Let the physics handle the non-physical states
+        NumericalFluxConvective<dim,nspecies,nstate,real>::evaluate_flux_batch(soln_int, soln_ext, normal_int, numerical_flux_dot_n);
+        return;
+    }
+    const std::array<std::vector<real>, nstate> &prim_int = prim_soln_int_batch;
+    const std::array<std::vector<real>, nstate> &prim_ext = prim_soln_ext_batch;
+
+    // baseline flux (without upwind dissipation)
+    if constexpr (baseline_type == StaticBaselineFlux::central) {
+        // Specific total enthalpy, as in Euler::convective_flux
+        std::vector<real> enthalpy_int(n_points), enthalpy_ext(n_points);
+        for (unsigned int iquad=0; iquad<n_points; ++iquad) {
+            enthalpy_int[iquad] = soln_int[nstate-1][iquad]/soln_int[0][iquad] + prim_int[nstate-1][iquad]/prim_int[0][iquad];
+            enthalpy_ext[iquad] = soln_ext[nstate-1][iquad]/soln_ext[0][iquad] + prim_ext[nstate-1][iquad]/prim_ext[0][iquad];
+        }
+        for (int s=0; s<nstate; s++) {
+            std::vector<real> &flux_dot_n = numerical_flux_dot_n[s];
+            for (unsigned int iquad=0; iquad<n_points; ++iquad) {
+                flux_dot_n[iquad] = 0.0;
+            }
+            for (int d=0; d<dim; ++d) {
+                const std::vector<real> &normal = normal_int[d];
+                for (unsigned int iquad=0; iquad<n_points; ++iquad) {
+                    real flux_int, flux_ext;
+                    if (s == 0) {
+                        // Density equation
+                        flux_int = soln_int[1+d][iquad];
+                        flux_ext = soln_ext[1+d][iquad];
+                    } else if (s == nstate-1) {
+                        // Energy equation
+                        flux_int = prim_int[0][iquad]*prim_int[1+d][iquad]*enthalpy_int[iquad];
+                        flux_ext = prim_ext[0][iquad]*prim_ext[1+d][iquad]*enthalpy_ext[iquad];
+                    } else {
+                        // Momentum equation
+                        flux_int = prim_int[0][iquad]*prim_int[1+d][iquad]*prim_int[s][iquad];
+                        flux_ext = prim_ext[0][iquad]*prim_ext[1+d][iquad]*prim_ext[s][iquad];
+                        if (s == 1+d) {
+                            flux_int += prim_int[nstate-1][iquad];
+                            flux_ext += prim_ext[nstate-1][iquad];
+                        }
+                    }
+                    flux_dot_n[iquad] += 0.5*(flux_int + flux_ext)*normal[iquad];
+                }
+            }
+        }
+    } else {
+        // Two-point fluxes depend on the selected split form and are evaluated point by point
+        for (unsigned int iquad=0; iquad<n_points; ++iquad) {
+            std::array<real, nstate> soln_int_at_q;
+            std::array<real, nstate> soln_ext_at_q;
+            for (int s=0; s<nstate; s++) {
+                soln_int_at_q[s] = soln_int[s][iquad];
+                soln_ext_at_q[s] = soln_ext[s][iquad];
+            }
+            dealii::Tensor<1,dim,real> normal_int_at_q;
+            for (int d=0; d<dim; ++d) {
+                normal_int_at_q[d] = normal_int[d][iquad];
+            }
+            const std::array<real, nstate> flux_dot_n_at_q = flux_dot_normal<dim,nstate,real>(
+                euler_physics->EulerPhysics::convective_numerical_split_flux (soln_int_at_q,soln_ext_at_q),
+                normal_int_at_q);
+            for (int s=0; s<nstate; s++) {
+                numerical_flux_dot_n[s][iquad] = flux_dot_n_at_q[s];
+            }
+        }
+    }
+
+    // Riemann solver dissipation
+    if constexpr (dissipation_type == StaticRiemannSolverDissipation::lax_friedrichs) {
+        const double gam = euler_physics->gam;
+        std::vector<real> conv_max_eig(n_points);
+        for (unsigned int iquad=0; iquad<n_points; ++iquad) {
+            real vel_dot_n_int = 0.0;
+            real vel_dot_n_ext = 0.0;
+            for (int d=0; d<dim; ++d) {
+                vel_dot_n_int += prim_int[1+d][iquad]*normal_int[d][iquad];
+                vel_dot_n_ext += prim_ext[1+d][iquad]*normal_int[d][iquad];
+            }
+            const real conv_max_eig_int = abs(vel_dot_n_int) + sqrt(prim_int[nstate-1][iquad]*gam/prim_int[0][iquad]);
+            const real conv_max_eig_ext = abs(vel_dot_n_ext) + sqrt(prim_ext[nstate-1][iquad]*gam/prim_ext[0][iquad]);
+            // Replaced the std::max with an if-statement for the AD to work properly.
+            if (conv_max_eig_int > conv_max_eig_ext) {
+                conv_max_eig[iquad] = conv_max_eig_int;
+            } else {
+                conv_max_eig[iquad] = conv_max_eig_ext;
+            }
+        }
+        for (int s=0; s<nstate; s++) {
+            for (unsigned int iquad=0; iquad<n_points; ++iquad) {
+                numerical_flux_dot_n[s][iquad] = numerical_flux_dot_n[s][iquad] - 0.5 * conv_max_eig[iquad] * (soln_ext[s][iquad]-soln_int[s][iquad]);
+            }
+        }
+    } else if constexpr (dissipation_type == StaticRiemannSolverDissipation::roe_pike || dissipation_type == StaticRiemannSolverDissipation::l2roe) {
+        const RoeType &roe = static_cast<const RoeType&>(*this->riemann_solver_dissipation);
+        for (unsigned int iquad=0; iquad<n_points; ++iquad) {
+            std::array<real, nstate> soln_int_at_q, soln_ext_at_q, prim_int_at_q, prim_ext_at_q;
+            for (int s=0; s<nstate; s++) {
+                soln_int_at_q[s] = soln_int[s][iquad];
+                soln_ext_at_q[s] = soln_ext[s][iquad];
+                prim_int_at_q[s] = prim_int[s][iquad];
+                prim_ext_at_q[s] = prim_ext[s][iquad];
+            }
+            dealii::Tensor<1,dim,real> normal_int_at_q;
+            for (int d=0; d<dim; ++d) {
+                normal_int_at_q[d] = normal_int[d][iquad];
+            }
+            const std::array<real, nstate> riemann_solver_dissipation_dot_n = roe.template evaluate_roe_dissipation_from_primitive<RoeType>(
+                soln_int_at_q, soln_ext_at_q, prim_int_at_q, prim_ext_at_q, normal_int_at_q);
+            for (int s=0; s<nstate; s++) {
+                numerical_flux_dot_n[s][iquad] = numerical_flux_dot_n[s][iquad] + riemann_solver_dissipation_dot_n[s];
+            }
+        }
+    }
+}
+
 #if PHILIP_SPECIES==1
     // Define a sequence of indices representing the range [1, 6]
     #define POSSIBLE_NSTATE (1)(2)(3)(4)(5)(6)
@@ -568,7 +878,15 @@ std::array<real, nstate> RoeBaseRiemannSolverDissipation<dim,nspecies,nstate,rea
         template class EntropyConservingWithL2RoeDissipation<PHILIP_DIM, PHILIP_SPECIES, PHILIP_DIM+2, type>; \
         template class RoeBaseRiemannSolverDissipation<PHILIP_DIM, PHILIP_SPECIES, PHILIP_DIM+2, type>; \
         template class RoePikeRiemannSolverDissipation<PHILIP_DIM, PHILIP_SPECIES, PHILIP_DIM+2, type>; \
-        template class L2RoeRiemannSolverDissipation<PHILIP_DIM, PHILIP_SPECIES, PHILIP_DIM+2, type>;
+        template class L2RoeRiemannSolverDissipation<PHILIP_DIM, PHILIP_SPECIES, PHILIP_DIM+2, type>; \
+        template class StaticNumericalFluxConvective<PHILIP_DIM, PHILIP_SPECIES, PHILIP_DIM+2, type, StaticBaselineFlux::central, StaticRiemannSolverDissipation::zero>; \
+        template class StaticNumericalFluxConvective<PHILIP_DIM, PHILIP_SPECIES, PHILIP_DIM+2, type, StaticBaselineFlux::central, StaticRiemannSolverDissipation::lax_friedrichs>; \
+        template class StaticNumericalFluxConvective<PHILIP_DIM, PHILIP_SPECIES, PHILIP_DIM+2, type, StaticBaselineFlux::central, StaticRiemannSolverDissipation::roe_pike>; \
+        template class StaticNumericalFluxConvective<PHILIP_DIM, PHILIP_SPECIES, PHILIP_DIM+2, type, StaticBaselineFlux::central, StaticRiemannSolverDissipation::l2roe>; \
+        template class StaticNumericalFluxConvective<PHILIP_DIM, PHILIP_SPECIES, PHILIP_DIM+2, type, StaticBaselineFlux::entropy_conserving, StaticRiemannSolverDissipation::zero>; \
+        template class StaticNumericalFluxConvective<PHILIP_DIM, PHILIP_SPECIES, PHILIP_DIM+2, type, StaticBaselineFlux::entropy_conserving, StaticRiemannSolverDissipation::lax_friedrichs>; \
+        template class StaticNumericalFluxConvective<PHILIP_DIM, PHILIP_SPECIES, PHILIP_DIM+2, type, StaticBaselineFlux::entropy_conserving, StaticRiemannSolverDissipation::roe_pike>; \
+        template class StaticNumericalFluxConvective<PHILIP_DIM, PHILIP_SPECIES, PHILIP_DIM+2, type, StaticBaselineFlux::entropy_conserving, StaticRiemannSolverDissipation::l2roe>;
     BOOST_PP_SEQ_FOR_EACH(INSTANTIATE_TYPES, _, POSSIBLE_TYPE)
 #else
     #define POSSIBLE_TYPE (double)(FadType)(RadType)(FadFadType)(RadFadType)
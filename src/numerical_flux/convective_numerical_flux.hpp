@@ -2,6 +2,8 @@
 #define __CONVECTIVE_NUMERICAL_FLUX__
 
 #include <deal.II/base/tensor.h>
+#include <type_traits>
+#include <vector>
 #include "physics/physics.h"
 #include "physics/euler.h"
 
@@ -147,12 +149,28 @@ public:
         real &dV_normal, 
         dealii::Tensor<1,dim,real> &dV_tangent) const = 0;
 
+    /// Returns the upwind dissipation at an interface given the primitive variables of both states.
+    /** Lets callers that already converted the states to primitive variables skip the conversion.
+     *  The entropy fix and additional modifications of RoeType are called without virtual dispatch.
+     */
+    template<typename RoeType>
+    std::array<real, nstate> evaluate_roe_dissipation_from_primitive (
+        const std::array<real, nstate> &soln_int,
+        const std::array<real, nstate> &soln_ext,
+        const std::array<real, nstate> &prim_soln_int,
+        const std::array<real, nstate> &prim_soln_ext,
+        const dealii::Tensor<1,dim,real> &normal1) const;
+
+protected:
     /// Returns the convective flux at an interface
     /// --- See Blazek 2015, p.103-105
     /// --- Note: Modified calculation of alpha_{3,4} to use 
     ///           dVt (jump in tangential velocities);
     ///           expressions are equivalent.
-    std::array<real, nstate> evaluate_riemann_solver_dissipation (
+    /** The entropy fix and additional modifications of RoeType are called without virtual dispatch.
+     */
+    template<typename RoeType>
+    std::array<real, nstate> evaluate_roe_dissipation (
         const std::array<real, nstate> &soln_int,
         const std::array<real, nstate> &soln_ext,
         const dealii::Tensor<1,dim,real> &normal1) const;
@@ -167,6 +185,12 @@ public:
     explicit RoePikeRiemannSolverDissipation(std::shared_ptr <Physics::PhysicsBase<dim, nspecies, nstate, real>> physics_input)
     : RoeBaseRiemannSolverDissipation<dim, nspecies, nstate, real>(physics_input){};
 
+    /// Returns the Roe-Pike upwind dissipation at an interface.
+    std::array<real, nstate> evaluate_riemann_solver_dissipation (
+        const std::array<real, nstate> &soln_int,
+        const std::array<real, nstate> &soln_ext,
+        const dealii::Tensor<1,dim,real> &normal1) const override;
+
     /// Evaluates the entropy fix of Harten
     /// --- See Blazek 2015, p.103-105
     void evaluate_entropy_fix(
@@ -196,6 +220,12 @@ public:
     explicit L2RoeRiemannSolverDissipation(std::shared_ptr <Physics::PhysicsBase<dim, nspecies, nstate, real>> physics_input)
     : RoeBaseRiemannSolverDissipation<dim, nspecies, nstate, real>(physics_input){};
 
+    /// Returns the L2Roe upwind dissipation at an interface.
+    std::array<real, nstate> evaluate_riemann_solver_dissipation (
+        const std::array<real, nstate> &soln_int,
+        const std::array<real, nstate> &soln_ext,
+        const dealii::Tensor<1,dim,real> &normal1) const override;
+
     /// (1) Van Leer et al. (1989 Sonic) entropy fix for acoustic waves (i.e. i=1,5)
     /// (2) For waves (i=2,3,4) --> Entropy fix of Liou (2000 Mass)
     /// --- See p.74 of Osswald et al. (2016 L2Roe)
@@ -236,6 +266,9 @@ public:
         std::unique_ptr< BaselineNumericalFluxConvective<dim,nspecies,nstate,real> > baseline_input,
         std::unique_ptr< RiemannSolverDissipation<dim,nspecies,nstate,real> > riemann_solver_dissipation_input);
 
+    /// Virtual destructor required for derived classes.
+    virtual ~NumericalFluxConvective() = default;
+
 protected:
     /// Baseline convective numerical flux object
     std::unique_ptr< BaselineNumericalFluxConvective<dim,nspecies,nstate,real> > baseline;
@@ -245,10 +278,21 @@ protected:
 
 public:
     /// Returns the convective numerical flux at an interface.
-    std::array<real, nstate> evaluate_flux (
+    virtual std::array<real, nstate> evaluate_flux (
         const std::array<real, nstate> &soln_int,
         const std::array<real, nstate> &soln_ext,
         const dealii::Tensor<1,dim,real> &normal1) const;
+
+    /// Returns the convective numerical flux at all quadrature points of a face.
+    /** Structure-of-arrays layout: soln_int[istate][iquad], normal_int[idim][iquad] and
+     *  numerical_flux_dot_n[istate][iquad], which must already be sized to the number of points.
+     *  The default evaluates each point with evaluate_flux.
+     */
+    virtual void evaluate_flux_batch (
+        const std::array<std::vector<real>, nstate> &soln_int,
+        const std::array<std::vector<real>, nstate> &soln_ext,
+        const std::array<std::vector<real>, dim> &normal_int,
+        std::array<std::vector<real>, nstate> &numerical_flux_dot_n) const;
 };
 
 /// Lax-Friedrichs numerical flux. Derived from NumericalFluxConvective.
@@ -324,6 +368,79 @@ public:
     explicit EntropyConservingWithL2RoeDissipation(std::shared_ptr<Physics::PhysicsBase<dim, nspecies, nstate, real>> physics_input);
 };
 
+/// Baseline convective numerical fluxes available to StaticNumericalFluxConvective.
+enum class StaticBaselineFlux {
+    central,
+    entropy_conserving
+};
+
+/// Riemann solver dissipations available to StaticNumericalFluxConvective.
+enum class StaticRiemannSolverDissipation {
+    zero,
+    lax_friedrichs,
+    roe_pike,
+    l2roe
+};
+
+/// Convective numerical flux for Euler-based physics composed at compile time. Derived from NumericalFluxConvective.
+/** The baseline flux and the Riemann solver dissipation are template parameters and the physics
+ *  is called through the Euler member functions directly, so that a face quadrature point costs a
+ *  single virtual call (evaluate_flux) instead of one per component, per physics evaluation and
+ *  per Roe entropy fix. Only valid for physics that use the convective flux, eigenvalues and split
+ *  forms of Euler, i.e. Euler, NavierStokes and the channel flow variants of NavierStokes.
+ *  NumericalFluxFactory returns it for those and the runtime-composed fluxes otherwise.
+ */
+template<int dim, int nspecies, int nstate, typename real, StaticBaselineFlux baseline_type, StaticRiemannSolverDissipation dissipation_type>
+class StaticNumericalFluxConvective final : public NumericalFluxConvective<dim, nspecies, nstate, real>
+{
+    /// Roe dissipation class matching dissipation_type.
+    using RoeType = std::conditional_t<dissipation_type == StaticRiemannSolverDissipation::l2roe,
+                                       L2RoeRiemannSolverDissipation<dim, nspecies, nstate, real>,
+                                       RoePikeRiemannSolverDissipation<dim, nspecies, nstate, real>>;
+public:
+    /// Constructor
+    explicit StaticNumericalFluxConvective(std::shared_ptr<Physics::PhysicsBase<dim, nspecies, nstate, real>> physics_input);
+
+    /// Returns the convective numerical flux at an interface.
+    std::array<real, nstate> evaluate_flux (
+        const std::array<real, nstate> &soln_int,
+        const std::array<real, nstate> &soln_ext,
+        const dealii::Tensor<1,dim,real> &normal1) const override;
+
+    /// Returns the convective numerical flux at all quadrature points of a face.
+    /** The primitive variables, wave speeds and enthalpies of both states are computed once per point
+     *  in structure-of-arrays loops and shared by the baseline flux and the dissipation. Faces with a
+     *  non-positive density or pressure are evaluated point by point so that the physics handles them.
+     */
+    void evaluate_flux_batch (
+        const std::array<std::vector<real>, nstate> &soln_int,
+        const std::array<std::vector<real>, nstate> &soln_ext,
+        const std::array<std::vector<real>, dim> &normal_int,
+        std::array<std::vector<real>, nstate> &numerical_flux_dot_n) const override;
+
+protected:
+    /// Euler physics evaluated without virtual dispatch.
+    const std::shared_ptr < Physics::Euler<dim, nspecies, nstate, real> > euler_physics;
+
+    /// Primitive variables of the interior face states, stored [istate][iquad].
+    mutable std::array<std::vector<real>, nstate> prim_soln_int_batch;
+    /// Primitive variables of the exterior face states, stored [istate][iquad].
+    mutable std::array<std::vector<real>, nstate> prim_soln_ext_batch;
+
+    /// Converts face states to primitive variables. Returns false if a density or pressure is negative.
+    bool convert_conservative_to_primitive_batch (
+        const std::array<std::vector<real>, nstate> &soln,
+        std::array<std::vector<real>, nstate> &prim_soln) const;
+
+    /// Creates the baseline flux object matching baseline_type.
+    static std::unique_ptr< BaselineNumericalFluxConvective<dim,nspecies,nstate,real> > create_baseline(
+        std::shared_ptr<Physics::PhysicsBase<dim, nspecies, nstate, real>> physics_input);
+
+    /// Creates the Riemann solver dissipation object matching dissipation_type.
+    static std::unique_ptr< RiemannSolverDissipation<dim,nspecies,nstate,real> > create_riemann_solver_dissipation(
+        std::shared_ptr<Physics::PhysicsBase<dim, nspecies, nstate, real>> physics_input);
+};
+
 } /// NumericalFlux namespace
 } /// PHiLiP namespace
 
@@ -37,10 +37,14 @@ NumericalFluxFactory<dim, nspecies, nstate, real>
 
     if (conv_num_flux_type == AllParam::ConvectiveNumericalFlux::central_flux) {
         if constexpr (nstate<=5) {
+            auto static_flux = create_static_convective_numerical_flux<StaticBaselineFlux::central, StaticRiemannSolverDissipation::zero>(physics_input);
+            if (static_flux) return static_flux;
             return std::make_unique< Central<dim, nspecies, nstate, real> > (physics_input);
         }
     }
     else if(conv_num_flux_type == AllParam::ConvectiveNumericalFlux::lax_friedrichs) {
+        auto static_flux = create_static_convective_numerical_flux<StaticBaselineFlux::central, StaticRiemannSolverDissipation::lax_friedrichs>(physics_input);
+        if (static_flux) return static_flux;
         return std::make_unique< LaxFriedrichs<dim, nspecies, nstate, real> > (physics_input);
     } 
     else if(is_euler_based) {
@@ -50,11 +54,15 @@ NumericalFluxFactory<dim, nspecies, nstate, real>
     }
     else if (conv_num_flux_type == AllParam::ConvectiveNumericalFlux::two_point_flux) {
         if constexpr (nstate<=5 && nspecies==1) {
+            auto static_flux = create_static_convective_numerical_flux<StaticBaselineFlux::entropy_conserving, StaticRiemannSolverDissipation::zero>(physics_input);
+            if (static_flux) return static_flux;
             return std::make_unique< EntropyConserving<dim, nspecies, nstate, real> > (physics_input);
         }
     } 
     else if (conv_num_flux_type == AllParam::ConvectiveNumericalFlux::two_point_flux_with_lax_friedrichs_dissipation) {
         if constexpr (nstate<=5 && nspecies==1) {
+            auto static_flux = create_static_convective_numerical_flux<StaticBaselineFlux::entropy_conserving, StaticRiemannSolverDissipation::lax_friedrichs>(physics_input);
+            if (static_flux) return static_flux;
             return std::make_unique< EntropyConservingWithLaxFriedrichsDissipation<dim, nspecies, nstate, real> > (physics_input);
         }
     } 
@@ -109,16 +117,27 @@ NumericalFluxFactory<dim, nspecies, nstate, real>
         std::abort();
     }
 #endif
+    // Roe-type fluxes are only defined for Euler-based physics, so the statically composed flux is
+    // used whenever the physics is Euler itself; the runtime-composed flux remains as a fallback.
+    std::unique_ptr< NumericalFluxConvective<dim,nspecies,nstate,real> > static_flux;
     if(conv_num_flux_type == AllParam::ConvectiveNumericalFlux::roe && nspecies==1) {
+        static_flux = create_static_convective_numerical_flux<StaticBaselineFlux::central, StaticRiemannSolverDissipation::roe_pike>(euler_based_physics_to_be_passed);
+        if (static_flux) return static_flux;
         if constexpr (dim+2==nstate) return std::make_unique< RoePike<dim, nspecies, nstate, real> > (euler_based_physics_to_be_passed);
     } 
     else if(conv_num_flux_type == AllParam::ConvectiveNumericalFlux::l2roe && nspecies==1) {
+        static_flux = create_static_convective_numerical_flux<StaticBaselineFlux::central, StaticRiemannSolverDissipation::l2roe>(euler_based_physics_to_be_passed);
+        if (static_flux) return static_flux;
         if constexpr (dim+2==nstate) return std::make_unique< L2Roe<dim, nspecies, nstate, real> > (euler_based_physics_to_be_passed);
     } 
     else if(conv_num_flux_type == AllParam::ConvectiveNumericalFlux::two_point_flux_with_roe_dissipation && nspecies==1) {
+        static_flux = create_static_convective_numerical_flux<StaticBaselineFlux::entropy_conserving, StaticRiemannSolverDissipation::roe_pike>(euler_based_physics_to_be_passed);
+        if (static_flux) return static_flux;
         if constexpr (dim+2==nstate) return std::make_unique< EntropyConservingWithRoeDissipation<dim, nspecies, nstate, real> > (euler_based_physics_to_be_passed);
     }
     else if(conv_num_flux_type == AllParam::ConvectiveNumericalFlux::two_point_flux_with_l2roe_dissipation && nspecies==1) {
+        static_flux = create_static_convective_numerical_flux<StaticBaselineFlux::entropy_conserving, StaticRiemannSolverDissipation::l2roe>(euler_based_physics_to_be_passed);
+        if (static_flux) return static_flux;
         if constexpr (dim+2==nstate) return std::make_unique< EntropyConservingWithL2RoeDissipation<dim, nspecies, nstate, real> > (euler_based_physics_to_be_passed);
     }
 
@@ -129,6 +148,22 @@ NumericalFluxFactory<dim, nspecies, nstate, real>
     return nullptr;
 }
 
+template <int dim, int nspecies, int nstate, typename real>
+template <StaticBaselineFlux baseline_type, StaticRiemannSolverDissipation dissipation_type>
+std::unique_ptr< NumericalFluxConvective<dim,nspecies,nstate,real> >
+NumericalFluxFactory<dim, nspecies, nstate, real>
+::create_static_convective_numerical_flux(
+    std::shared_ptr<Physics::PhysicsBase<dim, nspecies, nstate, real>> physics_input)
+{
+    if constexpr (dim+2==nstate && nspecies==1) {
+        if (std::dynamic_pointer_cast<Physics::Euler<dim,nspecies,nstate,real>>(physics_input)) {
+            return std::make_unique< StaticNumericalFluxConvective<dim, nspecies, nstate, real, baseline_type, dissipation_type> > (physics_input);
+        }
+    }
+    (void) physics_input;
+    return nullptr;
+}
+
 template <int dim, int nspecies, int nstate, typename real>
 std::unique_ptr< NumericalFluxDissipative<dim,nspecies,nstate,real> >
 NumericalFluxFactory<dim, nspecies, nstate, real>
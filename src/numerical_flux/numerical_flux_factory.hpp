@@ -38,6 +38,12 @@ protected:
             const AllParam::PartialDifferentialEquation pde_type,
             const AllParam::ModelType model_type,
             std::shared_ptr<Physics::PhysicsBase<dim, nspecies, nstate, real>> physics_input);
+
+    /// Creates the statically composed convective numerical flux if the physics is Euler-based, nullptr otherwise
+    template<StaticBaselineFlux baseline_type, StaticRiemannSolverDissipation dissipation_type>
+    static std::unique_ptr< NumericalFluxConvective<dim,nspecies,nstate,real> > 
+        create_static_convective_numerical_flux(
+            std::shared_ptr<Physics::PhysicsBase<dim, nspecies, nstate, real>> physics_input);
 };
 
 } // NumericalFlux namespace
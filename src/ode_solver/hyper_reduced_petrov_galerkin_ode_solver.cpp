@@ -1,16 +1,7 @@
 #include "hyper_reduced_petrov_galerkin_ode_solver.h"
-#include "linear_solver/linear_solver.h"
-#include "reduced_order/multi_core_helper_functions.h"
-#include <deal.II/lac/trilinos_sparsity_pattern.h>
-#include <Epetra_Vector.h>
 #include <deal.II/lac/la_parallel_vector.h>
-#include <Epetra_LinearProblem.h>
-#include "Amesos_BaseSolver.h"
-#include <Amesos_Lapack.h>
-#include <EpetraExt_MatrixMatrix.h>
-#include <Epetra_SerialComm.h>
-#include <Epetra_Comm.h>
-#include <Epetra_Export.h>
+#include <Epetra_Vector.h>
+#include <Epetra_Import.h>
 
 namespace PHiLiP {
 namespace ODE {
@@ -37,23 +28,16 @@ int HyperReducedODESolver<dim,nspecies,real,MeshType>::steady_state ()
 
     this->current_iteration = 0;
 
+    // Only the sampled cells and their stencil are assembled and reconstructed during the iterations
+    setup_sampled_stencil();
+    reconstruct_stencil_solution(reduced_solution);
+
     this->pcout << " Evaluating right-hand side and setting system_matrix to Jacobian before starting iterations... " << std::endl;
     const bool compute_dRdW = true;
     this->dg->assemble_residual(compute_dRdW);
+    generate_test_basis();
 
-    // Build hyper-reduced Jacobian
-    const Epetra_CrsMatrix epetra_system_matrix = this->dg->system_matrix.trilinos_matrix();
-    std::shared_ptr<Epetra_CrsMatrix> reduced_system_matrix = generate_hyper_reduced_jacobian(epetra_system_matrix);
-
-    // Find test basis W with hyper-reduced Jacobian
-    const Epetra_CrsMatrix epetra_pod_basis = pod->getPODBasis()->trilinos_matrix();
-    std::shared_ptr<Epetra_CrsMatrix> epetra_test_basis = generate_test_basis(*reduced_system_matrix, epetra_pod_basis);
-
-    // Build hyper-reduced residual
-    Epetra_Vector epetra_right_hand_side(Epetra_DataAccess::View, epetra_system_matrix.RowMap(), this->dg->right_hand_side.begin());
-    std::shared_ptr<Epetra_Vector> hyper_reduced_rhs = generate_hyper_reduced_residual(epetra_right_hand_side, *epetra_test_basis);
-
-    hyper_reduced_rhs->Norm2(&this->initial_residual_norm);
+    this->initial_residual_norm = generate_hyper_reduced_residual().norm();
     this->initial_residual_norm /= this->dg->right_hand_side.size();
 
     this->pcout << " ********************************************************** "
@@ -92,12 +76,19 @@ int HyperReducedODESolver<dim,nspecies,real,MeshType>::steady_state ()
         if (this->ode_param.output_solution_every_x_steps > 0) {
             const bool is_output_iteration = (this->current_iteration % this->ode_param.output_solution_every_x_steps == 0);
             if (is_output_iteration) {
+                reconstruct_full_solution();
                 const int file_number = this->current_iteration / this->ode_param.output_solution_every_x_steps;
                 this->dg->output_results_vtk(file_number);
             }
         }
     }
 
+    // Return to a full-order state for the post-processing
+    reconstruct_full_solution();
+    this->dg->set_assembled_cells(std::vector<bool>());
+    this->dg->assemble_residual();
+    this->pcout << "Full-order residual norm: " << this->dg->get_residual_l2norm() << std::endl;
+
     this->pcout << " ********************************************************** "
                 << std::endl
                 << " ODESolver steady_state stopped at"
@@ -121,33 +112,17 @@ void HyperReducedODESolver<dim,nspecies,real,MeshType>::step_in_time (real /*dt*
         (this->current_iteration%this->ode_param.print_iteration_modulo) == 0 ) {
         this->pcout << " Evaluating system update... " << std::endl;
     }
-    // Build hyperreduced Jacobian
-    Epetra_CrsMatrix epetra_system_matrix = this->dg->system_matrix.trilinos_matrix();
-    std::shared_ptr<Epetra_CrsMatrix> reduced_system_matrix = generate_hyper_reduced_jacobian(epetra_system_matrix);
+    // Find test basis W with hyperreduced Jacobian and the hyperreduced residual
+    generate_test_basis();
+    const Eigen::VectorXd hyper_reduced_rhs = generate_hyper_reduced_residual();
 
-    // Find test basis W with hyperreduced Jacobian
-    const Epetra_CrsMatrix epetra_pod_basis = pod->getPODBasis()->trilinos_matrix();
-    std::shared_ptr<Epetra_CrsMatrix> epetra_test_basis = generate_test_basis(*reduced_system_matrix, epetra_pod_basis);
+    // Form (A p^k = b) where A = W^T * W and b = - W^T * R
+    Eigen::MatrixXd reduced_lhs = local_test_basis.transpose() * local_test_basis;
+    MPI_Allreduce(MPI_IN_PLACE, reduced_lhs.data(), reduced_lhs.size(), MPI_DOUBLE, MPI_SUM, this->mpi_communicator);
+    const Eigen::VectorXd reduced_solution_update = reduced_lhs.colPivHouseholderQr().solve(-hyper_reduced_rhs);
 
-    // Build hyperreduced residual
-    Epetra_Vector epetra_right_hand_side(Epetra_DataAccess::View, epetra_system_matrix.RowMap(), this->dg->right_hand_side.begin());
-    std::shared_ptr<Epetra_Vector> hyper_reduced_rhs = generate_hyper_reduced_residual(epetra_right_hand_side, *epetra_test_basis);
-    hyper_reduced_rhs->Scale(-1.0);
+    const Eigen::VectorXd old_reduced_solution = reduced_solution;
 
-    // Form (A p^k = b) where A = W^T * W and b = - W^T * R
-    std::shared_ptr<Epetra_CrsMatrix> epetra_reduced_lhs = generate_reduced_lhs(*epetra_test_basis);
-    Epetra_Vector epetra_reduced_solution_update(epetra_reduced_lhs->DomainMap());
-    Epetra_LinearProblem linearProblem(epetra_reduced_lhs.get(), &epetra_reduced_solution_update, hyper_reduced_rhs.get());
-
-    Amesos_Lapack Solver(linearProblem);
-    Teuchos::ParameterList List;
-    Solver.SetParameters(List);
-    Solver.SymbolicFactorization();
-    Solver.NumericFactorization();
-    Solver.Solve();
-
-    const dealii::LinearAlgebra::distributed::Vector<double> old_solution(this->dg->solution);
-    
     // Line search parameters (currently identical to reduced-order ode solver values)
     double step_length = 1.0;
     const double step_reduction = 0.5;
@@ -155,62 +130,27 @@ void HyperReducedODESolver<dim,nspecies,real,MeshType>::step_in_time (real /*dt*
     const double reduction_tolerance_1 = 1.0;
     const double reduction_tolerance_2 = 2.0;
 
-    double initial_residual;
-    hyper_reduced_rhs->Norm2(&initial_residual);
-    initial_residual /= this->dg->right_hand_side.size();
-
-    Epetra_Vector epetra_solution(Epetra_DataAccess::View, epetra_pod_basis.RangeMap(), this->dg->solution.begin());
-    Epetra_Vector epetra_solution_update(epetra_pod_basis.RangeMap());
-
-    epetra_pod_basis.Multiply(false, epetra_reduced_solution_update, epetra_solution_update);
-    epetra_solution.Update(1, epetra_solution_update, 1);
-    this->dg->assemble_residual();
-    hyper_reduced_rhs = generate_hyper_reduced_residual(epetra_right_hand_side, *epetra_test_basis);
-    double new_residual;
-    hyper_reduced_rhs->Norm2(&new_residual);
-    new_residual /= this->dg->right_hand_side.size();
-
-    // Note that line search is in the same function to avoid having to recompute test basis in a new function or store it as a member variable
+    const double initial_residual = hyper_reduced_rhs.norm() / this->dg->right_hand_side.size();
 
+    double new_residual = evaluate_hyper_reduced_residual_norm(old_reduced_solution + step_length * reduced_solution_update);
     this->pcout << " Step length " << step_length << ". Old residual: " << initial_residual << " New residual: " << new_residual << std::endl;
 
     int iline = 0;
     for (iline = 0; iline < maxline && new_residual > initial_residual * reduction_tolerance_1; ++iline) {
         step_length = step_length * step_reduction;
-        this->dg->solution = old_solution;
-        Epetra_Vector epetra_linesearch_reduced_solution_update(epetra_reduced_solution_update);
-        epetra_linesearch_reduced_solution_update.Scale(step_length);
-        epetra_pod_basis.Multiply(false, epetra_linesearch_reduced_solution_update, epetra_solution_update);
-        epetra_solution.Update(1, epetra_solution_update, 1);
-        this->dg->assemble_residual();
-        std::shared_ptr<Epetra_Vector> hyper_reduced_rhs = generate_hyper_reduced_residual(epetra_right_hand_side, *epetra_test_basis);
-        hyper_reduced_rhs->Norm2(&new_residual);
-        new_residual /= this->dg->right_hand_side.size();
+        new_residual = evaluate_hyper_reduced_residual_norm(old_reduced_solution + step_length * reduced_solution_update);
         this->pcout << " Step length " << step_length << " . Old residual: " << initial_residual << " New residual: " << new_residual << std::endl;
     }
 
-
     if (iline == maxline) {
         step_length = 1.0;
         this->pcout << " Line Search (Case 2): Increase nonlinear residual tolerance by a factor " << std::endl;
         this->pcout << " Line search failed. Will accept any valid residual less than " << reduction_tolerance_2 << " times the current " << initial_residual << "residual. " << std::endl;
-        epetra_solution.Update(1, epetra_solution_update, 1);
-        this->dg->assemble_residual();
-        std::shared_ptr<Epetra_Vector> hyper_reduced_rhs = generate_hyper_reduced_residual(epetra_right_hand_side, *epetra_test_basis);
-        hyper_reduced_rhs->Norm2(&new_residual);
-        new_residual /= this->dg->right_hand_side.size();
+        new_residual = evaluate_hyper_reduced_residual_norm(old_reduced_solution + step_length * reduced_solution_update);
         this->pcout << " Step length " << step_length << " . Old residual: " << initial_residual << " New residual: " << new_residual << std::endl;
         for (iline = 0; iline < maxline && new_residual > initial_residual * reduction_tolerance_2; ++iline) {
             step_length = step_length * step_reduction;
-            this->dg->solution = old_solution;
-            Epetra_Vector epetra_linesearch_reduced_solution_update(epetra_reduced_solution_update);
-            epetra_linesearch_reduced_solution_update.Scale(step_length);
-            epetra_pod_basis.Multiply(false, epetra_linesearch_reduced_solution_update, epetra_solution_update);
-            epetra_solution.Update(1, epetra_solution_update, 1);
-            this->dg->assemble_residual();
-            std::shared_ptr<Epetra_Vector> hyper_reduced_rhs = generate_hyper_reduced_residual(epetra_right_hand_side, *epetra_test_basis);
-            hyper_reduced_rhs->Norm2(&new_residual);
-            new_residual /= this->dg->right_hand_side.size();
+            new_residual = evaluate_hyper_reduced_residual_norm(old_reduced_solution + step_length * reduced_solution_update);
             this->pcout << " Step length " << step_length << " . Old residual: " << initial_residual << " New residual: " << new_residual << std::endl;
         }
     }
@@ -218,23 +158,11 @@ void HyperReducedODESolver<dim,nspecies,real,MeshType>::step_in_time (real /*dt*
     if (iline == maxline) {
         this->pcout << " Line Search (Case 3): Reverse Search Direction " << std::endl;
         step_length = -1.0;
-        epetra_solution.Update(-1, epetra_solution_update, 1);
-        this->dg->assemble_residual();
-        std::shared_ptr<Epetra_Vector> hyper_reduced_rhs = generate_hyper_reduced_residual(epetra_right_hand_side, *epetra_test_basis);
-        hyper_reduced_rhs->Norm2(&new_residual);
-        new_residual /= this->dg->right_hand_side.size();
+        new_residual = evaluate_hyper_reduced_residual_norm(old_reduced_solution + step_length * reduced_solution_update);
         this->pcout << " Step length " << step_length << " . Old residual: " << initial_residual << " New residual: " << new_residual << std::endl;
         for (iline = 0; iline < maxline && new_residual > initial_residual * reduction_tolerance_2; ++iline) {
             step_length = step_length * step_reduction;
-            this->dg->solution = old_solution;
-            Epetra_Vector epetra_linesearch_reduced_solution_update(epetra_reduced_solution_update);
-            epetra_linesearch_reduced_solution_update.Scale(step_length);
-            epetra_pod_basis.Multiply(false, epetra_linesearch_reduced_solution_update, epetra_solution_update);
-            epetra_solution.Update(1, epetra_solution_update, 1);
-            this->dg->assemble_residual();
-            std::shared_ptr<Epetra_Vector> hyper_reduced_rhs = generate_hyper_reduced_residual(epetra_right_hand_side, *epetra_test_basis);
-            hyper_reduced_rhs->Norm2(&new_residual);
-            new_residual /= this->dg->right_hand_side.size();
+            new_residual = evaluate_hyper_reduced_residual_norm(old_reduced_solution + step_length * reduced_solution_update);
             this->pcout << " Step length " << step_length << " . Old residual: " << initial_residual << " New residual: " << new_residual << std::endl;
         }
     }
@@ -242,33 +170,23 @@ void HyperReducedODESolver<dim,nspecies,real,MeshType>::step_in_time (real /*dt*
     if (iline == maxline) {
         this->pcout << " Line Search (Case 4): Reverse Search Direction AND Increase nonlinear residual tolerance by a factor " << std::endl;
         step_length = -1.0;
-        epetra_solution.Update(-1, epetra_solution_update, 1);
-        this->dg->assemble_residual();
-        std::shared_ptr<Epetra_Vector> hyper_reduced_rhs = generate_hyper_reduced_residual(epetra_right_hand_side, *epetra_test_basis);
-        hyper_reduced_rhs->Norm2(&new_residual);
-        new_residual /= this->dg->right_hand_side.size();
+        new_residual = evaluate_hyper_reduced_residual_norm(old_reduced_solution + step_length * reduced_solution_update);
         this->pcout << " Step length " << step_length << " . Old residual: " << initial_residual << " New residual: " << new_residual << std::endl;
         for (iline = 0; iline < maxline && new_residual > initial_residual * reduction_tolerance_2; ++iline) {
             step_length = step_length * step_reduction;
-            this->dg->solution = old_solution;
-            Epetra_Vector epetra_linesearch_reduced_solution_update(epetra_reduced_solution_update);
-            epetra_linesearch_reduced_solution_update.Scale(step_length);
-            epetra_pod_basis.Multiply(false, epetra_linesearch_reduced_solution_update, epetra_solution_update);
-            epetra_solution.Update(1, epetra_solution_update, 1);
-            this->dg->assemble_residual();
-            std::shared_ptr<Epetra_Vector> hyper_reduced_rhs = generate_hyper_reduced_residual(epetra_right_hand_side, *epetra_test_basis);
-            hyper_reduced_rhs->Norm2(&new_residual);
-            new_residual /= this->dg->right_hand_side.size();
+            new_residual = evaluate_hyper_reduced_residual_norm(old_reduced_solution + step_length * reduced_solution_update);
             this->pcout << " Step length " << step_length << " . Old residual: " << initial_residual << " New residual: " << new_residual << std::endl;
         }
     }
 
     if(iline == maxline){
         this->pcout << "Line search failed. Returning to old solution." << std::endl;
-        this->dg->solution = old_solution;
+        step_length = 0.0;
     }
 
-    this->pcout << "Full-order residual norm: " << this->dg->get_residual_l2norm() << std::endl;
+    // Only the reduced coordinates are updated; the full-order solution is reconstructed on the stencil
+    reduced_solution = old_reduced_solution + step_length * reduced_solution_update;
+    reconstruct_stencil_solution(reduced_solution);
 
     this->residual_norm = new_residual;
 
@@ -284,211 +202,207 @@ void HyperReducedODESolver<dim,nspecies,real,MeshType>::allocate_ode_system ()
     In 54th AIAA Aerospace Sciences Meeting (p. 1814).
     */
     this->pcout << "Allocating ODE system..." << std::endl;
-    dealii::LinearAlgebra::distributed::Vector<double> reference_solution(this->dg->solution);
+    reference_solution.reinit(this->dg->solution);
     reference_solution.import(pod->getReferenceState(), dealii::VectorOperation::values::insert);
 
     dealii::LinearAlgebra::distributed::Vector<double> initial_condition(this->dg->solution);
     initial_condition -= reference_solution;
 
-    const Epetra_CrsMatrix epetra_pod_basis = pod->getPODBasis()->trilinos_matrix();
+    const Epetra_CrsMatrix &epetra_pod_basis = pod->getPODBasis()->trilinos_matrix();
     Epetra_Vector epetra_reduced_solution(epetra_pod_basis.DomainMap());
     Epetra_Vector epetra_initial_condition(Epetra_DataAccess::Copy, epetra_pod_basis.RangeMap(), initial_condition.begin());
 
     epetra_pod_basis.Multiply(true, epetra_initial_condition, epetra_reduced_solution);
 
-    Epetra_Vector epetra_projection_tmp(epetra_pod_basis.RangeMap());
-    epetra_pod_basis.Multiply(false, epetra_reduced_solution, epetra_projection_tmp);
+    // Replicate the reduced coordinates on all processors
+    reduced_solution = Eigen::VectorXd::Zero(epetra_pod_basis.NumGlobalCols());
+    for (int i = 0; i < epetra_reduced_solution.MyLength(); ++i) {
+        reduced_solution(epetra_pod_basis.DomainMap().GID(i)) = epetra_reduced_solution[i];
+    }
+    MPI_Allreduce(MPI_IN_PLACE, reduced_solution.data(), reduced_solution.size(), MPI_DOUBLE, MPI_SUM, this->mpi_communicator);
 
-    Epetra_Vector epetra_solution(Epetra_DataAccess::View, epetra_pod_basis.RangeMap(), this->dg->solution.begin());
+    reconstruct_full_solution();
 
-    epetra_solution = epetra_projection_tmp;
-    this->dg->solution += reference_solution;
+    // The Jacobian column map may differ from a previous allocation
+    pod_basis_jacobian_columns.reset();
 }
 
 template <int dim, int nspecies, typename real, typename MeshType>
-std::shared_ptr<Epetra_CrsMatrix> HyperReducedODESolver<dim,nspecies,real,MeshType>::generate_test_basis(Epetra_CrsMatrix &system_matrix, const Epetra_CrsMatrix &pod_basis)
+void HyperReducedODESolver<dim,nspecies,real,MeshType>::reconstruct_full_solution ()
 {
-    Epetra_Map system_matrix_rowmap = system_matrix.RowMap();
-    Epetra_CrsMatrix petrov_galerkin_basis(Epetra_DataAccess::Copy, system_matrix_rowmap, pod_basis.NumGlobalCols());
-    EpetraExt::MatrixMatrix::Multiply(system_matrix, false, pod_basis, false, petrov_galerkin_basis, true);
-
-    return std::make_shared<Epetra_CrsMatrix>(petrov_galerkin_basis);
+    const Epetra_CrsMatrix &epetra_pod_basis = pod->getPODBasis()->trilinos_matrix();
+    for (int i_row = 0; i_row < epetra_pod_basis.NumMyRows(); ++i_row) {
+        int n_entries;
+        double *values;
+        int *local_columns;
+        epetra_pod_basis.ExtractMyRowView(i_row, n_entries, values, local_columns);
+        const dealii::types::global_dof_index dof = epetra_pod_basis.GRID(i_row);
+        double value = reference_solution[dof];
+        for (int i_entry = 0; i_entry < n_entries; ++i_entry) {
+            value += values[i_entry] * reduced_solution(epetra_pod_basis.GCID(local_columns[i_entry]));
+        }
+        this->dg->solution[dof] = value;
+    }
+    this->dg->solution.update_ghost_values();
 }
 
 template <int dim, int nspecies, typename real, typename MeshType>
-std::shared_ptr<Epetra_CrsMatrix> HyperReducedODESolver<dim,nspecies,real,MeshType>::generate_hyper_reduced_jacobian(const Epetra_CrsMatrix &system_matrix)
+void HyperReducedODESolver<dim,nspecies,real,MeshType>::reconstruct_stencil_solution (const Eigen::VectorXd &reduced_coordinates)
 {
-    /* Refer to Equation (12) in:
-    https://onlinelibrary.wiley.com/doi/10.1002/nme.6603 (includes definitions of matrices used below such as L_e and L_e_PLUS)
-    Create empty Hyper-reduced Jacobian Epetra structure */
-    Epetra_MpiComm epetra_comm(MPI_COMM_WORLD);
-    Epetra_Map system_matrix_rowmap = system_matrix.RowMap();
-    Epetra_CrsMatrix local_system_matrix = copy_matrix_to_all_cores(system_matrix);
-    Epetra_CrsMatrix reduced_jacobian(Epetra_DataAccess::Copy, system_matrix_rowmap, system_matrix.NumGlobalCols());
-    const int N = system_matrix.NumGlobalRows();
-    Epetra_BlockMap element_map = ECSW_weights.Map();
-    const unsigned int max_dofs_per_cell = this->dg->dof_handler.get_fe_collection().max_dofs_per_cell();
-    std::vector<dealii::types::global_dof_index> current_dofs_indices(max_dofs_per_cell);
-    std::vector<dealii::types::global_dof_index> neighbour_dofs_indices(max_dofs_per_cell);
-
-    // Loop through elements 
-    for (const auto &cell : this->dg->dof_handler.active_cell_iterators())
-    {
-        // Add the contributions of an element if the weight from the NNLS is non-zero
-        if (cell->is_locally_owned()){
-            int global = cell->active_cell_index();
-            const int local_element = element_map.LID(global);
-            if (ECSW_weights[local_element] != 0){
-                const int fe_index_curr_cell = cell->active_fe_index();
-                const dealii::FESystem<dim,dim> &current_fe_ref = this->dg->fe_collection[fe_index_curr_cell];
-                const int n_dofs_curr_cell = current_fe_ref.n_dofs_per_cell();
-
-                current_dofs_indices.resize(n_dofs_curr_cell);
-                cell->get_dof_indices(current_dofs_indices);
-
-                int numE;
-                int row_i = current_dofs_indices[0];
-                std::unique_ptr row(std::make_unique<double[]>(local_system_matrix.NumGlobalCols()));
-                std::unique_ptr global_indices(std::make_unique<int[]>(local_system_matrix.NumGlobalCols()));
-                // Use the Jacobian to determine the stencil around the current element
-                local_system_matrix.ExtractGlobalRowCopy(row_i, local_system_matrix.NumGlobalCols(), numE, row.get(), global_indices.get());
-                int neighbour_dofs_curr_cell = 0;
-                for (int i = 0; i < numE; i++){
-                    neighbour_dofs_curr_cell +=1;
-                    neighbour_dofs_indices.resize(neighbour_dofs_curr_cell);
-                    neighbour_dofs_indices[neighbour_dofs_curr_cell-1] = global_indices[i];
-                }
-
-                // Create L_e matrix and transposed L_e matrix for current cell
-                const Epetra_SerialComm sComm;
-                Epetra_Map LeRowMap(n_dofs_curr_cell, 0, sComm);
-                Epetra_Map LeTRowMap(N, 0, sComm);
-                Epetra_CrsMatrix L_e(Epetra_DataAccess::Copy, LeRowMap, LeTRowMap, 1);
-                Epetra_CrsMatrix L_e_T(Epetra_DataAccess::Copy, LeTRowMap, n_dofs_curr_cell);
-                Epetra_Map LePLUSRowMap(neighbour_dofs_curr_cell, 0, sComm);
-                Epetra_CrsMatrix L_e_PLUS(Epetra_DataAccess::Copy, LePLUSRowMap, LeTRowMap, 1);
-                double posOne = 1.0;
-
-                for(int i = 0; i < n_dofs_curr_cell; i++){
-                    const int col = current_dofs_indices[i];
-                    L_e.InsertGlobalValues(i, 1, &posOne , &col);
-                    L_e_T.InsertGlobalValues(col, 1, &posOne , &i);
-                }
-                L_e.FillComplete(LeTRowMap, LeRowMap);
-                L_e_T.FillComplete(LeRowMap, LeTRowMap);
+    const Epetra_CrsMatrix &epetra_pod_basis = pod->getPODBasis()->trilinos_matrix();
+    for (const auto &dof : stencil_dofs) {
+        int n_entries;
+        double *values;
+        int *local_columns;
+        epetra_pod_basis.ExtractMyRowView(epetra_pod_basis.LRID(static_cast<int>(dof)), n_entries, values, local_columns);
+        double value = reference_solution[dof];
+        for (int i_entry = 0; i_entry < n_entries; ++i_entry) {
+            value += values[i_entry] * reduced_coordinates(epetra_pod_basis.GCID(local_columns[i_entry]));
+        }
+        this->dg->solution[dof] = value;
+    }
+    this->dg->solution.update_ghost_values();
+}
 
-                for(int i = 0; i < neighbour_dofs_curr_cell; i++){
-                    const int col = neighbour_dofs_indices[i];
-                    L_e_PLUS.InsertGlobalValues(i, 1, &posOne , &col);
+template <int dim, int nspecies, typename real, typename MeshType>
+void HyperReducedODESolver<dim,nspecies,real,MeshType>::setup_sampled_stencil ()
+{
+    /* Each degree of freedom stores the layer of its cell in the stencil of the sampled cells:
+    1 for the sampled cells, 2 for their face neighbours (which complete the face terms of the sampled rows),
+    and 3 for the neighbours of those (which complete the auxiliary variable of the second layer).
+    Ghost values are exchanged after each layer so that the stencil crosses processor boundaries. */
+    const Epetra_BlockMap element_map = ECSW_weights.Map();
+    const int n_layers = 3;
+    dealii::LinearAlgebra::distributed::Vector<double> stencil_layer(this->dg->solution);
+    stencil_layer = 0.0;
+
+    std::vector<dealii::types::global_dof_index> dofs_indices;
+    std::vector<dealii::types::global_dof_index> neighbor_dofs_indices;
+    const auto is_in_layer = [&](const auto &neighbor_cell, const int layer) {
+        neighbor_dofs_indices.resize(neighbor_cell->get_fe().n_dofs_per_cell());
+        neighbor_cell->get_dof_indices(neighbor_dofs_indices);
+        return stencil_layer[neighbor_dofs_indices[0]] == layer;
+    };
+
+    for (int layer = 1; layer <= n_layers; ++layer) {
+        for (const auto &cell : this->dg->dof_handler.active_cell_iterators()) {
+            if (!cell->is_locally_owned()) continue;
+
+            dofs_indices.resize(cell->get_fe().n_dofs_per_cell());
+            cell->get_dof_indices(dofs_indices);
+            if (stencil_layer[dofs_indices[0]] != 0.0) continue;
+
+            bool in_stencil = false;
+            if (layer == 1) {
+                in_stencil = (ECSW_weights[element_map.LID(static_cast<int>(cell->active_cell_index()))] != 0);
+            } else {
+                for (unsigned int iface = 0; iface < dealii::GeometryInfo<dim>::faces_per_cell && !in_stencil; ++iface) {
+                    const bool is_periodic = cell->has_periodic_neighbor(iface);
+                    if (cell->face(iface)->at_boundary() && !is_periodic) continue;
+
+                    const auto neighbor_cell = cell->neighbor_or_periodic_neighbor(iface);
+                    if (!neighbor_cell->has_children()) {
+                        in_stencil = is_in_layer(neighbor_cell, layer-1);
+                        continue;
+                    }
+                    for (unsigned int i_subface = 0; i_subface < cell->face(iface)->n_children() && !in_stencil; ++i_subface) {
+                        in_stencil = is_periodic ? is_in_layer(cell->periodic_neighbor_child_on_subface(iface, i_subface), layer-1)
+                                                 : is_in_layer(cell->neighbor_child_on_subface(iface, i_subface), layer-1);
+                    }
                 }
-                L_e_PLUS.FillComplete(LeTRowMap, LePLUSRowMap);
-
-                // Find contribution of element to the Jacobian
-                Epetra_CrsMatrix J_L_e_T(Epetra_DataAccess::Copy, local_system_matrix.RowMap(), neighbour_dofs_curr_cell);
-                Epetra_CrsMatrix J_e_m(Epetra_DataAccess::Copy, LeRowMap, neighbour_dofs_curr_cell);
-                EpetraExt::MatrixMatrix::Multiply(local_system_matrix, false, L_e_PLUS, true, J_L_e_T, true);
-                EpetraExt::MatrixMatrix::Multiply(L_e, false, J_L_e_T, false, J_e_m, true);
-
-                // Jacobian for this element in the global dimensions
-                Epetra_CrsMatrix J_temp(Epetra_DataAccess::Copy, LeRowMap, N);
-                Epetra_CrsMatrix J_global_e(Epetra_DataAccess::Copy, LeTRowMap, N);
-                EpetraExt::MatrixMatrix::Multiply(J_e_m, false, L_e_PLUS, false, J_temp, true);
-                EpetraExt::MatrixMatrix::Multiply(L_e_T, false, J_temp, false, J_global_e, true);
-
-                // Add the contribution of the element to the hyper-reduced Jacobian with scaling from the weights
-                double scaling = ECSW_weights[local_element];
-                EpetraExt::MatrixMatrix::Add(J_global_e, false, scaling, reduced_jacobian, 1.0);
             }
+            if (in_stencil) {
+                for (const auto &dof : dofs_indices) stencil_layer[dof] = layer;
+            }
+        }
+        stencil_layer.update_ghost_values();
+    }
+
+    std::vector<bool> assembled_cells(this->dg->triangulation->n_active_cells(), false);
+    sampled_dofs.clear();
+    sampled_dofs_weights.clear();
+    stencil_dofs.clear();
+    for (const auto &cell : this->dg->dof_handler.active_cell_iterators()) {
+        if (!cell->is_locally_owned()) continue;
+
+        dofs_indices.resize(cell->get_fe().n_dofs_per_cell());
+        cell->get_dof_indices(dofs_indices);
+        const double layer = stencil_layer[dofs_indices[0]];
+        if (layer == 0.0) continue;
+
+        stencil_dofs.insert(stencil_dofs.end(), dofs_indices.begin(), dofs_indices.end());
+        if (layer <= 2) assembled_cells[cell->active_cell_index()] = true;
+        if (layer == 1) {
+            const double weight = ECSW_weights[element_map.LID(static_cast<int>(cell->active_cell_index()))];
+            sampled_dofs.insert(sampled_dofs.end(), dofs_indices.begin(), dofs_indices.end());
+            sampled_dofs_weights.insert(sampled_dofs_weights.end(), dofs_indices.size(), weight);
         }
     }
-    reduced_jacobian.FillComplete();
-    return std::make_shared<Epetra_CrsMatrix>(reduced_jacobian);
+    this->dg->set_assembled_cells(assembled_cells);
 }
 
 template <int dim, int nspecies, typename real, typename MeshType>
-std::shared_ptr<Epetra_Vector> HyperReducedODESolver<dim,nspecies,real,MeshType>::generate_hyper_reduced_residual(Epetra_Vector epetra_right_hand_side, Epetra_CrsMatrix &test_basis)
+void HyperReducedODESolver<dim,nspecies,real,MeshType>::generate_test_basis ()
 {
-    /* Refer to Equation (10) in:
-    https://onlinelibrary.wiley.com/doi/10.1002/nme.6603 (includes definitions of matrices used below such as L_e and L_e_PLUS)   
-    Create empty Hyper-reduced residual Epetra structure */
-    Epetra_MpiComm epetra_comm(MPI_COMM_WORLD);
-    Epetra_Map test_basis_colmap = test_basis.DomainMap();
-    std::unique_ptr global_ind(std::make_unique<int[]>(test_basis.NumGlobalCols()));
-    for (int i = 0; i < test_basis.NumGlobalCols(); i++){
-        global_ind[i] = i;
+    /* Refer to Equation (12) in:
+    https://onlinelibrary.wiley.com/doi/10.1002/nme.6603
+    The hyper-reduced Jacobian only has the rows of the sampled cells, scaled by their weights,
+    so the test basis W = J_hr * V is formed row by row on the sampled degrees of freedom. */
+    const Epetra_CrsMatrix &jacobian = this->dg->system_matrix.trilinos_matrix();
+    const Epetra_CrsMatrix &epetra_pod_basis = pod->getPODBasis()->trilinos_matrix();
+    const int n_pod = epetra_pod_basis.NumGlobalCols();
+
+    if (!pod_basis_jacobian_columns) {
+        Epetra_MultiVector pod_basis_owned(epetra_pod_basis.RowMap(), n_pod);
+        for (int i_row = 0; i_row < epetra_pod_basis.NumMyRows(); ++i_row) {
+            int n_entries;
+            double *values;
+            int *local_columns;
+            epetra_pod_basis.ExtractMyRowView(i_row, n_entries, values, local_columns);
+            for (int i_entry = 0; i_entry < n_entries; ++i_entry) {
+                pod_basis_owned[epetra_pod_basis.GCID(local_columns[i_entry])][i_row] = values[i_entry];
+            }
+        }
+        pod_basis_jacobian_columns = std::make_unique<Epetra_MultiVector>(jacobian.ColMap(), n_pod);
+        Epetra_Import pod_basis_importer(jacobian.ColMap(), epetra_pod_basis.RowMap());
+        pod_basis_jacobian_columns->Import(pod_basis_owned, pod_basis_importer, Insert);
     }
-    Epetra_Map POD_dim (-1,test_basis.NumGlobalCols(), global_ind.get(), 0, epetra_comm);
-    Epetra_Vector hyper_reduced_residual(POD_dim);
-    const int N = test_basis.NumGlobalRows();
-    Epetra_BlockMap element_map = ECSW_weights.Map();
-    const unsigned int max_dofs_per_cell = this->dg->dof_handler.get_fe_collection().max_dofs_per_cell();
-    std::vector<dealii::types::global_dof_index> current_dofs_indices(max_dofs_per_cell);
-    Epetra_Vector local_rhs = copy_vector_to_all_cores(epetra_right_hand_side);
-    Epetra_CrsMatrix local_test_basis = copy_matrix_to_all_cores(test_basis);
-
-    // Loop through elements
-    for (const auto &cell : this->dg->dof_handler.active_cell_iterators())
-    {
-        if (cell->is_locally_owned()){
-            // Add the contributions of an element if the weight from the NNLS is non-zero
-            const int global = cell->active_cell_index();
-            const int local_element = element_map.LID(global);
-            if (ECSW_weights[local_element] != 0){
-                const int fe_index_curr_cell = cell->active_fe_index();
-                const dealii::FESystem<dim,dim> &current_fe_ref = this->dg->fe_collection[fe_index_curr_cell];
-                const int n_dofs_curr_cell = current_fe_ref.n_dofs_per_cell();
-
-                current_dofs_indices.resize(n_dofs_curr_cell);
-                cell->get_dof_indices(current_dofs_indices);
-
-                // Create L_e matrix for current cell
-                const Epetra_SerialComm sComm;
-                Epetra_Map LeRowMap(n_dofs_curr_cell,n_dofs_curr_cell, 0, sComm);
-                Epetra_Map LeTRowMap(N, 0, sComm);
-                Epetra_CrsMatrix L_e(Epetra_DataAccess::Copy, LeRowMap, LeTRowMap, 1);
-                double posOne = 1.0;
-
-                for(int i = 0; i < n_dofs_curr_cell; i++){
-                    const int col = current_dofs_indices[i];
-                    L_e.InsertGlobalValues(i, 1, &posOne , &col);
-                }
-                L_e.FillComplete(LeTRowMap, LeRowMap);
-
-                // Find contribution of the current element in the global dimensions
-                Epetra_Vector local_r(LeRowMap);
-                Epetra_Vector global_r_e(LeTRowMap);
-                L_e.Multiply(false, local_rhs, local_r);
-                L_e.Multiply(true, local_r, global_r_e);
-
-                // Find reduced representation of residual and scale by weight
-                Epetra_Map POD_local (test_basis.NumGlobalCols(), test_basis.NumGlobalCols(), 0, sComm);
-                Epetra_Vector reduced_rhs_e(POD_local);
-                local_test_basis.Multiply(true, global_r_e, reduced_rhs_e);
-                reduced_rhs_e.Scale(ECSW_weights[local_element]);
-                std::unique_ptr reduced_rhs_array(std::make_unique<double[]>(reduced_rhs_e.MyLength()));
-
-                // Add to hyper-reduced representation of the residual
-                reduced_rhs_e.ExtractCopy(reduced_rhs_array.get());
-                for (int k = 0; k < reduced_rhs_e.MyLength(); ++k){
-                    hyper_reduced_residual.SumIntoMyValues(1, &reduced_rhs_array[k], &k);
-                }
+
+    local_test_basis.setZero(sampled_dofs.size(), n_pod);
+    for (unsigned int i_sampled = 0; i_sampled < sampled_dofs.size(); ++i_sampled) {
+        int n_entries;
+        double *values;
+        int *local_columns;
+        jacobian.ExtractMyRowView(jacobian.LRID(static_cast<int>(sampled_dofs[i_sampled])), n_entries, values, local_columns);
+        for (int i_entry = 0; i_entry < n_entries; ++i_entry) {
+            for (int i_pod = 0; i_pod < n_pod; ++i_pod) {
+                local_test_basis(i_sampled, i_pod) += values[i_entry] * (*pod_basis_jacobian_columns)[i_pod][local_columns[i_entry]];
             }
         }
+        local_test_basis.row(i_sampled) *= sampled_dofs_weights[i_sampled];
     }
-    Epetra_BlockMap old_map_b = hyper_reduced_residual.Map();
-    Epetra_Export b_importer(old_map_b, test_basis_colmap);
-    Epetra_Vector dist_hyper_res (test_basis_colmap); 
-    dist_hyper_res.Export(hyper_reduced_residual, b_importer, Add);
-    return std::make_shared<Epetra_Vector>(dist_hyper_res);
 }
 
 template <int dim, int nspecies, typename real, typename MeshType>
-std::shared_ptr<Epetra_CrsMatrix> HyperReducedODESolver<dim,nspecies,real,MeshType>::generate_reduced_lhs(Epetra_CrsMatrix &test_basis)
+Eigen::VectorXd HyperReducedODESolver<dim,nspecies,real,MeshType>::generate_hyper_reduced_residual () const
 {
-    Epetra_CrsMatrix epetra_reduced_lhs(Epetra_DataAccess::Copy, test_basis.DomainMap(), test_basis.NumGlobalCols());
-    EpetraExt::MatrixMatrix::Multiply(test_basis, true, test_basis, false, epetra_reduced_lhs);
+    /* Refer to Equation (10) in:
+    https://onlinelibrary.wiley.com/doi/10.1002/nme.6603 */
+    Eigen::VectorXd weighted_residual(sampled_dofs.size());
+    for (unsigned int i_sampled = 0; i_sampled < sampled_dofs.size(); ++i_sampled) {
+        weighted_residual(i_sampled) = sampled_dofs_weights[i_sampled] * this->dg->right_hand_side[sampled_dofs[i_sampled]];
+    }
+    Eigen::VectorXd hyper_reduced_residual = local_test_basis.transpose() * weighted_residual;
+    MPI_Allreduce(MPI_IN_PLACE, hyper_reduced_residual.data(), hyper_reduced_residual.size(), MPI_DOUBLE, MPI_SUM, this->mpi_communicator);
+    return hyper_reduced_residual;
+}
 
-    return std::make_shared<Epetra_CrsMatrix>(epetra_reduced_lhs);
+template <int dim, int nspecies, typename real, typename MeshType>
+double HyperReducedODESolver<dim,nspecies,real,MeshType>::evaluate_hyper_reduced_residual_norm (const Eigen::VectorXd &reduced_coordinates)
+{
+    reconstruct_stencil_solution(reduced_coordinates);
+    this->dg->assemble_residual();
+    return generate_hyper_reduced_residual().norm() / this->dg->right_hand_side.size();
 }
 
 #if PHILIP_SPECIES==1
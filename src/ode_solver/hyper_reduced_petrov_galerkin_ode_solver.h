@@ -4,6 +4,8 @@
 #include "dg/dg_base.hpp"
 #include "ode_solver_base.h"
 #include "reduced_order/pod_basis_base.h"
+#include <eigen/Eigen/Dense>
+#include <Epetra_MultiVector.h>
 
 namespace PHiLiP {
 namespace ODE {
@@ -62,18 +64,50 @@ public:
     */
     void allocate_ode_system () override;
 
-    /// Generate test basis
-    std::shared_ptr<Epetra_CrsMatrix> generate_test_basis(Epetra_CrsMatrix &epetra_system_matrix, const Epetra_CrsMatrix &pod_basis);
+    /// Reduced coordinates of the solution, replicated on all processors
+    /** The full-order solution is dg->solution = reference_solution + V * reduced_solution. It is only
+     *  reconstructed on the stencil of the sampled cells during the iterations, and in full for output.
+     */
+    Eigen::VectorXd reduced_solution;
 
-    /// Generate hyper-reduced jacobian matrix
-    std::shared_ptr<Epetra_CrsMatrix> generate_hyper_reduced_jacobian(const Epetra_CrsMatrix &system_matrix);
+    /// Reconstruct the full-order solution on all the degrees of freedom
+    void reconstruct_full_solution();
 
-    /// Generate hyper-reduced residual
-    std::shared_ptr<Epetra_Vector> generate_hyper_reduced_residual(Epetra_Vector epetra_right_hand_side, Epetra_CrsMatrix &test_basis);
+protected:
+    /// Reference state of the POD, in the layout of dg->solution
+    dealii::LinearAlgebra::distributed::Vector<double> reference_solution;
 
-    /// Generate reduced LHS
-    std::shared_ptr<Epetra_CrsMatrix> generate_reduced_lhs(Epetra_CrsMatrix &test_basis);
+    /// Locally owned degrees of freedom of the sampled cells
+    std::vector<dealii::types::global_dof_index> sampled_dofs;
 
+    /// ECSW weight of the cell owning each entry of sampled_dofs
+    std::vector<double> sampled_dofs_weights;
+
+    /// Locally owned degrees of freedom needed to evaluate the residual and Jacobian rows of the sampled cells
+    /** Sampled cells, their face neighbours and the neighbours of those, which are needed by the auxiliary variable.
+     */
+    std::vector<dealii::types::global_dof_index> stencil_dofs;
+
+    /// POD basis rows on the column map of the Jacobian, used to form the rows of J*V
+    std::unique_ptr<Epetra_MultiVector> pod_basis_jacobian_columns;
+
+    /// Rows of the hyper-reduced test basis W = w_e * J * V on the locally owned sampled degrees of freedom
+    Eigen::MatrixXd local_test_basis;
+
+    /// Flag the sampled cells and their stencil, and restrict the DG assembly to them
+    void setup_sampled_stencil();
+
+    /// Reconstruct the full-order solution on stencil_dofs only
+    void reconstruct_stencil_solution(const Eigen::VectorXd &reduced_coordinates);
+
+    /// Form the rows of the hyper-reduced test basis from the assembled Jacobian
+    void generate_test_basis();
+
+    /// Hyper-reduced residual W^T * (w_e * R) from the currently assembled residual, summed over all processors
+    Eigen::VectorXd generate_hyper_reduced_residual() const;
+
+    /// Normalized norm of the hyper-reduced residual at the given reduced coordinates
+    double evaluate_hyper_reduced_residual_norm(const Eigen::VectorXd &reduced_coordinates);
 };
 
 } // ODE namespace
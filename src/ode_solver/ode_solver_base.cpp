@@ -17,8 +17,8 @@ ODESolverBase<dim,nspecies,real,MeshType>::ODESolverBase(std::shared_ptr< DGBase
         , current_desired_time_for_output_solution_every_dt_time_intervals(ode_param.initial_desired_time_for_output_solution_every_dt_time_intervals)
         , original_time_step(0.0)
         , modified_time_step(0.0)
-        , mpi_communicator(MPI_COMM_WORLD)
-        , mpi_rank(dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD))
+        , mpi_communicator(dg_input->mpi_communicator)
+        , mpi_rank(dealii::Utilities::MPI::this_mpi_process(dg_input->mpi_communicator))
         , pcout(std::cout, mpi_rank==0)
 {}
 
@@ -338,7 +338,7 @@ std::shared_ptr<EmptyRRKBase<dim,nspecies,real,MeshType>> ODESolverFactory<dim,n
     if ( ( (ode_solver_type == ODEEnum::runge_kutta_solver && dg_input->all_parameters->flow_solver_param.do_calculate_numerical_entropy)
             || ( !dg_input->all_parameters->ode_solver_param.use_relaxation_runge_kutta && dg_input->all_parameters->flow_solver_param.do_calculate_numerical_entropy ) )
             && nspecies==1  ) {
-            return std::make_shared<RKNumEntropy<dim,nspecies,real,MeshType>>(rk_tableau_butcher);
+            return std::make_shared<RKNumEntropy<dim,nspecies,real,MeshType>>(rk_tableau_butcher, dg_input->mpi_communicator);
     }
     else if (dg_input->all_parameters->ode_solver_param.use_relaxation_runge_kutta){
 
@@ -364,9 +364,9 @@ std::shared_ptr<EmptyRRKBase<dim,nspecies,real,MeshType>> ODESolverFactory<dim,n
 
         pcout << "Adding " << rrk_type_string << " Relaxation Runge Kutta to the ODE solver..." << std::endl;
         if (numerical_entropy_type==NumEntropyEnum::energy && nspecies==1)
-            return std::make_shared<AlgebraicRRKODESolver<dim,nspecies,real,MeshType>>(rk_tableau_butcher);
+            return std::make_shared<AlgebraicRRKODESolver<dim,nspecies,real,MeshType>>(rk_tableau_butcher, dg_input->mpi_communicator);
         else if (numerical_entropy_type==NumEntropyEnum::nonlinear && nspecies==1)
-            return std::make_shared<RootFindingRRKODESolver<dim,nspecies,real,MeshType>>(rk_tableau_butcher);
+            return std::make_shared<RootFindingRRKODESolver<dim,nspecies,real,MeshType>>(rk_tableau_butcher, dg_input->mpi_communicator);
         else return nullptr; // no need for message as numerical_entropy_type has already been checked
     } else {
         return std::make_shared<EmptyRRKBase<dim,nspecies,real,MeshType>> (rk_tableau_butcher);
@@ -1,16 +1,15 @@
 #include "reduced_order_ode_solver.h"
 
-#include <Amesos_Lapack.h>
-#include <Epetra_LinearProblem.h>
 #include <Epetra_Vector.h>
 #include <deal.II/lac/la_parallel_vector.h>
 #include <deal.II/lac/trilinos_sparsity_pattern.h>
 
-#include "Amesos_BaseSolver.h"
 #include "dg/dg_base.hpp"
 #include "linear_solver/linear_solver.h"
 #include "ode_solver_base.h"
 #include "reduced_order/pod_basis_base.h"
+#include "reduced_order/multi_core_helper_functions.h"
+#include <eigen/Eigen/Dense>
 
 namespace PHiLiP {
 namespace ODE {
@@ -91,6 +90,9 @@ int ReducedOrderODESolver<dim,nspecies,real,MeshType>::steady_state ()
         }
     }
 
+    this->dg->assemble_residual();
+    this->pcout << "Full-order residual norm: " << this->dg->get_residual_l2norm() << std::endl;
+
     this->pcout << " ********************************************************** "
                 << std::endl
                 << " ODESolver steady_state stopped at"
@@ -125,15 +127,28 @@ void ReducedOrderODESolver<dim,nspecies,real,MeshType>::step_in_time (real /*dt*
     Epetra_Vector epetra_reduced_rhs(epetra_test_basis->DomainMap());
     epetra_test_basis->Multiply(true, epetra_right_hand_side, epetra_reduced_rhs);
     std::shared_ptr<Epetra_CrsMatrix> epetra_reduced_lhs = generate_reduced_lhs(epetra_system_matrix, *epetra_test_basis);
-    Epetra_Vector epetra_reduced_solution_update(epetra_reduced_lhs->DomainMap());
-    Epetra_LinearProblem linearProblem(epetra_reduced_lhs.get(), &epetra_reduced_solution_update, &epetra_reduced_rhs);
+    // The reduced system is small and dense: solve it redundantly on every processor with a dense LU
+    const Epetra_CrsMatrix local_reduced_lhs = copy_matrix_to_all_cores(*epetra_reduced_lhs);
+    const Epetra_Vector local_reduced_rhs = copy_vector_to_all_cores(epetra_reduced_rhs);
+    const int n_reduced = local_reduced_lhs.NumGlobalRows();
+    Eigen::MatrixXd reduced_lhs = Eigen::MatrixXd::Zero(n_reduced, n_reduced);
+    Eigen::VectorXd reduced_rhs(n_reduced);
+    for (int i_row = 0; i_row < n_reduced; ++i_row) {
+        int n_entries;
+        double *values;
+        int *local_columns;
+        local_reduced_lhs.ExtractMyRowView(i_row, n_entries, values, local_columns);
+        for (int i_entry = 0; i_entry < n_entries; ++i_entry) {
+            reduced_lhs(local_reduced_lhs.GRID(i_row), local_reduced_lhs.GCID(local_columns[i_entry])) = values[i_entry];
+        }
+        reduced_rhs(local_reduced_rhs.Map().GID(i_row)) = local_reduced_rhs[i_row];
+    }
+    const Eigen::VectorXd reduced_solution_update = reduced_lhs.partialPivLu().solve(reduced_rhs);
 
-    Amesos_Lapack Solver(linearProblem);
-    Teuchos::ParameterList List;
-    Solver.SetParameters(List);
-    Solver.SymbolicFactorization();
-    Solver.NumericFactorization();
-    Solver.Solve();
+    Epetra_Vector epetra_reduced_solution_update(epetra_reduced_lhs->DomainMap());
+    for (int i = 0; i < epetra_reduced_solution_update.MyLength(); ++i) {
+        epetra_reduced_solution_update[i] = reduced_solution_update(epetra_reduced_solution_update.Map().GID(i));
+    }
 
     const dealii::LinearAlgebra::distributed::Vector<double> old_solution(this->dg->solution);
     double step_length = 1.0;
@@ -253,8 +268,6 @@ void ReducedOrderODESolver<dim,nspecies,real,MeshType>::step_in_time (real /*dt*
         this->dg->solution = old_solution;
     }
 
-    this->pcout << "Full-order residual norm: " << this->dg->get_residual_l2norm() << std::endl;
-
     this->residual_norm = new_residual;
 
     ++(this->current_iteration);
@@ -22,7 +22,8 @@ class AlgebraicRRKODESolver: public RRKODESolverBase<dim, nspecies, real, MeshTy
 public:
     /// Default constructor that will set the constants.
     explicit AlgebraicRRKODESolver(
-            std::shared_ptr<RKTableauButcherBase<dim,real,MeshType>> rk_tableau_input);
+            std::shared_ptr<RKTableauButcherBase<dim,real,MeshType>> rk_tableau_input,
+            const MPI_Comm mpi_communicator_input = MPI_COMM_WORLD);
 
 protected:
 
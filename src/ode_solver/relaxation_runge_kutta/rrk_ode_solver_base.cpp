@@ -5,8 +5,9 @@ namespace ODE {
 
 template <int dim, int nspecies, typename real, typename MeshType>
 RRKODESolverBase<dim,nspecies,real,MeshType>::RRKODESolverBase(
-            std::shared_ptr<RKTableauButcherBase<dim,real,MeshType>> rk_tableau_input)
-        : RKNumEntropy<dim,nspecies,real,MeshType>(rk_tableau_input)
+            std::shared_ptr<RKTableauButcherBase<dim,real,MeshType>> rk_tableau_input,
+            const MPI_Comm mpi_communicator_input)
+        : RKNumEntropy<dim,nspecies,real,MeshType>(rk_tableau_input, mpi_communicator_input)
 {
     // Do nothing
 }
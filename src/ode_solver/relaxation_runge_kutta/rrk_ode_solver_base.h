@@ -19,7 +19,8 @@ class RRKODESolverBase: public RKNumEntropy<dim, nspecies, real, MeshType>
 public:
     /// Constructor
     explicit RRKODESolverBase(
-            std::shared_ptr<RKTableauButcherBase<dim,real,MeshType>> rk_tableau_input);
+            std::shared_ptr<RKTableauButcherBase<dim,real,MeshType>> rk_tableau_input,
+            const MPI_Comm mpi_communicator_input = MPI_COMM_WORLD);
 
     /// Relaxation Runge-Kutta parameter gamma^n
     /** See:  Ketcheson 2019, "Relaxation Runge--Kutta methods: Conservation and stability for inner-product norms"
@@ -7,12 +7,13 @@ namespace ODE {
 
 template <int dim, int nspecies, typename real, typename MeshType>
 RKNumEntropy<dim,nspecies,real,MeshType>::RKNumEntropy(
-            std::shared_ptr<RKTableauButcherBase<dim,real,MeshType>> rk_tableau_input)
+            std::shared_ptr<RKTableauButcherBase<dim,real,MeshType>> rk_tableau_input,
+            const MPI_Comm mpi_communicator_input)
         : EmptyRRKBase<dim,nspecies,real,MeshType>(rk_tableau_input)
         , butcher_tableau(rk_tableau_input)
         , n_rk_stages(butcher_tableau->n_rk_stages)
-        , mpi_communicator(MPI_COMM_WORLD)
-        , mpi_rank(dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD))
+        , mpi_communicator(mpi_communicator_input)
+        , mpi_rank(dealii::Utilities::MPI::this_mpi_process(mpi_communicator))
         , pcout(std::cout, mpi_rank==0)
 {
     this->rk_stage_solution.resize(n_rk_stages);
@@ -21,7 +21,8 @@ class RKNumEntropy: public EmptyRRKBase <dim, nspecies, real, MeshType>
 public:
     /// Default constructor that will set the constants.
     explicit RKNumEntropy(
-            std::shared_ptr<RKTableauButcherBase<dim,real,MeshType>> rk_tableau_input);
+            std::shared_ptr<RKTableauButcherBase<dim,real,MeshType>> rk_tableau_input,
+            const MPI_Comm mpi_communicator_input = MPI_COMM_WORLD);
 
     /// Calculate FR entropy adjustment
     /** FR_contribution = dt \sum_i=1^s b_i v^{(i)} K du^{(i)}/dt
@@ -23,7 +23,7 @@ FlowConstraints<dim, nspecies>
     , dg(_dg)
     , design_parameterization(_design_parameterization)
     , jacobian_prec(nullptr)
-    , adjoint_jacobian_prec(nullptr)
+    , flow_CFL_jacobian_prec(0.0)
 {
     flow_CFL_ = 0.0;
     
@@ -173,9 +173,6 @@ void FlowConstraints<dim, nspecies>
     update_1(des_var_sim);
     update_2(des_var_ctl);
 
-    const bool compute_dRdW=true; const bool compute_dRdX=false; const bool compute_d2R=false;
-    dg->assemble_residual(compute_dRdW, compute_dRdX, compute_d2R, flow_CFL_);
-
     if(i_print) std::cout << __PRETTY_FUNCTION__ << std::endl;
     //solve_linear_2 (
     //    this->dg->system_matrix,
@@ -202,7 +199,7 @@ void FlowConstraints<dim, nspecies>
     //MPI_Barrier(MPI_COMM_WORLD);
     //dg->system_matrix.print(std::cout);
 
-    solve_linear (dg->system_matrix, input_vector_v, output_vector_v, this->linear_solver_param);
+    solve_jacobian_system(false, input_vector_v, output_vector_v);
     //solve_linear_2 ( this->dg->system_matrix, input_vector_v, output_vector_v, this->linear_solver_param);
     //try {
     //  solve_linear (dg->system_matrix, input_vector_v, output_vector_v, this->linear_solver_param);
@@ -215,59 +212,103 @@ template<int dim, int nspecies>
 void FlowConstraints<dim, nspecies>
 ::destroy_JacobianPreconditioner_1()
 {
-    delete jacobian_prec;
-    jacobian_prec = nullptr;
+    jacobian_prec.reset();
 }
 template<int dim, int nspecies>
 void FlowConstraints<dim, nspecies>
 ::destroy_AdjointJacobianPreconditioner_1()
 {
-    delete adjoint_jacobian_prec;
-    adjoint_jacobian_prec = nullptr;
+    // The adjoint preconditioner is the transpose of the Jacobian factorization.
+    jacobian_prec.reset();
 }
 
 template<int dim, int nspecies>
-int FlowConstraints<dim, nspecies>
-::construct_JacobianPreconditioner_1(
-    const ROL::Vector<double>& des_var_sim,
-    const ROL::Vector<double>& des_var_ctl)
+void FlowConstraints<dim, nspecies>
+::update_jacobian_preconditioner()
 {
-    update_1(des_var_sim);
-    update_2(des_var_ctl);
-
     const bool compute_dRdW=true; const bool compute_dRdX=false; const bool compute_d2R=false;
     dg->assemble_residual(compute_dRdW, compute_dRdX, compute_d2R, flow_CFL_);
 
-    Epetra_CrsMatrix * jacobian = const_cast<Epetra_CrsMatrix *>(&(dg->system_matrix.trilinos_matrix()));
+    if (jacobian_prec && flow_CFL_jacobian_prec == flow_CFL_
+        && solution_jacobian_prec.size() == dg->solution.size()
+        && volume_nodes_jacobian_prec.size() == dg->high_order_grid->volume_nodes.size()) {
 
-    destroy_JacobianPreconditioner_1();
-    Ifpack Factory;
+        auto diff_sol = dg->solution;
+        diff_sol -= solution_jacobian_prec;
+        auto diff_node = dg->high_order_grid->volume_nodes;
+        diff_node -= volume_nodes_jacobian_prec;
+        if (diff_sol.l2_norm() == 0.0 && diff_node.l2_norm() == 0.0) return;
+    }
 
-    Teuchos::ParameterList List;
+    destroy_JacobianPreconditioner_1();
+    jacobian_prec = build_ilu_preconditioner(dg->system_matrix, this->linear_solver_param);
 
-    const std::string PrecType = "ILUT"; 
-    List.set("fact: ilut level-of-fill", 50.0);
-    List.set("fact: absolute threshold", 1e-3);
-    List.set("fact: relative threshold", 1.01);//1.0+1e-2);
-    List.set("fact: drop tolerance", 0.0);//1e-12);
+    solution_jacobian_prec = dg->solution;
+    volume_nodes_jacobian_prec = dg->high_order_grid->volume_nodes;
+    flow_CFL_jacobian_prec = flow_CFL_;
+}
 
-    //const std::string PrecType = "ILU"; 
-    //List.set("fact: level-of-fill", 0);
+template<int dim, int nspecies>
+void FlowConstraints<dim, nspecies>
+::solve_jacobian_system(
+    const bool transpose,
+    dealii::LinearAlgebra::distributed::Vector<double> &input_vector,
+    dealii::LinearAlgebra::distributed::Vector<double> &output_vector)
+{
+    const dealii::TrilinosWrappers::SparseMatrix &matrix = transpose ? dg->system_matrix_transpose : dg->system_matrix;
 
-    List.set("schwarz: reordering type", "rcm");
-    const int OverlapLevel = 1; // one row of overlap among the processes
-    jacobian_prec = Factory.Create(PrecType, jacobian, OverlapLevel);
-    assert (jacobian_prec != 0);
+    if (this->linear_solver_param.linear_solver_type == Parameters::LinearSolverParam::LinearSolverEnum::direct) {
+        const bool compute_dRdW=true; const bool compute_dRdX=false; const bool compute_d2R=false;
+        dg->assemble_residual(compute_dRdW, compute_dRdX, compute_d2R, flow_CFL_);
+        solve_linear (matrix, input_vector, output_vector, this->linear_solver_param);
+        return;
+    }
 
+    update_jacobian_preconditioner();
+    if (!jacobian_prec) {
+        solve_linear (matrix, input_vector, output_vector, this->linear_solver_param);
+        return;
+    }
+    // The transposed factorization of the Jacobian preconditions its transpose.
+    jacobian_prec->SetUseTranspose(transpose);
+    solve_linear (matrix, *jacobian_prec, input_vector, output_vector, this->linear_solver_param);
+    jacobian_prec->SetUseTranspose(false);
+}
 
+template<int dim, int nspecies>
+void FlowConstraints<dim, nspecies>
+::apply_jacobian_preconditioner(
+    const bool transpose,
+    dealii::LinearAlgebra::distributed::Vector<double> &input_vector,
+    dealii::LinearAlgebra::distributed::Vector<double> &output_vector)
+{
+    if (!jacobian_prec) {
+        output_vector = input_vector;
+        return;
+    }
+    Epetra_Vector input_trilinos(View,
+                    dg->system_matrix.trilinos_matrix().DomainMap(),
+                    input_vector.begin());
+    Epetra_Vector output_trilinos(View,
+                    dg->system_matrix.trilinos_matrix().RangeMap(),
+                    output_vector.begin());
+    jacobian_prec->SetUseTranspose(transpose);
+    jacobian_prec->ApplyInverse (input_trilinos, output_trilinos);
+    jacobian_prec->SetUseTranspose(false);
+}
 
+template<int dim, int nspecies>
+int FlowConstraints<dim, nspecies>
+::construct_JacobianPreconditioner_1(
+    const ROL::Vector<double>& des_var_sim,
+    const ROL::Vector<double>& des_var_ctl)
+{
+    update_1(des_var_sim);
+    update_2(des_var_ctl);
 
-    IFPACK_CHK_ERR(jacobian_prec->SetParameters(List));
-    IFPACK_CHK_ERR(jacobian_prec->Initialize());
-    IFPACK_CHK_ERR(jacobian_prec->Compute());
+    update_jacobian_preconditioner();
 
     return 0;
-
 }
 
 template<int dim, int nspecies>
@@ -279,36 +320,10 @@ int FlowConstraints<dim, nspecies>
     update_1(des_var_sim);
     update_2(des_var_ctl);
 
-    const bool compute_dRdW=true; const bool compute_dRdX=false; const bool compute_d2R=false;
-    dg->assemble_residual(compute_dRdW, compute_dRdX, compute_d2R, flow_CFL_);
-
-    Epetra_CrsMatrix * adjoint_jacobian = const_cast<Epetra_CrsMatrix *>(&(dg->system_matrix_transpose.trilinos_matrix()));
-
-    destroy_AdjointJacobianPreconditioner_1();
-    Ifpack Factory;
-
-    Teuchos::ParameterList List;
-
-    const std::string PrecType = "ILUT"; 
-    List.set("fact: ilut level-of-fill", 50.0);
-    List.set("fact: absolute threshold", 1e-3);
-    List.set("fact: relative threshold", 1.01);//1.0+1e-2);
-    List.set("fact: drop tolerance", 0.0);//1e-12);
-
-    //const std::string PrecType = "ILU"; 
-    //List.set("fact: level-of-fill", 0);
-
-    List.set("schwarz: reordering type", "rcm");
-    const int OverlapLevel = 1; // one row of overlap among the processes
-    adjoint_jacobian_prec = Factory.Create(PrecType, adjoint_jacobian, OverlapLevel);
-    assert (adjoint_jacobian_prec != 0);
-
-    IFPACK_CHK_ERR(adjoint_jacobian_prec->SetParameters(List));
-    IFPACK_CHK_ERR(adjoint_jacobian_prec->Initialize());
-    IFPACK_CHK_ERR(adjoint_jacobian_prec->Compute());
+    // Reuses the Jacobian factorization, which is applied transposed.
+    update_jacobian_preconditioner();
 
     return 0;
-
 }
 
 template<int dim, int nspecies>
@@ -328,13 +343,7 @@ void FlowConstraints<dim, nspecies>
     auto input_vector_v = ROL_vector_to_dealii_vector_reference(input_vector);
     auto &output_vector_v = ROL_vector_to_dealii_vector_reference(output_vector);
 
-    Epetra_Vector input_trilinos(View,
-                    dg->system_matrix.trilinos_matrix().DomainMap(),
-                    input_vector_v.begin());
-    Epetra_Vector output_trilinos(View,
-                    dg->system_matrix.trilinos_matrix().RangeMap(),
-                    output_vector_v.begin());
-    jacobian_prec->ApplyInverse (input_trilinos, output_trilinos);
+    apply_jacobian_preconditioner(false, input_vector_v, output_vector_v);
 
     //n_vmult += 2;
     //dRdW_mult += 2;
@@ -360,13 +369,7 @@ void FlowConstraints<dim, nspecies>
     auto input_vector_v = ROL_vector_to_dealii_vector_reference(input_vector);
     auto &output_vector_v = ROL_vector_to_dealii_vector_reference(output_vector);
 
-    Epetra_Vector input_trilinos(View,
-                    dg->system_matrix_transpose.trilinos_matrix().DomainMap(),
-                    input_vector_v.begin());
-    Epetra_Vector output_trilinos(View,
-                    dg->system_matrix_transpose.trilinos_matrix().RangeMap(),
-                    output_vector_v.begin());
-    adjoint_jacobian_prec->ApplyInverse (input_trilinos, output_trilinos);
+    apply_jacobian_preconditioner(true, input_vector_v, output_vector_v);
 
     //n_vmult += 2;
     //dRdW_mult += 2;
@@ -387,14 +390,11 @@ double& /*tol*/ )
     update_1(des_var_sim);
     update_2(des_var_ctl);
 
-    const bool compute_dRdW=true; const bool compute_dRdX=false; const bool compute_d2R=false;
-    dg->assemble_residual(compute_dRdW, compute_dRdX, compute_d2R, flow_CFL_);
-
     // Input vector is copied into temporary non-const vector.
     auto input_vector_v = ROL_vector_to_dealii_vector_reference(input_vector);
     auto &output_vector_v = ROL_vector_to_dealii_vector_reference(output_vector);
 
-    solve_linear (dg->system_matrix_transpose, input_vector_v, output_vector_v, this->linear_solver_param);
+    solve_jacobian_system(true, input_vector_v, output_vector_v);
 
 }
 
@@ -540,9 +540,11 @@ void FlowConstraints<dim, nspecies>
     update_1(des_var_sim);
     update_2(des_var_ctl);
 
-    const bool compute_dRdW=false; const bool compute_dRdX=false; const bool compute_d2R=true;
-    dg->assemble_residual(compute_dRdW, compute_dRdX, compute_d2R, flow_CFL_);
-    dg->d2RdWdW.vmult(ROL_vector_to_dealii_vector_reference(output_vector), ROL_vector_to_dealii_vector_reference(input_vector));
+    auto zero_volume_nodes = dg->high_order_grid->volume_nodes;
+    zero_volume_nodes = 0.0;
+    auto d2RdXdW_input = dg->high_order_grid->volume_nodes;
+    dg->apply_d2R(ROL_vector_to_dealii_vector_reference(input_vector), zero_volume_nodes,
+                  ROL_vector_to_dealii_vector_reference(output_vector), d2RdXdW_input);
 
     n_vmult += 6;
     d2R_mult += 1;
@@ -572,9 +574,10 @@ void FlowConstraints<dim, nspecies>
 
     auto input_d2RdWdX = dg->high_order_grid->volume_nodes;
     {
-        const bool compute_dRdW=false; const bool compute_dRdX=false; const bool compute_d2R=true;
-        dg->assemble_residual(compute_dRdW, compute_dRdX, compute_d2R, flow_CFL_);
-        dg->d2RdWdX.Tvmult(input_d2RdWdX, input_vector_v);
+        auto zero_volume_nodes = dg->high_order_grid->volume_nodes;
+        zero_volume_nodes = 0.0;
+        auto d2RdWdW_input = dg->solution;
+        dg->apply_d2R(input_vector_v, zero_volume_nodes, d2RdWdW_input, input_d2RdWdX);
     }
 
     // auto input_d2RdWdX_dXvdXvs = dg->high_order_grid->volume_nodes;
@@ -652,9 +655,10 @@ void FlowConstraints<dim, nspecies>
 
     auto &output_vector_v = ROL_vector_to_dealii_vector_reference(output_vector);
     {
-        const bool compute_dRdW=false; const bool compute_dRdX=false; const bool compute_d2R=true;
-        dg->assemble_residual(compute_dRdW, compute_dRdX, compute_d2R, flow_CFL_);
-        dg->d2RdWdX.vmult(output_vector_v, dXvdXp_input);
+        auto zero_solution = dg->solution;
+        zero_solution = 0.0;
+        auto d2RdXdX_dXvdXp_input = dg->high_order_grid->volume_nodes;
+        dg->apply_d2R(zero_solution, dXvdXp_input, output_vector_v, d2RdXdX_dXvdXp_input);
     }
 
     n_vmult += 7;
@@ -712,9 +716,10 @@ void FlowConstraints<dim, nspecies>
 
     auto d2RdXdX_dXvdXp_input = dg->high_order_grid->volume_nodes;
     {
-        const bool compute_dRdW=false; const bool compute_dRdX=false; const bool compute_d2R=true;
-        dg->assemble_residual(compute_dRdW, compute_dRdX, compute_d2R, flow_CFL_);
-        dg->d2RdXdX.vmult(d2RdXdX_dXvdXp_input, dXvdXp_input);
+        auto zero_solution = dg->solution;
+        zero_solution = 0.0;
+        auto d2RdWdX_dXvdXp_input = dg->solution;
+        dg->apply_d2R(zero_solution, dXvdXp_input, d2RdWdX_dXvdXp_input, d2RdXdX_dXvdXp_input);
     }
 
     //auto dXvdXvsT_d2RdXdX_dXvdXp_input = dg->high_order_grid->volume_nodes;
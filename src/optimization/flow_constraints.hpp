@@ -44,11 +44,34 @@ private:
     dealii::LinearAlgebra::distributed::Vector<double> design_var;
 
     /// Jacobian preconditioner.
-    /** Currently uses ILUT */
-    Ifpack_Preconditioner *jacobian_prec;
-    /// Adjoint Jacobian preconditioner.
-    /** Currently uses ILUT */
-    Ifpack_Preconditioner *adjoint_jacobian_prec;
+    /** ILU or ILUT factorization built from linear_solver_param. The same factorization is used by the forward
+     *  and adjoint GMRES solves and preconditioners, the latter applying its transpose.
+     *  It is only recomputed when the Jacobian changes, and is a nullptr if no preconditioner is requested.
+     */
+    std::unique_ptr<Ifpack_Preconditioner> jacobian_prec;
+    /// Simulation variables at which jacobian_prec was computed.
+    dealii::LinearAlgebra::distributed::Vector<double> solution_jacobian_prec;
+    /// Volume nodes at which jacobian_prec was computed.
+    dealii::LinearAlgebra::distributed::Vector<double> volume_nodes_jacobian_prec;
+    /// Mass matrix regularization at which jacobian_prec was computed.
+    double flow_CFL_jacobian_prec;
+
+    /// Assembles the Jacobian at the current state and factorizes it unless it is already factorized.
+    void update_jacobian_preconditioner();
+    /// Solves the Jacobian system, or its transpose, with the solver requested by linear_solver_param.
+    /** GMRES is preconditioned by the cached Jacobian factorization, while the direct solver
+     *  factorizes the assembled matrix itself.
+     */
+    void solve_jacobian_system(
+        const bool transpose,
+        dealii::LinearAlgebra::distributed::Vector<double> &input_vector,
+        dealii::LinearAlgebra::distributed::Vector<double> &output_vector);
+    /// Applies the inverse of the Jacobian factorization, or of its transpose, onto a vector.
+    /** The input vector is copied if no preconditioner is requested. */
+    void apply_jacobian_preconditioner(
+        const bool transpose,
+        dealii::LinearAlgebra::distributed::Vector<double> &input_vector,
+        dealii::LinearAlgebra::distributed::Vector<double> &output_vector);
 
 protected:
     /// ID used when outputting the flow solution.
@@ -28,6 +28,7 @@ AllParameters::AllParameters ()
     , mesh_adaptation_param(MeshAdaptationParam())
     , functional_param(FunctionalParam())
     , time_refinement_study_param(TimeRefinementStudyParam())
+    , mpi_communicator(MPI_COMM_WORLD)
     , pcout(std::cout, dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD)==0)
 { }
 
@@ -392,6 +393,11 @@ void AllParameters::declare_parameters (dealii::ParameterHandler &prm)
                       dealii::Patterns::FileName(dealii::Patterns::FileName::FileType::input),
                       "Filename of the chemistry data file that contains the properties of the species used in simulation. (ex. H2_O2.kinetics");
 
+    prm.declare_entry("thermodynamic_table_tolerance", "0.0",
+                      dealii::Patterns::Double(0, dealii::Patterns::Double::max_double_value),
+                      "Relative interpolation error bound of the tabulated species enthalpy and heat capacities of the real gas physics. "
+                      "A value of zero evaluates the NASA polynomials directly.");
+
     prm.declare_entry("wall_model_input_from_second_element", "true",
                       dealii::Patterns::Bool(),
                       "Flag for using second element as wall model input. If false, uses buffer (i.e. wall-adjacent) element.");
@@ -667,6 +673,7 @@ const std::string test_string = prm.get("test_type");
     use_projected_entropy_variables_for_nsfr_boundary_term = prm.get_bool("use_projected_entropy_variables_for_nsfr_boundary_term");
 
     chemistry_input_file = prm.get("chemistry_input_file");
+    thermodynamic_table_tolerance = prm.get_double("thermodynamic_table_tolerance");
 
     pcout << "Parsing linear solver subsection..." << std::endl;
     linear_solver_param.parse_parameters (prm);
@@ -331,6 +331,10 @@ public:
 
     std::string chemistry_input_file; ///< Name of file containing NASA CAP data for species
 
+    /// Relative interpolation error bound of the tabulated species thermodynamic properties.
+    /** A value of zero evaluates the NASA polynomials directly. */
+    double thermodynamic_table_tolerance;
+
     /// Flag for using wall model (initialized as false)
     bool using_wall_model = false;
 
@@ -339,6 +343,13 @@ public:
 
     /// Flag for using projected entropy variables for NSFR boundary term
     bool use_projected_entropy_variables_for_nsfr_boundary_term;
+
+    /// MPI communicator on which the flow solver case, DG and ODE solver are built.
+    /** Not read from the input file; defaults to MPI_COMM_WORLD. Setting it to a
+     *  sub-communicator before constructing a FlowSolver runs the full-order solve
+     *  on that subset of processes (see AdaptiveSamplingBase ensemble snapshots).
+     */
+    MPI_Comm mpi_communicator;
     
     /// Declare parameters that can be set as inputs and set up the default options
     /** This subroutine should call the sub-parameter classes static declare_parameters()
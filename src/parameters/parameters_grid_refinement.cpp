@@ -80,11 +80,13 @@ void GridRefinementParam::declare_parameters(dealii::ParameterHandler &prm)
         prm.declare_entry("output_type", "msh_out",
                           dealii::Patterns::Selection(
                           " gmsh_out | "
-                          " msh_out"),
+                          " msh_out | "
+                          " in_process"),
                           "Enum of output data types (for interface with mesh generators)."
                           "Choices are "
                           " <gmsh_out | "
-                          "  msh_out>.");
+                          "  msh_out | "
+                          "  in_process>.");
 
         prm.declare_entry("output_data_type", "size_field",
                           dealii::Patterns::Selection(
@@ -173,8 +175,9 @@ void GridRefinementParam::parse_parameters(dealii::ParameterHandler &prm)
         else if(error_indicator_string == "adjoint_based") {error_indicator = ErrorIndicator::adjoint_based;}
         
         const std::string output_type_string = prm.get("output_type");
-        if(output_type_string == "gmsh_out")     {output_type = OutputType::gmsh_out;}
-        else if(output_type_string == "msh_out") {output_type = OutputType::msh_out;}
+        if(output_type_string == "gmsh_out")        {output_type = OutputType::gmsh_out;}
+        else if(output_type_string == "msh_out")    {output_type = OutputType::msh_out;}
+        else if(output_type_string == "in_process") {output_type = OutputType::in_process;}
 
         const std::string output_data_type_string = prm.get("output_data_type");
         if(output_data_type_string == "size_field")        {output_data_type = OutputDataType::size_field;}
@@ -74,6 +74,7 @@ public:
     enum OutputType{
         gmsh_out, // output of pos and geo files for gmsh remeshing
         msh_out,  // output of .msh with data fields corresponding to output_data_type
+        in_process, // no output, metric-conforming refinement of the current grid with solution transfer
         };
     /// Selected file output type
     OutputType output_type;
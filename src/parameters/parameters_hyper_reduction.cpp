@@ -12,6 +12,10 @@ void HyperReductionParam::declare_parameters (dealii::ParameterHandler &prm)
         prm.declare_entry("NNLS_max_iter", "5000",
                           dealii::Patterns::Integer(0, dealii::Patterns::Integer::max_int_value),
                           "Maximum number of iterations for the NNLS solver");
+        prm.declare_entry("NNLS_max_columns_per_iteration", "1",
+                          dealii::Patterns::Integer(1, dealii::Patterns::Integer::max_int_value),
+                          "Maximum number of columns added to the positive set per outer iteration of the NNLS solver. "
+                          "Values above 1 reduce the number of outer iterations for problems with many candidate cells.");
         prm.declare_entry("training_data", "jacobian",
                           dealii::Patterns::Selection(
                           " jacobian | "
@@ -40,6 +44,7 @@ void HyperReductionParam::parse_parameters (dealii::ParameterHandler &prm)
     {
         NNLS_tol = prm.get_double("NNLS_tol");
         NNLS_max_iter = prm.get_integer("NNLS_max_iter");
+        NNLS_max_columns_per_iteration = prm.get_integer("NNLS_max_columns_per_iteration");
         training_data = prm.get("training_data");
         num_training_snaps = prm.get_integer("num_training_snaps");
         adapt_sampling_bool = prm.get_bool("adapt_sampling_bool");
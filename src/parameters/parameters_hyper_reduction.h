@@ -18,6 +18,9 @@ public:
     /// Maximum number of iterations for NNLS Solver
     int NNLS_max_iter;
 
+    /// Maximum number of columns moved into the positive set per outer iteration of the NNLS Solver
+    int NNLS_max_columns_per_iteration;
+
     /// Training data (Residual-based vs Jacobian-based)
     std::string training_data;
 
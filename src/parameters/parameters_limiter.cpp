@@ -39,9 +39,8 @@ void LimiterParam::declare_parameters (dealii::ParameterHandler &prm)
                           dealii::Patterns::Double(0, 1e200),
                           "Maximum delta_x required for minmod function within TVB Limiter.");
 
-        using convert_tensor = dealii::Patterns::Tools::Convert<dealii::Tensor<1, 4, double>>;
-        prm.declare_entry("tuning_parameter_for_each_state", "0,0,0,0", 
-                          *convert_tensor::to_pattern(), 
+        prm.declare_entry("tuning_parameter_for_each_state", "0,0,0,0,0,0",
+                          dealii::Patterns::List(dealii::Patterns::Double(), 1, 6, ","),
                           "TVB Limiter tuning parameters for each state. Set to 0 if TVD is required.");
     }
     prm.leave_subsection();
@@ -64,8 +63,9 @@ void LimiterParam::parse_parameters (dealii::ParameterHandler &prm)
         use_tvb_limiter = prm.get_bool("use_tvb_limiter");
         max_delta_x = prm.get_double("max_delta_x");
 
-        using convert_tensor = dealii::Patterns::Tools::Convert<dealii::Tensor<1, 4, double>>;
-        tuning_parameter_for_each_state = convert_tensor::to_value(prm.get("tuning_parameter_for_each_state"));
+        const std::string tuning_parameter_string = prm.get("tuning_parameter_for_each_state");
+        std::unique_ptr<dealii::Patterns::PatternBase> ListPatternTuning(new dealii::Patterns::List(dealii::Patterns::Double(), 1, 6, ","));
+        tuning_parameter_for_each_state = dealii::Patterns::Tools::Convert<decltype(tuning_parameter_for_each_state)>::to_value(tuning_parameter_string, ListPatternTuning);
     }
     prm.leave_subsection();
 }
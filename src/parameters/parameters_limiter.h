@@ -32,8 +32,8 @@ public:
     double max_delta_x;
 
     /// Tuning parameters for TVB Limiter
-    /** TVB Limiter can only be run for 1D, so max length is max nstate = 4 **/
-    dealii::Tensor<1, 4, double> tuning_parameter_for_each_state;
+    /** One value per state, up to the maximum nstate = 6 **/
+    std::vector<double> tuning_parameter_for_each_state;
 
     /// Constructor
     LimiterParam();
@@ -29,6 +29,22 @@ void MeshAdaptationParam::declare_parameters (dealii::ParameterHandler &prm)
                           dealii::Patterns::Bool(),
                           "Flag to use goal oriented mesh adaptation. False by default.");
 
+        prm.declare_entry("fine_adjoint_type", "exact",
+                          dealii::Patterns::Selection(
+                          " exact | "
+                          " element_patch | "
+                          " smoothed_coarse "
+                          ),
+                          "Fine grid adjoint used by the dual weighted residual. "
+                          "Choices are "
+                          " <exact | "
+                          "  element_patch | "
+                          "  smoothed_coarse>.");
+
+        prm.declare_entry("fine_adjoint_smoothing_sweeps","3",
+                          dealii::Patterns::Integer(0),
+                          "Number of block-Jacobi sweeps applied to the prolongated coarse adjoint.");
+
         
         prm.enter_subsection("fixed-fraction");
         {
@@ -55,6 +71,11 @@ void MeshAdaptationParam::declare_parameters (dealii::ParameterHandler &prm)
             prm.declare_entry("norm_Lp_anisotropic_adaptation","2.0",
                               dealii::Patterns::Double(0.0,1.0e5),
                               "Lp norm w.r.t. which the optimization is performed in the continuous mesh framework.");
+
+            prm.declare_entry("use_in_process_anisotropic_remeshing","false",
+                              dealii::Patterns::Bool(),
+                              "Flag to refine/coarsen the current mesh towards the optimal metric and transfer the solution, "
+                              "instead of generating a new mesh with GMSH. False by default.");
         }
         prm.leave_subsection(); // "anisotropic"
     }
@@ -75,6 +96,12 @@ void MeshAdaptationParam::parse_parameters (dealii::ParameterHandler &prm)
         
         use_goal_oriented_mesh_adaptation = prm.get_bool("use_goal_oriented_mesh_adaptation");
 
+        const std::string fine_adjoint_string = prm.get("fine_adjoint_type");
+        if(fine_adjoint_string == "exact")                {fine_adjoint_type = FineAdjointType::exact;}
+        else if(fine_adjoint_string == "element_patch")   {fine_adjoint_type = FineAdjointType::element_patch;}
+        else if(fine_adjoint_string == "smoothed_coarse") {fine_adjoint_type = FineAdjointType::smoothed_coarse;}
+        fine_adjoint_smoothing_sweeps = prm.get_integer("fine_adjoint_smoothing_sweeps");
+
         prm.enter_subsection("fixed-fraction");
         {
             refine_fraction = prm.get_double("refine_fraction");
@@ -87,6 +114,7 @@ void MeshAdaptationParam::parse_parameters (dealii::ParameterHandler &prm)
         {
             mesh_complexity_anisotropic_adaptation = prm.get_double("mesh_complexity_anisotropic_adaptation");
             norm_Lp_anisotropic_adaptation = prm.get_double("norm_Lp_anisotropic_adaptation");
+            use_in_process_anisotropic_remeshing = prm.get_bool("use_in_process_anisotropic_remeshing");
         }
         prm.leave_subsection(); // "anisotropic"
     }
@@ -32,6 +32,18 @@ public:
     /// Flag to use goal oriented mesh adaptation
     bool use_goal_oriented_mesh_adaptation;
 
+    /// Choices for the fine grid adjoint of the dual weighted residual
+    enum FineAdjointType{
+        exact,          ///< Global solve of the p-enriched adjoint problem
+        element_patch,  ///< Local solves on the face-neighbour patch of each cell
+        smoothed_coarse ///< Prolongated coarse adjoint smoothed with block-Jacobi sweeps
+    };
+    /// Selection of the fine grid adjoint approximation
+    FineAdjointType fine_adjoint_type;
+
+    /// Number of block-Jacobi sweeps used by FineAdjointType::smoothed_coarse
+    int fine_adjoint_smoothing_sweeps;
+
     /// Tolerance to decide between h- or p-refinement
     double hp_smoothness_tolerance;
 
@@ -41,6 +53,9 @@ public:
     /// Lp norm w.r.t. which the optimization is performed in the continuous mesh framework.
     double norm_Lp_anisotropic_adaptation;
 
+    /// Flag to adapt the current mesh towards the optimal metric instead of remeshing through GMSH.
+    bool use_in_process_anisotropic_remeshing;
+
     /// Declare parameters
     static void declare_parameters (dealii::ParameterHandler &prm);
  
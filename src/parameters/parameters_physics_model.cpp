@@ -71,6 +71,11 @@ void PhysicsModelParam::declare_parameters (dealii::ParameterHandler &prm)
                               dealii::Patterns::Double(1e-15, dealii::Patterns::Double::max_double_value),
                               "Clipping limit for the Dynamic Smagorinsky model constant (default is 0.01).");
 
+            prm.declare_entry("cellwise_mean_quantities_overintegration", "10",
+                              dealii::Patterns::Integer(0, dealii::Patterns::Integer::max_int_value),
+                              "Number of extra 1D quadrature points used to integrate the cellwise mean quantities "
+                              "of the shear-improved and dynamic Smagorinsky models (default is 10).");
+
             prm.declare_entry("apply_low_reynolds_number_eddy_viscosity_correction", "false",
                               dealii::Patterns::Bool(),
                               "Flag for applying the low Reynolds number eddy viscosity correction. By default, false.");
@@ -130,6 +135,8 @@ void PhysicsModelParam::parse_parameters (dealii::ParameterHandler &prm)
             poly_degree_max_large_scales       = prm.get_integer("poly_degree_max_large_scales");
             dynamic_smagorinsky_model_constant_clipping_limit 
                                                = prm.get_double("dynamic_smagorinsky_model_constant_clipping_limit");
+            cellwise_mean_quantities_overintegration
+                                               = prm.get_integer("cellwise_mean_quantities_overintegration");
             apply_low_reynolds_number_eddy_viscosity_correction
                                                = prm.get_bool("apply_low_reynolds_number_eddy_viscosity_correction");
         }
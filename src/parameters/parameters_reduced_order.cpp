@@ -49,6 +49,11 @@ void ReducedOrderModelParam::declare_parameters (dealii::ParameterHandler &prm)
         prm.declare_entry("residual_error_bool", "false",
                           dealii::Patterns::Bool(),
                           "Use residual/reduced residual for error indicator instead of DWR. False by default.");
+        prm.declare_entry("ensemble_group_size", "0",
+                          dealii::Patterns::Integer(0, dealii::Patterns::Integer::max_int_value),
+                          "Number of processes used by each solve when several snapshots or ROM points are solved at once. "
+                          "The processes are split into groups of this size which solve different points concurrently. "
+                          "0 (default) solves the points one after another on all processes.");
     }
     prm.leave_subsection();
 }
@@ -84,6 +89,7 @@ void ReducedOrderModelParam::parse_parameters (dealii::ParameterHandler &prm)
         if (solver_string == "direct") FOM_error_linear_solver_type = LinearSolverEnum::direct;
         if (solver_string == "gmres") FOM_error_linear_solver_type = LinearSolverEnum::gmres;
         residual_error_bool = prm.get_bool("residual_error_bool");
+        ensemble_group_size = prm.get_integer("ensemble_group_size");
     }
     prm.leave_subsection();
 }
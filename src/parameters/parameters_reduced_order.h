@@ -58,6 +58,9 @@ public:
     /// Use residual/reduced residual for error indicator instead of DWR. False by default.
     bool residual_error_bool;
 
+    /// Number of processes per concurrent snapshot or ROM point solve (0 solves the points one after another on all processes)
+    int ensemble_group_size;
+
     /// Declares the possible variables and sets the defaults.
     static void declare_parameters (dealii::ParameterHandler &prm);
     /// Parses input file and sets the variables.
@@ -1,6 +1,8 @@
 #include <cmath>
 #include <vector>
+#include <type_traits>
 #include <boost/preprocessor/seq/for_each.hpp>
+#include <deal.II/base/vectorization.h>
 
 #include "ADTypes.hpp"
 
@@ -158,7 +160,16 @@ bool Euler<dim,nspecies,nstate,real>::check_positive_quantity(real2 &qty, const
 
     if (this->all_parameters->limiter_param.bound_preserving_limiter != limiter_enum::positivity_preservingZhang2010
         && this->all_parameters->limiter_param.bound_preserving_limiter != limiter_enum::positivity_preservingWang2012) {
-        if (qty < 0.0) {
+        if constexpr (std::is_same<real2,dealii::VectorizedArray<double>>::value) {
+            qty_is_positive = true;
+            for (unsigned int lane=0; lane<real2::size(); ++lane) {
+                if (qty[lane] < 0.0) {
+                    qty[lane] = this->template handle_non_physical_result<double>(qty_name + " is negative.");
+                    qty_is_positive = false;
+                }
+            }
+        }
+        else if (qty < 0.0) {
             // Refer to base class for non-physical results handling
             qty = this->template handle_non_physical_result<real2>(qty_name + " is negative.");
             qty_is_positive = false;
@@ -174,7 +185,7 @@ bool Euler<dim,nspecies,nstate,real>::check_positive_quantity(real2 &qty, const
 
 template <int dim, int nspecies, int nstate, typename real>
 template<typename real2>
-inline std::array<real2,nstate> Euler<dim,nspecies,nstate,real>
+std::array<real2,nstate> Euler<dim,nspecies,nstate,real>
 ::convert_conservative_to_primitive_templated ( const std::array<real2,nstate> &conservative_soln ) const
 {
     std::array<real2, nstate> primitive_soln;
@@ -320,7 +331,7 @@ std::array<dealii::Tensor<1,dim,real>,nstate> Euler<dim,nspecies,nstate,real>
 
 template <int dim, int nspecies, int nstate, typename real>
 template<typename real2>
-inline dealii::Tensor<1,dim,real2> Euler<dim,nspecies,nstate,real>
+dealii::Tensor<1,dim,real2> Euler<dim,nspecies,nstate,real>
 ::compute_velocities ( const std::array<real2,nstate> &conservative_soln ) const
 {
     const real2 density = conservative_soln[0];
@@ -331,7 +342,7 @@ inline dealii::Tensor<1,dim,real2> Euler<dim,nspecies,nstate,real>
 
 template <int dim, int nspecies, int nstate, typename real>
 template <typename real2>
-inline real2 Euler<dim,nspecies,nstate,real>
+real2 Euler<dim,nspecies,nstate,real>
 ::compute_velocity_squared ( const dealii::Tensor<1,dim,real2> &velocities ) const
 {
     real2 vel2 = 0.0;
@@ -344,7 +355,7 @@ inline real2 Euler<dim,nspecies,nstate,real>
 
 template <int dim, int nspecies, int nstate, typename real>
 template<typename real2>
-inline dealii::Tensor<1,dim,real2> Euler<dim,nspecies,nstate,real>
+dealii::Tensor<1,dim,real2> Euler<dim,nspecies,nstate,real>
 ::extract_velocities_from_primitive ( const std::array<real2,nstate> &primitive_soln ) const
 {
     dealii::Tensor<1,dim,real2> velocities;
@@ -448,7 +459,7 @@ inline real Euler<dim,nspecies,nstate,real>
 
 template <int dim, int nspecies, int nstate, typename real>
 template<typename real2>
-inline real2 Euler<dim,nspecies,nstate,real>
+real2 Euler<dim,nspecies,nstate,real>
 ::compute_temperature ( const std::array<real2,nstate> &primitive_soln ) const
 {
     const real2 density = primitive_soln[0];
@@ -483,7 +494,7 @@ inline real Euler<dim,nspecies,nstate,real>
 
 template <int dim, int nspecies, int nstate, typename real>
 template<typename real2>
-inline real2 Euler<dim,nspecies,nstate,real>
+real2 Euler<dim,nspecies,nstate,real>
 ::compute_pressure_templated ( const std::array<real2,nstate> &conservative_soln ) const
 {
     const real2 density = conservative_soln[0];
@@ -915,12 +926,20 @@ template <int dim, int nspecies, int nstate, typename real>
 std::array<dealii::Tensor<1,dim,real>,nstate> Euler<dim,nspecies,nstate,real>
 ::convective_flux (const std::array<real,nstate> &conservative_soln) const
 {
-    std::array<dealii::Tensor<1,dim,real>,nstate> conv_flux;
-    const real density = conservative_soln[0];
-    const real pressure = compute_pressure_templated<real>(conservative_soln);
-    const dealii::Tensor<1,dim,real> vel = compute_velocities<real>(conservative_soln);
-    const real specific_total_energy = conservative_soln[nstate-1]/conservative_soln[0];
-    const real specific_total_enthalpy = specific_total_energy + pressure/density;
+    return convective_flux_templated<real>(conservative_soln);
+}
+
+template <int dim, int nspecies, int nstate, typename real>
+template<typename real2>
+std::array<dealii::Tensor<1,dim,real2>,nstate> Euler<dim,nspecies,nstate,real>
+::convective_flux_templated (const std::array<real2,nstate> &conservative_soln) const
+{
+    std::array<dealii::Tensor<1,dim,real2>,nstate> conv_flux;
+    const real2 density = conservative_soln[0];
+    const real2 pressure = compute_pressure_templated<real2>(conservative_soln);
+    const dealii::Tensor<1,dim,real2> vel = compute_velocities<real2>(conservative_soln);
+    const real2 specific_total_energy = conservative_soln[nstate-1]/conservative_soln[0];
+    const real2 specific_total_enthalpy = specific_total_energy + pressure/density;
 
     for (int flux_dim=0; flux_dim<dim; ++flux_dim) {
         // Density equation
@@ -936,6 +955,53 @@ std::array<dealii::Tensor<1,dim,real>,nstate> Euler<dim,nspecies,nstate,real>
     return conv_flux;
 }
 
+template <int dim, int nspecies, int nstate, typename real>
+void Euler<dim,nspecies,nstate,real>
+::convective_flux_batch (
+    const std::array<std::vector<real>,nstate> &conservative_soln,
+    std::array<dealii::Tensor<1,dim,std::vector<real>>,nstate> &conv_flux) const
+{
+    const unsigned int n_points = conservative_soln[0].size();
+    for (int s=0; s<nstate; ++s) {
+        for (int flux_dim=0; flux_dim<dim; ++flux_dim) {
+            conv_flux[s][flux_dim].resize(n_points);
+        }
+    }
+
+    unsigned int n_packed_points = 0;
+    if constexpr (std::is_same<real,double>::value) {
+        using VectorizedReal = dealii::VectorizedArray<double>;
+        constexpr unsigned int n_lanes = VectorizedReal::size();
+        n_packed_points = n_points - n_points%n_lanes;
+        for (unsigned int ipoint=0; ipoint<n_packed_points; ipoint+=n_lanes) {
+            std::array<VectorizedReal,nstate> soln;
+            for (int s=0; s<nstate; ++s) {
+                soln[s].load(&conservative_soln[s][ipoint]);
+            }
+            const std::array<dealii::Tensor<1,dim,VectorizedReal>,nstate> conv_flux_pack = convective_flux_templated<VectorizedReal>(soln);
+            for (int s=0; s<nstate; ++s) {
+                for (int flux_dim=0; flux_dim<dim; ++flux_dim) {
+                    conv_flux_pack[s][flux_dim].store(&conv_flux[s][flux_dim][ipoint]);
+                }
+            }
+        }
+    }
+
+    // Points left over after the last full pack
+    for (unsigned int ipoint=n_packed_points; ipoint<n_points; ++ipoint) {
+        std::array<real,nstate> soln;
+        for (int s=0; s<nstate; ++s) {
+            soln[s] = conservative_soln[s][ipoint];
+        }
+        const std::array<dealii::Tensor<1,dim,real>,nstate> conv_flux_at_point = convective_flux_templated<real>(soln);
+        for (int s=0; s<nstate; ++s) {
+            for (int flux_dim=0; flux_dim<dim; ++flux_dim) {
+                conv_flux[s][flux_dim][ipoint] = conv_flux_at_point[s][flux_dim];
+            }
+        }
+    }
+}
+
 template <int dim, int nspecies, int nstate, typename real>
 std::array<real,nstate> Euler<dim,nspecies,nstate,real>
 ::convective_normal_flux (const std::array<real,nstate> &conservative_soln, const dealii::Tensor<1,dim,real> &normal) const
@@ -1709,6 +1775,18 @@ dealii::UpdateFlags Euler<dim,nspecies,nstate,real>
         template dealii::Tensor<1,PHILIP_DIM, FadType > Euler < PHILIP_DIM, PHILIP_SPECIES, PHILIP_DIM+2, type >::extract_velocities_from_primitive< FadType >(const std::array<FadType, PHILIP_DIM+2> &primitive_soln) const; \
         template dealii::Tensor<1,PHILIP_DIM, FadType > Euler < PHILIP_DIM, PHILIP_SPECIES, PHILIP_DIM+2, type >::compute_velocities< FadType >(const std::array<FadType, PHILIP_DIM+2> &conservative_soln) const;
     BOOST_PP_SEQ_FOR_EACH(INSTANTIATE_FADTYPES, _, POSSIBLE_TYPES)
+// -- -- instantiate real = double with real2 = VectorizedArray<double> for the packed points of NavierStokes::dissipative_flux_batch()
+    #define INSTANTIATE_VECTORIZEDTYPE(type) \
+        template std::array<dealii::Tensor<1,PHILIP_DIM,type>,PHILIP_DIM+2> Euler<PHILIP_DIM,PHILIP_SPECIES,PHILIP_DIM+2,double>::convert_conservative_gradient_to_primitive_gradient_templated<type>(const std::array<type,PHILIP_DIM+2> &conservative_soln, const std::array<dealii::Tensor<1,PHILIP_DIM,type>,PHILIP_DIM+2> &conservative_soln_gradient) const;\
+        template std::array<type, PHILIP_DIM+2> Euler < PHILIP_DIM, PHILIP_SPECIES, PHILIP_DIM+2, double>::convert_conservative_to_primitive_templated< type >(const std::array<type, PHILIP_DIM+2> &conservative_soln) const; \
+        template bool Euler < PHILIP_DIM, PHILIP_SPECIES, PHILIP_DIM+2, double >::check_positive_quantity< type >(type &qty, const std::string qty_name) const; \
+        template type Euler < PHILIP_DIM, PHILIP_SPECIES, PHILIP_DIM+2, double >::compute_pressure_templated< type >(const std::array<type, PHILIP_DIM+2> &conservative_soln) const; \
+        template type Euler < PHILIP_DIM, PHILIP_SPECIES, PHILIP_DIM+2, double >::compute_temperature< type >(const std::array<type, PHILIP_DIM+2> &primitive_soln) const; \
+        template type Euler < PHILIP_DIM, PHILIP_SPECIES, PHILIP_DIM+2, double >::compute_velocity_squared< type >(const dealii::Tensor<1,PHILIP_DIM, type > &velocities) const; \
+        template dealii::Tensor<1,PHILIP_DIM, type > Euler < PHILIP_DIM, PHILIP_SPECIES, PHILIP_DIM+2, double >::extract_velocities_from_primitive< type >(const std::array<type, PHILIP_DIM+2> &primitive_soln) const; \
+        template dealii::Tensor<1,PHILIP_DIM, type > Euler < PHILIP_DIM, PHILIP_SPECIES, PHILIP_DIM+2, double >::compute_velocities< type >(const std::array<type, PHILIP_DIM+2> &conservative_soln) const;
+    INSTANTIATE_VECTORIZEDTYPE(dealii::VectorizedArray<double>)
+    #undef INSTANTIATE_VECTORIZEDTYPE
 //==============================================================================
 
 #endif
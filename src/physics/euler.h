@@ -2,6 +2,7 @@
 #define __EULER__
 
 #include <deal.II/base/tensor.h>
+#include <vector>
 #include "physics.h"
 #include "parameters/all_parameters.h"
 #include "parameters/parameters_manufactured_solution.h"
@@ -145,6 +146,20 @@ public:
     std::array<dealii::Tensor<1,dim,real>,nstate> convective_flux (
         const std::array<real,nstate> &conservative_soln) const override;
 
+    /// Convective flux templated on the type of the solution, shared by convective_flux() and convective_flux_batch()
+    template<typename real2>
+    std::array<dealii::Tensor<1,dim,real2>,nstate> convective_flux_templated (
+        const std::array<real2,nstate> &conservative_soln) const;
+
+    /// Convective flux at a batch of points stored as structure-of-arrays: \f$ \mathbf{F}_{conv} \f$
+    /** When real is double, the points are processed in packs of dealii::VectorizedArray<double>
+     *  through convective_flux_templated(). The points left over after the last full pack go through
+     *  convective_flux(). The output vectors are resized.
+     */
+    void convective_flux_batch (
+        const std::array<std::vector<real>,nstate> &conservative_soln,
+        std::array<dealii::Tensor<1,dim,std::vector<real>>,nstate> &conv_flux) const;
+
     /// Convective normal flux: \f$ \mathbf{F}_{conv} \cdot \hat{n} \f$
     std::array<real,nstate> convective_normal_flux (const std::array<real,nstate> &conservative_soln, const dealii::Tensor<1,dim,real> &normal) const;
 
@@ -200,7 +215,7 @@ public:
 
 protected:
     /// Check positive quantity and modify it according to handle_non_physical_result()
-    /** in PhysicsBase class
+    /** in PhysicsBase class. For dealii::VectorizedArray<double>, each lane is checked and handled separately.
      */
     template<typename real2>
     bool check_positive_quantity(real2 &quantity, const std::string qty_name) const;
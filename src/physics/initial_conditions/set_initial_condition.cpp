@@ -47,7 +47,7 @@ void SetInitialCondition<dim,nspecies,nstate,real>::interpolate_initial_conditio
         std::shared_ptr < PHiLiP::DGBase<dim,nspecies,real> > &dg) 
 {
     dealii::LinearAlgebra::distributed::Vector<double> solution_no_ghost;
-    solution_no_ghost.reinit(dg->locally_owned_dofs, MPI_COMM_WORLD);
+    solution_no_ghost.reinit(dg->locally_owned_dofs, dg->mpi_communicator);
     dealii::VectorTools::interpolate(dg->dof_handler,*initial_condition_function,solution_no_ghost);
     dg->solution = solution_no_ghost;
     // Limit the solution so the interpolation doesn't return nonphysical values
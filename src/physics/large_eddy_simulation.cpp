@@ -296,8 +296,21 @@ double LargeEddySimulationBase<dim,nspecies,nstate,real>
      *  high-order multiscale DG approach to LES at increasing Reynolds number."
      *  Computers and Fluids 194 (2019), Page 4, Eq.(14).
      * */
-    const int cell_poly_degree = this->cellwise_poly_degree[cell_index];
-    return get_filter_width_from_poly_degree(cell_index,cell_poly_degree);
+    return this->cellwise_filter_width[cell_index];
+}
+//----------------------------------------------------------------
+template <int dim, int nspecies, int nstate, typename real>
+void LargeEddySimulationBase<dim,nspecies,nstate,real>
+::update_cellwise_model_data ()
+{
+    // The filter width only depends on the cell volume and polynomial degree,
+    // so it is computed once per mesh/polynomial degree distribution instead of at every quadrature node
+    const unsigned int n_cells = this->cellwise_volume.size();
+    this->cellwise_filter_width.reinit(n_cells);
+    for (unsigned int cell_index=0; cell_index<n_cells; ++cell_index) {
+        const int cell_poly_degree = this->cellwise_poly_degree[cell_index];
+        this->cellwise_filter_width[cell_index] = get_filter_width_from_poly_degree(cell_index,cell_poly_degree);
+    }
 }
 //----------------------------------------------------------------
 template <int dim, int nspecies, int nstate, typename real>
@@ -589,8 +602,21 @@ double LargeEddySimulation_Smagorinsky<dim,nspecies,nstate,real>
     const dealii::types::global_dof_index cell_index) const
 {
     // Product of the model constant (Cs) and the filter width (delta) all squared
-    const double model_constant_times_filter_width = get_model_constant_times_filter_width(cell_index);
-    return model_constant_times_filter_width*model_constant_times_filter_width;
+    return this->cellwise_model_constant_times_filter_width_sqr[cell_index];
+}
+//----------------------------------------------------------------
+template <int dim, int nspecies, int nstate, typename real>
+void LargeEddySimulation_Smagorinsky<dim,nspecies,nstate,real>
+::update_cellwise_model_data ()
+{
+    LargeEddySimulationBase<dim,nspecies,nstate,real>::update_cellwise_model_data();
+
+    const unsigned int n_cells = this->cellwise_filter_width.size();
+    this->cellwise_model_constant_times_filter_width_sqr.reinit(n_cells);
+    for (unsigned int cell_index=0; cell_index<n_cells; ++cell_index) {
+        const double model_constant_times_filter_width = get_model_constant_times_filter_width(cell_index);
+        this->cellwise_model_constant_times_filter_width_sqr[cell_index] = model_constant_times_filter_width*model_constant_times_filter_width;
+    }
 }
 //----------------------------------------------------------------
 template <int dim, int nspecies, int nstate, typename real>
@@ -95,9 +95,13 @@ public:
         const std::array<dealii::Tensor<1,dim,real>,nstate> &solution_gradient,
         const dealii::types::global_dof_index cell_index) const override;
 
-    /// Compute the nondimensionalized filter width used by the SGS model given a cell index
+    /// Returns the nondimensionalized filter width used by the SGS model given a cell index
+    /** Reads the value stored by update_cellwise_model_data(). */
     double get_filter_width (const dealii::types::global_dof_index cell_index) const;
 
+    /// Updates the cellwise filter width from the cellwise volume and polynomial degree
+    void update_cellwise_model_data() override;
+
     /// Compute the nondimensionalized filter width used by the SGS model given a cell index
     double get_filter_width_from_poly_degree (
         const dealii::types::global_dof_index cell_index,
@@ -229,8 +233,12 @@ public:
     virtual double get_model_constant_times_filter_width (const dealii::types::global_dof_index cell_index) const;
 
     /// Returns the product of the eddy viscosity model constant and the filter width squared
+    /** Reads the value stored by update_cellwise_model_data(). */
     virtual double get_model_constant_times_filter_width_squared (const dealii::types::global_dof_index cell_index) const;
 
+    /// Updates the cellwise filter width and the model constant times filter width squared
+    void update_cellwise_model_data() override;
+
     /// Corrected eddy viscosity for low Reynolds number flows
     real get_corrected_eddy_viscosity_low_reynolds_number(
         const real uncorrected_eddy_viscosity) const;
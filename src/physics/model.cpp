@@ -35,6 +35,13 @@ std::array<real,nstate> ModelBase<dim, nspecies, nstate, real>
 //----------------------------------------------------------------
 template <int dim, int nspecies, int nstate, typename real>
 void ModelBase<dim,nspecies,nstate,real>
+::update_cellwise_model_data()
+{
+    // do nothing
+}
+//----------------------------------------------------------------
+template <int dim, int nspecies, int nstate, typename real>
+void ModelBase<dim,nspecies,nstate,real>
 ::set_unfiltered_conservative_solution(const std::array<real,nstate> &unfiltered_conservative_solution_)
 {
     for(int s=0; s<nstate; ++s){
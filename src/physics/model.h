@@ -131,6 +131,18 @@ public:
      *  used for dynamic Smagorinsky eddy viscosity model */
     dealii::LinearAlgebra::distributed::Vector<double> dynamic_smagorinsky_model_constant_times_filter_width_sqr;
 
+    /** Cellwise LES filter width;
+     *  built by update_cellwise_model_data() from cellwise_volume and cellwise_poly_degree */
+    dealii::LinearAlgebra::distributed::Vector<double> cellwise_filter_width;
+    /** Cellwise eddy viscosity model constant times filter width squared;
+     *  built by update_cellwise_model_data() for constant coefficient eddy viscosity models */
+    dealii::LinearAlgebra::distributed::Vector<double> cellwise_model_constant_times_filter_width_sqr;
+
+    /// Updates the cellwise model data that only depend on the mesh and polynomial degree distribution
+    /** Called by DG after cellwise_volume and cellwise_poly_degree have been updated.
+     *  The implementation in this Model base class does nothing. */
+    virtual void update_cellwise_model_data();
+
     /// Setter for the unfiltered conservative solution
     virtual void set_unfiltered_conservative_solution(const std::array<real,nstate> &unfiltered_conservative_solution_);
 
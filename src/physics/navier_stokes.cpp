@@ -1,7 +1,9 @@
 #include <cmath>
 #include <vector>
 #include <complex> // for the jacobian
+#include <type_traits>
 #include <boost/preprocessor/seq/for_each.hpp>
+#include <deal.II/base/vectorization.h>
 #include <deal.II/lac/identity_matrix.h>
 
 #include "ADTypes.hpp"
@@ -299,6 +301,7 @@ inline real2 NavierStokes<dim,nspecies,nstate,real>
      * * Reference: Sutherland, W. (1893), "The viscosity of gases and molecular force", Philosophical Magazine, S. 5, 36, pp. 507-531 (1893)
      * * Values: https://www.cfd-online.com/Wiki/Sutherland%27s_law
      */
+    using std::pow; // for dealii::VectorizedArray, whose pow is declared in namespace std
     const real2 viscosity_coefficient = ((1.0 + temperature_ratio)/(temperature + temperature_ratio))*pow(temperature,1.5);
     
     return viscosity_coefficient;
@@ -761,13 +764,9 @@ dealii::Tensor<2,dim,real2> NavierStokes<dim,nspecies,nstate,real>
      */
 
     // Divergence of velocity
-    // -- Initialize
-    real2 vel_divergence; // complex initializes it as 0+0i
-    if(std::is_same<real2,real>::value){ 
-        vel_divergence = 0.0;
-    }
     // -- Obtain from trace of strain rate tensor
-    for (int d=0; d<dim; d++) {
+    real2 vel_divergence = strain_rate_tensor[0][0];
+    for (int d=1; d<dim; d++) {
         vel_divergence += strain_rate_tensor[d][d];
     }
 
@@ -878,6 +877,62 @@ std::array<dealii::Tensor<1,dim,real>,nstate> NavierStokes<dim,nspecies,nstate,r
     return viscous_flux;
 }
 
+template <int dim, int nspecies, int nstate, typename real>
+void NavierStokes<dim,nspecies,nstate,real>
+::dissipative_flux_batch (
+    const std::array<std::vector<real>,nstate> &conservative_soln,
+    const std::array<dealii::Tensor<1,dim,std::vector<real>>,nstate> &solution_gradient,
+    std::array<dealii::Tensor<1,dim,std::vector<real>>,nstate> &viscous_flux) const
+{
+    const unsigned int n_points = conservative_soln[0].size();
+    for (int s=0; s<nstate; ++s) {
+        for (int flux_dim=0; flux_dim<dim; ++flux_dim) {
+            viscous_flux[s][flux_dim].resize(n_points);
+        }
+    }
+
+    unsigned int n_packed_points = 0;
+    if constexpr (std::is_same<real,double>::value) {
+        using VectorizedReal = dealii::VectorizedArray<double>;
+        constexpr unsigned int n_lanes = VectorizedReal::size();
+        n_packed_points = n_points - n_points%n_lanes;
+        for (unsigned int ipoint=0; ipoint<n_packed_points; ipoint+=n_lanes) {
+            std::array<VectorizedReal,nstate> soln;
+            std::array<dealii::Tensor<1,dim,VectorizedReal>,nstate> soln_gradient;
+            for (int s=0; s<nstate; ++s) {
+                soln[s].load(&conservative_soln[s][ipoint]);
+                for (int d=0; d<dim; ++d) {
+                    soln_gradient[s][d].load(&solution_gradient[s][d][ipoint]);
+                }
+            }
+            const std::array<dealii::Tensor<1,dim,VectorizedReal>,nstate> viscous_flux_pack = dissipative_flux_templated<VectorizedReal>(soln, soln_gradient);
+            for (int s=0; s<nstate; ++s) {
+                for (int flux_dim=0; flux_dim<dim; ++flux_dim) {
+                    viscous_flux_pack[s][flux_dim].store(&viscous_flux[s][flux_dim][ipoint]);
+                }
+            }
+        }
+    }
+
+    // Points left over after the last full pack
+    for (unsigned int ipoint=n_packed_points; ipoint<n_points; ++ipoint) {
+        std::array<real,nstate> soln;
+        std::array<dealii::Tensor<1,dim,real>,nstate> soln_gradient;
+        for (int s=0; s<nstate; ++s) {
+            soln[s] = conservative_soln[s][ipoint];
+            for (int d=0; d<dim; ++d) {
+                soln_gradient[s][d] = solution_gradient[s][d][ipoint];
+            }
+        }
+        const std::array<dealii::Tensor<1,dim,real>,nstate> viscous_flux_at_point = dissipative_flux_templated<real>(soln, soln_gradient);
+        for (int s=0; s<nstate; ++s) {
+            for (int flux_dim=0; flux_dim<dim; ++flux_dim) {
+                viscous_flux[s][flux_dim][ipoint] = viscous_flux_at_point[s][flux_dim];
+            }
+        }
+    }
+}
+
 template <int dim, int nspecies, int nstate, typename real>
 dealii::Tensor<1,dim,real> NavierStokes<dim,nspecies,nstate,real>
 ::compute_scaled_viscosity_gradient (
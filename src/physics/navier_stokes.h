@@ -390,6 +390,16 @@ public:
         const std::array<real,nstate> &conservative_soln,
         const std::array<dealii::Tensor<1,dim,real>,nstate> &solution_gradient) const override;
 
+    /// Dissipative flux at a batch of points stored as structure-of-arrays
+    /** Packed counterpart of dissipative_flux() following Euler::convective_flux_batch():
+     *  packs of dealii::VectorizedArray<double> go through dissipative_flux_templated() when
+     *  real is double, as do the left-over points with real. The output vectors are resized.
+     */
+    void dissipative_flux_batch (
+        const std::array<std::vector<real>,nstate> &conservative_soln,
+        const std::array<dealii::Tensor<1,dim,std::vector<real>>,nstate> &solution_gradient,
+        std::array<dealii::Tensor<1,dim,std::vector<real>>,nstate> &viscous_flux) const;
+
     /** Gradient of the scaled nondimensionalized viscosity coefficient
      *  Reference: Masatsuka 2018 "I do like CFD", p.148, eq.(4.14.14 and 4.14.17)
      */
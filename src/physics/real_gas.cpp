@@ -1,6 +1,8 @@
+#include <algorithm>
 #include <cmath>
 #include <vector>
 #include <fstream>
+#include <limits>
 
 #include "ADTypes.hpp"
 
@@ -37,7 +39,40 @@ RealGas<dim,nspecies,nstate,real>::RealGas (
         std::abort(); 
     }
     readspeciesdata(parameters_input->chemistry_input_file);
+
+    // no temperature has been computed yet
+    cached_temperature_state.fill(std::numeric_limits<double>::quiet_NaN());
+    cached_temperature = -1.0;
+
+    use_thermodynamic_table = false;
+    n_table_intervals = 0;
+    if(parameters_input->thermodynamic_table_tolerance > 0.0) {
+        build_thermodynamic_table(parameters_input->thermodynamic_table_tolerance);
+    }
+}
+
+namespace {
+//----------------------------------------------------------------
+// Returns the value from a CoDiPack or Sacado variable.
+template<typename real>
+double getValue(const real &x) {
+    if constexpr(std::is_same<real,double>::value) {
+        return x;
+    }
+    else if constexpr(std::is_same<real,FadType>::value) {
+        return x.val(); // sacado
+    }
+    else if constexpr(std::is_same<real,FadFadType>::value) {
+        return x.val().val(); // sacado
+    }
+    else if constexpr(std::is_same<real,RadType>::value) {
+        return x.value(); // CoDiPack
+    }
+    else {
+        return x.value().value(); // CoDiPack
+    }
 }
+} // anonymous namespace
 
 // Read chemistry file
 template <int dim, int nspecies, int nstate, typename real>
@@ -523,6 +558,9 @@ std::array<real,nspecies> RealGas<dim,nspecies,nstate,real>
         std::cout<<"Cp Calculation Error: Temperature passed in is negative... Temperature = " << dimensional_temperature << "...Aborting." << std::endl;
         std::abort();
     }
+    if (is_in_thermodynamic_table(dimensional_temperature)) {
+        return compute_tabulated_species_specific_Cp(dimensional_temperature);
+    }
     std::array<int,nspecies> species_tempindex = GetNASACAP_TemperatureIndex(dimensional_temperature);
     // species loop
     for (int s=0; s<nspecies; ++s) 
@@ -578,6 +616,9 @@ std::array<real,nspecies> RealGas<dim,nspecies,nstate,real>
         std::cout<<"Enthalpy Calculation Error: Temperature passed in is negative... Temperature = " << dimensional_temperature << "...Aborting." << std::endl;
         std::abort();
     }
+    if (is_in_thermodynamic_table(dimensional_temperature)) {
+        return compute_tabulated_species_specific_enthalpy(dimensional_temperature);
+    }
     std::array<int,nspecies> species_tempindex = GetNASACAP_TemperatureIndex(dimensional_temperature);
     /// species loop
     for (int s=0; s<nspecies; ++s) 
@@ -643,6 +684,192 @@ std::array<real,nspecies> RealGas<dim,nspecies,nstate,real>
     return e;
 }
 
+// Tabulation of the species thermodynamic properties
+template <int dim, int nspecies, int nstate, typename real>
+void RealGas<dim,nspecies,nstate,real>
+::build_thermodynamic_table ( const double tolerance )
+{
+    // the NASA polynomials are evaluated directly while the table is built
+    use_thermodynamic_table = false;
+
+    // temperature range covered by the polynomials of all species, split where any species changes polynomial
+    double table_temperature_min = NASACAPTemperatureLimits[0][0];
+    double table_temperature_max = NASACAPTemperatureLimits[0][3];
+    for (int s=1; s<nspecies; ++s) {
+        table_temperature_min = std::max(table_temperature_min, NASACAPTemperatureLimits[s][0]);
+        table_temperature_max = std::min(table_temperature_max, NASACAPTemperatureLimits[s][3]);
+    }
+    table_temperature_bounds = {table_temperature_min, table_temperature_max};
+    for (int s=0; s<nspecies; ++s) {
+        for (int j=1; j<3; ++j) {
+            const double bound = NASACAPTemperatureLimits[s][j];
+            if (bound > table_temperature_min && bound < table_temperature_max) table_temperature_bounds.push_back(bound);
+        }
+    }
+    std::sort(table_temperature_bounds.begin(), table_temperature_bounds.end());
+    table_temperature_bounds.erase(std::unique(table_temperature_bounds.begin(), table_temperature_bounds.end()), table_temperature_bounds.end());
+    const int n_segments = table_temperature_bounds.size() - 1;
+
+    const auto compute_direct_enthalpy = [&](const double dimensional_temperature) {
+        const std::array<real,nspecies> h = compute_species_specific_enthalpy(dimensional_temperature/this->temperature_ref);
+        std::array<double,nspecies> h_value;
+        for (int s=0; s<nspecies; ++s) h_value[s] = getValue<real>(h[s]);
+        return h_value;
+    };
+    const auto compute_direct_Cp = [&](const double dimensional_temperature) {
+        const std::array<real,nspecies> Cp = compute_species_specific_Cp(dimensional_temperature/this->temperature_ref);
+        std::array<double,nspecies> Cp_value;
+        for (int s=0; s<nspecies; ++s) Cp_value[s] = getValue<real>(Cp[s]);
+        return Cp_value;
+    };
+
+    // derivative of the nondimensional enthalpy with respect to the dimensional temperature per unit nondimensional Cp
+    const double enthalpy_slope_per_Cp = this->R_ref/this->u_ref_sqr;
+    const int max_table_intervals = 1 << 16;
+    double max_error = 0.0;
+    for (n_table_intervals = 16; n_table_intervals <= max_table_intervals; n_table_intervals *= 2) {
+        const int n_nodes = n_segments*(n_table_intervals+1);
+        table_enthalpy.resize(n_nodes*nspecies);
+        table_enthalpy_slope.resize(n_nodes*nspecies);
+
+        std::array<double,nspecies> enthalpy_scale;
+        std::array<double,nspecies> Cp_scale;
+        enthalpy_scale.fill(0.0);
+        Cp_scale.fill(0.0);
+        for (int segment=0; segment<n_segments; ++segment) {
+            const double spacing = (table_temperature_bounds[segment+1] - table_temperature_bounds[segment])/n_table_intervals;
+            for (int i=0; i<=n_table_intervals; ++i) {
+                double dimensional_temperature = table_temperature_bounds[segment] + i*spacing;
+                // the last node of a segment takes the values of the polynomial below the bound
+                if (i == n_table_intervals && segment < n_segments-1) {
+                    dimensional_temperature = std::nextafter(table_temperature_bounds[segment+1], table_temperature_min);
+                }
+                const std::array<double,nspecies> h = compute_direct_enthalpy(dimensional_temperature);
+                const std::array<double,nspecies> Cp = compute_direct_Cp(dimensional_temperature);
+                const int node = segment*(n_table_intervals+1) + i;
+                for (int s=0; s<nspecies; ++s) {
+                    table_enthalpy[node*nspecies+s] = h[s];
+                    table_enthalpy_slope[node*nspecies+s] = Cp[s]*enthalpy_slope_per_Cp*spacing;
+                    enthalpy_scale[s] = std::max(enthalpy_scale[s], std::abs(h[s]));
+                    Cp_scale[s] = std::max(Cp_scale[s], std::abs(Cp[s]));
+                }
+            }
+        }
+
+        // relative interpolation error between the nodes, where it is the largest
+        max_error = 0.0;
+        for (int segment=0; segment<n_segments; ++segment) {
+            const double spacing = (table_temperature_bounds[segment+1] - table_temperature_bounds[segment])/n_table_intervals;
+            for (int i=0; i<n_table_intervals; ++i) {
+                for (const double t : {0.25, 0.5, 0.75}) {
+                    const double dimensional_temperature = table_temperature_bounds[segment] + (i+t)*spacing;
+                    const std::array<double,nspecies> h = compute_direct_enthalpy(dimensional_temperature);
+                    const std::array<double,nspecies> Cp = compute_direct_Cp(dimensional_temperature);
+                    const std::array<real,nspecies> h_table = compute_tabulated_species_specific_enthalpy(dimensional_temperature);
+                    const std::array<real,nspecies> Cp_table = compute_tabulated_species_specific_Cp(dimensional_temperature);
+                    for (int s=0; s<nspecies; ++s) {
+                        max_error = std::max(max_error, std::abs(getValue<real>(h_table[s]) - h[s])/enthalpy_scale[s]);
+                        max_error = std::max(max_error, std::abs(getValue<real>(Cp_table[s]) - Cp[s])/Cp_scale[s]);
+                    }
+                }
+            }
+        }
+        if (max_error <= tolerance) break;
+    }
+
+    use_thermodynamic_table = (max_error <= tolerance);
+    if (use_thermodynamic_table) {
+        this->pcout << "Tabulated species thermodynamic properties with " << n_table_intervals << " intervals per segment in "
+                    << n_segments << " segments between " << table_temperature_min << " K and " << table_temperature_max
+                    << " K. Maximum relative error: " << max_error << std::endl;
+    } else {
+        this->pcout << "Thermodynamic table tolerance of " << tolerance << " not reached with " << max_table_intervals
+                    << " intervals per segment. Maximum relative error: " << max_error << ". Evaluating the NASA polynomials directly." << std::endl;
+    }
+}
+
+template <int dim, int nspecies, int nstate, typename real>
+inline bool RealGas<dim,nspecies,nstate,real>
+::is_in_thermodynamic_table ( const real dimensional_temperature ) const
+{
+    return use_thermodynamic_table
+           && dimensional_temperature >= table_temperature_bounds.front()
+           && dimensional_temperature <= table_temperature_bounds.back();
+}
+
+template <int dim, int nspecies, int nstate, typename real>
+inline int RealGas<dim,nspecies,nstate,real>
+::locate_in_thermodynamic_table ( const real dimensional_temperature, real &local_coordinate, double &spacing ) const
+{
+    // a temperature on a bound belongs to the polynomial above it, as in GetNASACAP_TemperatureIndex
+    const int n_segments = table_temperature_bounds.size() - 1;
+    int segment = 0;
+    while (segment < n_segments-1 && dimensional_temperature >= table_temperature_bounds[segment+1]) ++segment;
+
+    spacing = (table_temperature_bounds[segment+1] - table_temperature_bounds[segment])/n_table_intervals;
+    const real x = (dimensional_temperature - table_temperature_bounds[segment])/spacing;
+    const int i = std::min(std::max(static_cast<int>(getValue<real>(x)), 0), n_table_intervals-1);
+    local_coordinate = x - static_cast<double>(i);
+
+    return segment*(n_table_intervals+1) + i;
+}
+
+template <int dim, int nspecies, int nstate, typename real>
+std::array<real,nspecies> RealGas<dim,nspecies,nstate,real>
+::compute_tabulated_species_specific_enthalpy ( const real dimensional_temperature ) const
+{
+    real t;
+    double spacing;
+    const int node = locate_in_thermodynamic_table(dimensional_temperature, t, spacing);
+
+    // cubic Hermite basis
+    const real t2 = t*t;
+    const real t3 = t2*t;
+    const real h00 = 2.0*t3 - 3.0*t2 + 1.0;
+    const real h10 = t3 - 2.0*t2 + t;
+    const real h01 = -2.0*t3 + 3.0*t2;
+    const real h11 = t3 - t2;
+
+    const double *enthalpy_left = &table_enthalpy[node*nspecies];
+    const double *enthalpy_right = enthalpy_left + nspecies;
+    const double *slope_left = &table_enthalpy_slope[node*nspecies];
+    const double *slope_right = slope_left + nspecies;
+
+    std::array<real,nspecies> h;
+    for (int s=0; s<nspecies; ++s) {
+        h[s] = h00*enthalpy_left[s] + h10*slope_left[s] + h01*enthalpy_right[s] + h11*slope_right[s];
+    }
+    return h; // nondimensional mass value
+}
+
+template <int dim, int nspecies, int nstate, typename real>
+std::array<real,nspecies> RealGas<dim,nspecies,nstate,real>
+::compute_tabulated_species_specific_Cp ( const real dimensional_temperature ) const
+{
+    real t;
+    double spacing;
+    const int node = locate_in_thermodynamic_table(dimensional_temperature, t, spacing);
+
+    // derivative of the cubic Hermite basis, such that Cp is consistent with the tabulated enthalpy
+    const real t2 = t*t;
+    const real d00 = 6.0*t2 - 6.0*t;
+    const real d10 = 3.0*t2 - 4.0*t + 1.0;
+    const real d01 = -6.0*t2 + 6.0*t;
+    const real d11 = 3.0*t2 - 2.0*t;
+
+    const double *enthalpy_left = &table_enthalpy[node*nspecies];
+    const double *enthalpy_right = enthalpy_left + nspecies;
+    const double *slope_left = &table_enthalpy_slope[node*nspecies];
+    const double *slope_right = slope_left + nspecies;
+
+    const double Cp_per_enthalpy_slope = this->u_ref_sqr/(this->R_ref*spacing);
+    std::array<real,nspecies> Cp;
+    for (int s=0; s<nspecies; ++s) {
+        Cp[s] = (d00*enthalpy_left[s] + d10*slope_left[s] + d01*enthalpy_right[s] + d11*slope_right[s])*Cp_per_enthalpy_slope;
+    }
+    return Cp; // nondimensional mass value
+}
+
 // Algorithm 15 (f_M15): Compute temperature
 template <int dim, int nspecies, int nstate, typename real>
 inline real RealGas<dim,nspecies,nstate,real>
@@ -653,59 +880,70 @@ inline real RealGas<dim,nspecies,nstate,real>
     const real specific_kinetic_energy= compute_specific_kinetic_energy(conservative_soln);
     const real mixture_gas_constant = compute_mixture_gas_constant(conservative_soln);
     const real mixture_specific_total_energy = compute_mixture_specific_total_energy(conservative_soln);
-
-    std::array<real,nspecies> species_specific_enthalpy;
-    real mixture_specific_internal_energy;
-    real mixture_specific_enthalpy;
-
-    real f;
-    std::array<real,nspecies> Cv;
-    real mixture_Cv;
-    real f_d; // f'
-    real T_npo; // T_(n+1)
-    real err = 999.9;
-    int itr = 0;
+    // mixture specific internal energy: e = E - k
+    const real mixture_specific_internal_energy = (mixture_specific_total_energy - specific_kinetic_energy)*this->u_ref_sqr; // dimensional value
+
+    /* reuse the temperature of the previous call if the state has not changed,
+       e.g. for the pressure, speed of sound and fluxes evaluated at the same point */
+    std::array<double,nstate> state_values;
+    for (int s=0; s<nstate; ++s) {
+        state_values[s] = getValue<real>(conservative_soln[s]);
+    }
+    if (state_values == cached_temperature_state) {
+        // Newton updates from the converged value recover the derivatives of the AD types, one update per derivative order
+        constexpr int n_derivative_order = std::is_same<real,double>::value ? 0
+                                           : (std::is_same<real,FadType>::value || std::is_same<real,RadType>::value) ? 1 : 2;
+        if constexpr (n_derivative_order == 0) {
+            return cached_temperature;
+        } else {
+            real T_n = cached_temperature*this->temperature_ref;
+            for (int i=0; i<n_derivative_order; ++i) {
+                T_n = compute_temperature_newton_update(T_n, mass_fractions, mixture_specific_internal_energy, mixture_gas_constant);
+            }
+            return T_n/this->temperature_ref;
+        }
+    }
 
     /* compute temperature using the Newton-Raphson method */
-    real T_n = 2.0*this->temperature_ref; // the initial guess
+    const double default_initial_guess = 2.0*this->temperature_ref;
+    // the previously computed temperature is the initial guess since neighbouring points have close states
+    double initial_guess = (cached_temperature > 0.0) ? cached_temperature*this->temperature_ref : default_initial_guess;
+    real T_n;
+    real T_npo; // T_(n+1)
+    real err;
+    int itr;
+    int max_itr;
     do
     {
-        /// 1) f(T_n)
-        // mixture specific internal energy: e = E - k
-        mixture_specific_internal_energy = (mixture_specific_total_energy - specific_kinetic_energy)*this->u_ref_sqr; // dimensional value
-        // species specific enthalpy at T_n
-        species_specific_enthalpy = compute_species_specific_enthalpy(T_n/this->temperature_ref); // nondimensional mass value
-        // mixture specific enthalpy at T_n
-        mixture_specific_enthalpy = compute_mixture_from_species(mass_fractions,species_specific_enthalpy)*this->u_ref_sqr; // dimensional value
-        // Newton-Raphson function
-        f = (mixture_specific_enthalpy - mixture_gas_constant*this->R_ref* T_n) - mixture_specific_internal_energy; // dimensional value
-
-        /// 2) f'(T_n)
-        // Cv at T_n
-        Cv = compute_species_specific_Cv(T_n/this->temperature_ref); // nondimensional mass value
-
-        // mixture Cv
-        mixture_Cv = compute_mixture_from_species(mass_fractions,Cv)*this->R_ref; // dimensional value
-
-        // Newton-Raphson derivative function
-        f_d = mixture_Cv;
-
-        /// 3) main part
-        T_npo = T_n - f/f_d; // dimensional value
-        err = abs((T_npo-T_n)/this->temperature_ref);
-        itr += 1;
-
-        // update T
-        if(itr > 9.99999e6) {
-                // output temperature values for the last 10 iterations
-                // included this output so user can determine if the tolerance is the issue
-                std::cout << "Nearing the max iterations...iteration #" << itr << " old temperature:  " << T_n 
-                            << " new temperature:  " << T_npo << std::endl;
-                std::cout << " Mixture Cv:  " << mixture_Cv << std::endl << std::endl;
+        T_n = initial_guess;
+        // a warm start that needs many iterations is abandoned for the default guess
+        max_itr = (initial_guess == default_initial_guess) ? 1e7 : 100;
+        err = 999.9;
+        itr = 0;
+        do
+        {
+            T_npo = compute_temperature_newton_update(T_n, mass_fractions, mixture_specific_internal_energy, mixture_gas_constant); // dimensional value
+            err = abs((T_npo-T_n)/this->temperature_ref);
+            itr += 1;
+
+            // update T
+            if(itr > 9.99999e6) {
+                    // output temperature values for the last 10 iterations
+                    // included this output so user can determine if the tolerance is the issue
+                    std::cout << "Nearing the max iterations...iteration #" << itr << " old temperature:  " << T_n 
+                                << " new temperature:  " << T_npo << std::endl;
+            }
+            T_n = T_npo;
         }
-        T_n = T_npo;
+        while (err>this->tol && itr < max_itr);
+
+        // restart from the default guess if the warm start did not converge to a valid temperature
+        const bool is_valid = (itr < max_itr) && (T_n > 0) && (T_n == T_n);
+        if (is_valid || initial_guess == default_initial_guess) break;
+        initial_guess = default_initial_guess;
     }
-    while (err>this->tol && itr < 1e7);
+    while (true);
+
     if(itr == 1e7) {
         std::cout << "Maximum iterations for temperature reached without converging...Aborting..." << std::endl;
         std::abort();
@@ -719,9 +957,39 @@ inline real RealGas<dim,nspecies,nstate,real>
         std::cout << "Computed temperature is NaN...Aborting..." << std::endl;
         std::abort();
     }
+
+    cached_temperature_state = state_values;
+    cached_temperature = getValue<real>(T_n);
     return T_n;
 }
 
+// Algorithm 15b: Newton-Raphson update of the dimensional temperature
+template <int dim, int nspecies, int nstate, typename real>
+inline real RealGas<dim,nspecies,nstate,real>
+::compute_temperature_newton_update (
+    const real dimensional_temperature,
+    const std::array<real,nspecies> &mass_fractions,
+    const real mixture_specific_internal_energy,
+    const real mixture_gas_constant) const
+{
+    /// 1) f(T_n)
+    // species specific enthalpy at T_n
+    const std::array<real,nspecies> species_specific_enthalpy = compute_species_specific_enthalpy(dimensional_temperature/this->temperature_ref); // nondimensional mass value
+    // mixture specific enthalpy at T_n
+    const real mixture_specific_enthalpy = compute_mixture_from_species(mass_fractions,species_specific_enthalpy)*this->u_ref_sqr; // dimensional value
+    // Newton-Raphson function
+    const real f = (mixture_specific_enthalpy - mixture_gas_constant*this->R_ref*dimensional_temperature) - mixture_specific_internal_energy; // dimensional value
+
+    /// 2) f'(T_n)
+    // Cv at T_n
+    const std::array<real,nspecies> Cv = compute_species_specific_Cv(dimensional_temperature/this->temperature_ref); // nondimensional mass value
+    // mixture Cv
+    const real mixture_Cv = compute_mixture_from_species(mass_fractions,Cv)*this->R_ref; // dimensional value
+
+    /// 3) main part
+    return dimensional_temperature - f/mixture_Cv; // dimensional value
+}
+
 // Algorithm 16 (f_M16): Compute mixture gas constant
 template <int dim, int nspecies, int nstate, typename real>
 inline real RealGas<dim,nspecies,nstate,real>
@@ -215,10 +215,37 @@ protected:
     // Algorithm 14 (f_M14): Compute species specific internal energy from temperature
     std::array<real,nspecies> compute_species_specific_internal_energy ( const real temperature ) const;
 
+    /// Tabulates the species enthalpy on a uniform temperature grid
+    /** The grid is refined until the cubic Hermite interpolant of the enthalpy, and its derivative for Cp,
+     *  match the NASA polynomials within the relative tolerance. The table covers the temperature range
+     *  shared by all species; the polynomials are evaluated directly outside of it.
+     */
+    void build_thermodynamic_table ( const double tolerance );
+
+    /// Returns true if the dimensional temperature is covered by the thermodynamic table
+    bool is_in_thermodynamic_table ( const real dimensional_temperature ) const;
+
+    /// Interpolates the species specific enthalpy from the table for all species at once
+    std::array<real,nspecies> compute_tabulated_species_specific_enthalpy ( const real dimensional_temperature ) const;
+
+    /// Interpolates the species specific heat at constant pressure from the table for all species at once
+    std::array<real,nspecies> compute_tabulated_species_specific_Cp ( const real dimensional_temperature ) const;
+
 public:
     // Algorithm 15 (f_M15): Compute temperature from conservative_soln
+    /** The Newton-Raphson solve is skipped when the state is the same as in the previous call,
+     *  and otherwise starts from the previously computed temperature.
+     */
     virtual real compute_temperature ( const std::array<real,nstate> &conservative_soln ) const;
 
+protected:
+    // Algorithm 15b: One Newton-Raphson update of the dimensional temperature from the mixture internal energy
+    real compute_temperature_newton_update (
+        const real dimensional_temperature,
+        const std::array<real,nspecies> &mass_fractions,
+        const real mixture_specific_internal_energy,
+        const real mixture_gas_constant) const;
+
 protected:
     // Algorithm 16 (f_M16): Compute mixture gas constant from conservative_soln
     real compute_mixture_gas_constant ( const std::array<real,nstate> &conservative_soln ) const;
@@ -286,6 +313,27 @@ protected:
     std::array<double,nspecies> species_weight; // Species molecular weight [kg/mol]
     std::array<double,nspecies> species_enthalpy_offset; // Species enthalpy offset - reads in [J/mol], stores nondimesnional
     std::array<real,nspecies> Rs; // Species gas constant
+
+    bool use_thermodynamic_table; ///< Flag for interpolating the species thermodynamic properties from the table
+    int n_table_intervals; ///< Number of uniform intervals in each segment of the thermodynamic table
+    /// Dimensional temperatures bounding the segments of the thermodynamic table [K]
+    /** The bounds are the edges of the polynomial temperature ranges of all species, so that no interval
+     *  of the table straddles a change of polynomial.
+     */
+    std::vector<double> table_temperature_bounds;
+    /// Species enthalpy at the table nodes, stored node by node with the species contiguous
+    std::vector<double> table_enthalpy;
+    /// Derivative of the species enthalpy with respect to the dimensional temperature times the spacing, same layout as table_enthalpy
+    std::vector<double> table_enthalpy_slope;
+
+    /// Index of the first table node of the interval containing the dimensional temperature
+    /** Also returns the local coordinate in [0,1] within the interval and the spacing of the interval. */
+    int locate_in_thermodynamic_table ( const real dimensional_temperature, real &local_coordinate, double &spacing ) const;
+
+    /// Values of the conservative state of the last temperature solve
+    mutable std::array<double,nstate> cached_temperature_state;
+    /// Temperature of the last solve, reused for the same state and as the next initial guess
+    mutable double cached_temperature;
 };
 
 } // Physics namespace
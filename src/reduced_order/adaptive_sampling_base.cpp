@@ -17,9 +17,48 @@
 #include "ROL_Bounds.hpp"
 #include "halton.h"
 #include "min_max_scaler.h"
+#include <deal.II/grid/cell_id.h>
+#include <algorithm>
+#include <map>
+#include <Epetra_MpiComm.h>
+#include <Epetra_LocalMap.h>
+#include <Epetra_Import.h>
 
 namespace PHiLiP {
 
+namespace {
+/// Concatenates the local vectors of every process of the communicator on its root (rank 0).
+template <typename T>
+std::vector<T> gather_on_root(const std::vector<T> &local_values, const MPI_Datatype datatype, const MPI_Comm communicator)
+{
+    int rank, n_procs;
+    MPI_Comm_rank(communicator, &rank);
+    MPI_Comm_size(communicator, &n_procs);
+
+    int n_local = local_values.size();
+    std::vector<int> n_per_proc(n_procs, 0);
+    MPI_Gather(&n_local, 1, MPI_INT, n_per_proc.data(), 1, MPI_INT, 0, communicator);
+
+    std::vector<int> offsets(n_procs, 0);
+    for (int i = 1; i < n_procs; ++i) offsets[i] = offsets[i-1] + n_per_proc[i-1];
+
+    std::vector<T> gathered_values;
+    if (rank == 0) gathered_values.resize(offsets[n_procs-1] + n_per_proc[n_procs-1]);
+    MPI_Gatherv(local_values.data(), n_local, datatype, gathered_values.data(), n_per_proc.data(), offsets.data(), datatype, 0, communicator);
+    return gathered_values;
+}
+
+/// Broadcasts a vector whose size is only known on the root.
+template <typename T>
+void broadcast_vector(std::vector<T> &values, const MPI_Datatype datatype, const int root, const MPI_Comm communicator)
+{
+    unsigned long n_values = values.size();
+    MPI_Bcast(&n_values, 1, MPI_UNSIGNED_LONG, root, communicator);
+    values.resize(n_values);
+    MPI_Bcast(values.data(), n_values, datatype, root, communicator);
+}
+} // anonymous namespace
+
 template<int dim, int nspecies, int nstate>
 AdaptiveSamplingBase<dim, nspecies, nstate>::AdaptiveSamplingBase(const PHiLiP::Parameters::AllParameters *const parameters_input,
                                                 const dealii::ParameterHandler &parameter_handler_input)
@@ -149,13 +188,44 @@ RowVectorXd AdaptiveSamplingBase<dim, nspecies, nstate>::getMaxErrorROM() const{
         i++;
     }
 
+    MatrixXd start_parameters(rom_locations.size(), snapshot_parameters.cols());
+    for(unsigned int k = 0 ; k < rom_locations.size() ; k++){
+        start_parameters.row(k) = rom_locations[k]->parameter;
+    }
+
+    RowVectorXd max_error_params = maximizeRBFError(parameters, errors, start_parameters);
+
+    // Check if max_error_params is a ROM point
+    for(auto it = rom_locations.begin(); it != rom_locations.end(); ++it){
+        if(max_error_params.isApprox(it->get()->parameter)){
+            this->pcout << "Max error location is approximately the same as a ROM location. Removing ROM location." << std::endl;
+            rom_locations.erase(it);
+            break;
+        }
+    }
+
+    return max_error_params;
+}
+
+template <int dim, int nspecies, int nstate>
+RowVectorXd AdaptiveSamplingBase<dim, nspecies, nstate>::maximizeRBFError(const MatrixXd& parameters, const VectorXd& errors, const MatrixXd& start_parameters) const{
     // Must scale both axes between [0,1] for the 2d rbf interpolation to work optimally
     ProperOrthogonalDecomposition::MinMaxScaler scaler;
     MatrixXd parameters_scaled = scaler.fit_transform(parameters);
 
-    // Construct radial basis function
-    std::string kernel = "thin_plate_spline";
-    ProperOrthogonalDecomposition::RBFInterpolation rbf = ProperOrthogonalDecomposition::RBFInterpolation(parameters_scaled, errors, kernel);
+    // Update the radial basis function of the previous iteration with the new points and errors.
+    // If the new points extend the parameter range, every scaled coordinate moves and the RBF is rebuilt.
+    const bool same_scaling = rbf
+                              && rbf_scaler.min.size() == scaler.min.size()
+                              && rbf_scaler.min == scaler.min
+                              && rbf_scaler.max == scaler.max;
+    if(same_scaling){
+        rbf->updateData(parameters_scaled, errors);
+    }
+    else{
+        rbf = std::make_shared<ProperOrthogonalDecomposition::RBFInterpolation>(parameters_scaled, errors, ProperOrthogonalDecomposition::RBFKernel::thin_plate_spline);
+        rbf_scaler = scaler;
+    }
 
     // Set parameters.
     ROL::ParameterList parlist;
@@ -166,17 +236,20 @@ RowVectorXd AdaptiveSamplingBase<dim, nspecies, nstate>::getMaxErrorROM() const{
     parlist.sublist("Status Test").set("Step Tolerance",1.e-14);
     parlist.sublist("Status Test").set("Iteration Limit",100);
 
-    // Find max error and parameters by minimizing function starting at each ROM location
-    RowVectorXd max_error_params(parameters.cols());
-    max_error = 0;
+    const int dimension = parameters.cols();
+    const int n_mpi = dealii::Utilities::MPI::n_mpi_processes(mpi_communicator);
 
-    for(auto it = rom_locations.begin(); it != rom_locations.end(); ++it){
+    // Find max error and parameters by minimizing function starting at each ROM location.
+    // The starts are independent and distributed round-robin over the processes.
+    double local_max_error = -1.0;
+    RowVectorXd local_max_error_params = RowVectorXd::Zero(dimension);
 
-        Eigen::RowVectorXd rom_unscaled = it->get()->parameter;
+    for(int i_start = mpi_rank ; i_start < start_parameters.rows() ; i_start += n_mpi){
+
+        Eigen::RowVectorXd rom_unscaled = start_parameters.row(i_start);
         Eigen::RowVectorXd rom_scaled = scaler.transform(rom_unscaled);
 
         //start bounds
-        int dimension = parameters.cols();
         ROL::Ptr<std::vector<double>> l_ptr = ROL::makePtr<std::vector<double>>(dimension,0.0);
         ROL::Ptr<std::vector<double>> u_ptr = ROL::makePtr<std::vector<double>>(dimension,1.0);
         ROL::Ptr<ROL::Vector<double>> lo = ROL::makePtr<ROL::StdVector<double>>(l_ptr);
@@ -196,17 +269,10 @@ RowVectorXd AdaptiveSamplingBase<dim, nspecies, nstate>::getMaxErrorROM() const{
             (*x_ptr)[j] = rom_scaled(j);
         }
 
-        this->pcout << "Unscaled parameter: " << rom_unscaled << std::endl;
-        this->pcout << "Scaled parameter: ";
-        for(int j = 0 ; j < dimension ; j++){
-            this->pcout << (*x_ptr)[j] << " ";
-        }
-        this->pcout << std::endl;
-
         ROL::StdVector<double> x(x_ptr);
 
         // Run Algorithm
-        algo.run(x, rbf, bcon,false);
+        algo.run(x, *rbf, bcon,false);
 
         ROL::Ptr<std::vector<double>> x_min = x.getVector();
 
@@ -214,37 +280,30 @@ RowVectorXd AdaptiveSamplingBase<dim, nspecies, nstate>::getMaxErrorROM() const{
             rom_scaled(j) = (*x_min)[j];
         }
 
-        RowVectorXd rom_unscaled_optim = scaler.inverse_transform(rom_scaled);
-
-        this->pcout << "Parameters of optimization convergence: " << rom_unscaled_optim << std::endl;
-
-        double error = std::abs(rbf.evaluate(rom_scaled));
-        this->pcout << "RBF error at optimization convergence: " << error << std::endl;
-        if(error > max_error){
-            this->pcout << "RBF error is greater than current max error. Updating max error." << std::endl;
-            max_error = error;
-            max_error_params = rom_unscaled_optim;
-            this->pcout << "RBF Max error: " << max_error << std::endl;
+        double error = std::abs(rbf->evaluate(rom_scaled));
+        if(error > local_max_error){
+            local_max_error = error;
+            local_max_error_params = scaler.inverse_transform(rom_scaled);
         }
     }
 
-    // Check if max_error_params is a ROM point
-    for(auto it = rom_locations.begin(); it != rom_locations.end(); ++it){
-        if(max_error_params.isApprox(it->get()->parameter)){
-            this->pcout << "Max error location is approximately the same as a ROM location. Removing ROM location." << std::endl;
-            rom_locations.erase(it);
-            break;
-        }
-    }
+    // Keep the largest error over all processes
+    struct { double value; int rank; } local_max{local_max_error, mpi_rank}, global_max;
+    MPI_Allreduce(&local_max, &global_max, 1, MPI_DOUBLE_INT, MPI_MAXLOC, mpi_communicator);
+    RowVectorXd max_error_params = local_max_error_params;
+    MPI_Bcast(max_error_params.data(), dimension, MPI_DOUBLE, global_max.rank, mpi_communicator);
+
+    max_error = std::max(global_max.value, 0.0);
+    this->pcout << "Parameters of optimization convergence: " << max_error_params << std::endl;
+    this->pcout << "RBF Max error: " << max_error << std::endl;
 
     return max_error_params;
 }
 
 template <int dim, int nspecies, int nstate>
 void AdaptiveSamplingBase<dim, nspecies, nstate>::placeInitialSnapshots() const{
-    for(auto snap_param : snapshot_parameters.rowwise()){
-        this->pcout << "Sampling initial snapshot at " << snap_param << std::endl;
-        dealii::LinearAlgebra::distributed::Vector<double> fom_solution = solveSnapshotFOM(snap_param);
+    std::vector<dealii::LinearAlgebra::distributed::Vector<double>> fom_solutions = solveSnapshotsFOM(snapshot_parameters);
+    for(auto &fom_solution : fom_solutions){
         nearest_neighbors->update_snapshots(snapshot_parameters, fom_solution);
         current_pod->addSnapshot(fom_solution);
         this->fom_locations.emplace_back(fom_solution);
@@ -253,9 +312,11 @@ void AdaptiveSamplingBase<dim, nspecies, nstate>::placeInitialSnapshots() const{
 
 template <int dim, int nspecies, int nstate>
 dealii::LinearAlgebra::distributed::Vector<double> AdaptiveSamplingBase<dim, nspecies, nstate>::solveSnapshotFOM(const RowVectorXd& parameter) const{
-    this->pcout << "Solving FOM at " << parameter << std::endl;
-    Parameters::AllParameters params = reinit_params(parameter);
+    return solveSnapshotsFOM(MatrixXd(parameter))[0];
+}
 
+template <int dim, int nspecies, int nstate>
+dealii::LinearAlgebra::distributed::Vector<double> AdaptiveSamplingBase<dim, nspecies, nstate>::solveSnapshotFOM(const Parameters::AllParameters& params) const{
     std::unique_ptr<FlowSolver::FlowSolver<dim,nspecies,nstate>> flow_solver = FlowSolver::FlowSolverFactory<dim,nspecies,nstate>::select_flow_case(&params, parameter_handler);
 
     // Solve implicit solution
@@ -264,10 +325,300 @@ dealii::LinearAlgebra::distributed::Vector<double> AdaptiveSamplingBase<dim, nsp
     flow_solver->ode_solver->allocate_ode_system();
     flow_solver->run();
 
-    this->pcout << "Done solving FOM." << std::endl;
     return flow_solver->dg->solution;
 }
 
+template <int dim, int nspecies, int nstate>
+std::vector<dealii::LinearAlgebra::distributed::Vector<double>> AdaptiveSamplingBase<dim, nspecies, nstate>::solveSnapshotsFOM(const MatrixXd& parameters) const{
+    auto solve = [this](const RowVectorXd& parameter, const Parameters::AllParameters& params){
+        this->pcout << "Solving FOM at " << parameter << std::endl;
+        PointSolution solution;
+        solution.vectors.emplace_back(solveSnapshotFOM(params));
+        this->pcout << "Done solving FOM." << std::endl;
+        return solution;
+    };
+    std::vector<PointSolution> solutions = solveOnProcessGroups(parameters, solve);
+
+    std::vector<dealii::LinearAlgebra::distributed::Vector<double>> fom_solutions;
+    for(auto &solution : solutions){
+        fom_solutions.emplace_back(std::move(solution.vectors[0]));
+    }
+    return fom_solutions;
+}
+
+template <int dim, int nspecies, int nstate>
+std::vector<typename AdaptiveSamplingBase<dim, nspecies, nstate>::ROMSolutionAndError> AdaptiveSamplingBase<dim, nspecies, nstate>::solveSnapshotsROM(const MatrixXd& parameters, const ROMSolve& rom_solve) const{
+    auto solve = [this, &rom_solve](const RowVectorXd& parameter, const Parameters::AllParameters& params){
+        std::unique_ptr<ProperOrthogonalDecomposition::ROMSolution<dim,nspecies,nstate>> rom_solution = rom_solve(parameter, params, getPODOnCommunicator(params.mpi_communicator));
+        // The error estimate solves the adjoint of the FOM, so it is computed by the solving group as well
+        const ProperOrthogonalDecomposition::ROMTestLocation<dim,nspecies,nstate> rom_location(parameter, std::move(rom_solution));
+        PointSolution solution;
+        solution.vectors.emplace_back(rom_location.rom_solution->solution);
+        solution.vectors.emplace_back(rom_location.rom_solution->gradient);
+        solution.values.emplace_back(rom_location.fom_to_initial_rom_error);
+        return solution;
+    };
+    std::vector<PointSolution> solutions = solveOnProcessGroups(parameters, solve);
+
+    std::vector<ROMSolutionAndError> rom_solutions;
+    for(int point = 0; point < parameters.rows(); ++point){
+        const DealiiVector &solution = solutions[point].vectors[0];
+        // The functional gradient has no ghost entries
+        DealiiVector gradient;
+        gradient.reinit(solution.locally_owned_elements(), mpi_communicator);
+        gradient.copy_locally_owned_data_from(solutions[point].vectors[1]);
+        rom_solutions.emplace_back(std::make_unique<ProperOrthogonalDecomposition::ROMSolution<dim,nspecies,nstate>>(reinit_params(parameters.row(point)), solution, gradient), solutions[point].values[0]);
+    }
+    return rom_solutions;
+}
+
+template <int dim, int nspecies, int nstate>
+std::vector<typename AdaptiveSamplingBase<dim, nspecies, nstate>::PointSolution> AdaptiveSamplingBase<dim, nspecies, nstate>::solveOnProcessGroups(const MatrixXd& parameters, const std::function<PointSolution(const RowVectorXd&, const Parameters::AllParameters&)>& solve) const{
+    const int n_points = parameters.rows();
+    std::vector<PointSolution> solutions(n_points);
+    const int n_mpi = dealii::Utilities::MPI::n_mpi_processes(mpi_communicator);
+    const int group_size = all_parameters->reduced_order_param.ensemble_group_size;
+
+    if(group_size <= 0 || n_mpi / group_size < 2 || n_points < 2){
+        for(int point = 0; point < n_points; ++point){
+            solutions[point] = solve(parameters.row(point), reinit_params(parameters.row(point)));
+        }
+        return solutions;
+    }
+
+    const ProcessGroups &groups = setupProcessGroups();
+    const int group_index = groups.group_of(mpi_rank);
+    const int group_rank = dealii::Utilities::MPI::this_mpi_process(groups.communicator);
+    this->pcout << "Solving at " << n_points << " points on " << groups.n_groups << " groups of processes." << std::endl;
+
+    // Shared counter of the next point to solve, stored on process 0
+    int next_point = 0;
+    MPI_Win counter_window;
+    MPI_Win_create(&next_point, (mpi_rank == 0) ? sizeof(int) : 0, sizeof(int), MPI_INFO_NULL, mpi_communicator, &counter_window);
+
+    // World rank of the root of the group that solved each point
+    std::vector<int> point_owner(n_points, -1);
+
+    while(true){
+        int point = 0;
+        if(group_rank == 0){
+            const int increment = 1;
+            MPI_Win_lock(MPI_LOCK_EXCLUSIVE, 0, 0, counter_window);
+            MPI_Fetch_and_op(&increment, &point, MPI_INT, 0, 0, MPI_SUM, counter_window);
+            MPI_Win_unlock(0, counter_window);
+        }
+        MPI_Bcast(&point, 1, MPI_INT, 0, groups.communicator);
+        if(point >= n_points) break;
+
+        if(group_rank == 0) std::cout << "Process group " << group_index << " solving at " << parameters.row(point) << std::endl;
+        Parameters::AllParameters params = reinit_params(parameters.row(point));
+        params.mpi_communicator = groups.communicator;
+        solutions[point] = solve(parameters.row(point), params);
+        if(group_rank == 0) point_owner[point] = mpi_rank;
+    }
+    MPI_Win_free(&counter_window);
+
+    MPI_Allreduce(MPI_IN_PLACE, point_owner.data(), n_points, MPI_INT, MPI_MAX, mpi_communicator);
+
+    // Each process of the solving group sends its entries to the processes owning them in the MPI_COMM_WORLD partition
+    std::vector<int> send_counts(n_mpi), send_offsets(n_mpi), recv_counts(n_mpi), recv_offsets(n_mpi);
+    for(int point = 0; point < n_points; ++point){
+        const int solving_group = groups.group_of(point_owner[point]);
+        const bool is_solving = (group_index == solving_group);
+        PointSolution &solution = solutions[point];
+
+        unsigned long n_vectors = solution.vectors.size();
+        MPI_Bcast(&n_vectors, 1, MPI_UNSIGNED_LONG, point_owner[point], mpi_communicator);
+        broadcast_vector(solution.values, MPI_DOUBLE, point_owner[point], mpi_communicator);
+
+        int n_send = 0, n_recv = 0;
+        for(int rank = 0; rank < n_mpi; ++rank){
+            send_counts[rank] = is_solving ? n_vectors * groups.send_positions[rank].size() : 0;
+            recv_counts[rank] = (groups.group_of(rank) == solving_group) ? n_vectors * groups.recv_dofs[rank].size() : 0;
+            send_offsets[rank] = n_send;
+            recv_offsets[rank] = n_recv;
+            n_send += send_counts[rank];
+            n_recv += recv_counts[rank];
+        }
+
+        std::vector<double> send_values;
+        send_values.reserve(n_send);
+        if(is_solving){
+            for(int rank = 0; rank < n_mpi; ++rank){
+                for(const auto &vector : solution.vectors){
+                    for(const unsigned int position : groups.send_positions[rank]) send_values.push_back(vector.local_element(position));
+                }
+            }
+        }
+        std::vector<double> recv_values(n_recv);
+        MPI_Alltoallv(send_values.data(), send_counts.data(), send_offsets.data(), MPI_DOUBLE,
+                      recv_values.data(), recv_counts.data(), recv_offsets.data(), MPI_DOUBLE, mpi_communicator);
+
+        std::vector<DealiiVector> world_vectors(n_vectors, groups.world_solution);
+        for(int rank = 0; rank < n_mpi; ++rank){
+            if(recv_counts[rank] == 0) continue;
+            int value_index = recv_offsets[rank];
+            for(auto &vector : world_vectors){
+                for(const auto &dof : groups.recv_dofs[rank]) vector[dof] = recv_values[value_index++];
+            }
+        }
+        for(auto &vector : world_vectors) vector.update_ghost_values();
+        solution.vectors = std::move(world_vectors);
+    }
+    this->pcout << "Done solving on the groups of processes." << std::endl;
+    return solutions;
+}
+
+template <int dim, int nspecies, int nstate>
+const typename AdaptiveSamplingBase<dim, nspecies, nstate>::ProcessGroups& AdaptiveSamplingBase<dim, nspecies, nstate>::setupProcessGroups() const{
+    if(process_groups) return *process_groups;
+
+    process_groups = std::make_unique<ProcessGroups>();
+    ProcessGroups &groups = *process_groups;
+    const int n_mpi = dealii::Utilities::MPI::n_mpi_processes(mpi_communicator);
+    groups.group_size = all_parameters->reduced_order_param.ensemble_group_size;
+    groups.n_groups = std::max(n_mpi / groups.group_size, 1);
+    MPI_Comm_split(mpi_communicator, groups.group_of(mpi_rank), mpi_rank, &groups.communicator);
+
+    // Partitions of the group and of MPI_COMM_WORLD
+    Parameters::AllParameters group_params = *all_parameters;
+    group_params.mpi_communicator = groups.communicator;
+    std::unique_ptr<FlowSolver::FlowSolver<dim,nspecies,nstate>> group_flow_solver = FlowSolver::FlowSolverFactory<dim,nspecies,nstate>::select_flow_case(&group_params, parameter_handler);
+    const bool compute_dRdW = true;
+    group_flow_solver->dg->assemble_residual(compute_dRdW);
+    groups.system_matrix = std::make_shared<dealii::TrilinosWrappers::SparseMatrix>();
+    groups.system_matrix->copy_from(group_flow_solver->dg->system_matrix);
+
+    std::unique_ptr<FlowSolver::FlowSolver<dim,nspecies,nstate>> world_flow_solver = FlowSolver::FlowSolverFactory<dim,nspecies,nstate>::select_flow_case(all_parameters, parameter_handler);
+    groups.world_solution = world_flow_solver->dg->solution;
+
+    // CellId, active_cell_index and DoF indices of the cells of the MPI_COMM_WORLD partition, shared once
+    std::vector<unsigned int> cell_ids;
+    std::vector<unsigned int> n_dofs;
+    std::vector<int> cell_indices;
+    std::vector<dealii::types::global_dof_index> world_dofs;
+    std::vector<dealii::types::global_dof_index> dof_indices;
+    for(const auto &cell : world_flow_solver->dg->dof_handler.active_cell_iterators()){
+        if(!cell->is_locally_owned()) continue;
+        const auto binary_id = cell->id().template to_binary<dim>();
+        cell_ids.insert(cell_ids.end(), binary_id.begin(), binary_id.end());
+        cell_indices.push_back(cell->active_cell_index());
+        dof_indices.resize(cell->get_fe().n_dofs_per_cell());
+        cell->get_dof_indices(dof_indices);
+        n_dofs.push_back(dof_indices.size());
+        world_dofs.insert(world_dofs.end(), dof_indices.begin(), dof_indices.end());
+    }
+    cell_ids = gather_on_root(cell_ids, MPI_UNSIGNED, mpi_communicator);
+    n_dofs = gather_on_root(n_dofs, MPI_UNSIGNED, mpi_communicator);
+    cell_indices = gather_on_root(cell_indices, MPI_INT, mpi_communicator);
+    world_dofs = gather_on_root(world_dofs, DEAL_II_DOF_INDEX_MPI_TYPE, mpi_communicator);
+    broadcast_vector(cell_ids, MPI_UNSIGNED, 0, mpi_communicator);
+    broadcast_vector(n_dofs, MPI_UNSIGNED, 0, mpi_communicator);
+    broadcast_vector(cell_indices, MPI_INT, 0, mpi_communicator);
+    broadcast_vector(world_dofs, DEAL_II_DOF_INDEX_MPI_TYPE, 0, mpi_communicator);
+
+    // Index of each cell in the shared arrays and offset of its DoF indices
+    constexpr unsigned int binary_id_size = std::tuple_size<dealii::CellId::binary_type>::value;
+    std::map<dealii::CellId, std::pair<unsigned int, unsigned int>> world_cells;
+    unsigned int dof_offset = 0;
+    for(unsigned int i_cell = 0; i_cell < n_dofs.size(); ++i_cell){
+        dealii::CellId::binary_type binary_id;
+        std::copy_n(cell_ids.begin() + i_cell*binary_id_size, binary_id_size, binary_id.begin());
+        world_cells.emplace(dealii::CellId(binary_id), std::make_pair(i_cell, dof_offset));
+        dof_offset += n_dofs[i_cell];
+    }
+
+    // MPI_COMM_WORLD index of the DoFs owned by this process in the group partition
+    const dealii::IndexSet &group_owned_dofs = group_flow_solver->dg->dof_handler.locally_owned_dofs();
+    std::vector<dealii::types::global_dof_index> owned_group_to_world(group_owned_dofs.n_elements());
+    for(const auto &cell : group_flow_solver->dg->dof_handler.active_cell_iterators()){
+        if(!cell->is_locally_owned()) continue;
+        const auto world_cell = world_cells.find(cell->id());
+        Assert(world_cell != world_cells.end(), dealii::ExcInternalError());
+        const unsigned int i_cell = world_cell->second.first;
+        const unsigned int world_offset = world_cell->second.second;
+        dof_indices.resize(cell->get_fe().n_dofs_per_cell());
+        cell->get_dof_indices(dof_indices);
+        Assert(dof_indices.size() == n_dofs[i_cell], dealii::ExcDimensionMismatch(dof_indices.size(), n_dofs[i_cell]));
+        for(unsigned int i_dof = 0; i_dof < dof_indices.size(); ++i_dof){
+            owned_group_to_world[group_owned_dofs.index_within_set(dof_indices[i_dof])] = world_dofs[world_offset + i_dof];
+        }
+        groups.owned_cells.push_back(cell->active_cell_index());
+        groups.owned_cells_world_index.push_back(cell_indices[i_cell]);
+    }
+
+    // The group POD basis needs the map of every DoF of the group
+    const std::vector<dealii::IndexSet> group_owned_dofs_per_rank = dealii::Utilities::MPI::all_gather(groups.communicator, group_owned_dofs);
+    const std::vector<std::vector<dealii::types::global_dof_index>> owned_group_to_world_per_rank = dealii::Utilities::MPI::all_gather(groups.communicator, owned_group_to_world);
+    groups.group_to_world_dofs.resize(group_owned_dofs.size());
+    for(unsigned int rank = 0; rank < group_owned_dofs_per_rank.size(); ++rank){
+        for(unsigned int i = 0; i < owned_group_to_world_per_rank[rank].size(); ++i){
+            groups.group_to_world_dofs[group_owned_dofs_per_rank[rank].nth_index_in_set(i)] = owned_group_to_world_per_rank[rank][i];
+        }
+    }
+
+    // Send each owned entry to the processes owning it in the MPI_COMM_WORLD partition.
+    // The receivers keep the MPI_COMM_WORLD indices, so only values are sent afterwards.
+    const std::vector<dealii::IndexSet> world_owned_dofs = dealii::Utilities::MPI::all_gather(mpi_communicator, world_flow_solver->dg->dof_handler.locally_owned_dofs());
+    groups.send_positions.assign(n_mpi, std::vector<unsigned int>());
+    std::map<unsigned int, std::vector<dealii::types::global_dof_index>> send_dofs;
+    for(unsigned int position = 0; position < owned_group_to_world.size(); ++position){
+        const dealii::types::global_dof_index world_dof = owned_group_to_world[position];
+        for(int rank = 0; rank < n_mpi; ++rank){
+            if(!world_owned_dofs[rank].is_element(world_dof)) continue;
+            groups.send_positions[rank].push_back(position);
+            send_dofs[rank].push_back(world_dof);
+        }
+    }
+    groups.recv_dofs.assign(n_mpi, std::vector<dealii::types::global_dof_index>());
+    for(auto &received : dealii::Utilities::MPI::some_to_some(mpi_communicator, send_dofs)){
+        groups.recv_dofs[received.first] = std::move(received.second);
+    }
+
+    return groups;
+}
+
+template <int dim, int nspecies, int nstate>
+std::shared_ptr<ProperOrthogonalDecomposition::OnlinePOD<dim,nspecies>> AdaptiveSamplingBase<dim, nspecies, nstate>::getPODOnCommunicator(const MPI_Comm communicator) const{
+    if(communicator == mpi_communicator) return current_pod;
+
+    // The snapshots are stored on every process, so the group basis is built without communication between groups
+    ProcessGroups &groups = *process_groups;
+    const auto n_snapshots = current_pod->snapshotMatrix.cols();
+    if(!groups.pod || groups.pod->snapshotMatrix.cols() != n_snapshots){
+        groups.pod = std::make_shared<ProperOrthogonalDecomposition::OnlinePOD<dim,nspecies>>(groups.system_matrix);
+        groups.pod->snapshotMatrix.resize(groups.group_to_world_dofs.size(), n_snapshots);
+        for(unsigned int i = 0; i < groups.group_to_world_dofs.size(); ++i){
+            groups.pod->snapshotMatrix.row(i) = current_pod->snapshotMatrix.row(groups.group_to_world_dofs[i]);
+        }
+        groups.pod->computeBasis();
+    }
+    return groups.pod;
+}
+
+template <int dim, int nspecies, int nstate>
+std::vector<double> AdaptiveSamplingBase<dim, nspecies, nstate>::gatherWeights(const Epetra_Vector& weights) const{
+    const Epetra_LocalMap all_cells_map(weights.GlobalLength(), 0, weights.Comm());
+    Epetra_Vector all_weights(all_cells_map);
+    const Epetra_Import importer(all_cells_map, weights.Map());
+    all_weights.Import(weights, importer, Epetra_CombineMode::Insert);
+    return std::vector<double>(all_weights.Values(), all_weights.Values() + all_weights.MyLength());
+}
+
+template <int dim, int nspecies, int nstate>
+Epetra_Vector AdaptiveSamplingBase<dim, nspecies, nstate>::getWeightsOnCommunicator(const std::vector<double>& all_weights, const Epetra_Vector& weights, const MPI_Comm communicator) const{
+    if(communicator == mpi_communicator) return weights;
+
+    ProcessGroups &groups = *process_groups;
+    const Epetra_MpiComm group_comm(communicator);
+    const Epetra_Map cell_map(-1, groups.owned_cells.size(), groups.owned_cells.data(), 0, group_comm);
+    Epetra_Vector group_weights(cell_map);
+    for(unsigned int i = 0; i < groups.owned_cells.size(); ++i){
+        group_weights[i] = all_weights[groups.owned_cells_world_index[i]];
+    }
+    return group_weights;
+}
+
 template <int dim, int nspecies, int nstate>
 Parameters::AllParameters AdaptiveSamplingBase<dim, nspecies, nstate>::reinit_params(const RowVectorXd& parameter) const{
     // Copy all parameters
@@ -7,8 +7,15 @@
 #include "rom_test_location.h"
 #include <eigen/Eigen/Dense>
 #include "nearest_neighbors.h"
+#include "rbf_interpolation.h"
+#include "min_max_scaler.h"
+#include <Epetra_Vector.h>
+#include <functional>
+#include <algorithm>
+#include "reduced_order_solution.h"
 
 namespace PHiLiP {
+
 using DealiiVector = dealii::LinearAlgebra::distributed::Vector<double>;
 using Eigen::MatrixXd;
 using Eigen::RowVectorXd;
@@ -55,6 +62,12 @@ public:
     /// Nearest neighbors of snapshots
     std::shared_ptr<ProperOrthogonalDecomposition::NearestNeighbors> nearest_neighbors;
 
+    /// RBF interpolation of the errors, updated with the new points and errors at each iteration
+    mutable std::shared_ptr<ProperOrthogonalDecomposition::RBFInterpolation> rbf;
+
+    /// Scaling of the parameters used by rbf. The RBF is rebuilt instead of updated when the scaling changes.
+    mutable ProperOrthogonalDecomposition::MinMaxScaler rbf_scaler;
+
     const MPI_Comm mpi_communicator; ///< MPI communicator.
     const int mpi_rank; ///< MPI rank.
 
@@ -78,15 +91,120 @@ public:
     /// Compute RBF and find max error
     virtual RowVectorXd getMaxErrorROM() const;
 
+    /// Fit the RBF to the errors at the parameters and find its maximum
+    /** A bounded optimization is started from each row of start_parameters. The starts are distributed
+     *  over the processes and the largest error is shared with all of them. Sets max_error.
+     */
+    RowVectorXd maximizeRBFError(const MatrixXd& parameters, const VectorXd& errors, const MatrixXd& start_parameters) const;
+
     /// Solve full-order snapshot
     dealii::LinearAlgebra::distributed::Vector<double> solveSnapshotFOM(const RowVectorXd& parameter) const;
 
+    /// Solve full-order snapshot on the communicator of params
+    dealii::LinearAlgebra::distributed::Vector<double> solveSnapshotFOM(const Parameters::AllParameters& params) const;
+
+    /// Solve full-order snapshots at every row of parameters
+    /** The points are distributed over the process groups by solveOnProcessGroups.
+     *  Solutions are returned in the order of the rows of parameters.
+     */
+    std::vector<dealii::LinearAlgebra::distributed::Vector<double>> solveSnapshotsFOM(const MatrixXd& parameters) const;
+
+    /// ROM solution and its error estimate with respect to the FOM
+    using ROMSolutionAndError = std::pair<std::unique_ptr<ProperOrthogonalDecomposition::ROMSolution<dim,nspecies,nstate>>, double>;
+
+    /// Reduced-order solve at a point, on the communicator of its parameters and with the given POD basis
+    using ROMSolve = std::function<std::unique_ptr<ProperOrthogonalDecomposition::ROMSolution<dim,nspecies,nstate>>(const RowVectorXd&, const Parameters::AllParameters&, std::shared_ptr<ProperOrthogonalDecomposition::PODBase<dim,nspecies>>)>;
+
+    /// Solve the ROM and the adjoint-based error estimate between the FOM and the ROM at every row of parameters
+    /** The points are distributed over the process groups by solveOnProcessGroups. The returned ROM solutions
+     *  are on the MPI_COMM_WORLD partition and the errors are the fom_to_initial_rom_error of their test location.
+     */
+    std::vector<ROMSolutionAndError> solveSnapshotsROM(const MatrixXd& parameters, const ROMSolve& rom_solve) const;
+
+    /// Vectors and scalars computed at a point by solveOnProcessGroups
+    struct PointSolution {
+        std::vector<DealiiVector> vectors; ///< Vectors with the partition of the solving communicator
+        std::vector<double> values; ///< Scalars
+    };
+
+    /// Solve at every row of parameters, concurrently on groups of processes
+    /** If reduced_order_param.ensemble_group_size is non-zero and there is more than one point, MPI_COMM_WORLD is
+     *  split into groups of that many processes. The root of each group takes the next unsolved row from a counter
+     *  stored on process 0, so that groups finishing early pick up the remaining points. solve receives the row
+     *  and the parameters at that row, with their mpi_communicator set to the group. Each process of the solving group then sends the entries
+     *  it owns to the processes owning them in the MPI_COMM_WORLD partition, and the scalars are broadcast.
+     *  Otherwise, the points are solved one after the other on MPI_COMM_WORLD.
+     *  Results are returned in the order of the rows of parameters, with vectors on the MPI_COMM_WORLD partition.
+     */
+    std::vector<PointSolution> solveOnProcessGroups(const MatrixXd& parameters, const std::function<PointSolution(const RowVectorXd&, const Parameters::AllParameters&)>& solve) const;
+
+    /// POD basis of current_pod on the partition of the communicator
+    /** Returns current_pod on MPI_COMM_WORLD. On a process group, the basis is rebuilt from the snapshots of
+     *  current_pod whenever a snapshot has been added since the last call.
+     */
+    std::shared_ptr<ProperOrthogonalDecomposition::OnlinePOD<dim,nspecies>> getPODOnCommunicator(const MPI_Comm communicator) const;
+
+    /// ECSW weights of every cell, indexed by the GIDs of weights, on every process
+    std::vector<double> gatherWeights(const Epetra_Vector& weights) const;
+
+    /// ECSW weights on the partition of the communicator, from the weights returned by gatherWeights
+    Epetra_Vector getWeightsOnCommunicator(const std::vector<double>& all_weights, const Epetra_Vector& weights, const MPI_Comm communicator) const;
+
     /// Reinitialize parameters
     Parameters::AllParameters reinit_params(const RowVectorXd& parameter) const;
 
     /// Set up parameter space depending on test case
     void configureInitialParameterSpace() const;
 
+protected:
+    /// Process groups used by solveOnProcessGroups and the maps between their partition and the one of MPI_COMM_WORLD
+    struct ProcessGroups {
+        /// Destructor, releases the objects built on the communicator before freeing it
+        ~ProcessGroups()
+        {
+            pod.reset();
+            system_matrix.reset();
+            if(communicator != MPI_COMM_NULL) MPI_Comm_free(&communicator);
+        }
+
+        int n_groups; ///< Number of groups
+        int group_size; ///< Processes per group, leftover processes join the last group
+        MPI_Comm communicator = MPI_COMM_NULL; ///< Communicator of the group of this process
+
+        /// System matrix with the partition of the group, for the POD basis
+        std::shared_ptr<dealii::TrilinosWrappers::SparseMatrix> system_matrix;
+
+        /// Solution vector with the partition of MPI_COMM_WORLD
+        DealiiVector world_solution;
+
+        /// MPI_COMM_WORLD index of every DoF of the group partition
+        std::vector<dealii::types::global_dof_index> group_to_world_dofs;
+
+        /// Local position, in the group partition, of the entries sent to each process of MPI_COMM_WORLD
+        std::vector<std::vector<unsigned int>> send_positions;
+
+        /// MPI_COMM_WORLD indices of the entries received from each process of MPI_COMM_WORLD
+        std::vector<std::vector<dealii::types::global_dof_index>> recv_dofs;
+
+        /// active_cell_index of the cells owned by this process in the group partition
+        std::vector<int> owned_cells;
+
+        /// GID of the same cells in the ECSW weights, the active_cell_index on their MPI_COMM_WORLD owner
+        std::vector<int> owned_cells_world_index;
+
+        /// POD basis on the group
+        std::shared_ptr<ProperOrthogonalDecomposition::OnlinePOD<dim,nspecies>> pod;
+
+        /// Group index of the process of MPI_COMM_WORLD
+        int group_of(const int world_rank) const { return std::min(world_rank / group_size, n_groups - 1); }
+    };
+
+    /// Splits MPI_COMM_WORLD into process groups and builds the DoF maps, once
+    const ProcessGroups& setupProcessGroups() const;
+
+    /// Process groups, created on first use
+    mutable std::unique_ptr<ProcessGroups> process_groups;
+
 };
 
 }
@@ -27,13 +27,10 @@ void AssembleECSWJac<dim,nspecies,nstate>::build_problem(){
     MatrixXd snapshotMatrix = this->pod->getSnapshotMatrix();
     const Epetra_CrsMatrix epetra_pod_basis = this->pod->getPODBasis()->trilinos_matrix();
     Epetra_CrsMatrix epetra_system_matrix = this->dg->system_matrix.trilinos_matrix();
-    Epetra_Map system_matrix_rowmap = epetra_system_matrix.RowMap();
-    Epetra_CrsMatrix local_system_matrix = copy_matrix_to_all_cores(epetra_system_matrix);
 
     // Get dimensions of the problem
     int num_snaps_POD = snapshotMatrix.cols(); // Number of snapshots used to build the POD basis
     int n_reduced_dim_POD = epetra_pod_basis.NumGlobalCols(); // Reduced subspace dimension
-    int N_FOM_dim = epetra_pod_basis.NumGlobalRows(); // Length of solution vector
     int num_elements_N_e = this->dg->triangulation->n_active_cells(); // Number of elements (equal to N if there is one DOF per cell)
 
     // Create empty and temporary C and d structs
@@ -67,10 +64,13 @@ void AssembleECSWJac<dim,nspecies,nstate>::build_problem(){
     Epetra_CrsMatrix C_T(Epetra_DataAccess::Copy, ColMap, RowMap, num_elements_N_e);
     Epetra_Vector d(dMap);
 
+    // Rows of C summed over the elements, accumulated locally and reduced onto d
+    const int n_c_se = n_reduced_dim_POD*n_reduced_dim_POD;
+    std::vector<double> local_d(n_c_se*training_snaps, 0.0);
+    std::vector<int> c_se_rows(n_c_se);
+    std::vector<double> c_se_values(n_c_se);
+
     // Loop through the given number of training snapshots to find Jacobian values
-    const unsigned int max_dofs_per_cell = this->dg->dof_handler.get_fe_collection().max_dofs_per_cell();
-    std::vector<dealii::types::global_dof_index> current_dofs_indices(max_dofs_per_cell);
-    std::vector<dealii::types::global_dof_index> neighbour_dofs_indices(max_dofs_per_cell); 
     int row_num = 0;
     int snap_num = 0;
     for(auto snap_param : this->snapshot_parameters.rowwise()){
@@ -89,125 +89,22 @@ void AssembleECSWJac<dim,nspecies,nstate>::build_problem(){
 
         // Compute test basis
         epetra_system_matrix = this->dg->system_matrix.trilinos_matrix(); // Jacobian at snapshot location
-        system_matrix_rowmap = epetra_system_matrix.RowMap();
         std::shared_ptr<Epetra_CrsMatrix> epetra_test_basis = this->local_generate_test_basis(epetra_system_matrix, epetra_pod_basis);
-        Epetra_CrsMatrix local_system_matrix = copy_matrix_to_all_cores(epetra_system_matrix);
-        Epetra_CrsMatrix local_pod_basis = copy_matrix_to_all_cores(epetra_pod_basis);
-        Epetra_CrsMatrix local_test_basis = copy_matrix_to_all_cores(*epetra_test_basis);
-
-        // Loop through elements
-        for (const auto &cell : this->dg->dof_handler.active_cell_iterators())
-        {
-            if (cell->is_locally_owned()){
-                int cell_num = cell->active_cell_index();
-                std::unique_ptr row(std::make_unique<double[]>(local_system_matrix.NumGlobalCols()));
-                std::unique_ptr global_indices(std::make_unique<int[]>(local_system_matrix.NumGlobalCols()));
-
-                // Create L_e matrix and transposed L_e matrix for current cell
-                const int fe_index_curr_cell = cell->active_fe_index();
-                const dealii::FESystem<dim,dim> &current_fe_ref = this->dg->fe_collection[fe_index_curr_cell];
-                const int n_dofs_curr_cell = current_fe_ref.n_dofs_per_cell();
-
-                current_dofs_indices.resize(n_dofs_curr_cell);
-                cell->get_dof_indices(current_dofs_indices);
-
-                int numE;
-                int row_i = current_dofs_indices[0];
-                // Use the Jacobian to determine the stencil around the current element
-                local_system_matrix.ExtractGlobalRowCopy(row_i, local_system_matrix.NumGlobalCols(), numE, row.get(), global_indices.get());
-                int neighbour_dofs_curr_cell = 0;
-                for (int i = 0; i < numE; i++){
-                    neighbour_dofs_curr_cell +=1;
-                    neighbour_dofs_indices.resize(neighbour_dofs_curr_cell);
-                    neighbour_dofs_indices[neighbour_dofs_curr_cell-1] = global_indices[i];
-                }
-
-                const Epetra_SerialComm sComm;
-                Epetra_Map LeRowMap(n_dofs_curr_cell, 0, sComm);
-                Epetra_Map LeTRowMap(N_FOM_dim, 0, sComm);
-                Epetra_CrsMatrix L_e(Epetra_DataAccess::Copy, LeRowMap, LeTRowMap, 1);
-                Epetra_CrsMatrix L_e_T(Epetra_DataAccess::Copy, LeTRowMap, n_dofs_curr_cell);
-                Epetra_Map LePLUSRowMap(neighbour_dofs_curr_cell, 0, sComm);
-                Epetra_CrsMatrix L_e_PLUS(Epetra_DataAccess::Copy, LePLUSRowMap, LeTRowMap, 1);
-                double posOne = 1.0;
-
-                for(int i = 0; i < n_dofs_curr_cell; i++){
-                    const int col = current_dofs_indices[i];
-                    L_e.InsertGlobalValues(i, 1, &posOne , &col);
-                    L_e_T.InsertGlobalValues(col, 1, &posOne , &i);
-                }
-                L_e.FillComplete(LeTRowMap, LeRowMap);
-                L_e_T.FillComplete(LeRowMap, LeTRowMap);
 
-                for(int i = 0; i < neighbour_dofs_curr_cell; i++){
-                    const int col = neighbour_dofs_indices[i];
-                    L_e_PLUS.InsertGlobalValues(i, 1, &posOne , &col);
-                }
-                L_e_PLUS.FillComplete(LeTRowMap, LePLUSRowMap);
-
-                // Find contribution of element to the Jacobian
-                Epetra_CrsMatrix J_L_e_T(Epetra_DataAccess::Copy, local_system_matrix.RowMap(), neighbour_dofs_curr_cell);
-                Epetra_CrsMatrix J_e_m(Epetra_DataAccess::Copy, LeRowMap, neighbour_dofs_curr_cell);
-                EpetraExt::MatrixMatrix::Multiply(local_system_matrix, false, L_e_PLUS, true, J_L_e_T, true);
-                EpetraExt::MatrixMatrix::Multiply(L_e, false, J_L_e_T, false, J_e_m, true);
-
-                // Jacobian for this element in the global dimensions
-                Epetra_CrsMatrix J_temp(Epetra_DataAccess::Copy, LeRowMap, N_FOM_dim);
-                Epetra_CrsMatrix J_global_e(Epetra_DataAccess::Copy, LeTRowMap, N_FOM_dim);
-                EpetraExt::MatrixMatrix::Multiply(J_e_m, false, L_e_PLUS, false, J_temp, true);
-                EpetraExt::MatrixMatrix::Multiply(L_e_T, false, J_temp, false, J_global_e, true);
-
-                // Post-multiply by the ROB V
-                Epetra_CrsMatrix J_e_V(Epetra_DataAccess::Copy, LeTRowMap, n_reduced_dim_POD);
-                EpetraExt::MatrixMatrix::Multiply(J_global_e, false, local_pod_basis, false, J_e_V, true);
-
-                // Assemble the transpose of the test basis
-                Epetra_CrsMatrix W_T(Epetra_DataAccess::Copy, local_test_basis.ColMap(), N_FOM_dim);
-                for(int i =0; i < local_test_basis.NumGlobalRows(); i++){
-                    std::unique_ptr row(std::make_unique<double[]>(local_test_basis.NumGlobalCols()));
-                    std::unique_ptr global_cols(std::make_unique<int[]>(local_test_basis.NumGlobalCols()));
-                    int numE;
-                    const int globalRow = local_test_basis.GRID(i);
-                    local_test_basis.ExtractGlobalRowCopy(globalRow, local_test_basis.NumGlobalCols(), numE , row.get(), global_cols.get());
-                    for(int j = 0; j < numE; j++){
-                        int col = global_cols[j];
-                        W_T.InsertGlobalValues(col, 1, &row[j], &i);
-                    }
-                }
-                W_T.FillComplete(local_test_basis.RowMap(), local_test_basis.ColMap());
-
-                // Pre-multiply by the tranpose of the test basis
-                Epetra_CrsMatrix W_T_J_e_V(Epetra_DataAccess::Copy, W_T.RowMap(), n_reduced_dim_POD);
-                EpetraExt::MatrixMatrix::Multiply(W_T, false, J_e_V, false, W_T_J_e_V , true);
-
-                // Stack into n^2 vector
-                Epetra_Map cseRowMap(n_reduced_dim_POD*n_reduced_dim_POD, 0, sComm);
-                Epetra_Vector c_se(cseRowMap);
-                for(int i =0; i < W_T_J_e_V.NumGlobalRows(); i++){
-                    std::unique_ptr row(std::make_unique<double[]>(local_test_basis.NumGlobalCols()));
-                    std::unique_ptr global_cols(std::make_unique<int[]>(local_test_basis.NumGlobalCols()));
-                    int numE;
-                    const int globalRow = W_T_J_e_V.GRID(i);
-                    W_T_J_e_V.ExtractGlobalRowCopy(globalRow, W_T_J_e_V.NumGlobalCols(), numE , row.get(), global_cols.get());
-                    for(int j = 0; j < numE; j++){
-                        int col = global_cols[j];
-                        int idx = col*n_reduced_dim_POD + i; 
-                        c_se[idx] = row[j];
+        // Contribution W^T J_e V of each element, stacked column-wise into an n^2 vector and subbed into C and d
+        this->dg->project_cellwise_jacobian(*epetra_test_basis, epetra_pod_basis,
+            [&](const unsigned int cell_num, const dealii::FullMatrix<double> &W_T_J_e_V){
+                for (int j = 0; j < n_reduced_dim_POD; ++j){
+                    for (int i = 0; i < n_reduced_dim_POD; ++i){
+                        const int idx = j*n_reduced_dim_POD + i;
+                        c_se_rows[idx] = row_num+idx;
+                        c_se_values[idx] = W_T_J_e_V(i,j);
+                        local_d[row_num+idx] += W_T_J_e_V(i,j);
                     }
                 }
-
-                std::unique_ptr c_se_array(std::make_unique<double[]>(n_reduced_dim_POD*n_reduced_dim_POD));
-
-                c_se.ExtractCopy(c_se_array.get());
-            
-                // Sub into entries of C and d
-                for (int k = 0; k < (n_reduced_dim_POD*n_reduced_dim_POD); ++k){
-                    int place = row_num+k;
-                    C_T.InsertGlobalValues(cell_num, 1, &c_se_array[k], &place);
-                }
-            }     
-        }
-        row_num+=(n_reduced_dim_POD*n_reduced_dim_POD);
+                C_T.InsertGlobalValues(cell_num, n_c_se, c_se_values.data(), c_se_rows.data());
+            });
+        row_num+=n_c_se;
         snap_num+=1;
         
         // Check if number of training snapshots has been reached
@@ -221,16 +118,10 @@ void AssembleECSWJac<dim,nspecies,nstate>::build_problem(){
 
     C_T.FillComplete(RowMap, ColMap);
 
-    Epetra_CrsMatrix C_single = copy_matrix_to_all_cores(C_T);
-    for (int p = 0; p < num_elements_N_e; p++){
-        std::unique_ptr row(std::make_unique<double[]>(C_single.NumGlobalCols()));
-        std::unique_ptr global_cols(std::make_unique<int[]>(C_single.NumGlobalCols()));
-        int numE;
-        C_single.ExtractGlobalRowCopy(p, C_single.NumGlobalCols(), numE , row.get(), global_cols.get());
-        for (int o = 0; o < dMap.NumMyElements(); o++){
-            int col = dMap.GID(o);
-            d.SumIntoMyValues(1, &row[col], &o);
-        }
+    std::vector<double> global_d(local_d.size());
+    this->Comm_.SumAll(local_d.data(), global_d.data(), local_d.size());
+    for (int o = 0; o < dMap.NumMyElements(); o++){
+        d[o] = global_d[dMap.GID(o)];
     }
 
     // Sub temp C and d into class A and b
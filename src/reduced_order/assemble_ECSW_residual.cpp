@@ -31,7 +31,6 @@ void AssembleECSWRes<dim,nspecies,nstate>::build_problem(){
     // Get dimensions of the problem
     int num_snaps_POD = snapshotMatrix.cols(); // Number of snapshots used to build the POD basis
     int n_reduced_dim_POD = epetra_pod_basis.NumGlobalCols(); // Reduced subspace dimension
-    int N_FOM_dim = epetra_pod_basis.NumGlobalRows(); // Length of solution vector
     int num_elements_N_e = this->dg->triangulation->n_active_cells(); // Number of elements (equal to N if there is one DOF per cell)
 
     // Create empty and temporary C and d structs
@@ -64,9 +63,12 @@ void AssembleECSWRes<dim,nspecies,nstate>::build_problem(){
     Epetra_CrsMatrix C_T(Epetra_DataAccess::Copy, ColMap, RowMap, num_elements_N_e);
     Epetra_Vector d(dMap);
 
+    // Rows of C summed over the elements, accumulated locally and reduced onto d
+    std::vector<double> local_d(n_reduced_dim_POD*training_snaps, 0.0);
+    std::vector<int> c_se_rows(n_reduced_dim_POD);
+    std::vector<double> c_se_values(n_reduced_dim_POD);
+
     // Loop through the given number of training snapshots to find residuals
-    const unsigned int max_dofs_per_cell = this->dg->dof_handler.get_fe_collection().max_dofs_per_cell();
-    std::vector<dealii::types::global_dof_index> current_dofs_indices(max_dofs_per_cell); 
     int row_num = 0;
     int snap_num = 0;
     for(auto snap_param : this->snapshot_parameters.rowwise()){
@@ -82,61 +84,21 @@ void AssembleECSWRes<dim,nspecies,nstate>::build_problem(){
         this->dg->solution = this->fom_locations[snap_num];
         const bool compute_dRdW = true;
         this->dg->assemble_residual(compute_dRdW);
-        Epetra_Vector epetra_right_hand_side(Epetra_DataAccess::Copy, epetra_system_matrix.RowMap(), this->dg->right_hand_side.begin());
-        Epetra_Vector local_rhs = copy_vector_to_all_cores(epetra_right_hand_side);
 
         // Compute test basis
         epetra_system_matrix = this->dg->system_matrix.trilinos_matrix();
         std::shared_ptr<Epetra_CrsMatrix> epetra_test_basis = this->local_generate_test_basis(epetra_system_matrix, epetra_pod_basis);
-        Epetra_CrsMatrix local_test_basis = copy_matrix_to_all_cores(*epetra_test_basis);
-
-        // Loop through the elements
-        for (const auto &cell : this->dg->dof_handler.active_cell_iterators())
-        {
-            if (cell->is_locally_owned()){
-                int cell_num = cell->active_cell_index();
-                const int fe_index_curr_cell = cell->active_fe_index();
-                const dealii::FESystem<dim,dim> &current_fe_ref = this->dg->fe_collection[fe_index_curr_cell];
-                const int n_dofs_curr_cell = current_fe_ref.n_dofs_per_cell();
-
-                current_dofs_indices.resize(n_dofs_curr_cell);
-                cell->get_dof_indices(current_dofs_indices);
-
-                // Create L_e matrix for current cell
-                const Epetra_SerialComm sComm;
-                Epetra_Map LeRowMap(n_dofs_curr_cell, 0, sComm);
-                Epetra_Map LeColMap(N_FOM_dim, 0, sComm);
-                Epetra_CrsMatrix L_e(Epetra_DataAccess::Copy, LeRowMap, LeColMap, 1);
-                double posOne = 1.0;
-
-                for(int i = 0; i < n_dofs_curr_cell; i++){
-                    const int col = current_dofs_indices[i];
-                    L_e.InsertGlobalValues(i, 1, &posOne , &col);
-                }
-                L_e.FillComplete(LeColMap, LeRowMap);
-
-                // Extract residual contributions of the current cell into global dimension
-                Epetra_Vector local_r(LeRowMap);
-                Epetra_Vector global_r_e(LeColMap);
-                L_e.Multiply(false, local_rhs, local_r);
-                L_e.Multiply(true, local_r, global_r_e);
-
-                // Find reduced-order representation of contribution
-                Epetra_Map cseRowMap(n_reduced_dim_POD, 0, sComm);
-                Epetra_Vector c_se(cseRowMap);
 
-                local_test_basis.Multiply(true, global_r_e, c_se);
-                std::unique_ptr c_se_array(std::make_unique<double[]>(n_reduced_dim_POD));
-
-                c_se.ExtractCopy(c_se_array.get());
-                
-                // Sub into entries of C and d
+        // Find reduced-order representation of the contribution of each element and sub it into C and d
+        this->dg->project_cellwise_residual(*epetra_test_basis,
+            [&](const unsigned int cell_num, const dealii::Vector<double> &c_se){
                 for (int k = 0; k < n_reduced_dim_POD; ++k){
-                    int place = row_num+k;
-                    C_T.InsertGlobalValues(cell_num, 1, &c_se_array[k], &place);
+                    c_se_rows[k] = row_num+k;
+                    c_se_values[k] = c_se[k];
+                    local_d[row_num+k] += c_se[k];
                 }
-            }
-        }
+                C_T.InsertGlobalValues(cell_num, n_reduced_dim_POD, c_se_values.data(), c_se_rows.data());
+            });
         row_num+=n_reduced_dim_POD;
         snap_num+=1;
 
@@ -151,16 +113,10 @@ void AssembleECSWRes<dim,nspecies,nstate>::build_problem(){
 
     C_T.FillComplete(RowMap, ColMap);
 
-    Epetra_CrsMatrix C_single = copy_matrix_to_all_cores(C_T);
-    for (int p = 0; p < num_elements_N_e; p++){
-        std::unique_ptr row(std::make_unique<double[]>(C_single.NumGlobalCols()));
-        std::unique_ptr global_cols(std::make_unique<int[]>(C_single.NumGlobalCols()));
-        int numE;
-        C_single.ExtractGlobalRowCopy(p, C_single.NumGlobalCols(), numE , row.get(), global_cols.get());
-        for (int o = 0; o < dMap.NumMyElements(); o++){
-            int col = dMap.GID(o);
-            d.SumIntoMyValues(1, &row[col], &o);
-        }
+    std::vector<double> global_d(local_d.size());
+    this->Comm_.SumAll(local_d.data(), global_d.data(), local_d.size());
+    for (int o = 0; o < dMap.NumMyElements(); o++){
+        d[o] = global_d[dMap.GID(o)];
     }
 
     // Sub temp C and d into class A and b
@@ -29,6 +29,14 @@ HROMTestLocation<dim, nspecies, nstate>::HROMTestLocation(const RowVectorXd& par
 {
 }
 
+template <int dim, int nspecies, int nstate>
+HROMTestLocation<dim, nspecies, nstate>::HROMTestLocation(const RowVectorXd& parameter, std::unique_ptr<ROMSolution<dim, nspecies, nstate>> rom_solution, std::shared_ptr< DGBase<dim, nspecies, double> > dg_input, Epetra_Vector weights, const double fom_to_initial_rom_error)
+        : TestLocationBase<dim, nspecies, nstate>(parameter, std::move(rom_solution), fom_to_initial_rom_error)
+        , dg(dg_input)
+        , ECSW_weights(weights)
+{
+}
+
 template <int dim, int nspecies, int nstate>
 void HROMTestLocation<dim, nspecies, nstate>::compute_initial_rom_to_final_rom_error(std::shared_ptr<ProperOrthogonalDecomposition::PODBase<dim,nspecies>> pod_updated){
 
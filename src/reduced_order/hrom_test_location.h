@@ -29,6 +29,9 @@ public:
     /// Constructor
     HROMTestLocation(const RowVectorXd& parameter, std::unique_ptr<ROMSolution < dim, nspecies, nstate>> rom_solution, std::shared_ptr< DGBase<dim, nspecies, double> > dg_input, Epetra_Vector weights);
 
+    /// Constructor with the error between the FOM and the initial ROM already computed
+    HROMTestLocation(const RowVectorXd& parameter, std::unique_ptr<ROMSolution < dim, nspecies, nstate>> rom_solution, std::shared_ptr< DGBase<dim, nspecies, double> > dg_input, Epetra_Vector weights, const double fom_to_initial_rom_error);
+
     /// Compute error between initial ROM and final ROM
     void compute_initial_rom_to_final_rom_error(std::shared_ptr<ProperOrthogonalDecomposition::PODBase<dim,nspecies>> pod_updated) override;
 
@@ -55,7 +55,7 @@ public:
     void updateNearestExistingROMs(const RowVectorXd& parameter, Epetra_Vector weights) const;
 
     /// Solve reduced-order solution
-    std::unique_ptr<ProperOrthogonalDecomposition::ROMSolution<dim,nspecies,nstate>> solveSnapshotROM(const RowVectorXd& parameter, Epetra_Vector weights) const;
+    std::unique_ptr<ProperOrthogonalDecomposition::ROMSolution<dim,nspecies,nstate>> solveSnapshotROM(const RowVectorXd& parameter, const Parameters::AllParameters& params, std::shared_ptr<ProperOrthogonalDecomposition::PODBase<dim,nspecies>> pod, Epetra_Vector weights) const;
 
     /// Copy all elements in matrix A to all cores
     Epetra_Vector allocateVectorToSingleCore(const Epetra_Vector &b) const;
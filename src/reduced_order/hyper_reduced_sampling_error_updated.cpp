@@ -256,85 +256,13 @@ RowVectorXd HyperreducedSamplingErrorUpdated<dim, nspecies, nstate>::getMaxError
         i++;
     }
 
-    // Must scale both axes between [0,1] for the 2d rbf interpolation to work optimally
-    ProperOrthogonalDecomposition::MinMaxScaler scaler;
-    MatrixXd parameters_scaled = scaler.fit_transform(parameters);
-
-    // Construct radial basis function
-    std::string kernel = "thin_plate_spline";
-    ProperOrthogonalDecomposition::RBFInterpolation rbf = ProperOrthogonalDecomposition::RBFInterpolation(parameters_scaled, errors, kernel);
-
-    // Set parameters.
-    ROL::ParameterList parlist;
-    parlist.sublist("Step").sublist("Line Search").sublist("Line-Search Method").set("Type","Backtracking");
-    parlist.sublist("Step").sublist("Line Search").sublist("Descent Method").set("Type","Quasi-Newton Method");
-    parlist.sublist("Step").sublist("Line Search").sublist("Secant").set("Type","Limited-Memory BFGS");
-    parlist.sublist("Status Test").set("Gradient Tolerance",1.e-10);
-    parlist.sublist("Status Test").set("Step Tolerance",1.e-14);
-    parlist.sublist("Status Test").set("Iteration Limit",100);
-
-    // Find max error and parameters by minimizing function starting at each ROM location
-    RowVectorXd max_error_params(parameters.cols());
-    this->max_error = 0;
-
-    for(auto it = hrom_locations.begin(); it != hrom_locations.end(); ++it){
-
-        Eigen::RowVectorXd rom_unscaled = it->get()->parameter;
-        Eigen::RowVectorXd rom_scaled = scaler.transform(rom_unscaled);
-
-        //start bounds
-        int dimension = parameters.cols();
-        ROL::Ptr<std::vector<double>> l_ptr = ROL::makePtr<std::vector<double>>(dimension,0.0);
-        ROL::Ptr<std::vector<double>> u_ptr = ROL::makePtr<std::vector<double>>(dimension,1.0);
-        ROL::Ptr<ROL::Vector<double>> lo = ROL::makePtr<ROL::StdVector<double>>(l_ptr);
-        ROL::Ptr<ROL::Vector<double>> up = ROL::makePtr<ROL::StdVector<double>>(u_ptr);
-        ROL::Bounds<double> bcon(lo,up);
-        //end bounds
-
-        ROL::Ptr<ROL::Step<double>> step = ROL::makePtr<ROL::LineSearchStep<double>>(parlist);
-        ROL::Ptr<ROL::StatusTest<double>> status = ROL::makePtr<ROL::StatusTest<double>>(parlist);
-        ROL::Algorithm<double> algo(step,status,false);
-
-        // Iteration Vector
-        ROL::Ptr<std::vector<double>> x_ptr = ROL::makePtr<std::vector<double>>(dimension, 0.0);
-
-        // Set Initial Guess
-        for(int j = 0 ; j < dimension ; j++){
-            (*x_ptr)[j] = rom_scaled(j);
-        }
-
-        this->pcout << "Unscaled parameter: " << rom_unscaled << std::endl;
-        this->pcout << "Scaled parameter: ";
-        for(int j = 0 ; j < dimension ; j++){
-            this->pcout << (*x_ptr)[j] << " ";
-        }
-        this->pcout << std::endl;
-
-        ROL::StdVector<double> x(x_ptr);
-
-        // Run Algorithm
-        algo.run(x, rbf, bcon,false);
-
-        ROL::Ptr<std::vector<double>> x_min = x.getVector();
-
-        for(int j = 0 ; j < dimension ; j++){
-            rom_scaled(j) = (*x_min)[j];
-        }
-
-        RowVectorXd rom_unscaled_optim = scaler.inverse_transform(rom_scaled);
-
-        this->pcout << "Parameters of optimization convergence: " << rom_unscaled_optim << std::endl;
-
-        double error = std::abs(rbf.evaluate(rom_scaled));
-        this->pcout << "RBF error at optimization convergence: " << error << std::endl;
-        if(error > this->max_error){
-            this->pcout << "RBF error is greater than current max error. Updating max error." << std::endl;
-            this->max_error = error;
-            max_error_params = rom_unscaled_optim;
-            this->pcout << "RBF Max error: " << this->max_error << std::endl;
-        }
+    MatrixXd start_parameters(hrom_locations.size(), this->snapshot_parameters.cols());
+    for(unsigned int k = 0 ; k < hrom_locations.size() ; k++){
+        start_parameters.row(k) = hrom_locations[k]->parameter;
     }
 
+    RowVectorXd max_error_params = this->maximizeRBFError(parameters, errors, start_parameters);
+
     // Check if max_error_params is a ROM point
     for(auto it = hrom_locations.begin(); it != hrom_locations.end(); ++it){
         if(max_error_params.isApprox(it->get()->parameter)){
@@ -350,9 +278,10 @@ RowVectorXd HyperreducedSamplingErrorUpdated<dim, nspecies, nstate>::getMaxError
 
 template <int dim, int nspecies, int nstate>
 bool HyperreducedSamplingErrorUpdated<dim, nspecies, nstate>::placeROMLocations(const MatrixXd& rom_points, Epetra_Vector weights) const{
-    bool error_greater_than_tolerance = false;
     std::unique_ptr<FlowSolver::FlowSolver<dim,nspecies,nstate>> flow_solver = FlowSolver::FlowSolverFactory<dim,nspecies,nstate>::select_flow_case(this->all_parameters, this->parameter_handler);
 
+    // Collect the new ROM points, then solve them together on the process groups
+    MatrixXd new_points(0, rom_points.cols());
     for(auto midpoint : rom_points.rowwise()){
 
         // Check if ROM point already exists as another ROM point
@@ -366,17 +295,37 @@ bool HyperreducedSamplingErrorUpdated<dim, nspecies, nstate>::placeROMLocations(
             }
         }
 
-        if(element == hrom_locations.end() && snapshot_exists == false){
-            std::unique_ptr<ProperOrthogonalDecomposition::ROMSolution<dim, nspecies, nstate>> rom_solution = solveSnapshotROM(midpoint, weights);
-            hrom_locations.emplace_back(std::make_unique<ProperOrthogonalDecomposition::HROMTestLocation<dim,nspecies,nstate>>(midpoint, std::move(rom_solution), flow_solver->dg, weights));
-            if(abs(hrom_locations.back()->total_error) > this->all_parameters->reduced_order_param.adaptation_tolerance){
-                error_greater_than_tolerance = true;
+        // Check if ROM point already appears earlier in rom_points
+        bool point_exists = false;
+        for(auto new_point : new_points.rowwise()){
+            if(new_point.isApprox(midpoint)){
+                point_exists = true;
             }
         }
+
+        if(element == hrom_locations.end() && snapshot_exists == false && point_exists == false){
+            new_points.conservativeResize(new_points.rows()+1, new_points.cols());
+            new_points.row(new_points.rows()-1) = midpoint;
+        }
         else{
             this->pcout << "ROM already computed." << std::endl;
         }
     }
+
+    // Each process group solves with the weights of the cells it owns
+    const std::vector<double> all_weights = this->gatherWeights(weights);
+    auto rom_solve = [this, &all_weights, &weights](const RowVectorXd& parameter, const Parameters::AllParameters& params, std::shared_ptr<ProperOrthogonalDecomposition::PODBase<dim,nspecies>> pod){
+        return solveSnapshotROM(parameter, params, pod, this->getWeightsOnCommunicator(all_weights, weights, params.mpi_communicator));
+    };
+    std::vector<typename AdaptiveSamplingBase<dim,nspecies,nstate>::ROMSolutionAndError> rom_solutions = this->solveSnapshotsROM(new_points, rom_solve);
+
+    bool error_greater_than_tolerance = false;
+    for(int i = 0 ; i < new_points.rows() ; i++){
+        hrom_locations.emplace_back(std::make_unique<ProperOrthogonalDecomposition::HROMTestLocation<dim,nspecies,nstate>>(new_points.row(i), std::move(rom_solutions[i].first), flow_solver->dg, weights, rom_solutions[i].second));
+        if(abs(hrom_locations.back()->total_error) > this->all_parameters->reduced_order_param.adaptation_tolerance){
+            error_greater_than_tolerance = true;
+        }
+    }
     return error_greater_than_tolerance;
 }
 
@@ -493,7 +442,7 @@ void HyperreducedSamplingErrorUpdated<dim, nspecies, nstate>::updateNearestExist
         local_mean_error = local_mean_error / (rom_points.cols() + 1);
         if ((std::abs(hrom_locations[index[0]]->total_error) > this->all_parameters->reduced_order_param.recomputation_coefficient * local_mean_error) || (std::abs(hrom_locations[index[0]]->total_error) < (1/this->all_parameters->reduced_order_param.recomputation_coefficient) * local_mean_error)) {
             this->pcout << "Total error greater than tolerance. Recomputing ROM solution" << std::endl;
-            std::unique_ptr<ProperOrthogonalDecomposition::ROMSolution<dim, nspecies, nstate>> rom_solution = solveSnapshotROM(hrom_locations[index[0]]->parameter, weights);
+            std::unique_ptr<ProperOrthogonalDecomposition::ROMSolution<dim, nspecies, nstate>> rom_solution = solveSnapshotROM(hrom_locations[index[0]]->parameter, this->reinit_params(hrom_locations[index[0]]->parameter), this->current_pod, weights);
             std::unique_ptr<ProperOrthogonalDecomposition::HROMTestLocation<dim, nspecies, nstate>> rom_location = std::make_unique<ProperOrthogonalDecomposition::HROMTestLocation<dim, nspecies, nstate>>(hrom_locations[index[0]]->parameter, std::move(rom_solution), flow_solver->dg, weights);
             hrom_locations[index[0]] = std::move(rom_location);
         }
@@ -501,15 +450,14 @@ void HyperreducedSamplingErrorUpdated<dim, nspecies, nstate>::updateNearestExist
 }
 
 template <int dim, int nspecies, int nstate>
-std::unique_ptr<ProperOrthogonalDecomposition::ROMSolution<dim,nspecies,nstate>> HyperreducedSamplingErrorUpdated<dim, nspecies, nstate>::solveSnapshotROM(const RowVectorXd& parameter, Epetra_Vector weights) const{
+std::unique_ptr<ProperOrthogonalDecomposition::ROMSolution<dim,nspecies,nstate>> HyperreducedSamplingErrorUpdated<dim, nspecies, nstate>::solveSnapshotROM(const RowVectorXd& parameter, const Parameters::AllParameters& params, std::shared_ptr<ProperOrthogonalDecomposition::PODBase<dim,nspecies>> pod, Epetra_Vector weights) const{
     this->pcout << "Solving ROM at " << parameter << std::endl;
-    Parameters::AllParameters params = this->reinit_params(parameter);
 
     std::unique_ptr<FlowSolver::FlowSolver<dim,nspecies,nstate>> flow_solver = FlowSolver::FlowSolverFactory<dim,nspecies,nstate>::select_flow_case(&params, this->parameter_handler);
 
     // Solve implicit solution
     auto ode_solver_type = Parameters::ODESolverParam::ODESolverEnum::hyper_reduced_petrov_galerkin_solver;
-    flow_solver->ode_solver =  PHiLiP::ODE::ODESolverFactory<dim, nspecies, double>::create_ODESolver_manual(ode_solver_type, flow_solver->dg, this->current_pod, weights);
+    flow_solver->ode_solver =  PHiLiP::ODE::ODESolverFactory<dim, nspecies, double>::create_ODESolver_manual(ode_solver_type, flow_solver->dg, pod, weights);
     flow_solver->ode_solver->allocate_ode_system();
     flow_solver->ode_solver->steady_state();
 
@@ -123,7 +123,8 @@ int AdaptiveSampling<dim, nspecies, nstate>::run_sampling() const
 
 template <int dim, int nspecies, int nstate>
 bool AdaptiveSampling<dim, nspecies, nstate>::placeROMLocations(const MatrixXd& rom_points) const{
-    bool error_greater_than_tolerance = false;
+    // Collect the new ROM points, then solve them together on the process groups
+    MatrixXd new_points(0, rom_points.cols());
     for(auto midpoint : rom_points.rowwise()){
 
         // Check if ROM point already exists as another ROM point
@@ -137,17 +138,35 @@ bool AdaptiveSampling<dim, nspecies, nstate>::placeROMLocations(const MatrixXd&
             }
         }
 
-        if(element == this->rom_locations.end() && snapshot_exists == false){
-            std::unique_ptr<ProperOrthogonalDecomposition::ROMSolution<dim, nspecies, nstate>> rom_solution = solveSnapshotROM(midpoint);
-            this->rom_locations.emplace_back(std::make_unique<ProperOrthogonalDecomposition::ROMTestLocation<dim,nspecies,nstate>>(midpoint, std::move(rom_solution)));
-            if(abs(this->rom_locations.back()->total_error) > this->all_parameters->reduced_order_param.adaptation_tolerance){
-                error_greater_than_tolerance = true;
+        // Check if ROM point already appears earlier in rom_points
+        bool point_exists = false;
+        for(auto new_point : new_points.rowwise()){
+            if(new_point.isApprox(midpoint)){
+                point_exists = true;
             }
         }
+
+        if(element == this->rom_locations.end() && snapshot_exists == false && point_exists == false){
+            new_points.conservativeResize(new_points.rows()+1, new_points.cols());
+            new_points.row(new_points.rows()-1) = midpoint;
+        }
         else{
             this->pcout << "ROM already computed." << std::endl;
         }
     }
+
+    auto rom_solve = [this](const RowVectorXd& parameter, const Parameters::AllParameters& params, std::shared_ptr<ProperOrthogonalDecomposition::PODBase<dim,nspecies>> pod){
+        return solveSnapshotROM(parameter, params, pod);
+    };
+    std::vector<typename AdaptiveSamplingBase<dim,nspecies,nstate>::ROMSolutionAndError> rom_solutions = this->solveSnapshotsROM(new_points, rom_solve);
+
+    bool error_greater_than_tolerance = false;
+    for(int i = 0 ; i < new_points.rows() ; i++){
+        this->rom_locations.emplace_back(std::make_unique<ProperOrthogonalDecomposition::ROMTestLocation<dim,nspecies,nstate>>(new_points.row(i), std::move(rom_solutions[i].first), rom_solutions[i].second));
+        if(abs(this->rom_locations.back()->total_error) > this->all_parameters->reduced_order_param.adaptation_tolerance){
+            error_greater_than_tolerance = true;
+        }
+    }
     return error_greater_than_tolerance;
 }
 
@@ -263,7 +282,7 @@ void AdaptiveSampling<dim, nspecies, nstate>::updateNearestExistingROMs(const Ro
         local_mean_error = local_mean_error / (rom_points.cols() + 1);
         if ((std::abs(this->rom_locations[index[0]]->total_error) > this->all_parameters->reduced_order_param.recomputation_coefficient * local_mean_error) || (std::abs(this->rom_locations[index[0]]->total_error) < (1/this->all_parameters->reduced_order_param.recomputation_coefficient) * local_mean_error)) {
             this->pcout << "Total error greater than tolerance. Recomputing ROM solution" << std::endl;
-            std::unique_ptr<ProperOrthogonalDecomposition::ROMSolution<dim, nspecies, nstate>> rom_solution = solveSnapshotROM(this->rom_locations[index[0]]->parameter);
+            std::unique_ptr<ProperOrthogonalDecomposition::ROMSolution<dim, nspecies, nstate>> rom_solution = solveSnapshotROM(this->rom_locations[index[0]]->parameter, this->reinit_params(this->rom_locations[index[0]]->parameter), this->current_pod);
             std::unique_ptr<ProperOrthogonalDecomposition::ROMTestLocation<dim, nspecies, nstate>> rom_location = std::make_unique<ProperOrthogonalDecomposition::ROMTestLocation<dim, nspecies, nstate>>(this->rom_locations[index[0]]->parameter, std::move(rom_solution));
             this->rom_locations[index[0]] = std::move(rom_location);
         }
@@ -271,15 +290,14 @@ void AdaptiveSampling<dim, nspecies, nstate>::updateNearestExistingROMs(const Ro
 }
 
 template <int dim, int nspecies, int nstate>
-std::unique_ptr<ProperOrthogonalDecomposition::ROMSolution<dim,nspecies,nstate>> AdaptiveSampling<dim, nspecies, nstate>::solveSnapshotROM(const RowVectorXd& parameter) const{
+std::unique_ptr<ProperOrthogonalDecomposition::ROMSolution<dim,nspecies,nstate>> AdaptiveSampling<dim, nspecies, nstate>::solveSnapshotROM(const RowVectorXd& parameter, const Parameters::AllParameters& params, std::shared_ptr<ProperOrthogonalDecomposition::PODBase<dim,nspecies>> pod) const{
     this->pcout << "Solving ROM at " << parameter << std::endl;
-    Parameters::AllParameters params = this->reinit_params(parameter);
 
     std::unique_ptr<FlowSolver::FlowSolver<dim,nspecies,nstate>> flow_solver = FlowSolver::FlowSolverFactory<dim,nspecies,nstate>::select_flow_case(&params, this->parameter_handler);
 
     // Solve implicit solution
     auto ode_solver_type = Parameters::ODESolverParam::ODESolverEnum::pod_petrov_galerkin_solver;
-    flow_solver->ode_solver =  PHiLiP::ODE::ODESolverFactory<dim, nspecies, double>::create_ODESolver_manual(ode_solver_type, flow_solver->dg, this->current_pod);
+    flow_solver->ode_solver =  PHiLiP::ODE::ODESolverFactory<dim, nspecies, double>::create_ODESolver_manual(ode_solver_type, flow_solver->dg, pod);
     flow_solver->ode_solver->allocate_ode_system();
     flow_solver->ode_solver->steady_state();
 
@@ -51,7 +51,7 @@ public:
     void updateNearestExistingROMs(const RowVectorXd& parameter) const;
 
     /// Solve reduced-order solution
-    std::unique_ptr<ProperOrthogonalDecomposition::ROMSolution<dim,nspecies,nstate>> solveSnapshotROM(const RowVectorXd& parameter) const;
+    std::unique_ptr<ProperOrthogonalDecomposition::ROMSolution<dim,nspecies,nstate>> solveSnapshotROM(const RowVectorXd& parameter, const Parameters::AllParameters& params, std::shared_ptr<ProperOrthogonalDecomposition::PODBase<dim,nspecies>> pod) const;
 
     /// Functional value predicted by the rom at each sammpling iteration at parameter location specified in the inputs
     mutable std::vector<double> rom_functional;
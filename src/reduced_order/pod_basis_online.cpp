@@ -74,8 +74,7 @@ void OnlinePOD<dim,nspecies>::computeBasis() {
         }
     }
 
-    Epetra_MpiComm epetra_comm(MPI_COMM_WORLD);
-    Epetra_Map domain_map((int)pod_basis.cols(), 0, epetra_comm);
+    Epetra_Map domain_map((int)pod_basis.cols(), 0, epetra_system_matrix.Comm());
 
     epetra_basis.FillComplete(domain_map, system_matrix_map);
 
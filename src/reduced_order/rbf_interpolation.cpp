@@ -2,12 +2,18 @@
 #include <eigen/Eigen/Dense>
 #include <eigen/Eigen/LU>
 #include <iostream>
+#include <cmath>
+#include <limits>
 #include "ROL_StdVector.hpp"
 
 namespace PHiLiP {
 namespace ProperOrthogonalDecomposition {
 
 RBFInterpolation::RBFInterpolation(const MatrixXd& data_coordinates, const VectorXd& data_values, std::string kernel)
+        : RBFInterpolation(data_coordinates, data_values, kernelFromString(kernel))
+{}
+
+RBFInterpolation::RBFInterpolation(const MatrixXd& data_coordinates, const VectorXd& data_values, const RBFKernel kernel)
         : data_coordinates(data_coordinates)
         , data_values(data_values)
         , kernel(kernel)
@@ -15,69 +21,238 @@ RBFInterpolation::RBFInterpolation(const MatrixXd& data_coordinates, const Vecto
     computeWeights();
 }
 
-void RBFInterpolation::computeWeights() {
-    long N = data_coordinates.rows();
+RBFKernel RBFInterpolation::kernelFromString(const std::string &kernel) {
+    if(kernel == "cubic"){
+        return RBFKernel::cubic;
+    }
+    else if(kernel == "linear"){
+        return RBFKernel::linear;
+    }
+    return RBFKernel::thin_plate_spline;
+}
+
+template <RBFKernel kernel_type>
+double RBFInterpolation::kernelFunction(const double r) {
+    if constexpr(kernel_type == RBFKernel::thin_plate_spline){
+        return (r > 0) ? r * r * std::log(r) : 0.0;
+    }
+    else if constexpr(kernel_type == RBFKernel::cubic){
+        return r * r * r;
+    }
+    else {
+        return r;
+    }
+}
+
+template <RBFKernel kernel_type>
+double RBFInterpolation::kernelDerivativeOverRadius(const double r) {
+    // The contribution (x - x_i) phi'(r)/r vanishes at r = 0 for all kernels except the linear one,
+    // which is not differentiable there; zero is used in both cases.
+    if(r <= 0) return 0.0;
+    if constexpr(kernel_type == RBFKernel::thin_plate_spline){
+        return 2.0 * std::log(r) + 1.0;
+    }
+    else if constexpr(kernel_type == RBFKernel::cubic){
+        return 3.0 * r;
+    }
+    else {
+        return 1.0 / r;
+    }
+}
+
+MatrixXd RBFInterpolation::interpolationMatrix() const {
+    const long N = data_coordinates.rows();
 
     MatrixXd A;
     A.resize(N,N);
 
-    for(unsigned int i = 0 ; i < N ; i++){
-        for(unsigned int j = i ; j < N ; j++){
+    for(long i = 0 ; i < N ; i++){
+        for(long j = i ; j < N ; j++){
             double point = (data_coordinates.row(i) - data_coordinates.row(j)).norm();
-            //std::cout << point << std::endl;
             A(i,j) = radialBasisFunction(point);
             A(j,i) = A(i,j);
         }
     }
+    return A;
+}
 
-    weights = A.lu().solve(data_values);
+void RBFInterpolation::computeWeights() {
+    const Eigen::PartialPivLU<MatrixXd> lu = interpolationMatrix().lu();
+    weights = lu.solve(data_values);
+    inverse_interpolation_matrix = lu.inverse();
+    n_updates = 0;
 }
 
-double RBFInterpolation::radialBasisFunction(double r) const{
-    if(kernel == "thin_plate_spline"){
-        if(r > 0){
-            return std::pow(r, 2) * std::log(r);
+int RBFInterpolation::findRow(const MatrixXd& matrix, const RowVectorXd& coordinate) {
+    for(long i = 0 ; i < matrix.rows() ; i++){
+        if(matrix.row(i) == coordinate) return i;
+    }
+    return -1;
+}
+
+bool RBFInterpolation::addPoint(const RowVectorXd& coordinate) {
+    const long N = data_coordinates.rows();
+
+    VectorXd b(N);
+    for(long i = 0 ; i < N ; i++){
+        b(i) = radialBasisFunction((coordinate - data_coordinates.row(i)).norm());
+    }
+    const VectorXd w = inverse_interpolation_matrix * b;
+    // Schur complement of the bordered matrix [A b; b^T phi(0)]
+    const double schur = radialBasisFunction(0.0) - b.dot(w);
+    if(std::abs(schur) <= 1e3 * std::numeric_limits<double>::epsilon() * b.norm() * w.norm()) return false;
+
+    inverse_interpolation_matrix.conservativeResize(N+1, N+1);
+    inverse_interpolation_matrix.topLeftCorner(N,N).noalias() += (w / schur) * w.transpose();
+    inverse_interpolation_matrix.topRightCorner(N,1) = -w / schur;
+    inverse_interpolation_matrix.bottomLeftCorner(1,N) = -w.transpose() / schur;
+    inverse_interpolation_matrix(N,N) = 1.0 / schur;
+
+    data_coordinates.conservativeResize(N+1, Eigen::NoChange);
+    data_coordinates.row(N) = coordinate;
+    return true;
+}
+
+bool RBFInterpolation::removePoint(const int index) {
+    const long N = data_coordinates.rows();
+    const double pivot = inverse_interpolation_matrix(index, index);
+    if(std::abs(pivot) <= std::numeric_limits<double>::epsilon() * inverse_interpolation_matrix.cwiseAbs().maxCoeff()) return false;
+
+    // Inverse of A with row/column index removed: M_rr - M_ri M_ir / M_ii
+    const VectorXd column = inverse_interpolation_matrix.col(index);
+    const RowVectorXd row = inverse_interpolation_matrix.row(index);
+    inverse_interpolation_matrix.noalias() -= (column / pivot) * row;
+
+    const long n_after = N - index - 1;
+    inverse_interpolation_matrix.block(index, 0, n_after, N) = inverse_interpolation_matrix.block(index+1, 0, n_after, N).eval();
+    inverse_interpolation_matrix.block(0, index, N, n_after) = inverse_interpolation_matrix.block(0, index+1, N, n_after).eval();
+    inverse_interpolation_matrix.conservativeResize(N-1, N-1);
+
+    data_coordinates.block(index, 0, n_after, data_coordinates.cols()) = data_coordinates.block(index+1, 0, n_after, data_coordinates.cols()).eval();
+    data_coordinates.conservativeResize(N-1, Eigen::NoChange);
+    return true;
+}
+
+void RBFInterpolation::updateData(const MatrixXd& new_coordinates, const VectorXd& new_values) {
+    bool rebuild = (new_coordinates.cols() != data_coordinates.cols());
+
+    // Each rank-one update costs O(N^2) while a refactorization costs O(N^3), so rebuild directly
+    // when a large part of the points changes (e.g. the coordinates were rescaled)
+    if(!rebuild){
+        long n_removed = 0;
+        for(long i = 0 ; i < data_coordinates.rows() ; i++){
+            if(findRow(new_coordinates, data_coordinates.row(i)) < 0) n_removed++;
         }
-        else{
-            return 0;
+        const long n_added = new_coordinates.rows() - (data_coordinates.rows() - n_removed);
+        rebuild = (2 * (n_removed + n_added) > new_coordinates.rows());
+    }
+
+    // Remove points that are no longer part of the data
+    for(long i = data_coordinates.rows()-1 ; i >= 0 && !rebuild ; i--){
+        if(findRow(new_coordinates, data_coordinates.row(i)) < 0){
+            rebuild = !removePoint(i);
         }
     }
-    else if(kernel == "cubic"){
-        return std::pow(r, 3);
+    // Append new points
+    for(long i = 0 ; i < new_coordinates.rows() && !rebuild ; i++){
+        if(findRow(data_coordinates, new_coordinates.row(i)) < 0){
+            rebuild = !addPoint(new_coordinates.row(i));
+        }
     }
-    else if(kernel == "linear"){
-        return r;
+
+    if(rebuild){
+        data_coordinates = new_coordinates;
+        data_values = new_values;
+        computeWeights();
+        return;
     }
-    else{
-        return std::pow(r, 2) * std::log(r);
+
+    // Reorder the values to match the stored points
+    data_values.resize(data_coordinates.rows());
+    for(long i = 0 ; i < data_coordinates.rows() ; i++){
+        data_values(i) = new_values(findRow(new_coordinates, data_coordinates.row(i)));
+    }
+    weights = inverse_interpolation_matrix * data_values;
+
+    // Refactor when the updated inverse has drifted too far from the interpolation matrix
+    const MatrixXd A = interpolationMatrix();
+    const double residual = (A * weights - data_values).norm();
+    const double scale = A.norm() * weights.norm() + data_values.norm();
+    if(++n_updates >= max_updates || !(residual <= residual_tolerance * scale)){
+        computeWeights();
     }
 }
 
-double RBFInterpolation::evaluate(const RowVectorXd& evaluate_coordinate) const {
-    long N = data_coordinates.rows();
+double RBFInterpolation::radialBasisFunction(double r) const{
+    switch(kernel){
+        case RBFKernel::cubic: return kernelFunction<RBFKernel::cubic>(r);
+        case RBFKernel::linear: return kernelFunction<RBFKernel::linear>(r);
+        default: return kernelFunction<RBFKernel::thin_plate_spline>(r);
+    }
+}
 
-    RowVectorXd s(1,N);
+template <RBFKernel kernel_type>
+double RBFInterpolation::evaluateKernel(const RowVectorXd& evaluate_coordinate) const {
+    double val = 0;
+    for(long i = 0 ; i < data_coordinates.rows() ; i++){
+        const double point = (evaluate_coordinate - data_coordinates.row(i)).norm();
+        val += weights(i) * kernelFunction<kernel_type>(point);
+    }
+    return val;
+}
 
-    for(unsigned int i = 0 ; i < N ; i++){
-        double point = (evaluate_coordinate - data_coordinates.row(i)).norm();
-        s(0,i) = radialBasisFunction(point);
+double RBFInterpolation::evaluate(const RowVectorXd& evaluate_coordinate) const {
+    switch(kernel){
+        case RBFKernel::cubic: return evaluateKernel<RBFKernel::cubic>(evaluate_coordinate);
+        case RBFKernel::linear: return evaluateKernel<RBFKernel::linear>(evaluate_coordinate);
+        default: return evaluateKernel<RBFKernel::thin_plate_spline>(evaluate_coordinate);
     }
+}
 
-    //std::cout << s*weights << std::endl;
+template <RBFKernel kernel_type>
+RowVectorXd RBFInterpolation::evaluateGradientKernel(const RowVectorXd& evaluate_coordinate) const {
+    RowVectorXd grad = RowVectorXd::Zero(evaluate_coordinate.size());
+    for(long i = 0 ; i < data_coordinates.rows() ; i++){
+        const RowVectorXd difference = evaluate_coordinate - data_coordinates.row(i);
+        grad += (weights(i) * kernelDerivativeOverRadius<kernel_type>(difference.norm())) * difference;
+    }
+    return grad;
+}
 
-    return s*weights;
+RowVectorXd RBFInterpolation::evaluateGradient(const RowVectorXd& evaluate_coordinate) const {
+    switch(kernel){
+        case RBFKernel::cubic: return evaluateGradientKernel<RBFKernel::cubic>(evaluate_coordinate);
+        case RBFKernel::linear: return evaluateGradientKernel<RBFKernel::linear>(evaluate_coordinate);
+        default: return evaluateGradientKernel<RBFKernel::thin_plate_spline>(evaluate_coordinate);
+    }
 }
 
-double RBFInterpolation::value(const ROL::Vector<double> &x, double &/*tol*/ ) {
+RowVectorXd RBFInterpolation::toCoordinate(const ROL::Vector<double> &x) {
     ROL::Ptr<const vector> xp = getVector<ROL::StdVector<double>>(x);
-    RowVectorXd evaluate_coordinate(2);
-    evaluate_coordinate(0) = (*xp)[0];
-    evaluate_coordinate(1) = (*xp)[1];
-    double val = evaluate(evaluate_coordinate);
+    RowVectorXd evaluate_coordinate(xp->size());
+    for(unsigned int j = 0 ; j < xp->size() ; j++){
+        evaluate_coordinate(j) = (*xp)[j];
+    }
+    return evaluate_coordinate;
+}
+
+double RBFInterpolation::value(const ROL::Vector<double> &x, double &/*tol*/ ) {
+    double val = evaluate(toCoordinate(x));
 
     //For optimization, return -abs(val) to consider only magnitude of error, not sign
     return -std::abs(val);
 }
 
+void RBFInterpolation::gradient(ROL::Vector<double> &g, const ROL::Vector<double> &x, double &/*tol*/ ) {
+    const RowVectorXd evaluate_coordinate = toCoordinate(x);
+    const double sign = (evaluate(evaluate_coordinate) >= 0) ? -1.0 : 1.0;
+    const RowVectorXd grad = sign * evaluateGradient(evaluate_coordinate);
+
+    ROL::Ptr<vector> gp = dynamic_cast<ROL::StdVector<double>&>(g).getVector();
+    for(unsigned int j = 0 ; j < gp->size() ; j++){
+        (*gp)[j] = grad(j);
+    }
+}
+
+}
 }
-}
\ No newline at end of file
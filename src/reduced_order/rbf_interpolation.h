@@ -11,33 +11,67 @@ using Eigen::MatrixXd;
 using Eigen::VectorXd;
 using Eigen::RowVectorXd;
 
+/// Radial basis function kernels
+enum class RBFKernel {
+    thin_plate_spline, ///< r^2 log(r)
+    cubic,             ///< r^3
+    linear             ///< r
+};
+
 /// Radial basis function interpolation
+/** The inverse of the interpolation matrix is stored so that points can be added or removed
+ *  with O(N^2) rank-one updates (bordering / Schur complement) instead of refactoring the matrix.
+ *  Since the updates accumulate round-off, the weights they give are checked against the residual
+ *  of the interpolation conditions and the matrix is refactored periodically.
+ *  The kernel is selected once at construction and dispatched through a template.
+ */
 class RBFInterpolation: public ROL::Objective<double>
 {
 public:
     /// Constructor
     RBFInterpolation(const MatrixXd& data_coordinates, const VectorXd& data_values, std::string kernel);
 
+    /// Constructor
+    RBFInterpolation(const MatrixXd& data_coordinates, const VectorXd& data_values, const RBFKernel kernel);
+
+    /// Converts a kernel name to its RBFKernel, defaulting to the thin plate spline
+    static RBFKernel kernelFromString(const std::string &kernel);
+
     /// Compute RBF interpolation weights
+    /** Solves for the weights with the LU factorization of the interpolation matrix,
+     *  and rebuilds its inverse from the same factorization. */
     void computeWeights();
 
+    /// Update the interpolation to a new set of data
+    /** Points of the current set that are absent from new_coordinates are removed, new points
+     *  are appended, and the weights are recomputed from new_values. Points are matched by their
+     *  exact coordinates, so the ordering of new_coordinates does not matter.
+     *  The inverse is rebuilt from scratch when more than half of the points change, when an
+     *  update is ill-conditioned, after max_updates updates, or when the weights do not satisfy
+     *  the interpolation conditions to residual_tolerance.
+     */
+    void updateData(const MatrixXd& new_coordinates, const VectorXd& new_values);
+
     /// Choose radial basis function
     double radialBasisFunction(double r) const;
 
     /// Evaluate RBF
     double evaluate(const RowVectorXd& evaluate_coordinate) const;
 
+    /// Evaluate gradient of the RBF with respect to the coordinate
+    RowVectorXd evaluateGradient(const RowVectorXd& evaluate_coordinate) const;
+
     /// RBF weights
     VectorXd weights;
 
     /// Data coordinates
-    const MatrixXd data_coordinates;
+    MatrixXd data_coordinates;
 
     /// Data values
-    const VectorXd data_values;
+    VectorXd data_values;
 
     /// RBF kernel
-    const std::string kernel;
+    const RBFKernel kernel;
 
     /// ROL required
     typedef std::vector<double> vector;
@@ -51,12 +85,58 @@ public:
     }
 
     /// ROL evaluate value
-    double value(const ROL::Vector<double> &x, double &/*tol*/ );
+    double value(const ROL::Vector<double> &x, double &/*tol*/ ) override;
+
+    /// ROL evaluate gradient
+    void gradient(ROL::Vector<double> &g, const ROL::Vector<double> &x, double &/*tol*/ ) override;
+
+private:
+    /// Inverse of the interpolation matrix A_ij = phi(|x_i - x_j|)
+    MatrixXd inverse_interpolation_matrix;
+
+    /// Number of updateData calls since the last factorization
+    unsigned int n_updates = 0;
+
+    /// Maximum number of updateData calls between factorizations
+    static constexpr unsigned int max_updates = 20;
+
+    /// Tolerance on the relative residual ||A w - f|| / (||A|| ||w|| + ||f||) of updated weights
+    static constexpr double residual_tolerance = 1e-10;
+
+    /// Interpolation matrix of the data coordinates
+    MatrixXd interpolationMatrix() const;
+
+    /// Kernel phi(r)
+    template <RBFKernel kernel_type>
+    static double kernelFunction(const double r);
+
+    /// Kernel derivative divided by the radius phi'(r)/r, zero at r = 0
+    template <RBFKernel kernel_type>
+    static double kernelDerivativeOverRadius(const double r);
+
+    /// Evaluate RBF with a fixed kernel
+    template <RBFKernel kernel_type>
+    double evaluateKernel(const RowVectorXd& evaluate_coordinate) const;
+
+    /// Evaluate gradient of the RBF with a fixed kernel
+    template <RBFKernel kernel_type>
+    RowVectorXd evaluateGradientKernel(const RowVectorXd& evaluate_coordinate) const;
+
+    /// Append a point by bordering the inverse. Returns false if the point makes the matrix singular.
+    bool addPoint(const RowVectorXd& coordinate);
+
+    /// Remove a point through the Schur complement of the inverse. Returns false if the update is unstable.
+    bool removePoint(const int index);
+
+    /// Index of a row of matrix equal to coordinate, -1 if there is none
+    static int findRow(const MatrixXd& matrix, const RowVectorXd& coordinate);
 
+    /// Copy the x vector of ROL into an Eigen row vector
+    RowVectorXd toCoordinate(const ROL::Vector<double> &x);
 };
 
 }
 }
 
 
-#endif
\ No newline at end of file
+#endif
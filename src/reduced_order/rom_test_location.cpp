@@ -25,6 +25,12 @@ ROMTestLocation<dim, nspecies, nstate>::ROMTestLocation(const RowVectorXd& param
 {
 }
 
+template <int dim, int nspecies, int nstate>
+ROMTestLocation<dim, nspecies, nstate>::ROMTestLocation(const RowVectorXd& parameter, std::unique_ptr<ROMSolution<dim, nspecies, nstate>> rom_solution, const double fom_to_initial_rom_error)
+        :  TestLocationBase<dim, nspecies, nstate>(parameter, std::move(rom_solution), fom_to_initial_rom_error)
+{
+}
+
 template <int dim, int nspecies, int nstate>
 void ROMTestLocation<dim, nspecies, nstate>::compute_initial_rom_to_final_rom_error(std::shared_ptr<ProperOrthogonalDecomposition::PODBase<dim,nspecies>> pod_updated){
 
@@ -19,6 +19,9 @@ public:
     /// Constructor
     ROMTestLocation(const RowVectorXd& parameter, std::unique_ptr<ROMSolution < dim, nspecies, nstate>> rom_solution);
 
+    /// Constructor with the error between the FOM and the initial ROM already computed
+    ROMTestLocation(const RowVectorXd& parameter, std::unique_ptr<ROMSolution < dim, nspecies, nstate>> rom_solution, const double fom_to_initial_rom_error);
+
     /// Compute error between initial ROM and final ROM
     void compute_initial_rom_to_final_rom_error(std::shared_ptr<ProperOrthogonalDecomposition::PODBase<dim,nspecies>> pod_updated) override;
 
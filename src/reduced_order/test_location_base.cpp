@@ -35,6 +35,19 @@ TestLocationBase<dim, nspecies, nstate>::TestLocationBase(const RowVectorXd& par
     pcout << "ROM test location created. Error estimate updated." << std::endl;
 }
 
+template <int dim, int nspecies, int nstate>
+TestLocationBase<dim, nspecies, nstate>::TestLocationBase(const RowVectorXd& parameter, std::unique_ptr<ROMSolution<dim, nspecies, nstate>> rom_solution, const double fom_to_initial_rom_error)
+        : parameter(parameter)
+        , rom_solution(std::move(rom_solution))
+        , fom_to_initial_rom_error(fom_to_initial_rom_error)
+        , initial_rom_to_final_rom_error(0)
+        , total_error(fom_to_initial_rom_error)
+        , mpi_communicator(MPI_COMM_WORLD)
+        , mpi_rank(dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD))
+        , pcout(std::cout, mpi_rank==0)
+{
+}
+
 template <int dim, int nspecies, int nstate>
 void TestLocationBase<dim, nspecies, nstate>::compute_FOM_to_initial_ROM_error(){
     pcout << "Computing adjoint-based error estimate between ROM and FOM..." << std::endl;
@@ -18,6 +18,9 @@ public:
     /// Constructor
     TestLocationBase(const RowVectorXd& parameter, std::unique_ptr<ROMSolution < dim, nspecies, nstate>> rom_solution);
 
+    /// Constructor with the error between the FOM and the initial ROM already computed
+    TestLocationBase(const RowVectorXd& parameter, std::unique_ptr<ROMSolution < dim, nspecies, nstate>> rom_solution, const double fom_to_initial_rom_error);
+
     /// Destructor
     virtual ~TestLocationBase () {};
 
@@ -90,12 +90,14 @@ int AnisotropicMeshAdaptationCases<dim, nspecies, nstate> :: run_test () const
     const bool use_goal_oriented_approach = param.mesh_adaptation_param.use_goal_oriented_mesh_adaptation;
     const double complexity = param.mesh_adaptation_param.mesh_complexity_anisotropic_adaptation;
     const double normLp = param.mesh_adaptation_param.norm_Lp_anisotropic_adaptation;
+    const bool use_in_process_remeshing = param.mesh_adaptation_param.use_in_process_anisotropic_remeshing;
 
     std::unique_ptr<AnisotropicMeshAdaptation<dim, nspecies, nstate, double>> anisotropic_mesh_adaptation =
-                        std::make_unique<AnisotropicMeshAdaptation<dim, nspecies, nstate, double>> (flow_solver->dg, normLp, complexity, use_goal_oriented_approach);
+                        std::make_unique<AnisotropicMeshAdaptation<dim, nspecies, nstate, double>> (flow_solver->dg, normLp, complexity, use_goal_oriented_approach, use_in_process_remeshing);
     
     flow_solver->run();
     const double functional_initial = evaluate_functional(flow_solver->dg);
+    const unsigned int n_cells_initial = flow_solver->dg->triangulation->n_global_active_cells();
     const unsigned int n_adaptation_cycles = param.mesh_adaptation_param.total_mesh_adaptation_cycles;
     
     for(unsigned int cycle = 0; cycle < n_adaptation_cycles; ++cycle)
@@ -104,6 +106,12 @@ int AnisotropicMeshAdaptationCases<dim, nspecies, nstate> :: run_test () const
         flow_solver->run();
     }
     const double functional_final = evaluate_functional(flow_solver->dg);
+    const unsigned int n_cells_final = flow_solver->dg->triangulation->n_global_active_cells();
+    pcout<<"Number of active cells went from "<<n_cells_initial<<" to "<<n_cells_final<<" after adaptation."<<std::endl;
+
+    const double functional_exact = 0.5625;
+    const double error_initial = abs(functional_initial-functional_exact);
+    const double error_final = abs(functional_final-functional_exact);
 
     verify_fe_values_shape_hessian(*(flow_solver->dg));
 
@@ -119,13 +127,23 @@ int AnisotropicMeshAdaptationCases<dim, nspecies, nstate> :: run_test () const
     pcout<<"Distance to the expected coordinates of the highest refined cell = "<<distance_val<<std::endl;
 
     int test_val = 0;
+    if(use_in_process_remeshing)
+    { // The initial mesh is refined in place, so it must gain cells towards the metric complexity and reduce the functional error.
+        if( !(n_cells_final > n_cells_initial) ) {
+            pcout<<"In-process remeshing did not refine the mesh. Test failed."<<std::endl;
+            test_val++;
+        }
+        if( !(error_final < error_initial) ) {
+            pcout<<"Functional error has not decreased after in-process remeshing. Test failed."<<std::endl;
+            pcout<<"error_initial = "<<error_initial<<std::endl;
+            pcout<<"error_final = "<<error_final<<std::endl;
+            test_val++;
+        }
+        return test_val;
+    }
     if(distance_val < 0.1) {return test_val;}// within a ball of radius 0.1
     else
     { // Check if functional error has decreased.
-        const double functional_exact = 0.5625;
-        const double error_initial = abs(functional_initial-functional_exact);
-        const double error_final = abs(functional_final-functional_exact);
-
         if( !(error_final < error_initial) ) {
             pcout<<"Functional error has not decreased after adaptation. Test failed."<<std::endl;
             pcout<<"error_initial = "<<error_initial<<std::endl;
@@ -91,6 +91,11 @@ int GridRefinementStudy<dim,nspecies,nstate,MeshType>::run_test() const
 
     std::vector<double> error_per_cell;
 
+    // final grid size and solution error of each run, to compare the continuous refinement outputs
+    std::vector<unsigned int> final_n_cells;
+    std::vector<double> final_l2_error;
+    int test_fail = 0;
+
     // start of loop for each grid refinement run
     for(unsigned int iref = 0; iref <  (num_refinements?num_refinements:1); ++iref){
         // getting the parameters for this run
@@ -327,6 +332,21 @@ int GridRefinementStudy<dim,nspecies,nstate,MeshType>::run_test() const
             msh_out.write_msh(out_msh);
         }
 
+        final_n_cells.push_back(grid->n_global_active_cells());
+        final_l2_error.push_back(solution_error.empty() ? 0.0 : solution_error.back());
+
+        // the metric-conforming refinement in process must reduce the error of the initial grid
+        using RefinementMethodEnum = Parameters::GridRefinementParam::RefinementMethod;
+        using OutputTypeEnum = Parameters::GridRefinementParam::OutputType;
+        if(gr_param.refinement_method == RefinementMethodEnum::continuous 
+        && gr_param.output_type == OutputTypeEnum::in_process
+        && solution_error.size() > 1
+        && solution_error.back() >= solution_error.front()){
+            pcout << "In process continuous refinement did not reduce the error: "
+                  << solution_error.front() << " -> " << solution_error.back() << std::endl;
+            test_fail = 1;
+        }
+
         if(grs_param.output_solution_error || grs_param.output_functional_error){
             pcout << " ********************************************" << std::endl
                 << " Convergence rates for p = " << poly_degree << std::endl
@@ -387,7 +407,38 @@ int GridRefinementStudy<dim,nspecies,nstate,MeshType>::run_test() const
     if(pcout.is_active() && grs_param.output_gnuplot_functional)
         output_gnufig_functional(gf_functional);
 
-    return 0;
+    // the in process refinement should reach a grid of similar size and accuracy as the remeshing
+    // of the same size field through gmsh, it only lacks the freedom to move vertices
+    const double max_cells_ratio = 2.0;
+    const double max_error_ratio = 4.0;
+    using RefinementMethodEnum = Parameters::GridRefinementParam::RefinementMethod;
+    using OutputTypeEnum = Parameters::GridRefinementParam::OutputType;
+    for(unsigned int iref = 0; iref < final_n_cells.size(); ++iref){
+        const Parameters::GridRefinementParam &gr_param = grs_param.grid_refinement_param_vector[iref];
+        if(gr_param.refinement_method != RefinementMethodEnum::continuous || gr_param.output_type != OutputTypeEnum::in_process)
+            continue;
+
+        for(unsigned int jref = 0; jref < final_n_cells.size(); ++jref){
+            const Parameters::GridRefinementParam &gr_param_gmsh = grs_param.grid_refinement_param_vector[jref];
+            if(gr_param_gmsh.refinement_method != RefinementMethodEnum::continuous 
+            || gr_param_gmsh.output_type != OutputTypeEnum::gmsh_out
+            || gr_param_gmsh.refinement_steps != gr_param.refinement_steps
+            || gr_param_gmsh.complexity_scale != gr_param.complexity_scale
+            || gr_param_gmsh.complexity_add != gr_param.complexity_add)
+                continue;
+
+            const double cells_ratio = (double)final_n_cells[iref] / final_n_cells[jref];
+            const double error_ratio = final_l2_error[iref] / final_l2_error[jref];
+            pcout << "In process refinement " << iref << " against gmsh refinement " << jref 
+                  << ": cells ratio = " << cells_ratio << ", l2 error ratio = " << error_ratio << std::endl;
+            if(cells_ratio > max_cells_ratio || cells_ratio < 1.0/max_cells_ratio || error_ratio > max_error_ratio){
+                pcout << "In process refinement differs from the gmsh remeshing." << std::endl;
+                test_fail = 1;
+            }
+        }
+    }
+
+    return test_fail;
 }
 
 // gets the grid from the enum and reads file if neccesary
@@ -0,0 +1,137 @@
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <deal.II/base/conditional_ostream.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_tools.h>
+
+#include <deal.II/numerics/vector_tools.h>
+
+#include "physics/physics_factory.h"
+#include "physics/manufactured_solution.h"
+#include "parameters/all_parameters.h"
+#include "parameters/parameters.h"
+#include "dg/dg_factory.hpp"
+#include "functional/functional.h"
+
+const double TOLERANCE = 1e-12;
+
+#if PHILIP_DIM==1
+    using Triangulation = dealii::Triangulation<PHILIP_DIM>;
+#else
+    using Triangulation = dealii::parallel::distributed::Triangulation<PHILIP_DIM>;
+#endif
+
+/// Relative l2 difference between two derivative vectors.
+double relative_difference(const dealii::LinearAlgebra::distributed::Vector<double> &derivative,
+                           const dealii::LinearAlgebra::distributed::Vector<double> &reference)
+{
+    dealii::LinearAlgebra::distributed::Vector<double> difference = derivative;
+    difference -= reference;
+    return difference.l2_norm() / (1.0 + reference.l2_norm());
+}
+
+/// Compares the value, dIdW and dIdX of @p functional_first_order, evaluated without d2I
+/// and therefore with FadType, against @p functional_second_order evaluated with d2I through FadFadType.
+template <int dim, int nspecies, int nstate>
+int compare_first_and_second_order_ad(
+    const std::string &name,
+    PHiLiP::Functional<dim,nspecies,nstate,double> &functional_first_order,
+    PHiLiP::Functional<dim,nspecies,nstate,double> &functional_second_order,
+    const dealii::ConditionalOStream &pcout)
+{
+    const double value_first_order = functional_first_order.evaluate_functional(true,true,false);
+    const double value_second_order = functional_second_order.evaluate_functional(true,true,true);
+
+    const double value_difference = std::abs(value_first_order - value_second_order) / (1.0 + std::abs(value_second_order));
+    const double dIdW_difference = relative_difference(functional_first_order.dIdw, functional_second_order.dIdw);
+    const double dIdX_difference = relative_difference(functional_first_order.dIdX, functional_second_order.dIdX);
+
+    pcout << name << ": value " << value_first_order
+          << ", relative difference in value " << value_difference
+          << ", in dIdW " << dIdW_difference
+          << ", in dIdX " << dIdX_difference << std::endl;
+
+    const double dIdW_norm = functional_first_order.dIdw.l2_norm();
+    const double dIdX_norm = functional_first_order.dIdX.l2_norm();
+    if (dIdW_norm == 0.0 || dIdX_norm == 0.0) {
+        pcout << name << ": the first-order derivatives are zero." << std::endl;
+        return 1;
+    }
+    return (value_difference > TOLERANCE || dIdW_difference > TOLERANCE || dIdX_difference > TOLERANCE);
+}
+
+/** Tests that the functionals evaluating their first derivatives with FadType
+ *  give the same value, dIdW and dIdX as the FadFadType evaluation used for d2I.
+ */
+int main(int argc, char *argv[])
+{
+    const int dim = PHILIP_DIM;
+    const int nspecies = 1;
+    const int nstate = 1;
+    int fail_bool = false;
+
+    // Initializing MPI
+    dealii::Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+    const int this_mpi_process = dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD);
+    dealii::ConditionalOStream pcout(std::cout, this_mpi_process==0);
+
+    // Initializing parameter handling
+    dealii::ParameterHandler parameter_handler;
+    PHiLiP::Parameters::AllParameters::declare_parameters(parameter_handler);
+    PHiLiP::Parameters::AllParameters all_parameters;
+    all_parameters.parse_parameters(parameter_handler);
+
+    const unsigned poly_degree = 2;
+
+    // Distorted grid so that dIdX does not vanish by symmetry
+    std::shared_ptr<Triangulation> grid = std::make_shared<Triangulation>(
+#if PHILIP_DIM!=1
+        MPI_COMM_WORLD,
+#endif
+        typename dealii::Triangulation<dim>::MeshSmoothing(
+            dealii::Triangulation<dim>::smoothing_on_refinement |
+            dealii::Triangulation<dim>::smoothing_on_coarsening));
+
+    const bool colorize = true;
+    dealii::GridGenerator::hyper_cube(*grid, 0.0, 1.0, colorize);
+    grid->refine_global(2);
+    const double random_factor = 0.2;
+    const bool keep_boundary = false;
+    dealii::GridTools::distort_random(random_factor, *grid, keep_boundary);
+
+    std::shared_ptr < PHiLiP::DGBase<dim, nspecies, double> > dg = PHiLiP::DGFactory<dim,nspecies,double>::create_discontinuous_galerkin(&all_parameters, poly_degree, grid);
+    dg->allocate_system();
+
+    // Manufactured solution as the state
+    std::shared_ptr <PHiLiP::Physics::PhysicsBase<dim,nspecies,nstate,double>> physics_double = PHiLiP::Physics::PhysicsFactory<dim, nspecies, nstate, double>::create_Physics(&all_parameters);
+    dealii::LinearAlgebra::distributed::Vector<double> solution_no_ghost;
+    solution_no_ghost.reinit(dg->locally_owned_dofs, MPI_COMM_WORLD);
+    dealii::VectorTools::interpolate(dg->dof_handler, *physics_double->manufactured_solution_function, solution_no_ghost);
+    dg->solution = solution_no_ghost;
+
+    const double normLp = 3.0;
+    {
+        PHiLiP::FunctionalNormLpVolume<dim,nspecies,nstate,double> functional_first_order(normLp, dg);
+        PHiLiP::FunctionalNormLpVolume<dim,nspecies,nstate,double> functional_second_order(normLp, dg);
+        fail_bool |= compare_first_and_second_order_ad<dim,nspecies,nstate>("Volume Lp norm", functional_first_order, functional_second_order, pcout);
+    }
+    {
+        const std::vector<unsigned int> boundary_vector;
+        const bool use_all_boundaries = true;
+        PHiLiP::FunctionalNormLpBoundary<dim,nspecies,nstate,double> functional_first_order(normLp, boundary_vector, use_all_boundaries, dg);
+        PHiLiP::FunctionalNormLpBoundary<dim,nspecies,nstate,double> functional_second_order(normLp, boundary_vector, use_all_boundaries, dg);
+        fail_bool |= compare_first_and_second_order_ad<dim,nspecies,nstate>("Boundary Lp norm", functional_first_order, functional_second_order, pcout);
+    }
+
+    if (fail_bool) {
+        pcout << "Test failed." << std::endl;
+    } else {
+        pcout << "Test successful." << std::endl;
+    }
+    return fail_bool;
+}
@@ -0,0 +1,130 @@
+#include <deal.II/base/conditional_ostream.h>
+#include <deal.II/base/convergence_table.h>
+
+#include <deal.II/distributed/tria.h>
+#include <deal.II/grid/grid_generator.h>
+
+#include "mesh/high_order_grid.h"
+#include "mesh/meshmover_linear_elasticity.hpp"
+
+/// Bump displacement of the bottom surface, which decays linearly towards the top surface.
+template<int dim>
+dealii::Point<dim> bump_deformation(dealii::Point<dim> point) {
+    const double amplitude = 0.1;
+    double r2 = 0.0;
+    for (int d=0; d<dim-1; ++d) {
+        r2 += (point[d]-0.5)*(point[d]-0.5);
+    }
+    dealii::Point<dim> new_point = point;
+    new_point[dim-1] += amplitude * std::exp(-25.0*r2) * (1.0 - point[dim-1]);
+    return new_point;
+}
+
+/** Tests that the AMG preconditioned LinearElasticity solve takes a number of iterations
+ *  that stays flat under global refinement, and that it gives the same volume displacements
+ *  as the ILUT preconditioned solve and as a mesh mover reusing a cached preconditioner
+ *  whose original mesh mover has been destroyed.
+ */
+int main (int argc, char * argv[])
+{
+    const int dim = PHILIP_DIM;
+
+    dealii::Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+    const int mpi_rank = dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD);
+    dealii::ConditionalOStream pcout(std::cout, mpi_rank==0);
+
+    using namespace PHiLiP;
+    using VectorType = dealii::LinearAlgebra::distributed::Vector<double>;
+    using MeshMoverType = MeshMover::LinearElasticity<dim, double>;
+
+    const unsigned int poly_degree = 2;
+    const unsigned int initial_n_cells = 4;
+    const unsigned int n_grids = (dim == 3) ? 3 : 4;
+    // Mesh-independent convergence: every refinement stays within a few iterations of the coarsest grid.
+    const unsigned int max_additional_iterations = 4;
+    const double solution_tolerance = 1e-8;
+
+    int fail_bool = false;
+    std::vector<unsigned int> n_iterations(n_grids);
+    dealii::ConvergenceTable convergence_table;
+
+    for (unsigned int igrid=0; igrid<n_grids; ++igrid) {
+
+        using Triangulation = dealii::parallel::distributed::Triangulation<dim>;
+        std::shared_ptr<Triangulation> grid = std::make_shared<Triangulation>(
+            MPI_COMM_WORLD,
+            typename dealii::Triangulation<dim>::MeshSmoothing(
+                dealii::Triangulation<dim>::smoothing_on_refinement |
+                dealii::Triangulation<dim>::smoothing_on_coarsening));
+        dealii::GridGenerator::subdivided_hyper_cube(*grid, initial_n_cells);
+        grid->refine_global(igrid);
+
+        HighOrderGrid<dim,double> high_order_grid(poly_degree, grid);
+
+        std::function<dealii::Point<dim>(dealii::Point<dim>)> transformation = bump_deformation<dim>;
+        VectorType surface_node_displacements = high_order_grid.transform_surface_nodes(transformation);
+        surface_node_displacements -= high_order_grid.surface_nodes;
+        surface_node_displacements.update_ghost_values();
+
+        MeshMoverType meshmover(high_order_grid, surface_node_displacements);
+        meshmover.preconditioner_type = MeshMoverType::PreconditionerType::amg;
+        const VectorType volume_displacements = meshmover.get_volume_displacements();
+        n_iterations[igrid] = meshmover.get_last_n_linear_iterations();
+
+        convergence_table.add_value("cells", grid->n_global_active_cells());
+        convergence_table.add_value("DoFs", high_order_grid.dof_handler_grid.n_dofs());
+        convergence_table.add_value("AMG iterations", n_iterations[igrid]);
+
+        if (igrid != 0) continue;
+
+        // Same displacements when reusing the preconditioner in another mesh mover on the same mesh,
+        // after the mesh mover that built it has been destroyed, as done by FreeFormDeformation.
+        std::shared_ptr<dealii::TrilinosWrappers::PreconditionBase> cached_preconditioner;
+        {
+            MeshMoverType meshmover_cache(high_order_grid, surface_node_displacements);
+            cached_preconditioner = meshmover_cache.get_preconditioner();
+        }
+        MeshMoverType meshmover_reuse(high_order_grid, surface_node_displacements);
+        meshmover_reuse.set_preconditioner(cached_preconditioner);
+        VectorType difference = meshmover_reuse.get_volume_displacements();
+        difference -= volume_displacements;
+        const double reuse_difference = difference.l2_norm() / volume_displacements.l2_norm();
+        const unsigned int n_reuse_iterations = meshmover_reuse.get_last_n_linear_iterations();
+
+        // Same displacements with the ILUT preconditioner.
+        MeshMoverType meshmover_ilut(high_order_grid, surface_node_displacements);
+        meshmover_ilut.preconditioner_type = MeshMoverType::PreconditionerType::ilut;
+        difference = meshmover_ilut.get_volume_displacements();
+        difference -= volume_displacements;
+        const double ilut_difference = difference.l2_norm() / volume_displacements.l2_norm();
+
+        pcout << "Relative difference with reused preconditioner: " << reuse_difference << std::endl;
+        pcout << "Relative difference with ILUT preconditioner: " << ilut_difference << std::endl;
+        pcout << "Iterations with reused preconditioner: " << n_reuse_iterations << std::endl;
+        if (n_reuse_iterations != n_iterations[igrid]) {
+            pcout << "Reused preconditioner took " << n_reuse_iterations << " iterations instead of " << n_iterations[igrid] << "." << std::endl;
+            fail_bool = true;
+        }
+        if (reuse_difference > solution_tolerance || ilut_difference > solution_tolerance) {
+            pcout << "Volume displacements depend on the preconditioner." << std::endl;
+            fail_bool = true;
+        }
+    }
+
+    if (pcout.is_active()) convergence_table.write_text(pcout.get_stream());
+
+    for (unsigned int igrid=1; igrid<n_grids; ++igrid) {
+        if (n_iterations[igrid] > n_iterations[0] + max_additional_iterations) {
+            pcout << "AMG iterations grew from " << n_iterations[0] << " to " << n_iterations[igrid]
+                  << " after " << igrid << " refinements, more than " << max_additional_iterations << " additional iterations." << std::endl;
+            fail_bool = true;
+        }
+    }
+
+    if (fail_bool) {
+        pcout << "Test failed." << std::endl;
+    } else {
+        pcout << "Test successful." << std::endl;
+    }
+    return fail_bool;
+}
@@ -112,9 +112,10 @@ int main (int argc, char * argv[])
 
                 const double dXvdXp_frob_norm = dXvdXp.frobenius_norm();
 
-                dXvdXp.add(-1.0, dXvdXp_FD);
+                // The analytical dXvdXp only stores its non-zero entries, the dense FD matrix holds the difference.
+                dXvdXp_FD.add(-1.0, dXvdXp);
 
-                const double abs_diff_frob_norm = dXvdXp.frobenius_norm();
+                const double abs_diff_frob_norm = dXvdXp_FD.frobenius_norm();
                 const double rel_diff_frob_norm = abs_diff_frob_norm / dXvdXp_frob_norm;
 
                 pcout << " ****************************** " << std::endl;
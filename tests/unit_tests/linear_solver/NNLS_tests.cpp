@@ -4,6 +4,7 @@
 #include <iostream>
 #include <vector>
 #include <fstream>
+#include <chrono>
 #include <eigen/Eigen/QR>
 #include "parameters/parameters.h"
 //#include <eigen/Eigen/SVD>
@@ -28,6 +29,15 @@ Parameters::AllParameters reinit_params(Parameters::AllParameters all_parameters
     return parameters;
 }
 
+/// @brief Calls .solve on the NNLS problem and outputs the wall time and number of iterations
+bool timed_solve(NNLSSolver &NNLS_prob, dealii::ConditionalOStream &pcout){
+    const auto start = std::chrono::steady_clock::now();
+    const bool exit_con = NNLS_prob.solve();
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    pcout << "NNLS solve time: " << elapsed.count() << " s, iterations: " << NNLS_prob.iter_ << std::endl;
+    return exit_con;
+}
+
 // THE FOLLOWING THREE FUNCTIONS ARE COPIED FROM eigen/test/random_matrix_helper.h in Eigen
 /**
  * Generate a random unitary matrix of prescribed dimension.
@@ -186,7 +196,7 @@ bool test_nnls_known_CLASS(const PHiLiP::Parameters::AllParameters *const all_pa
 
   // Create instance of NNLS solver, and call .solve to find the solution and exit condition
   NNLSSolver NNLS_prob(all_parameters, parameter_handler, A, Comm, b);
-  bool exit_con = NNLS_prob.solve();
+  bool exit_con = timed_solve(NNLS_prob, pcout);
   pcout << " Solution x "<< std::endl;
   Epetra_Vector x = NNLS_prob.get_solution();
   x.Print(std::cout);
@@ -229,7 +239,7 @@ bool test_nnls_handles_Mx0_matrix(const PHiLiP::Parameters::AllParameters *const
 
   // Create instance of NNLS solver, and call .solve to find the solution and exit conditions
   NNLSSolver NNLS_prob(all_parameters, parameter_handler, A, Comm, b);
-  bool exit_con = NNLS_prob.solve();
+  bool exit_con = timed_solve(NNLS_prob, pcout);
 
   // Check if solver exited by reaching the maximum number of iterationss
   if (!exit_con){
@@ -264,7 +274,7 @@ bool test_nnls_handles_0x0_matrix(const PHiLiP::Parameters::AllParameters *const
 
   // Create instance of NNLS solver, and call .solve to find the solution and exit conditions
   NNLSSolver NNLS_prob(all_parameters, parameter_handler, A, Comm, b);
-  bool exit_con = NNLS_prob.solve();
+  bool exit_con = timed_solve(NNLS_prob, pcout);
 
   // Check if solver exited by reaching the maximum number of iterationss
   if (!exit_con){
@@ -331,7 +341,7 @@ bool test_nnls_random_problem(PHiLiP::Parameters::AllParameters *all_parameters,
   // Create instance of NNLS solver, and call .solve to find the solution and exit conditions
   Parameters::AllParameters const new_parameters = reinit_params(*all_parameters, tolerance, max_iter);
   NNLSSolver NNLS_prob(&new_parameters, parameter_handler, A, Comm, b);
-  bool exit_con = NNLS_prob.solve();
+  bool exit_con = timed_solve(NNLS_prob, pcout);
 
   // Check if solver exited by reaching the maximum number of iterations
   // As noted above, this is permissable due to the change in the exit condition but the solution must satisfy the gradient exit condition
@@ -378,7 +388,7 @@ bool test_nnls_handles_zero_rhs(const PHiLiP::Parameters::AllParameters *const a
 
   // Create instance of NNLS solver, and call .solve to find the solution and exit conditions
   NNLSSolver NNLS_prob(all_parameters, parameter_handler, A, Comm, b);
-  bool exit_con = NNLS_prob.solve();
+  bool exit_con = timed_solve(NNLS_prob, pcout);
 
   bool opt = true;
   // Check if solver exited by reaching the maximum number of iterations
@@ -427,7 +437,7 @@ bool test_nnls_handles_dependent_columns(const PHiLiP::Parameters::AllParameters
 
   // Create instance of NNLS solver, and call .solve to find the solution and exit conditions
   NNLSSolver NNLS_prob(all_parameters, parameter_handler, A, Comm, b);
-  bool exit_con = NNLS_prob.solve();
+  bool exit_con = timed_solve(NNLS_prob, pcout);
 
   // From Eigen : 
   /* What should happen when the input 'A' has dependent columns?
@@ -479,7 +489,7 @@ bool test_nnls_handles_wide_matrix(const PHiLiP::Parameters::AllParameters *cons
 
   // Create instance of NNLS solver, and call .solve to find the solution and exit conditions
   NNLSSolver NNLS_prob(all_parameters, parameter_handler, A, Comm, b);
-  bool exit_con = NNLS_prob.solve();
+  bool exit_con = timed_solve(NNLS_prob, pcout);
 
   // From Eigen:
   /* What should happen when the input 'A' is wide?
@@ -539,7 +549,7 @@ bool test_nnls_special_case_solves_in_zero_iterations(const PHiLiP::Parameters::
   // Create instance of NNLS solver, and call .solve to find the solution and exit conditions
   NNLSSolver NNLS_prob(all_parameters, parameter_handler, A, Comm, b);
   NNLS_prob.starting_solution(x_start); // SET SOLUTION TO EXACT SOLUTION
-  bool exit_con = NNLS_prob.solve();
+  bool exit_con = timed_solve(NNLS_prob, pcout);
 
   // Check if solver exited by reaching the maximum number of iterations
   bool opt = true;
@@ -588,7 +598,7 @@ bool test_nnls_special_case_solves_in_n_iterations(const PHiLiP::Parameters::All
 
   // Create instance of NNLS solver, and call .solve to find the solution and exit conditions
   NNLSSolver NNLS_prob(all_parameters, parameter_handler, A, Comm, b);
-  bool exit_con = NNLS_prob.solve();
+  bool exit_con = timed_solve(NNLS_prob, pcout);
 
   //
   // VERIFY
@@ -647,7 +657,7 @@ bool test_nnls_returns_NoConvergence_when_maxIterations_is_too_low(PHiLiP::Param
   Parameters::AllParameters const new_parameters = reinit_params(*all_parameters, 1E-8, max_iters);
   // Create instance of NNLS solver, and call .solve to find the solution and exit conditions
   NNLSSolver NNLS_prob(&new_parameters, parameter_handler, A, Comm, b);
-  bool exit_con = NNLS_prob.solve();
+  bool exit_con = timed_solve(NNLS_prob, pcout);
 
   // Check if solver exited by reaching the maximum number of iterations, return true in this case
   bool opt = false;
@@ -759,6 +769,51 @@ bool case_MATLAB (const PHiLiP::Parameters::AllParameters *const all_parameters,
   return test_nnls_known_CLASS(all_parameters, parameter_handler, A_eig, 1024, 49, x_eig, b_eig, Comm, pcout);
 }
 
+/// @brief Test on a problem sized like ECSW training data (many more candidate cells than rows) with a sparse positive solution
+/// @param Comm MpiComm for Epetra Maps
+/// @return boolean depending on the exit condition of the solver and the optimality of the solution, for one and several columns added per iteration
+bool test_nnls_timing(const PHiLiP::Parameters::AllParameters *const all_parameters,
+                  const dealii::ParameterHandler &parameter_handler,
+                  Epetra_MpiComm &Comm,
+                  dealii::ConditionalOStream pcout) {
+  const Index rows = 200;
+  const Index cols = 2000;
+  const Index num_nonzero = 40;
+  MatrixXd A_eig = MatrixXd::Random(rows, cols).cwiseAbs();
+  MatrixXd x_eig = VectorXd::Zero(cols);
+  for (Index i = 0; i < num_nonzero; i++){
+    x_eig(internal::random<Index>(0, cols - 1), 0) = 1.0 + internal::random<double>(0.0, 1.0);
+  }
+  MatrixXd b_eig = A_eig * x_eig;
+
+  // Convert Eigen structures to Epetra
+  Epetra_CrsMatrix A(eig_to_epetra_matrix(A_eig, cols, rows, Comm));
+  Eigen::VectorXd b_vec = Eigen::Map<Eigen::VectorXd>(b_eig.data(), b_eig.size());
+  Epetra_Vector b(eig_to_epetra_vector(b_vec,rows,Comm));
+
+  bool opt = true;
+  for (const int max_columns : {1, 10}){
+    Parameters::AllParameters new_parameters = reinit_params(*all_parameters, 1E-6, 10000);
+    new_parameters.hyper_reduction_param.NNLS_max_columns_per_iteration = max_columns;
+    pcout << "Columns added per iteration: " << max_columns << std::endl;
+
+    // Create instance of NNLS solver, and call .solve to find the solution and exit conditions
+    NNLSSolver NNLS_prob(&new_parameters, parameter_handler, A, Comm, b);
+    bool exit_con = timed_solve(NNLS_prob, pcout);
+    if (!exit_con){
+      pcout << "Exited due to maximum iterations, not necessarily optimum solution" << std::endl;
+      opt &= false;
+    }
+
+    // Confirm the optimality of the solution wrt tolerance and positivity
+    Epetra_Vector x(NNLS_prob.get_solution());
+    Eigen::MatrixXd x_nnls_eig(x.GlobalLength(),1);
+    epetra_to_eig_vec(x.GlobalLength(), x , x_nnls_eig);
+    opt &= verify_nnls_optimality(A_eig, b_eig, x_nnls_eig, new_parameters.hyper_reduction_param.NNLS_tol);
+  }
+  return opt;
+}
+
 /// @brief Case multiCore: Testing NNLS on multiple cores
 bool test_nnls_multiCore(const PHiLiP::Parameters::AllParameters *const all_parameters,
                   const dealii::ParameterHandler &parameter_handler,
@@ -791,6 +846,8 @@ bool test_nnls_multiCore(const PHiLiP::Parameters::AllParameters *const all_para
     pcout << "Case MATLAB" << std::endl;
     Parameters::AllParameters new_parameters = reinit_params(non_const_all_param, 1E-4, 10000);
     ok &= case_MATLAB(&new_parameters, parameter_handler, Comm, pcout);
+    pcout << "Case Timing" << std::endl;
+    ok &= test_nnls_timing(all_parameters, parameter_handler, Comm, pcout);
     return ok;
 
 }
@@ -831,6 +888,7 @@ int main(int argc, char *argv[]){
   std::string s_10 = "nIter"; 
   std::string s_11 = "maxIter";
   std::string s_12 = "multiCore";
+  std::string s_13 = "timing";
    
   if (argv[1] == s_1){
     ok &= case_1(&new_parameters, parameter_handler, Comm, pcout);
@@ -874,6 +932,9 @@ int main(int argc, char *argv[]){
   else if (argv[1] == s_12){
     ok &= test_nnls_multiCore(&all_parameters, parameter_handler, Comm, pcout);
   }
+  else if (argv[1] == s_13){
+    ok &= test_nnls_timing(&all_parameters, parameter_handler, Comm, pcout);
+  }
   else {
     ok = false;
   }
@@ -0,0 +1,129 @@
+#include <cmath>
+#include <memory>
+#include <vector>
+
+#include <deal.II/base/conditional_ostream.h>
+#include <deal.II/base/index_set.h>
+#include <deal.II/base/mpi.h>
+
+#include <deal.II/lac/dynamic_sparsity_pattern.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/trilinos_sparse_matrix.h>
+
+#include "parameters/parameters_linear_solver.h"
+#include "linear_solver/linear_solver.h"
+
+using VectorType = dealii::LinearAlgebra::distributed::Vector<double>;
+
+/// Non-symmetric convection-diffusion-like matrix, with an extra off-band entry so that ILU is not exact.
+void assemble_matrix(const unsigned int n, const bool transpose, dealii::TrilinosWrappers::SparseMatrix &matrix)
+{
+    const auto entry = [n](const unsigned int row, const unsigned int col) {
+        if (row == col) return 4.0;
+        if (col + 1 == row) return -1.5;
+        if (row + 1 == col) return -0.5;
+        if (col == (row + 7) % n) return 0.3;
+        return 0.0;
+    };
+    dealii::DynamicSparsityPattern sparsity_pattern(n, n);
+    for (unsigned int row = 0; row < n; ++row) {
+        for (unsigned int col = 0; col < n; ++col) {
+            if (entry(row, col) != 0.0) sparsity_pattern.add(row, col);
+        }
+    }
+    const dealii::IndexSet locally_owned = dealii::complete_index_set(n);
+    matrix.reinit(locally_owned, locally_owned, sparsity_pattern, MPI_COMM_WORLD);
+    for (unsigned int row = 0; row < n; ++row) {
+        for (unsigned int col = 0; col < n; ++col) {
+            const double value = transpose ? entry(col, row) : entry(row, col);
+            if (value != 0.0) matrix.set(row, col, value);
+        }
+    }
+    matrix.compress(dealii::VectorOperation::insert);
+}
+
+/// Relative l2 difference between two solutions.
+double relative_difference(const VectorType &solution, const VectorType &reference)
+{
+    VectorType difference = solution;
+    difference -= reference;
+    return difference.l2_norm() / reference.l2_norm();
+}
+
+/** Tests that GMRES preconditioned by a factorization built once with build_ilu_preconditioner,
+ *  and reused across right-hand sides and for the transposed system, gives the same solutions
+ *  as the GMRES solve_linear that factorizes the matrix itself.
+ */
+int main (int argc, char * argv[])
+{
+    dealii::Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+    const int mpi_rank = dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD);
+    dealii::ConditionalOStream pcout(std::cout, mpi_rank==0);
+
+    using namespace PHiLiP;
+
+    dealii::ParameterHandler parameter_handler;
+    Parameters::LinearSolverParam::declare_parameters (parameter_handler);
+    Parameters::LinearSolverParam param;
+    param.parse_parameters (parameter_handler);
+    param.linear_solver_type = Parameters::LinearSolverParam::LinearSolverEnum::gmres;
+    param.linear_solver_output = Parameters::OutputEnum::quiet;
+    param.max_iterations = 1000;
+    param.restart_number = 200;
+    param.linear_residual = 1e-14;
+
+    const unsigned int n = 200;
+    const double solution_tolerance = 1e-10;
+
+    dealii::TrilinosWrappers::SparseMatrix matrix, matrix_transpose;
+    assemble_matrix(n, false, matrix);
+    assemble_matrix(n, true, matrix_transpose);
+
+    const dealii::IndexSet locally_owned = dealii::complete_index_set(n);
+    std::vector<VectorType> right_hand_sides(2, VectorType(locally_owned, MPI_COMM_WORLD));
+    for (unsigned int i = 0; i < n; ++i) {
+        right_hand_sides[0][i] = 1.0;
+        right_hand_sides[1][i] = std::sin(0.1*i);
+    }
+
+    int fail_bool = false;
+    // ILU(0) and ILUT with a fill ratio of 2.
+    for (const int ilut_fill : {0, 2}) {
+        param.ilut_fill = ilut_fill;
+        pcout << "ilut_fill = " << ilut_fill << std::endl;
+
+        std::unique_ptr<Ifpack_Preconditioner> preconditioner = build_ilu_preconditioner(matrix, param);
+        if (!preconditioner) {
+            pcout << "No preconditioner was built." << std::endl;
+            fail_bool = true;
+            continue;
+        }
+
+        for (const bool transpose : {false, true}) {
+            const dealii::TrilinosWrappers::SparseMatrix &system_matrix = transpose ? matrix_transpose : matrix;
+            preconditioner->SetUseTranspose(transpose);
+            for (unsigned int i_rhs = 0; i_rhs < right_hand_sides.size(); ++i_rhs) {
+                VectorType rhs = right_hand_sides[i_rhs];
+                VectorType reference(locally_owned, MPI_COMM_WORLD);
+                solve_linear(system_matrix, rhs, reference, param);
+
+                rhs = right_hand_sides[i_rhs];
+                VectorType solution(locally_owned, MPI_COMM_WORLD);
+                solve_linear(system_matrix, *preconditioner, rhs, solution, param);
+
+                const double difference = relative_difference(solution, reference);
+                pcout << (transpose ? "Transposed system" : "System") << ", right-hand side " << i_rhs
+                      << ": relative difference with a fresh factorization " << difference << std::endl;
+                if (difference > solution_tolerance) fail_bool = true;
+            }
+            preconditioner->SetUseTranspose(false);
+        }
+    }
+
+    if (fail_bool) {
+        pcout << "Test failed." << std::endl;
+    } else {
+        pcout << "Test successful." << std::endl;
+    }
+    return fail_bool;
+}
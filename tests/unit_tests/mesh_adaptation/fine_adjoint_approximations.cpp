@@ -0,0 +1,170 @@
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <map>
+
+#include <deal.II/base/conditional_ostream.h>
+#include <deal.II/base/convergence_table.h>
+
+#include <deal.II/distributed/tria.h>
+#include <deal.II/grid/grid_generator.h>
+
+#include "parameters/all_parameters.h"
+#include "dg/dg_factory.hpp"
+#include "ode_solver/ode_solver_factory.h"
+#include "mesh/mesh_adaptation/mesh_error_estimate.h"
+
+/// Sum of the cellwise dual weighted residual indicators over all processors.
+double total_indicator(const dealii::Vector<double> &cellwise_indicator)
+{
+    return dealii::Utilities::MPI::sum(cellwise_indicator.l1_norm(), MPI_COMM_WORLD);
+}
+
+/// Relative difference of an approximate adjoint with the exact one.
+double relative_adjoint_error(const dealii::LinearAlgebra::distributed::Vector<double> &approximate_adjoint,
+                              const dealii::LinearAlgebra::distributed::Vector<double> &exact_adjoint)
+{
+    dealii::LinearAlgebra::distributed::Vector<double> difference = approximate_adjoint;
+    difference -= exact_adjoint;
+    return difference.l2_norm() / exact_adjoint.l2_norm();
+}
+
+/** Compares the approximate fine grid adjoints of the DualWeightedResidualError with the exact one
+ *  on a manufactured diffusion problem. The effectivity index of an approximation is the total dual weighted
+ *  residual it gives divided by the total obtained with the exact fine grid adjoint.
+ */
+int main (int argc, char * argv[])
+{
+    const int dim = PHILIP_DIM;
+    const int nspecies = 1;
+    const int nstate = 1;
+
+    dealii::Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+    const int mpi_rank = dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD);
+    dealii::ConditionalOStream pcout(std::cout, mpi_rank==0);
+
+    using namespace PHiLiP;
+    using VectorType = dealii::LinearAlgebra::distributed::Vector<double>;
+
+    const unsigned int poly_degree = 1;
+    const unsigned int n_refinements = 3;
+    // A wrong patch or smoother leaves the low order error of the prolongated coarse adjoint,
+    // whose effectivity index is far from one.
+    const double effectivity_tolerance = 0.2;
+
+    dealii::ParameterHandler parameter_handler;
+    Parameters::AllParameters::declare_parameters (parameter_handler);
+    parameter_handler.set("pde_type", "diffusion");
+    parameter_handler.set("dimension", (long int)dim);
+    parameter_handler.enter_subsection("ODE solver");
+    parameter_handler.set("ode_solver_type", "implicit");
+    parameter_handler.set("nonlinear_max_iterations", (long int) 50);
+    parameter_handler.set("nonlinear_steady_residual_tolerance", 1e-12);
+    parameter_handler.leave_subsection();
+    parameter_handler.enter_subsection("linear solver");
+    parameter_handler.enter_subsection("gmres options");
+    parameter_handler.set("linear_residual_tolerance", 1e-12);
+    parameter_handler.leave_subsection();
+    parameter_handler.leave_subsection();
+    parameter_handler.enter_subsection("manufactured solution convergence study");
+    parameter_handler.set("use_manufactured_source_term", true);
+    parameter_handler.leave_subsection();
+
+    Parameters::AllParameters param;
+    param.parse_parameters (parameter_handler);
+
+    // The dual weighted residual requires a triangulation without mesh smoothing.
+    using Triangulation = dealii::parallel::distributed::Triangulation<dim>;
+    std::shared_ptr<Triangulation> grid = std::make_shared<Triangulation>(MPI_COMM_WORLD);
+    dealii::GridGenerator::hyper_cube(*grid, 0.0, 1.0, true);
+    grid->refine_global(n_refinements);
+
+    std::shared_ptr < DGBase<dim, nspecies, double> > dg = DGFactory<dim,nspecies,double>::create_discontinuous_galerkin(&param, poly_degree, grid);
+    dg->allocate_system ();
+    dg->solution = 0.0;
+
+    std::shared_ptr<ODE::ODESolverBase<dim, nspecies, double>> ode_solver = ODE::ODESolverFactory<dim, nspecies, double>::create_ODESolver(dg);
+    ode_solver->steady_state();
+
+    DualWeightedResidualError<dim, nspecies, nstate, double> dual_weighted_residual_error(dg);
+
+    dual_weighted_residual_error.reinit();
+    const VectorType exact_adjoint = dual_weighted_residual_error.fine_grid_adjoint();
+    const double exact_total = total_indicator(dual_weighted_residual_error.dual_weighted_residual());
+    dual_weighted_residual_error.convert_dgsolution_to_coarse_or_fine(DualWeightedResidualError<dim, nspecies, nstate, double>::SolutionRefinementStateEnum::coarse);
+    pcout << "Total dual weighted residual with the exact fine adjoint: " << exact_total << std::endl;
+
+    int fail_bool = false;
+    dealii::ConvergenceTable convergence_table;
+    // Returns the relative error of the approximate adjoint.
+    auto check_approximation = [&](const std::string &name, const VectorType &approximate_adjoint, const bool check_effectivity) {
+        const double effectivity = total_indicator(dual_weighted_residual_error.dual_weighted_residual()) / exact_total;
+        const double adjoint_error = relative_adjoint_error(approximate_adjoint, exact_adjoint);
+        convergence_table.add_value("approximation", name);
+        convergence_table.add_value("effectivity", effectivity);
+        convergence_table.add_value("adjoint_error", adjoint_error);
+        dual_weighted_residual_error.convert_dgsolution_to_coarse_or_fine(DualWeightedResidualError<dim, nspecies, nstate, double>::SolutionRefinementStateEnum::coarse);
+        if (check_effectivity && std::abs(effectivity - 1.0) > effectivity_tolerance) {
+            pcout << "Effectivity index of the " << name << " fine adjoint is " << effectivity << std::endl;
+            fail_bool = true;
+        }
+        return adjoint_error;
+    };
+
+    const VectorType patch_adjoint = dual_weighted_residual_error.patch_fine_grid_adjoint();
+    const double patch_error = check_approximation("element_patch", patch_adjoint, true);
+
+    // Without sweeps, the prolongated coarse adjoint only recovers the Galerkin orthogonality.
+    // Every sweep must then reduce its error.
+    std::vector<double> smoothed_errors;
+    std::map<unsigned int, VectorType> smoothed_adjoints;
+    for (const unsigned int n_sweeps : {0u, 1u, 3u, 6u}) {
+        smoothed_adjoints[n_sweeps] = dual_weighted_residual_error.smoothed_fine_grid_adjoint(n_sweeps);
+        smoothed_errors.push_back(check_approximation("smoothed_coarse_" + std::to_string(n_sweeps), smoothed_adjoints[n_sweeps], n_sweeps >= 3));
+    }
+    for (unsigned int i = 1; i < smoothed_errors.size(); ++i) {
+        if (smoothed_errors[i] >= smoothed_errors[i-1]) {
+            pcout << "Smoothing sweeps did not reduce the fine adjoint error." << std::endl;
+            fail_bool = true;
+        }
+    }
+    if (patch_error >= smoothed_errors[0]) {
+        pcout << "Element patch solves did not reduce the error of the prolongated coarse adjoint." << std::endl;
+        fail_bool = true;
+    }
+
+    // fine_grid_adjoint() must return the approximation selected by the mesh adaptation parameters.
+    auto check_selection = [&](const std::string &fine_adjoint_type, const unsigned int n_sweeps, const VectorType &expected_adjoint) {
+        parameter_handler.enter_subsection("mesh adaptation");
+        parameter_handler.set("fine_adjoint_type", fine_adjoint_type);
+        parameter_handler.set("fine_adjoint_smoothing_sweeps", (long int) n_sweeps);
+        parameter_handler.leave_subsection();
+        param.parse_parameters (parameter_handler);
+
+        const VectorType selected_adjoint = dual_weighted_residual_error.fine_grid_adjoint();
+        check_approximation("selected_" + fine_adjoint_type + "_" + std::to_string(n_sweeps), selected_adjoint, fine_adjoint_type != "smoothed_coarse" || n_sweeps >= 3);
+        // The exact adjoint is solved again, from the last approximation as initial guess.
+        const double selection_tolerance = (fine_adjoint_type == "exact") ? 1e-8 : 1e-12;
+        const double difference = relative_adjoint_error(selected_adjoint, expected_adjoint);
+        if (difference > selection_tolerance) {
+            pcout << "The fine adjoint selected by fine_adjoint_type = " << fine_adjoint_type << " and fine_adjoint_smoothing_sweeps = " << n_sweeps
+                  << " differs from the requested approximation by " << difference << std::endl;
+            fail_bool = true;
+        }
+    };
+    check_selection("element_patch", 3, patch_adjoint);
+    check_selection("smoothed_coarse", 1, smoothed_adjoints[1]);
+    check_selection("smoothed_coarse", 6, smoothed_adjoints[6]);
+    check_selection("exact", 3, exact_adjoint);
+
+    convergence_table.set_precision("effectivity", 4);
+    convergence_table.set_scientific("adjoint_error", true);
+    if (pcout.is_active()) convergence_table.write_text(pcout.get_stream());
+
+    if (fail_bool) {
+        pcout << "Test failed." << std::endl;
+    } else {
+        pcout << "Test successful." << std::endl;
+    }
+    return fail_bool;
+}
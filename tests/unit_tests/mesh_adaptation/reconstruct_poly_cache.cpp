@@ -0,0 +1,164 @@
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#include <deal.II/base/conditional_ostream.h>
+#include <deal.II/base/function.h>
+#include <deal.II/base/mpi.h>
+
+#include <deal.II/distributed/tria.h>
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_tools.h>
+
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_tools.h>
+
+#include <deal.II/fe/fe_dgq.h>
+#include <deal.II/fe/mapping_q.h>
+
+#include <deal.II/hp/fe_collection.h>
+#include <deal.II/hp/mapping_collection.h>
+#include <deal.II/hp/q_collection.h>
+
+#include <deal.II/numerics/vector_tools.h>
+
+#include "grid_refinement/reconstruct_poly.h"
+
+/// Smooth function whose reconstructed derivatives vary over the domain.
+template <int dim>
+class SmoothFunction : public dealii::Function<dim>
+{
+public:
+    /// Value of sin(2 x_0) * exp(x_1 + ... + x_{dim-1}).
+    double value(const dealii::Point<dim> &point, const unsigned int /*component*/ = 0) const override
+    {
+        double val = std::sin(2.0*point[0]);
+        for (int d = 1; d < dim; ++d) val *= std::exp(point[d]);
+        return val;
+    }
+};
+
+/// Largest difference between the derivative values of two reconstructions on the locally owned cells.
+template <int dim>
+double max_difference(const dealii::DoFHandler<dim> &dof_handler,
+                      const std::vector<std::array<double,dim>> &values,
+                      const std::vector<std::array<double,dim>> &reference)
+{
+    double difference = 0.0;
+    for (const auto &cell : dof_handler.active_cell_iterators()) {
+        if (!cell->is_locally_owned()) continue;
+        const unsigned int index = cell->active_cell_index();
+        for (int d = 0; d < dim; ++d) {
+            difference = std::max(difference, std::abs(values[index][d] - reference[index][d]) / (1.0 + std::abs(reference[index][d])));
+        }
+    }
+    return dealii::Utilities::MPI::max(difference, MPI_COMM_WORLD);
+}
+
+/** Tests the cache of inverted reconstruction matrices of ReconstructPoly.
+ *  A second reconstruction on the same mesh must find every patch in the cache and give the same derivatives,
+ *  and after the mesh is moved, the reconstruction must match the one of a new ReconstructPoly.
+ */
+int main (int argc, char * argv[])
+{
+    const int dim = PHILIP_DIM;
+    const int nspecies = 1;
+    const int nstate = 1;
+
+    dealii::Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+    const int mpi_rank = dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD);
+    dealii::ConditionalOStream pcout(std::cout, mpi_rank==0);
+
+    using namespace PHiLiP;
+    using VectorType = dealii::LinearAlgebra::distributed::Vector<double>;
+    using ReconstructPolyType = GridRefinement::ReconstructPoly<dim,nspecies,nstate,double>;
+
+    const unsigned int poly_degree = 2;
+    const unsigned int rel_order = 1;
+    const unsigned int n_cells_per_direction = 8;
+    const double tolerance = 1e-12;
+
+    dealii::parallel::distributed::Triangulation<dim> grid(MPI_COMM_WORLD);
+    dealii::GridGenerator::subdivided_hyper_cube(grid, n_cells_per_direction);
+
+    // The FE index is the polynomial degree, as in DGBase.
+    dealii::hp::FECollection<dim> fe_collection;
+    dealii::hp::QCollection<dim> quadrature_collection;
+    for (unsigned int degree = 0; degree <= poly_degree; ++degree) {
+        fe_collection.push_back(dealii::FE_DGQ<dim>(degree));
+        quadrature_collection.push_back(dealii::QGauss<dim>(degree+2));
+    }
+    const dealii::hp::MappingCollection<dim> mapping_collection(dealii::MappingQ<dim>(1));
+    const dealii::UpdateFlags update_flags = dealii::update_values | dealii::update_gradients
+                                           | dealii::update_quadrature_points | dealii::update_JxW_values;
+
+    dealii::DoFHandler<dim> dof_handler(grid);
+    for (const auto &cell : dof_handler.active_cell_iterators()) {
+        if (cell->is_locally_owned()) cell->set_active_fe_index(poly_degree);
+    }
+    dof_handler.distribute_dofs(fe_collection);
+
+    dealii::IndexSet locally_relevant_dofs;
+    dealii::DoFTools::extract_locally_relevant_dofs(dof_handler, locally_relevant_dofs);
+    VectorType solution(dof_handler.locally_owned_dofs(), locally_relevant_dofs, MPI_COMM_WORLD);
+    dealii::VectorTools::interpolate(mapping_collection, dof_handler, SmoothFunction<dim>(), solution);
+    solution.update_ghost_values();
+
+    unsigned int n_owned_cells = 0;
+    for (const auto &cell : dof_handler.active_cell_iterators()) {
+        if (cell->is_locally_owned()) ++n_owned_cells;
+    }
+
+    int fail_bool = false;
+
+    ReconstructPolyType reconstruct_poly(dof_handler, mapping_collection, fe_collection, quadrature_collection, update_flags);
+
+    // First pass: translated patches of the uniform mesh already share their factorization.
+    reconstruct_poly.reconstruct_chord_derivative(solution, rel_order);
+    const std::vector<std::array<double,dim>> first_values = reconstruct_poly.derivative_value;
+    const unsigned int first_hits = dealii::Utilities::MPI::sum(reconstruct_poly.get_n_factorization_cache_hits(), MPI_COMM_WORLD);
+    const unsigned int first_misses = dealii::Utilities::MPI::sum(reconstruct_poly.get_n_factorization_cache_misses(), MPI_COMM_WORLD);
+    pcout << "First reconstruction: " << first_hits << " cache hits and " << first_misses << " misses." << std::endl;
+    if (first_hits == 0) {
+        pcout << "Translated patches did not share their factorization." << std::endl;
+        fail_bool = true;
+    }
+
+    // Second pass on the same mesh: every patch hits the cache and the result is unchanged.
+    reconstruct_poly.reconstruct_chord_derivative(solution, rel_order);
+    const unsigned int second_misses = dealii::Utilities::MPI::max(reconstruct_poly.get_n_factorization_cache_misses(), MPI_COMM_WORLD);
+    const bool all_hits = dealii::Utilities::MPI::min(static_cast<unsigned int>(reconstruct_poly.get_n_factorization_cache_hits() == n_owned_cells), MPI_COMM_WORLD);
+    const double second_difference = max_difference<dim>(dof_handler, reconstruct_poly.derivative_value, first_values);
+    pcout << "Second reconstruction: " << second_misses << " cache misses, relative difference " << second_difference << std::endl;
+    if (second_misses != 0 || !all_hits) {
+        pcout << "Second reconstruction on the same mesh did not reuse every factorization." << std::endl;
+        fail_bool = true;
+    }
+    if (second_difference > tolerance) {
+        pcout << "Second reconstruction on the same mesh changed the derivatives." << std::endl;
+        fail_bool = true;
+    }
+
+    // Moving the mesh invalidates the cached factorizations.
+    dealii::GridTools::scale(2.0, grid);
+    reconstruct_poly.reconstruct_chord_derivative(solution, rel_order);
+    const unsigned int moved_misses = dealii::Utilities::MPI::sum(reconstruct_poly.get_n_factorization_cache_misses(), MPI_COMM_WORLD);
+
+    ReconstructPolyType reconstruct_poly_moved(dof_handler, mapping_collection, fe_collection, quadrature_collection, update_flags);
+    reconstruct_poly_moved.reconstruct_chord_derivative(solution, rel_order);
+    const double moved_difference = max_difference<dim>(dof_handler, reconstruct_poly.derivative_value, reconstruct_poly_moved.derivative_value);
+    pcout << "Reconstruction after mesh movement: " << moved_misses << " cache misses, relative difference with a new object " << moved_difference << std::endl;
+    if (moved_misses == 0 || moved_difference > tolerance) {
+        pcout << "Cached factorizations were reused after mesh movement." << std::endl;
+        fail_bool = true;
+    }
+
+    if (fail_bool) {
+        pcout << "Test failed." << std::endl;
+    } else {
+        pcout << "Test successful." << std::endl;
+    }
+    return fail_bool;
+}
@@ -0,0 +1,118 @@
+#include <iomanip>
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
+#include <deal.II/grid/grid_generator.h>
+
+#include "parameters/parameters.h"
+#include "physics/navier_stokes.h"
+
+// The packed kernels follow the same sequence of operations as the scalar ones;
+// the tolerance only leaves room for contractions into fused multiply-adds.
+const double TOLERANCE = 1E-13;
+
+template <int dim, int nstate>
+double max_relative_difference (
+    const std::array<dealii::Tensor<1,dim,std::vector<double>>,nstate> &batch_flux,
+    const unsigned int ipoint,
+    const std::array<dealii::Tensor<1,dim,double>,nstate> &flux)
+{
+    double max_rel_diff = 0.0;
+    for (int s=0; s<nstate; s++) {
+        for (int d=0; d<dim; d++) {
+            const double diff = std::abs(batch_flux[s][d][ipoint] - flux[s][d]);
+            double max = std::max(std::abs(batch_flux[s][d][ipoint]), std::abs(flux[s][d]));
+            if(max < 1.0) max = 1.0;
+            max_rel_diff = std::max(max_rel_diff, diff/max);
+        }
+    }
+    return max_rel_diff;
+}
+
+int main (int argc, char * argv[])
+{
+    MPI_Init(&argc, &argv);
+    std::cout << std::setprecision(std::numeric_limits<long double>::digits10 + 1) << std::scientific;
+    const int dim = PHILIP_DIM;
+    const int nspecies = 1;
+    const int nstate = dim+2;
+
+    //const double ref_length = 1.0, mach_inf=1.0, angle_of_attack = 0.0, side_slip_angle = 0.0, gamma_gas = 1.4;
+    //const double prandtl_number = 0.72, reynolds_number_inf=50000.0;
+    const double a = 1.0 , b = 0.0, c = 1.4, d=0.72, e=50000.0;
+    //default parameters
+    dealii::ParameterHandler parameter_handler;
+    PHiLiP::Parameters::AllParameters::declare_parameters (parameter_handler); // default fills options
+    PHiLiP::Parameters::AllParameters all_parameters;
+    all_parameters.parse_parameters (parameter_handler);
+
+    const double min = 0;
+    const double max = 1.0;
+    const int nx = 6;
+
+    std::vector<unsigned int> repetitions(dim, nx);
+    dealii::Point<dim,double> corner1, corner2;
+    for (int d=0; d<dim; d++) {
+        corner1[d] = min;
+        corner2[d] = max;
+    }
+    dealii::Triangulation<dim> grid;
+    dealii::GridGenerator::subdivided_hyper_rectangle(grid, repetitions, corner1, corner2);
+    // (nx+1)^dim vertices is odd, so the last points do not fill a complete pack
+    const std::vector<dealii::Point<dim>> &vertices = grid.get_vertices();
+    const unsigned int n_points = vertices.size();
+
+    for (const bool use_constant_viscosity : {false, true}) {
+        PHiLiP::Physics::NavierStokes<dim, nspecies, nstate, double> navier_stokes_physics = PHiLiP::Physics::NavierStokes<dim, nspecies, nstate, double>(&all_parameters,a,c,a,b,b,d,e,use_constant_viscosity,1.0);
+
+        std::array<std::vector<double>,nstate> soln_at_points;
+        std::array<dealii::Tensor<1,dim,std::vector<double>>,nstate> soln_gradient_at_points;
+        for (int s=0; s<nstate; s++) {
+            soln_at_points[s].resize(n_points);
+            for (int d=0; d<dim; d++) {
+                soln_gradient_at_points[s][d].resize(n_points);
+            }
+            for (unsigned int ipoint=0; ipoint<n_points; ++ipoint) {
+                soln_at_points[s][ipoint] = navier_stokes_physics.manufactured_solution_function->value(vertices[ipoint], s);
+                const dealii::Tensor<1,dim,double> gradient = navier_stokes_physics.manufactured_solution_function->gradient(vertices[ipoint], s);
+                for (int d=0; d<dim; d++) {
+                    soln_gradient_at_points[s][d][ipoint] = gradient[d];
+                }
+            }
+        }
+
+        std::array<dealii::Tensor<1,dim,std::vector<double>>,nstate> conv_flux_batch;
+        std::array<dealii::Tensor<1,dim,std::vector<double>>,nstate> viscous_flux_batch;
+        navier_stokes_physics.convective_flux_batch(soln_at_points, conv_flux_batch);
+        navier_stokes_physics.dissipative_flux_batch(soln_at_points, soln_gradient_at_points, viscous_flux_batch);
+
+        double max_rel_diff = 0.0;
+        for (unsigned int ipoint=0; ipoint<n_points; ++ipoint) {
+            std::array<double, nstate> soln;
+            std::array<dealii::Tensor<1,dim,double>,nstate> soln_gradient;
+            for (int s=0; s<nstate; s++) {
+                soln[s] = soln_at_points[s][ipoint];
+                for (int d=0; d<dim; d++) {
+                    soln_gradient[s][d] = soln_gradient_at_points[s][d][ipoint];
+                }
+            }
+            const std::array<dealii::Tensor<1,dim,double>,nstate> conv_flux = navier_stokes_physics.convective_flux(soln);
+            const std::array<dealii::Tensor<1,dim,double>,nstate> viscous_flux = navier_stokes_physics.dissipative_flux(soln, soln_gradient);
+
+            max_rel_diff = std::max(max_rel_diff, max_relative_difference<dim,nstate>(conv_flux_batch, ipoint, conv_flux));
+            max_rel_diff = std::max(max_rel_diff, max_relative_difference<dim,nstate>(viscous_flux_batch, ipoint, viscous_flux));
+        }
+        std::cout << "Constant viscosity: " << use_constant_viscosity
+                  << " Points: " << n_points
+                  << " Maximum relative difference between the batch and scalar fluxes = " << max_rel_diff
+                  << std::endl;
+        if(max_rel_diff > TOLERANCE) {
+            std::cout << "Difference too high. rel_diff=" << max_rel_diff << " and tolerance=" << TOLERANCE << std::endl;
+            std::cout << "Failing test..." << std::endl;
+            std::abort();
+        }
+    }
+    MPI_Finalize();
+    return 0;
+}
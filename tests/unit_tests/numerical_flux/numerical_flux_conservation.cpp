@@ -57,6 +57,8 @@ void initialize_model_variables(std::shared_ptr <PHiLiP::Physics::ModelBase<dim,
         pde_model->cellwise_poly_degree[1] = 3;
         pde_model->cellwise_volume[0] = 10.0;
         pde_model->cellwise_volume[1] = 20.0;
+        // update the model data that depend on the above
+        pde_model->update_cellwise_model_data();
     }
 }
 
@@ -277,6 +279,82 @@ int test_convective_numerical_flux_consistency (const PHiLiP::Parameters::AllPar
     return 0;
 }
 
+template<int dim, int nspecies, int nstate>
+int test_convective_numerical_flux_static_composition (const PHiLiP::Parameters::AllParameters *const all_parameters)
+{
+    using namespace PHiLiP;
+    std::shared_ptr <Physics::ModelBase<dim, nspecies, nstate, double>> pde_model = Physics::ModelFactory<dim, nspecies, nstate, double>::create_Model(all_parameters);
+    initialize_model_variables(pde_model);
+    std::shared_ptr <Physics::PhysicsBase<dim, nspecies, nstate, double>> pde_physics = Physics::PhysicsFactory<dim, nspecies, nstate, double>::create_Physics(all_parameters,pde_model);
+
+    // Factory returns the statically composed flux for Euler-based physics
+    std::unique_ptr<NumericalFlux::NumericalFluxConvective<dim, nspecies, nstate, double>> conv_num_flux = 
+        NumericalFlux::NumericalFluxFactory<dim, nspecies, nstate, double>
+        ::create_convective_numerical_flux (all_parameters->conv_num_flux_type, all_parameters->pde_type, all_parameters->model_type, pde_physics);
+
+    // Runtime-composed flux of the same type
+    std::unique_ptr<NumericalFlux::NumericalFluxConvective<dim, nspecies, nstate, double>> conv_num_flux_runtime;
+    if constexpr (dim+2==nstate && nspecies==1) {
+        using namespace NumericalFlux;
+        const ConvType conv = all_parameters->conv_num_flux_type;
+        if(conv==ConvType::lax_friedrichs) conv_num_flux_runtime = std::make_unique<LaxFriedrichs<dim, nspecies, nstate, double>>(pde_physics);
+        if(conv==ConvType::roe) conv_num_flux_runtime = std::make_unique<RoePike<dim, nspecies, nstate, double>>(pde_physics);
+        if(conv==ConvType::l2roe) conv_num_flux_runtime = std::make_unique<L2Roe<dim, nspecies, nstate, double>>(pde_physics);
+        if(conv==ConvType::central_flux) conv_num_flux_runtime = std::make_unique<Central<dim, nspecies, nstate, double>>(pde_physics);
+        if(conv==ConvType::two_point_flux) conv_num_flux_runtime = std::make_unique<EntropyConserving<dim, nspecies, nstate, double>>(pde_physics);
+        if(conv==ConvType::two_point_flux_with_lax_friedrichs_dissipation) conv_num_flux_runtime = std::make_unique<EntropyConservingWithLaxFriedrichsDissipation<dim, nspecies, nstate, double>>(pde_physics);
+        if(conv==ConvType::two_point_flux_with_roe_dissipation) conv_num_flux_runtime = std::make_unique<EntropyConservingWithRoeDissipation<dim, nspecies, nstate, double>>(pde_physics);
+        if(conv==ConvType::two_point_flux_with_l2roe_dissipation) conv_num_flux_runtime = std::make_unique<EntropyConservingWithL2RoeDissipation<dim, nspecies, nstate, double>>(pde_physics);
+    }
+    if(conv_num_flux_runtime == nullptr) return 0;
+
+    dealii::Tensor<1,dim,double> normal_int;
+    std::array<double, nstate> soln_int, soln_ext;
+    dealii::Point<dim> point_1;
+    dealii::Point<dim> point_2;
+    for(int d=0; d<dim; d++) {
+        point_1[d] = 0.9;
+        point_2[d] = 0.3;
+        normal_int[d] = 1.0/std::sqrt(1.0*dim);
+    }
+    // Different states on each side so that the Riemann solver dissipation is non-zero
+    for(int s=0; s<nstate; s++) {
+        soln_int[s] = pde_physics->manufactured_solution_function->value(point_1,s);
+        soln_ext[s] = pde_physics->manufactured_solution_function->value(point_2,s);
+    }
+
+    const std::array<double, nstate> conv_num_flux_dot_n = conv_num_flux->evaluate_flux(soln_int, soln_ext, normal_int);
+    const std::array<double, nstate> conv_num_flux_dot_n_runtime = conv_num_flux_runtime->evaluate_flux(soln_int, soln_ext, normal_int);
+
+    std::cout << "Statically composed convective numerical flux should be equal to the runtime-composed one" << std::endl;
+    compare_array<dim,nspecies,nstate> (conv_num_flux_dot_n, conv_num_flux_dot_n_runtime, 1.0);
+
+    // Batched evaluation over two face points: (int, ext) and (ext, int) with the opposite normal
+    std::array<std::vector<double>, nstate> soln_int_face, soln_ext_face, conv_num_flux_dot_n_face;
+    std::array<std::vector<double>, dim> normal_int_face;
+    for(int s=0; s<nstate; s++) {
+        soln_int_face[s] = {soln_int[s], soln_ext[s]};
+        soln_ext_face[s] = {soln_ext[s], soln_int[s]};
+        conv_num_flux_dot_n_face[s].resize(2);
+    }
+    for(int d=0; d<dim; d++) {
+        normal_int_face[d] = {normal_int[d], -normal_int[d]};
+    }
+    conv_num_flux->evaluate_flux_batch(soln_int_face, soln_ext_face, normal_int_face, conv_num_flux_dot_n_face);
+
+    std::array<double, nstate> conv_num_flux_dot_n_batch_1, conv_num_flux_dot_n_batch_2;
+    for(int s=0; s<nstate; s++) {
+        conv_num_flux_dot_n_batch_1[s] = conv_num_flux_dot_n_face[s][0];
+        conv_num_flux_dot_n_batch_2[s] = conv_num_flux_dot_n_face[s][1];
+    }
+    std::cout << "Batched convective numerical flux should be equal to the pointwise one" << std::endl;
+    compare_array<dim,nspecies,nstate> (conv_num_flux_dot_n_batch_1, conv_num_flux_dot_n_runtime, 1.0);
+    std::cout << "Batched convective numerical flux should be conservative" << std::endl;
+    compare_array<dim,nspecies,nstate> (conv_num_flux_dot_n_batch_2, conv_num_flux_dot_n_runtime, -1.0);
+
+    return 0;
+}
+
 void print_model_type(const ModelType model)
 {
     std::string model_string = "WARNING: invalid model";
@@ -431,6 +509,8 @@ int main (int argc, char * argv[])
             if(*pde==PDEType::burgers_inviscid) success = test_convective_numerical_flux_consistency<PHILIP_DIM, PHILIP_SPECIES,PHILIP_DIM> (&all_parameters);
             if(*pde==PDEType::euler) success = test_convective_numerical_flux_consistency<PHILIP_DIM, PHILIP_SPECIES,PHILIP_DIM+2> (&all_parameters);
             if(*pde==PDEType::navier_stokes) success = test_convective_numerical_flux_consistency<PHILIP_DIM, PHILIP_SPECIES,PHILIP_DIM+2> (&all_parameters);
+            if(*pde==PDEType::euler) success = test_convective_numerical_flux_static_composition<PHILIP_DIM, PHILIP_SPECIES,PHILIP_DIM+2> (&all_parameters);
+            if(*pde==PDEType::navier_stokes) success = test_convective_numerical_flux_static_composition<PHILIP_DIM, PHILIP_SPECIES,PHILIP_DIM+2> (&all_parameters);
             if(*pde==PDEType::physics_model) {
                 for (auto model = model_type.begin(); model != model_type.end() && success == 0; model++) {
                     all_parameters.model_type = *model;
@@ -0,0 +1,182 @@
+#include <assert.h>
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/distributed/tria.h>
+#include <deal.II/numerics/vector_tools.h>
+
+#include "assert_compare_array.h"
+#include "dg/dg_factory.hpp"
+#include "parameters/parameters.h"
+#include "physics/real_gas.h"
+
+#if PHILIP_DIM==1
+    using Triangulation = dealii::Triangulation<PHILIP_DIM>;
+#else
+    using Triangulation = dealii::parallel::distributed::Triangulation<PHILIP_DIM>;
+#endif
+
+// Interpolation error bound of the thermodynamic table, relative to the largest species enthalpy and Cp of the table range
+const double TABLE_TOLERANCE = 1E-8;
+// Upper temperature bound of the NASA polynomials in the chemistry files [K], which sets the largest tabulated enthalpy
+const double TABLE_MAX_TEMPERATURE = 20000.0;
+
+/// Relative error bound of the temperature at a dimensional temperature
+/** The enthalpy error is at most TABLE_TOLERANCE times the largest enthalpy, roughly Cp*TABLE_MAX_TEMPERATURE,
+ *  and becomes a temperature error through e = h - RT, i.e. divided by Cv. The factor 2 bounds Cp_max/Cv.
+ */
+double temperature_tolerance (const double dimensional_temperature)
+{
+    return 2.0*TABLE_MAX_TEMPERATURE/dimensional_temperature*TABLE_TOLERANCE;
+}
+
+// Number of cells per direction of the grid on which the residuals are compared
+const int N_CELLS_PER_DIRECTION = 4;
+
+/// Assembles the residual of the manufactured solution with and without the thermodynamic table
+/** Returns the relative difference of the residuals in the l2 norm. */
+template<int dim, int nspecies>
+double compare_residuals (
+    const PHiLiP::Parameters::AllParameters &parameters_direct,
+    const PHiLiP::Parameters::AllParameters &parameters_table,
+    const dealii::Function<dim> &manufactured_solution)
+{
+    using namespace PHiLiP;
+    const unsigned int poly_degree = 2;
+
+    std::array<dealii::LinearAlgebra::distributed::Vector<double>,2> residuals;
+    const std::array<const Parameters::AllParameters *,2> parameters = {&parameters_direct, &parameters_table};
+    for (int i=0; i<2; ++i) {
+        std::shared_ptr<Triangulation> grid = std::make_shared<Triangulation>(
+#if PHILIP_DIM!=1
+            MPI_COMM_WORLD
+#endif
+            );
+        dealii::GridGenerator::subdivided_hyper_cube(*grid, N_CELLS_PER_DIRECTION);
+        for (auto &cell : grid->active_cell_iterators()) {
+            for (unsigned int face=0; face<dealii::GeometryInfo<dim>::faces_per_cell; ++face) {
+                if (cell->face(face)->at_boundary()) cell->face(face)->set_boundary_id (1006);
+            }
+        }
+
+        std::shared_ptr<DGBase<dim,nspecies,double>> dg = DGFactory<dim,nspecies,double>::create_discontinuous_galerkin(parameters[i], poly_degree, grid);
+        dg->allocate_system ();
+
+        dealii::LinearAlgebra::distributed::Vector<double> solution_no_ghost;
+        solution_no_ghost.reinit(dg->locally_owned_dofs, MPI_COMM_WORLD);
+        dealii::VectorTools::interpolate(dg->dof_handler, manufactured_solution, solution_no_ghost);
+        dg->solution = solution_no_ghost;
+        dg->solution.update_ghost_values();
+
+        dg->assemble_residual();
+        residuals[i] = dg->right_hand_side;
+    }
+    const double residual_norm = residuals[0].l2_norm();
+    residuals[1] -= residuals[0];
+    std::cout << "Residual norm: " << residual_norm << " difference with the table: " << residuals[1].l2_norm() << std::endl;
+    return residuals[1].l2_norm()/residual_norm;
+}
+
+int main (int argc, char * argv[])
+{
+    dealii::Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+    const int dim = PHILIP_DIM;
+    const int nspecies = PHILIP_SPECIES;
+    const int nstate = dim+nspecies+1;
+
+    //default parameters
+    dealii::ParameterHandler parameter_handler;
+    PHiLiP::Parameters::AllParameters::declare_parameters (parameter_handler); // default fills options
+    PHiLiP::Parameters::AllParameters all_parameters;
+    all_parameters.parse_parameters (parameter_handler);
+
+    all_parameters.euler_param.mach_inf = 1.0; all_parameters.euler_param.gamma_gas = 1.4;
+    if (nspecies == 2)
+        all_parameters.chemistry_input_file = "../../chemistry_files/O2_N2.kinetics";
+    else if (nspecies == 3)
+        all_parameters.chemistry_input_file = "../../chemistry_files/H2_O2_N2.kinetics";
+
+    using ManufacturedSolutionEnum = PHiLiP::Parameters::ManufacturedSolutionParam::ManufacturedSolutionType;
+    all_parameters.manufactured_convergence_study_param.manufactured_solution_param.manufactured_solution_type = ManufacturedSolutionEnum::atan_solution;
+
+    // Physics evaluating the NASA polynomials directly
+    all_parameters.thermodynamic_table_tolerance = 0.0;
+    PHiLiP::Physics::RealGas<dim, nspecies, nstate, double> real_gas_physics_direct = PHiLiP::Physics::RealGas<dim, nspecies, nstate, double>(&all_parameters);
+    // Physics interpolating the thermodynamic properties from the table
+    all_parameters.thermodynamic_table_tolerance = TABLE_TOLERANCE;
+    PHiLiP::Physics::RealGas<dim, nspecies, nstate, double> real_gas_physics_table = PHiLiP::Physics::RealGas<dim, nspecies, nstate, double>(&all_parameters);
+
+    const double min = 0.0;
+    const double max = 1.0;
+    const int nx = 11;
+
+    std::vector<unsigned int> repetitions(dim, nx);
+    dealii::Point<dim,double> corner1, corner2;
+    for (int d=0; d<dim; d++) { 
+        corner1[d] = min;
+        corner2[d] = max;
+    }
+    dealii::Triangulation<dim> grid;
+    dealii::GridGenerator::subdivided_hyper_rectangle(grid, repetitions, corner1, corner2);
+
+    double max_tolerance = 0.0;
+    int n_table_differences = 0;
+    std::array<double, dim+nspecies+1> conservative_soln;
+    for (auto cell : grid.active_cell_iterators()) {
+        for (unsigned int v=0; v < dealii::GeometryInfo<dim>::vertices_per_cell; ++v) {
+            const dealii::Point<dim,double> vertex = cell->vertex(v);
+            for (int s=0; s<nstate; s++) {
+                conservative_soln[s] = real_gas_physics_direct.manufactured_solution_function->value(vertex, s);
+            }
+
+            // Thermodynamic state
+            const std::array<double,3> thermodynamic_state_direct = {
+                real_gas_physics_direct.compute_temperature(conservative_soln),
+                real_gas_physics_direct.compute_mixture_pressure(conservative_soln),
+                real_gas_physics_direct.compute_sound(conservative_soln)};
+            const std::array<double,3> thermodynamic_state_table = {
+                real_gas_physics_table.compute_temperature(conservative_soln),
+                real_gas_physics_table.compute_mixture_pressure(conservative_soln),
+                real_gas_physics_table.compute_sound(conservative_soln)};
+            const double tolerance = temperature_tolerance(thermodynamic_state_direct[0]*real_gas_physics_direct.temperature_ref);
+            max_tolerance = std::max(max_tolerance, tolerance);
+            if (thermodynamic_state_direct != thermodynamic_state_table) n_table_differences++;
+            assert_compare_array<3> ( thermodynamic_state_direct, thermodynamic_state_table, 1.0, tolerance);
+
+            // Convective flux, which differs through the pressure
+            const std::array<dealii::Tensor<1,dim,double>,nstate> flux_direct = real_gas_physics_direct.convective_flux(conservative_soln);
+            const std::array<dealii::Tensor<1,dim,double>,nstate> flux_table = real_gas_physics_table.convective_flux(conservative_soln);
+            for (int d=0; d<dim; d++) {
+                std::array<double,nstate> flux_direct_d, flux_table_d;
+                for (int s=0; s<nstate; s++) {
+                    flux_direct_d[s] = flux_direct[s][d];
+                    flux_table_d[s] = flux_table[s][d];
+                }
+                assert_compare_array<nstate> ( flux_direct_d, flux_table_d, 1.0, tolerance);
+            }
+        }
+    }
+    // Make sure the table was built and used, otherwise the comparisons above are trivially satisfied
+    if (n_table_differences == 0) {
+        std::cout << "The thermodynamic table was not used. Failing test..." << std::endl;
+        std::abort();
+    }
+    std::cout << "Largest relative temperature tolerance: " << max_tolerance << std::endl;
+
+    // Residual assembled with the table against the one assembled with the NASA polynomials.
+    // The fluxes differ by at most max_tolerance relative to their size. The table error is not smooth in space,
+    // so relative to the residual it can grow by up to the inverse of the cell size.
+    const double residual_tolerance = N_CELLS_PER_DIRECTION*max_tolerance;
+    PHiLiP::Parameters::AllParameters parameters_direct = all_parameters;
+    PHiLiP::Parameters::AllParameters parameters_table = all_parameters;
+    parameters_direct.pde_type = PHiLiP::Parameters::AllParameters::PartialDifferentialEquation::real_gas;
+    parameters_table.pde_type = PHiLiP::Parameters::AllParameters::PartialDifferentialEquation::real_gas;
+    parameters_direct.thermodynamic_table_tolerance = 0.0;
+    parameters_table.thermodynamic_table_tolerance = TABLE_TOLERANCE;
+    const double residual_difference = compare_residuals<dim,nspecies>(parameters_direct, parameters_table, *(real_gas_physics_direct.manufactured_solution_function));
+    std::cout << "Relative difference of the residuals: " << residual_difference << std::endl;
+    if (residual_difference > residual_tolerance) {
+        std::cout << "Difference too high. rel_diff=" << residual_difference << " and tolerance=" << residual_tolerance << std::endl;
+        std::cout << "Failing test..." << std::endl;
+        std::abort();
+    }
+    return 0;
+}
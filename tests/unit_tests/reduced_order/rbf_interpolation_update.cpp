@@ -0,0 +1,94 @@
+#include "reduced_order/rbf_interpolation.h"
+#include <eigen/Eigen/Dense>
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+using namespace PHiLiP::ProperOrthogonalDecomposition;
+
+// Compares the weights of an RBF updated with RBFInterpolation::updateData against a full fit on the same points.
+
+/// Error field sampled by the RBF
+double test_error(const RowVectorXd &point) {
+    return std::sin(3.0*point(0)) * std::cos(2.0*point(1)) + point(0)*point(1);
+}
+
+/// Returns the largest difference between the weights and between the evaluations of both interpolations
+double compare(const RBFInterpolation &updated, const RBFInterpolation &full) {
+    double difference = (updated.weights - full.weights).cwiseAbs().maxCoeff();
+    for(long i = 0 ; i < 10 ; i++){
+        RowVectorXd point(2);
+        point << 0.1*i + 0.03, 1.0 - 0.09*i;
+        difference = std::max(difference, std::abs(updated.evaluate(point) - full.evaluate(point)));
+    }
+    return difference;
+}
+
+int main() {
+    const double tolerance = 1e-8;
+    const int n_points = 20;
+
+    // Points spread over [0,1]^2
+    MatrixXd coordinates(n_points, 2);
+    VectorXd values(n_points);
+    for(int i = 0 ; i < n_points ; i++){
+        coordinates(i,0) = (i % 5) / 4.0 + 0.01*i;
+        coordinates(i,1) = (i / 5) / 3.0 + 0.005*(i % 3);
+        values(i) = test_error(coordinates.row(i));
+    }
+
+    RBFInterpolation updated(coordinates.topRows(n_points-2), values.head(n_points-2), RBFKernel::thin_plate_spline);
+
+    // Add two points, change the values of the existing points and remove one point, as an adaptive sampling iteration does
+    MatrixXd new_coordinates(n_points-1, 2);
+    VectorXd new_values(n_points-1);
+    new_coordinates.topRows(n_points-3) = coordinates.middleRows(1, n_points-3);
+    new_coordinates.row(n_points-3) = coordinates.row(n_points-1);
+    new_coordinates.row(n_points-2) = coordinates.row(n_points-2);
+    for(int i = 0 ; i < n_points-1 ; i++){
+        new_values(i) = 0.5*test_error(new_coordinates.row(i)) + 0.1;
+    }
+    // The updated RBF keeps its points in the order of new_coordinates: the remaining points, then the appended ones
+    updated.updateData(new_coordinates, new_values);
+
+    RBFInterpolation full(new_coordinates, new_values, RBFKernel::thin_plate_spline);
+
+    int n_failed = 0;
+    const double update_difference = compare(updated, full);
+    std::cout << "Difference between the incremental update and the full fit: " << update_difference << std::endl;
+    if(update_difference > tolerance) n_failed++;
+
+    // Rescaled coordinates change every point, which goes through the rebuild
+    const MatrixXd scaled_coordinates = 0.5 * new_coordinates;
+    updated.updateData(scaled_coordinates, new_values);
+    RBFInterpolation full_scaled(scaled_coordinates, new_values, RBFKernel::thin_plate_spline);
+    const double rebuild_difference = compare(updated, full_scaled);
+    std::cout << "Difference between the rebuilt interpolation and the full fit: " << rebuild_difference << std::endl;
+    if(rebuild_difference > tolerance) n_failed++;
+
+    // Many small updates, as over many sampling iterations, which go through the periodic refactorization
+    MatrixXd window_coordinates = coordinates;
+    VectorXd window_values = values;
+    RBFInterpolation window(window_coordinates, window_values, RBFKernel::thin_plate_spline);
+    for(int step = 0 ; step < 50 ; step++){
+        // Replace the oldest point by a new one and change every value
+        window_coordinates.topRows(n_points-1) = window_coordinates.bottomRows(n_points-1).eval();
+        window_coordinates(n_points-1,0) = std::fmod(0.37*step + 0.11, 1.0);
+        window_coordinates(n_points-1,1) = std::fmod(0.61*step + 0.23, 1.0);
+        for(int i = 0 ; i < n_points ; i++){
+            window_values(i) = test_error(window_coordinates.row(i)) + 0.01*step;
+        }
+        window.updateData(window_coordinates, window_values);
+    }
+    RBFInterpolation full_window(window_coordinates, window_values, RBFKernel::thin_plate_spline);
+    const double window_difference = compare(window, full_window);
+    std::cout << "Difference after many updates and the full fit: " << window_difference << std::endl;
+    if(window_difference > tolerance) n_failed++;
+
+    if(n_failed > 0){
+        std::cout << "RBF interpolation update test failed." << std::endl;
+        return 1;
+    }
+    std::cout << "RBF interpolation update test passed." << std::endl;
+    return 0;
+}
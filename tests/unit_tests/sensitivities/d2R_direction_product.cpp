@@ -0,0 +1,175 @@
+#include <cmath>
+
+#include <deal.II/base/tensor.h>
+#include <deal.II/grid/tria.h>
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_tools.h>
+
+#include <deal.II/numerics/vector_tools.h>
+
+#include "dg/dg_factory.hpp"
+#include "parameters/parameters.h"
+#include "physics/physics_factory.h"
+
+using PDEType   = PHiLiP::Parameters::AllParameters::PartialDifferentialEquation;
+
+#if PHILIP_DIM==1
+    using Triangulation = dealii::Triangulation<PHILIP_DIM>;
+#else
+    using Triangulation = dealii::parallel::distributed::Triangulation<PHILIP_DIM>;
+#endif
+
+const double TOLERANCE = 1E-11;
+
+/// Fills the locally owned entries of a vector with a smooth but non-trivial pattern.
+void fill_direction(dealii::LinearAlgebra::distributed::Vector<double> &vector, const double shift)
+{
+    for (const auto i : vector.locally_owned_elements()) {
+        vector[i] = std::sin(0.7*i + shift);
+    }
+    vector.update_ghost_values();
+}
+
+/** Compares the matrix-free Hessian-vector product of DGBase::apply_d2R() with
+ *  the products of the assembled d2RdWdW, d2RdWdX and d2RdXdX.
+ */
+template<int dim, int nspecies, int nstate>
+int test (
+    const unsigned int poly_degree,
+    std::shared_ptr<Triangulation> grid,
+    const PHiLiP::Parameters::AllParameters &all_parameters)
+{
+    int mpi_rank = dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD);
+    dealii::ConditionalOStream pcout(std::cout, mpi_rank==0);
+    using namespace PHiLiP;
+    using VectorType = dealii::LinearAlgebra::distributed::Vector<double>;
+
+    std::shared_ptr < DGBase<dim, nspecies, double> > dg = DGFactory<dim,nspecies,double>::create_discontinuous_galerkin(&all_parameters, poly_degree, grid);
+    dg->allocate_system ();
+    pcout << "Poly degree " << poly_degree << " ncells " << grid->n_active_cells() << " ndofs: " << dg->dof_handler.n_dofs() << std::endl;
+
+    std::shared_ptr <Physics::PhysicsBase<dim,nspecies,nstate,double>> physics_double = Physics::PhysicsFactory<dim, nspecies, nstate, double>::create_Physics(&all_parameters);
+    VectorType solution_no_ghost;
+    solution_no_ghost.reinit(dg->locally_owned_dofs, MPI_COMM_WORLD);
+    dealii::VectorTools::interpolate(*(dg->high_order_grid->mapping_fe_field), dg->dof_handler, *(physics_double->manufactured_solution_function), solution_no_ghost);
+    dg->solution = solution_no_ghost;
+    dg->solution.update_ghost_values();
+
+    VectorType dual(dg->right_hand_side);
+    fill_direction(dual, 0.3);
+    dg->set_dual(dual);
+    dg->dual.update_ghost_values();
+
+    VectorType direction_solution(dg->solution);
+    VectorType direction_volume_nodes(dg->high_order_grid->volume_nodes);
+    fill_direction(direction_solution, 1.1);
+    fill_direction(direction_volume_nodes, 2.3);
+
+    VectorType product_solution(dg->solution);
+    VectorType product_volume_nodes(dg->high_order_grid->volume_nodes);
+    dg->apply_d2R(direction_solution, direction_volume_nodes, product_solution, product_volume_nodes);
+
+    const bool compute_dRdW = false, compute_dRdX = false, compute_d2R = true;
+    dg->assemble_residual(compute_dRdW, compute_dRdX, compute_d2R);
+
+    VectorType expected_solution(dg->solution);
+    VectorType expected_volume_nodes(dg->high_order_grid->volume_nodes);
+    VectorType temp_solution(dg->solution);
+    VectorType temp_volume_nodes(dg->high_order_grid->volume_nodes);
+
+    dg->d2RdWdW.vmult(expected_solution, direction_solution);
+    dg->d2RdWdX.vmult(temp_solution, direction_volume_nodes);
+    expected_solution += temp_solution;
+
+    dg->d2RdXdX.vmult(expected_volume_nodes, direction_volume_nodes);
+    dg->d2RdWdX.Tvmult(temp_volume_nodes, direction_solution);
+    expected_volume_nodes += temp_volume_nodes;
+
+    const double solution_norm = expected_solution.l2_norm();
+    const double volume_nodes_norm = expected_volume_nodes.l2_norm();
+    product_solution -= expected_solution;
+    product_volume_nodes -= expected_volume_nodes;
+    const double solution_abs_diff = product_solution.l2_norm();
+    const double volume_nodes_abs_diff = product_volume_nodes.l2_norm();
+    const double solution_rel_diff = solution_abs_diff / (solution_norm + 1e-14);
+    const double volume_nodes_rel_diff = volume_nodes_abs_diff / (volume_nodes_norm + 1e-14);
+
+    pcout << "Error: "
+          << " d2R_W_abs_diff: " << solution_abs_diff
+          << " d2R_W_rel_diff: " << solution_rel_diff
+          << std::endl
+          << " d2R_X_abs_diff: " << volume_nodes_abs_diff
+          << " d2R_X_rel_diff: " << volume_nodes_rel_diff
+          << std::endl;
+    if (solution_abs_diff > TOLERANCE && solution_rel_diff > TOLERANCE) return 1;
+    if (volume_nodes_abs_diff > TOLERANCE && volume_nodes_rel_diff > TOLERANCE) return 1;
+
+    return 0;
+}
+
+int main (int argc, char * argv[])
+{
+    dealii::Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+    int mpi_rank = dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD);
+    dealii::ConditionalOStream pcout(std::cout, mpi_rank==0);
+
+    using namespace PHiLiP;
+    const int dim = PHILIP_DIM;
+    const int nspecies = 1;
+    int error = 0;
+
+    dealii::ParameterHandler parameter_handler;
+    Parameters::AllParameters::declare_parameters (parameter_handler);
+
+    Parameters::AllParameters all_parameters;
+    all_parameters.parse_parameters (parameter_handler);
+    std::vector<PDEType> pde_type {
+        PDEType::diffusion,
+        PDEType::advection,
+        PDEType::euler,
+        PDEType::navier_stokes
+    };
+    std::vector<std::string> pde_name {
+        " PDEType::diffusion "
+        , " PDEType::advection "
+        , " PDEType::euler "
+        , " PDEType::navier_stokes "
+    };
+
+    int ipde = -1;
+    for (auto pde = pde_type.begin(); pde != pde_type.end() && error == 0; pde++) {
+        ipde++;
+        for (unsigned int poly_degree=1; poly_degree<3 && error == 0; ++poly_degree) {
+            pcout << "Using " << pde_name[ipde] << std::endl;
+            all_parameters.pde_type = *pde;
+            std::shared_ptr<Triangulation> grid = std::make_shared<Triangulation>(
+#if PHILIP_DIM!=1
+                MPI_COMM_WORLD,
+#endif
+                typename dealii::Triangulation<dim>::MeshSmoothing(
+                    dealii::Triangulation<dim>::smoothing_on_refinement |
+                    dealii::Triangulation<dim>::smoothing_on_coarsening));
+
+            dealii::GridGenerator::subdivided_hyper_cube(*grid, 3);
+
+            const double random_factor = 0.3;
+            const bool keep_boundary = false;
+            dealii::GridTools::distort_random (random_factor, *grid, keep_boundary);
+            for (auto &cell : grid->active_cell_iterators()) {
+                for (unsigned int face=0; face<dealii::GeometryInfo<dim>::faces_per_cell; ++face) {
+                    if (cell->face(face)->at_boundary()) cell->face(face)->set_boundary_id (1000);
+                }
+            }
+
+            if ((*pde==PDEType::euler) || (*pde==PDEType::navier_stokes)) {
+                error = test<dim,nspecies,dim+2>(poly_degree, grid, all_parameters);
+            } else {
+                error = test<dim,nspecies,1>(poly_degree, grid, all_parameters);
+            }
+        }
+    }
+
+    if (error != 0) pcout << "Matrix-free Hessian-vector product differs from the assembled Hessian." << std::endl;
+
+    return error;
+}